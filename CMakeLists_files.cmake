@@ -322,20 +322,25 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Units/Dimension.cpp
   opm/input/eclipse/Units/UnitSystem.cpp
   opm/input/eclipse/Utility/Functional.cpp
+  opm/io/eclipse/CompressedRestart.cpp
   opm/io/eclipse/EclFile.cpp
+  opm/io/eclipse/EclIndex.cpp
   opm/io/eclipse/EclOutput.cpp
   opm/io/eclipse/EclUtil.cpp
   opm/io/eclipse/EGrid.cpp
+  opm/io/eclipse/EndianConversion.cpp
   opm/io/eclipse/EInit.cpp
   opm/io/eclipse/ERft.cpp
   opm/io/eclipse/ERst.cpp
   opm/io/eclipse/ERsm.cpp
   opm/io/eclipse/ESmry.cpp
   opm/io/eclipse/ExtESmry.cpp
+  opm/io/eclipse/MappedFile.cpp
   opm/io/eclipse/ESmry_write_rsm.cpp
   opm/io/eclipse/OutputStream.cpp
   opm/io/eclipse/ExtSmryOutput.cpp
   opm/io/eclipse/RestartFileView.cpp
+  opm/io/eclipse/RestartOutputPolicy.cpp
   opm/io/eclipse/SummaryNode.cpp
   opm/io/eclipse/rst/action.cpp
   opm/io/eclipse/rst/aquifer.cpp
@@ -359,6 +364,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/material/fluidmatrixinteractions/EclEpsConfig.cpp
   opm/material/fluidmatrixinteractions/EclEpsGridProperties.cpp
   opm/material/fluidmatrixinteractions/EclEpsScalingPoints.cpp
+  opm/material/fluidmatrixinteractions/EclEpsScalingPointsStore.cpp
   opm/material/fluidmatrixinteractions/EclHysteresisConfig.cpp
   opm/material/fluidmatrixinteractions/EclMaterialLawInitParams.cpp
   opm/material/fluidmatrixinteractions/EclMaterialLawHystParams.cpp
@@ -367,6 +373,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/material/fluidsystems/BlackOilFluidSystem.cpp
   opm/material/fluidsystems/PhaseUsageInfo.cpp
   opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.cpp
+  opm/material/fluidsystems/blackoilpvt/BrineCo2PvtSurrogate.cpp
   opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.cpp
   opm/material/fluidsystems/blackoilpvt/Co2GasPvt.cpp
   opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.cpp
@@ -413,6 +420,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/output/eclipse/EclipseGridInspector.cpp
   opm/output/eclipse/EclipseIO.cpp
   opm/output/eclipse/InteHEAD.cpp
+  opm/output/eclipse/LazyRestartSolution.cpp
   opm/output/eclipse/LgrHEADI.cpp
   opm/output/eclipse/LgrHEADQ.cpp
   opm/output/eclipse/LgrHEADD.cpp
@@ -476,6 +484,8 @@ list(APPEND ADDITIONAL_SOURCE_FILES
   test_util/arraylist.cpp
   test_util/compareECL.cpp
   test_util/convertECL.cpp
+  test_util/convertOPMZ.cpp
+  test_util/indexECL.cpp
   test_util/rewriteEclFile.cpp
   test_util/summary.cpp
 )
@@ -497,6 +507,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_calculateCellVol.cpp
   tests/test_cmp.cpp
   tests/test_CompletedCells.cpp
+  tests/test_CompressedRestart.cpp
   tests/test_CopyablePtr.cpp
   tests/test_ConditionalStorage.cpp
   tests/test_critical_error.cpp
@@ -510,7 +521,9 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_DoubHEAD.cpp
   tests/test_EclipseIO.cpp
   tests/test_EclipseIO_LGR.cpp
+  tests/test_EclIndex.cpp
   tests/test_EclIO.cpp
+  tests/test_EndianConversion.cpp
   tests/test_EGrid.cpp
   tests/test_EInit.cpp
   tests/test_ERft.cpp
@@ -525,6 +538,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_HeadersLGR.cpp
   tests/test_Inplace.cpp
   tests/test_InteHEAD.cpp
+  tests/test_LazyRestartSolution.cpp
   tests/test_LGOData.cpp
   tests/test_LgrHeadX.cpp
   tests/test_LinearisedOutputTable.cpp
@@ -536,6 +550,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_OutputStream.cpp
   tests/test_PhaseUsageInfo.cpp
   tests/test_PaddedOutputString.cpp
+  tests/test_ParallelFor.cpp
   tests/test_param.cpp
   tests/test_PAvgCalculator.cpp
   tests/test_PAvgDynamicSourceData.cpp
@@ -544,6 +559,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_Restart.cpp
   tests/test_RestartFileView.cpp
   tests/test_RestartLGR.cpp
+  tests/test_RestartOutputPolicy.cpp
   tests/test_restartwellinfo.cpp
   tests/test_RFT.cpp
   tests/test_RootFinders.cpp
@@ -678,6 +694,7 @@ list(APPEND DUNE_TEST_SOURCE_FILES
   tests/material/test_co2brinepvt.cpp
   tests/material/test_co2brine_ptflash.cpp
   tests/material/test_components.cpp
+  tests/material/test_cubiceos.cpp
   tests/material/test_eclblackoilfluidsystem.cpp
   tests/material/test_eclblackoilfluidsystemnonstatic.cpp
   tests/material/test_eclblackoilpvt.cpp
@@ -845,6 +862,13 @@ list(APPEND TEST_DATA_FILES
 list(APPEND EXAMPLE_SOURCE_FILES
   examples/wellgraph.cpp
   examples/networkgraph.cpp
+  examples/byteswap_benchmark.cpp
+  examples/restart_aggregate_benchmark.cpp
+  examples/tabulation_benchmark.cpp
+  examples/densead_benchmark.cpp
+  examples/ptflash_benchmark.cpp
+  examples/cubiceos_benchmark.cpp
+  examples/satfunc_benchmark.cpp
 )
 
 # programs listed here will not only be compiled, but also marked for
@@ -885,6 +909,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/common/utility/FileSystem.hpp
   opm/common/utility/MemPacker.hpp
   opm/common/utility/OpmInputError.hpp
+  opm/common/utility/ParallelFor.hpp
   opm/common/utility/Serializer.hpp
   opm/common/utility/String.hpp
   opm/common/utility/SymmTensor.hpp
@@ -1224,19 +1249,25 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/Utility/Typetools.hpp
   opm/io/eclipse/EGrid.hpp
   opm/io/eclipse/EInit.hpp
+  opm/io/eclipse/ArrayView.hpp
+  opm/io/eclipse/CompressedRestart.hpp
   opm/io/eclipse/ERft.hpp
   opm/io/eclipse/ERsm.hpp
   opm/io/eclipse/ERst.hpp
   opm/io/eclipse/ESmry.hpp
   opm/io/eclipse/EclFile.hpp
+  opm/io/eclipse/EclIndex.hpp
   opm/io/eclipse/EclIOdata.hpp
   opm/io/eclipse/EclOutput.hpp
   opm/io/eclipse/EclUtil.hpp
+  opm/io/eclipse/EndianConversion.hpp
   opm/io/eclipse/ExtESmry.hpp
   opm/io/eclipse/ExtSmryOutput.hpp
+  opm/io/eclipse/MappedFile.hpp
   opm/io/eclipse/OutputStream.hpp
   opm/io/eclipse/PaddedOutputString.hpp
   opm/io/eclipse/RestartFileView.hpp
+  opm/io/eclipse/RestartOutputPolicy.hpp
   opm/io/eclipse/SummaryNode.hpp
   opm/io/eclipse/SummaryNode.hpp
   opm/io/eclipse/rst/action.hpp
@@ -1327,9 +1358,12 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/densead/Evaluation8.hpp
   opm/material/densead/Evaluation9.hpp
   opm/material/densead/EvaluationFormat.hpp
+  opm/material/densead/EvaluationSimd.hpp
   opm/material/densead/EvaluationSpecializations.hpp
+  opm/material/densead/ExpressionTemplates.hpp
   opm/material/densead/Math.hpp
   opm/material/eos/CubicEOS.hpp
+  opm/material/eos/CubicEOSBatch.hpp
   opm/material/eos/CubicEOSParams.hpp
   opm/material/eos/PRParams.hpp
   opm/material/eos/PengRobinson.hpp
@@ -1347,6 +1381,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/fluidmatrixinteractions/EclEpsConfig.hpp
   opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp
   opm/material/fluidmatrixinteractions/EclEpsScalingPoints.hpp
+  opm/material/fluidmatrixinteractions/EclEpsScalingPointsStore.hpp
   opm/material/fluidmatrixinteractions/EclEpsTwoPhaseLaw.hpp
   opm/material/fluidmatrixinteractions/EclEpsTwoPhaseLawParams.hpp
   opm/material/fluidmatrixinteractions/EclHysteresisConfig.hpp
@@ -1432,6 +1467,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/fluidsystems/ThreeComponentFluidSystem.hh
   opm/material/fluidsystems/TwoPhaseImmiscibleFluidSystem.hpp
   opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp
+  opm/material/fluidsystems/blackoilpvt/BrineCo2PvtSurrogate.hpp
   opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp
   opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp
   opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.hpp
@@ -1448,6 +1484,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/fluidsystems/blackoilpvt/NullOilPvt.hpp
   opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp
   opm/material/fluidsystems/blackoilpvt/OilPvtThermal.hpp
+  opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp
   opm/material/fluidsystems/blackoilpvt/SolventPvt.hpp
   opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp
   opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.hpp
@@ -1504,6 +1541,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/output/eclipse/EclipseIOUtil.hpp
   opm/output/eclipse/Inplace.hpp
   opm/output/eclipse/InteHEAD.hpp
+  opm/output/eclipse/LazyRestartSolution.hpp
   opm/output/eclipse/LgrHEADD.hpp
   opm/output/eclipse/LgrHEADI.hpp
   opm/output/eclipse/LgrHEADQ.hpp
@@ -109,6 +109,31 @@ if (Boost_UNIT_TEST_FRAMEWORK_FOUND)
       ${PROJECT_SOURCE_DIR}/tests/ACTIONX_M1.X0010
   )
 
+  add_test(
+    NAME
+      convertECL_round_trip
+    COMMAND
+      ${PROJECT_SOURCE_DIR}/tests/convertECL_test_driver.sh
+      ${PROJECT_BINARY_DIR}/bin/convertECL
+      ${PROJECT_SOURCE_DIR}/tests/SPE1CASE1.EGRID
+      ${PROJECT_SOURCE_DIR}/tests/SPE1CASE1.RFT
+      ${PROJECT_SOURCE_DIR}/tests/SPE1CASE1.SMSPEC
+      ${PROJECT_SOURCE_DIR}/tests/SPE1CASE1.UNSMRY
+      ${PROJECT_SOURCE_DIR}/tests/SPE1_TESTCASE.UNRST
+      ${PROJECT_SOURCE_DIR}/tests/SPE1CASE2.X0060
+      ${PROJECT_SOURCE_DIR}/tests/ECLFILE.INIT
+  )
+
+  add_test(
+    NAME
+      convertOPMZ_restart
+    COMMAND
+      ${PROJECT_SOURCE_DIR}/tests/convertOPMZ_test_driver.sh
+      ${PROJECT_BINARY_DIR}/bin/convertOPMZ
+      ${PROJECT_BINARY_DIR}/bin/convertECL
+      ${PROJECT_SOURCE_DIR}/tests/BASE.UNRST
+  )
+
   # opm-tests dependent tests
   if(HAVE_OPM_TESTS)
     set(_excl_all)
@@ -21,6 +21,11 @@ maxDerivs = 12
 if len(sys.argv) == 2:
     maxDerivs = int(sys.argv[1])
 
+# range of numbers of derivatives for which the arithmetic operators use the
+# explicitly vectorised kernels of EvaluationSimd.hpp
+minSimdDerivs = 4
+maxSimdDerivs = 8
+
 specializationFileNames = []
 
 specializationTemplate = \
@@ -89,6 +94,9 @@ specializationTemplate = \
 
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/utility/gpuDecorators.hpp>
+{% if simd %}\
+#include <opm/material/densead/EvaluationSimd.hpp>
+{% endif %}\
 {% if numDerivs == 0 %}\
 
 #if HAVE_DUNE_COMMON
@@ -104,6 +112,15 @@ namespace DenseAd {
 //! is run-time determined
 static constexpr int DynamicSize = -1;
 
+//! Indicates whether a type is a node of the expression templates of
+//! ExpressionTemplates.hpp. The scalar overloads of the Evaluation operators
+//! do not accept such nodes.
+template <class T>
+struct is_expression
+{
+    static constexpr bool value = false;
+};
+
 {% endif %}\
 {% if numDerivs < 0 %}\
 /*!
@@ -242,6 +259,7 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation(const RhsValueType& c)
         : Evaluation(0, c)
     {
@@ -252,6 +270,7 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE constexpr Evaluation(const RhsValueType& c): data_{}
     {
         setValue(c);
@@ -261,6 +280,20 @@ public:
     }
 {% endif %}\
 
+    // evaluate an expression template of ExpressionTemplates.hpp
+    //
+    // the value and all derivatives are computed in a single pass, without
+    // creating temporary Evaluation objects for the sub-expressions.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation(const Expr& expr)
+{% if numDerivs < 0 %}\
+        : data_(1 + expr.size(), 0.0)
+{% endif %}\
+    {
+        assignExpression_(expr);
+    }
+
     // create an evaluation representing a variable with the variable position of varPos
     // The value is set to c, all derivatives are zero except for the one at varPos, which is set to 1.
 {% if numDerivs < 0 %}\
@@ -464,6 +497,27 @@ public:
 {% endif %}\
     }
 
+    // multiply all derivatives by a factor, leaving the value unchanged,
+    // e.g., to apply the chain rule
+    OPM_HOST_DEVICE void scaleDerivatives(const ValueType& factor)
+    {
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT>) {
+            simd::scaleDerivatives<{{ numDerivs + 1 }}>(data_.data(), factor);
+            return;
+        }
+
+{% endif %}\
+{% if numDerivs <= 0 %}\
+        for (int i = dstart_(); i < dend_(); ++i)
+            data_[i] *= factor;
+{% else %}\
+{%   for i in range(1, numDerivs+1) %}\
+        data_[{{i}}] *= factor;
+{%   endfor %}\
+{% endif %}\
+    }
+
 
     // add value and derivatives from other to this value and derivatives
     OPM_HOST_DEVICE Evaluation& operator+=(const Evaluation& other)
@@ -498,6 +552,13 @@ public:
 {% else %}\
         assert(size() == other.size());
 
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT>) {
+            simd::add<{{ numDerivs + 1 }}>(data_.data(), other.data_.data());
+            return *this;
+        }
+
+{% endif %}\
 {% if numDerivs == 0 %}\
         for (int i = 0; i < length_(); ++i)
             data_[i] += other.data_[i];
@@ -513,8 +574,16 @@ public:
 
     // add value from other to this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator+=(const RhsValueType& other)
     {
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT> && std::is_arithmetic_v<RhsValueType>) {
+            simd::addValue<{{ numDerivs + 1 }}>(data_.data(), other);
+            return *this;
+        }
+
+{% endif %}\
         // value is added, derivatives stay the same
         data_[valuepos_()] += other;
 
@@ -553,6 +622,13 @@ public:
 {% else %}\
         assert(size() == other.size());
 
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT>) {
+            simd::sub<{{ numDerivs + 1 }}>(data_.data(), other.data_.data());
+            return *this;
+        }
+
+{% endif %}\
 {% if numDerivs == 0 %}\
         for (int i = 0; i < length_(); ++i)
             data_[i] -= other.data_[i];
@@ -568,8 +644,16 @@ public:
 
     // subtract other's value from this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator-=(const RhsValueType& other)
     {
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT> && std::is_arithmetic_v<RhsValueType>) {
+            simd::subValue<{{ numDerivs + 1 }}>(data_.data(), other);
+            return *this;
+        }
+
+{% endif %}\
         // for constants, values are subtracted, derivatives stay the same
         data_[valuepos_()] -= other;
 
@@ -622,6 +706,13 @@ public:
 {% else %}\
         assert(size() == other.size());
 
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT>) {
+            simd::mul<{{ numDerivs + 1 }}>(data_.data(), other.data_.data());
+            return *this;
+        }
+
+{% endif %}\
         // while the values are multiplied, the derivatives follow the product rule,
         // i.e., (u*v)' = (v'u + u'v).
         const ValueType u = this->value();
@@ -646,8 +737,16 @@ public:
 
     // m(c*u)' = c*u'
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT> && std::is_arithmetic_v<RhsValueType>) {
+            simd::scale<{{ numDerivs + 1 }}>(data_.data(), other);
+            return *this;
+        }
+
+{% endif %}\
 {% if numDerivs <= 0 %}\
         for (int i = 0; i < length_(); ++i)
             data_[i] *= other;
@@ -718,6 +817,13 @@ public:
 {% else %}\
         assert(size() == other.size());
 
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT>) {
+            simd::div<{{ numDerivs + 1 }}>(data_.data(), other.data_.data());
+            return *this;
+        }
+
+{% endif %}\
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
         // u'v)/v^2.
         ValueType& u = data_[valuepos_()];
@@ -742,10 +848,18 @@ public:
 
     // divide value and derivatives by value of other
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator/=(const RhsValueType& other)
     {
         const ValueType tmp = 1.0/other;
 
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT>) {
+            simd::scale<{{ numDerivs + 1 }}>(data_.data(), tmp);
+            return *this;
+        }
+
+{% endif %}\
 {% if numDerivs <= 0 %}\
         for (int i = 0; i < length_(); ++i)
             data_[i] *= tmp;
@@ -782,6 +896,7 @@ public:
 
     // add constant to this object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator+(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -815,6 +930,7 @@ public:
 
     // subtract constant from evaluation object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator-(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -834,6 +950,13 @@ public:
 {% endif %}\
 
         // set value and derivatives to negative
+{% if simd %}\
+        if constexpr (simd::enabled<ValueT>) {
+            simd::negate<{{ numDerivs + 1 }}>(result.data_.data(), data_.data());
+            return result;
+        }
+
+{% endif %}\
 {% if numDerivs <= 0 %}\
         for (int i = 0; i < length_(); ++i)
             result.data_[i] = - data_[i];
@@ -868,6 +991,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator*(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -899,6 +1023,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator/(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -909,6 +1034,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator=(const RhsValueType& other)
     {
         setValue( other );
@@ -920,6 +1046,22 @@ public:
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
+    // evaluate an expression template of ExpressionTemplates.hpp in place
+    //
+    // the expression may refer to this object, since the derivative i of an
+    // expression only depends on the derivatives i of its operands.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation& operator=(const Expr& expr)
+    {
+{% if numDerivs < 0 %}\
+        data_.resize(1 + expr.size());
+{% endif %}\
+        assignExpression_(expr);
+
+        return *this;
+    }
+
     template <class RhsValueType>
     OPM_HOST_DEVICE bool operator==(const RhsValueType& other) const
     { return value() == other; }
@@ -1033,6 +1175,17 @@ public:
         if (data_.size() == 0) {
             data_.resize(1);
         }
+        data_[valuepos_()] = val;
+    }
+{% elif simd %}\
+    {
+        if constexpr (simd::enabled<ValueT> && std::is_arithmetic_v<RhsValueType>) {
+            if (!std::is_constant_evaluated()) {
+                simd::setValue<{{ numDerivs + 1 }}>(data_.data(), val);
+                return;
+            }
+        }
+
         data_[valuepos_()] = val;
     }
 {% else %}\
@@ -1091,6 +1244,22 @@ public:
     }
 
 private:
+    template <class Expr>
+    OPM_HOST_DEVICE void assignExpression_(const Expr& expr)
+    {
+        assert(size() == expr.size());
+
+        data_[valuepos_()] = expr.value();
+{% if numDerivs <= 0 %}\
+        for (int i = dstart_(); i < dend_(); ++i)
+            data_[i] = expr.derivative(i - dstart_());
+{% else %}\
+{%   for i in range(1, numDerivs+1) %}\
+        data_[{{i}}] = expr.derivative({{i - 1}});
+{%   endfor %}\
+{% endif %}\
+    }
+
 {% if numDerivs < 0 %}\
     FastSmallVector<ValueT, staticSize> data_;
 
@@ -1272,7 +1441,7 @@ includeSpecializationsTemplate = \
 print ("Generating generic template classes")
 fileName = "opm/material/densead/Evaluation.hpp"
 template = jinja2.Template(specializationTemplate)
-fileContents = template.render(numDerivs=0, scriptName=os.path.basename(sys.argv[0]))
+fileContents = template.render(numDerivs=0, simd=False, scriptName=os.path.basename(sys.argv[0]))
 
 f = open(fileName, "w")
 f.write(fileContents)
@@ -1280,7 +1449,7 @@ f.close()
 
 fileName = "opm/material/densead/DynamicEvaluation.hpp"
 specializationFileNames.append(fileName)
-fileContents = template.render(numDerivs=-1, scriptName=os.path.basename(sys.argv[0]))
+fileContents = template.render(numDerivs=-1, simd=False, scriptName=os.path.basename(sys.argv[0]))
 
 f = open(fileName, "w")
 f.write(fileContents)
@@ -1293,7 +1462,8 @@ for numDerivs in range(1, maxDerivs + 1):
     specializationFileNames.append(fileName)
 
     template = jinja2.Template(specializationTemplate)
-    fileContents = template.render(numDerivs=numDerivs, scriptName=os.path.basename(sys.argv[0]))
+    simd = minSimdDerivs <= numDerivs <= maxSimdDerivs
+    fileContents = template.render(numDerivs=numDerivs, simd=simd, scriptName=os.path.basename(sys.argv[0]))
 
     f = open(fileName, "w")
     f.write(fileContents)
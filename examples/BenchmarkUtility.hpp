@@ -0,0 +1,160 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Command line handling, timing and reporting shared by the benchmark
+// programs in this directory.
+
+#ifndef OPM_EXAMPLES_BENCHMARK_UTILITY_HPP
+#define OPM_EXAMPLES_BENCHMARK_UTILITY_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <getopt.h>
+
+namespace Opm::Benchmark {
+
+    /// Command line option taking a single argument.
+    struct Option
+    {
+        /// Option character, e.g., 'n' for "-n 1000".
+        char flag;
+
+        /// One line help text, including the default value.
+        std::string help;
+
+        /// Stores the option's argument.
+        std::function<void(const char*)> apply;
+    };
+
+    /// Option handler which stores the argument in 'value'.
+    template <typename T>
+    std::function<void(const char*)> store(T& value)
+    {
+        return [&value](const char* arg)
+        {
+            if constexpr (std::is_same_v<T, int>) {
+                value = std::stoi(arg);
+            }
+            else if constexpr (std::is_same_v<T, std::size_t>) {
+                value = std::stoul(arg);
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                value = std::stod(arg);
+            }
+            else {
+                value = T { arg };
+            }
+        };
+    }
+
+    inline void printHelp(const std::string& description,
+                          const std::vector<Option>& options)
+    {
+        std::cout << '\n' << description << "\n\n"
+                  << "-h Print help and exit.\n";
+
+        for (const auto& option : options) {
+            std::cout << '-' << option.flag << ' ' << option.help << '\n';
+        }
+
+        std::cout << '\n';
+    }
+
+    /// Parses the command line according to 'options'.  Returns the exit
+    /// status of the program if it should terminate, i.e., if the help
+    /// text was requested or the command line is invalid, and nullopt
+    /// otherwise.
+    inline std::optional<int> parseOptions(int argc, char** argv,
+                                           const std::string& description,
+                                           const std::vector<Option>& options)
+    {
+        auto optstring = std::string { "h" };
+        for (const auto& option : options) {
+            optstring += option.flag;
+            optstring += ':';
+        }
+
+        int c = 0;
+        while ((c = getopt(argc, argv, optstring.c_str())) != -1) {
+            if (c == 'h') {
+                printHelp(description, options);
+                return EXIT_SUCCESS;
+            }
+
+            auto option = std::find_if(options.begin(), options.end(),
+                                       [c](const Option& o) { return o.flag == c; });
+
+            if (option == options.end()) {
+                printHelp(description, options);
+                return EXIT_FAILURE;
+            }
+
+            try {
+                option->apply(optarg);
+            }
+            catch (const std::exception&) {
+                std::cerr << "Invalid argument '" << optarg << "' to option -" << option->flag << '\n';
+                return EXIT_FAILURE;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /// Best wall-clock time, in seconds, of 'reps' invocations of 'f'.
+    inline double bestTime(const int reps, const std::function<void()>& f)
+    {
+        auto best = std::chrono::duration<double>::max();
+
+        for (auto rep = 0; rep < reps; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            f();
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start));
+        }
+
+        return best.count();
+    }
+
+    /// Prints one result line: 'label' left aligned in a column of width
+    /// 'labelWidth', followed by 'value' and its 'unit'.
+    inline void report(const std::string& label,
+                       const double       value,
+                       const std::string& unit,
+                       const int          labelWidth = 28,
+                       const int          precision = 2)
+    {
+        std::cout << std::left << std::setw(labelWidth) << label
+                  << std::right << std::fixed << std::setprecision(precision)
+                  << std::setw(12) << value << ' ' << unit << '\n';
+    }
+
+} // namespace Opm::Benchmark
+
+#endif // OPM_EXAMPLES_BENCHMARK_UTILITY_HPP
@@ -0,0 +1,188 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Throughput of the bulk byte order conversion kernels used for binary
+// ECLIPSE-style result files, and of complete array write/read cycles
+// through EclOutput and EclFile.
+//
+// Usage: byteswap_benchmark [-s MiB] [-r repetitions] [-d directory]
+
+#include "config.h"
+
+#include <opm/io/eclipse/EndianConversion.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+namespace {
+
+    struct Options
+    {
+        std::size_t mebibytes { 64 };
+        int repetitions { 10 };
+        std::filesystem::path directory { std::filesystem::temp_directory_path() };
+    };
+
+    void printHelp()
+    {
+        std::cout << "\nbyteswap_benchmark measures the throughput of the byte order conversion\n"
+                  << "kernels used when reading and writing binary ECLIPSE-style files.\n\n"
+                  << "-h Print help and exit.\n"
+                  << "-s Buffer size in MiB (default 64).\n"
+                  << "-r Number of repetitions (default 10).\n"
+                  << "-d Directory for temporary result files (default system temporary directory).\n\n";
+    }
+
+    /// Best wall-clock time, in seconds, of 'reps' invocations of 'f'.
+    double bestTime(const int reps, const std::function<void()>& f)
+    {
+        auto best = std::chrono::duration<double>::max();
+
+        for (auto rep = 0; rep < reps; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            f();
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start));
+        }
+
+        return best.count();
+    }
+
+    void report(const std::string& label, const std::size_t bytes, const double seconds)
+    {
+        std::cout << std::left << std::setw(28) << label
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << (bytes / seconds) / (1024.0 * 1024.0 * 1024.0)
+                  << " GiB/s\n";
+    }
+
+    void kernelThroughput(const Options& opts)
+    {
+        const auto bytes = opts.mebibytes * 1024 * 1024;
+
+        auto src = std::vector<std::uint64_t>(bytes / sizeof(std::uint64_t));
+        std::iota(src.begin(), src.end(), std::uint64_t{0});
+
+        auto dst = std::vector<std::uint64_t>(src.size());
+
+        std::cout << "Kernel throughput (" << opts.mebibytes << " MiB buffer, default kernel: "
+                  << Opm::EclIO::kernelName(Opm::EclIO::defaultByteSwapKernel()) << ")\n";
+
+        for (const auto kernel : { Opm::EclIO::ByteSwapKernel::Portable,
+                                   Opm::EclIO::ByteSwapKernel::AVX2,
+                                   Opm::EclIO::ByteSwapKernel::NEON })
+        {
+            if (! Opm::EclIO::isAvailable(kernel)) {
+                continue;
+            }
+
+            const auto name = std::string { Opm::EclIO::kernelName(kernel) };
+
+            report(name + " 32-bit", bytes, bestTime(opts.repetitions, [&]()
+            {
+                Opm::EclIO::byteSwap32(src.data(), dst.data(), 2 * src.size(), kernel);
+            }));
+
+            report(name + " 64-bit", bytes, bestTime(opts.repetitions, [&]()
+            {
+                Opm::EclIO::byteSwap64(src.data(), dst.data(), src.size(), kernel);
+            }));
+
+            report(name + " 64-bit in place", bytes, bestTime(opts.repetitions, [&]()
+            {
+                Opm::EclIO::byteSwap64(dst.data(), dst.data(), dst.size(), kernel);
+            }));
+        }
+    }
+
+    template <typename T>
+    void fileThroughput(const Options& opts, const std::string& type)
+    {
+        const auto fname = (opts.directory / "BYTESWAP_BENCHMARK.INIT").string();
+        const auto bytes = opts.mebibytes * 1024 * 1024;
+
+        auto values = std::vector<T>(bytes / sizeof(T));
+        std::iota(values.begin(), values.end(), T{0});
+
+        report("EclOutput write " + type, bytes, bestTime(opts.repetitions, [&]()
+        {
+            Opm::EclIO::EclOutput output { fname, false };
+            output.write("VALUES", values);
+        }));
+
+        report("EclFile read " + type, bytes, bestTime(opts.repetitions, [&]()
+        {
+            Opm::EclIO::EclFile file { fname };
+            file.loadData();
+        }));
+
+        std::filesystem::remove(fname);
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    auto opts = Options{};
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "hs:r:d:")) != -1) {
+        switch (c) {
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 's':
+            opts.mebibytes = std::stoul(optarg);
+            break;
+        case 'r':
+            opts.repetitions = std::stoi(optarg);
+            break;
+        case 'd':
+            opts.directory = optarg;
+            break;
+        default:
+            printHelp();
+            return EXIT_FAILURE;
+        }
+    }
+
+    kernelThroughput(opts);
+
+    std::cout << "\nFile throughput (" << opts.mebibytes << " MiB array)\n";
+    fileThroughput<int>(opts, "INTE");
+    fileThroughput<float>(opts, "REAL");
+    fileThroughput<double>(opts, "DOUB");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Throughput of the fugacity coefficients of the Peng-Robinson EOS for
+// fluids with 6, 8 and 12 components.  Compares the per-cell evaluation
+// through the parameter cache and the fluid system, as used by the PT
+// flash, with the batched evaluation of CubicEOSBatch.  The derivatives
+// w.r.t. pressure and the mole fractions are propagated.
+//
+// Usage: cubiceos_benchmark [-n cells] [-r repetitions]
+
+#include "config.h"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/eos/CubicEOSBatch.hpp>
+#include <opm/material/fluidstates/CompositionalFluidState.hpp>
+#include <opm/material/fluidsystems/GenericOilGasWaterFluidSystem.hpp>
+
+#include <opm/input/eclipse/EclipseState/Compositional/CompositionalConfig.hpp>
+
+#include "BenchmarkUtility.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    using Opm::Benchmark::bestTime;
+
+    struct Options
+    {
+        std::size_t numCells { 1000 };
+        int repetitions { 20 };
+    };
+
+    // name, molar mass [g/mol], Tc [K], pc [bar], acentric factor
+    struct ComponentData { const char* name; double M, Tc, pc, omega; };
+    constexpr std::array<ComponentData, 12> componentData {{
+        {"N2",   28.01, 126.2, 33.98, 0.037},
+        {"CO2",  44.01, 304.1, 73.75, 0.225},
+        {"C1",   16.04, 190.6, 46.00, 0.011},
+        {"C2",   30.07, 305.3, 48.72, 0.099},
+        {"C3",   44.10, 369.8, 42.48, 0.152},
+        {"IC4",  58.12, 408.1, 36.48, 0.177},
+        {"NC4",  58.12, 425.1, 37.96, 0.200},
+        {"IC5",  72.15, 460.4, 33.80, 0.227},
+        {"NC5",  72.15, 469.7, 33.70, 0.251},
+        {"C6",   86.18, 507.6, 30.25, 0.301},
+        {"C10", 142.29, 617.7, 21.10, 0.489},
+        {"C20", 282.55, 768.0, 11.10, 0.907},
+    }};
+
+    template <int numComponents>
+    void benchmark(const Options& opts)
+    {
+        using FluidSystem = Opm::GenericOilGasWaterFluidSystem<double, numComponents, false>;
+        using Evaluation = Opm::DenseAd::Evaluation<double, numComponents>;
+        using FluidState = Opm::CompositionalFluidState<Evaluation, FluidSystem>;
+        using EOSType = Opm::CompositionalConfig::EOSType;
+
+        // the first components and the two heaviest ones
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const auto& c = componentData[compIdx < numComponents - 2 ? compIdx : compIdx + 12 - numComponents];
+            const double Tc = c.Tc;
+            const double pc = c.pc * 1e5;
+            // critical volume [m^3/kmol] for a critical compressibility of 0.27
+            const double Vc = 0.27 * Opm::Constants<double>::R * Tc / pc * 1e3;
+            FluidSystem::addComponent(typename FluidSystem::ComponentParam{c.name, c.M, Tc, pc, Vc, c.omega});
+        }
+
+        constexpr double T = 350.0;
+        constexpr auto eos = EOSType::PR;
+        constexpr int phaseIdx = FluidSystem::oilPhaseIdx;
+        const std::size_t n = opts.numCells;
+
+        std::vector<FluidState> fluidStates(n);
+        std::vector<Evaluation> p(n), x(numComponents * n);
+        for (std::size_t cellIdx = 0; cellIdx < n; ++cellIdx) {
+            auto& fs = fluidStates[cellIdx];
+            p[cellIdx] = Evaluation::createVariable(50e5 + 200e5 * cellIdx / n, 0);
+            fs.setPressure(phaseIdx, p[cellIdx]);
+            fs.setTemperature(T);
+
+            Evaluation xLast = 1.0;
+            for (int compIdx = 0; compIdx < numComponents - 1; ++compIdx) {
+                const double weight = 1.0 + 0.5 * ((cellIdx + compIdx) % 3);
+                x[compIdx * n + cellIdx] = Evaluation::createVariable(weight / (2.0 * numComponents), compIdx + 1);
+                xLast -= x[compIdx * n + cellIdx];
+            }
+            x[(numComponents - 1) * n + cellIdx] = xLast;
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fs.setMoleFraction(phaseIdx, compIdx, x[compIdx * n + cellIdx]);
+            }
+        }
+
+        std::vector<Evaluation> phi(numComponents * n);
+        const double tCell = bestTime(opts.repetitions, [&]()
+        {
+            typename FluidSystem::template ParameterCache<Evaluation> paramCache(eos);
+            for (std::size_t cellIdx = 0; cellIdx < n; ++cellIdx) {
+                paramCache.updatePhase(fluidStates[cellIdx], phaseIdx);
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    phi[compIdx * n + cellIdx] =
+                        FluidSystem::fugacityCoefficient(fluidStates[cellIdx], paramCache, phaseIdx, compIdx);
+                }
+            }
+        });
+        const auto reference = phi;
+
+        std::vector<Evaluation> A(n), B(n), Z(n), ASum(numComponents * n);
+        const double tBatch = bestTime(opts.repetitions, [&]()
+        {
+            Opm::CubicEOSBatch<double, FluidSystem> batch(eos);
+            batch.updateTemperature(T);
+            batch.template mix<Evaluation>(p, x, A, B, ASum);
+            batch.template compressibilityFactor<Evaluation>(A, B, /*isGasPhase=*/false, Z);
+            batch.template fugacityCoefficients<Evaluation>(p, A, B, ASum, Z, phi);
+        });
+
+        double maxError = 0.0;
+        for (std::size_t i = 0; i < phi.size(); ++i) {
+            maxError = std::max(maxError, std::abs(phi[i].value() / reference[i].value() - 1.0));
+        }
+
+        std::cout << std::left << std::setw(6) << numComponents
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << 1.0e9 * tCell / n << " ns"
+                  << std::setw(12) << 1.0e9 * tBatch / n << " ns"
+                  << std::setw(10) << tCell / tBatch << "x"
+                  << std::scientific << std::setprecision(1)
+                  << std::setw(12) << maxError << '\n';
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    auto opts = Options{};
+
+    const auto status = Opm::Benchmark::parseOptions(argc, argv,
+        "cubiceos_benchmark measures the throughput of the Peng-Robinson\n"
+        "fugacity coefficients per cell and in batches of cells.",
+        {
+            {'n', "Number of cells (default 1000).", Opm::Benchmark::store(opts.numCells)},
+            {'r', "Number of repetitions (default 20).", Opm::Benchmark::store(opts.repetitions)},
+        });
+
+    if (status.has_value()) {
+        return *status;
+    }
+
+    std::cout << std::left << std::setw(6) << "N"
+              << std::right << std::setw(15) << "per cell" << std::setw(15) << "batch"
+              << std::setw(11) << "speedup" << std::setw(12) << "rel. diff" << '\n';
+
+    [&opts]<int... Ns>(std::integer_sequence<int, Ns...>)
+    {
+        (benchmark<Ns>(opts), ...);
+    }(std::integer_sequence<int, 6, 8, 12>{});
+
+    return EXIT_SUCCESS;
+}
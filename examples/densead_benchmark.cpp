@@ -0,0 +1,207 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Throughput of the dense-AD Evaluation specializations for 3 to 8
+// derivatives, of which those for 4 to 8 use explicitly vectorised kernels,
+// compared with the generic Evaluation template, which leaves vectorisation
+// to the compiler.
+// Also compares eager evaluation with the expression templates of
+// ExpressionTemplates.hpp.
+//
+// Usage: densead_benchmark [-n evaluations] [-r repetitions]
+
+#include "config.h"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/ExpressionTemplates.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include "BenchmarkUtility.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    using Opm::Benchmark::bestTime;
+
+    struct Options
+    {
+        std::size_t numEvals { 4096 };
+        int repetitions { 2000 };
+    };
+
+    template <class Eval>
+    std::vector<Eval> createEvals(const std::size_t n, const double offset)
+    {
+        auto evals = std::vector<Eval>(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            evals[i] = offset + 1.0e-3 * i;
+            for (int j = 0; j < evals[i].size(); ++j) {
+                evals[i].setDerivative(j, offset - 0.1 * j);
+            }
+        }
+
+        return evals;
+    }
+
+    /// Time per evaluation, in nanoseconds, of 'kernel' applied to all
+    /// elements of the input arrays.
+    template <class Eval, class Kernel>
+    double timeKernel(const Options& opts, Kernel&& kernel)
+    {
+        const auto a = createEvals<Eval>(opts.numEvals, 1.5);
+        const auto b = createEvals<Eval>(opts.numEvals, 2.5);
+        const auto c = createEvals<Eval>(opts.numEvals, 0.5);
+        auto r = std::vector<Eval>(opts.numEvals);
+
+        const double seconds = bestTime(opts.repetitions, [&]()
+        {
+            for (std::size_t i = 0; i < r.size(); ++i) {
+                r[i] = kernel(a[i], b[i], c[i]);
+            }
+        });
+
+        volatile double sink = r.back().derivative(0);
+        static_cast<void>(sink);
+
+        return 1.0e9 * seconds / opts.numEvals;
+    }
+
+    template <int numDerivs, class Kernel>
+    void compare(const Options& opts, const std::string& name, Kernel&& kernel)
+    {
+        using SimdEval = Opm::DenseAd::Evaluation<double, numDerivs>;
+
+        // A non-zero static size selects the generic Evaluation template.
+        using GenericEval = Opm::DenseAd::Evaluation<double, numDerivs, 1u>;
+
+        const double tSimd = timeKernel<SimdEval>(opts, kernel);
+        const double tGeneric = timeKernel<GenericEval>(opts, kernel);
+
+        std::cout << std::left << std::setw(4) << numDerivs << std::setw(14) << name
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << tGeneric << " ns"
+                  << std::setw(12) << tSimd << " ns"
+                  << std::setw(10) << tGeneric / tSimd << "x\n";
+    }
+
+    template <int numDerivs>
+    void benchmark(const Options& opts)
+    {
+        compare<numDerivs>(opts, "arithmetic", [](const auto& a, const auto& b, const auto& c)
+        {
+            return (a*b + c) / (b - 2.0*c);
+        });
+
+        compare<numDerivs>(opts, "chain rule", [](const auto& a, const auto& b, const auto& c)
+        {
+            return Opm::exp(a) * Opm::pow(b, 0.7) + Opm::log(c);
+        });
+
+        // Phase flux through a face: mobility times potential difference.
+        compare<numDerivs>(opts, "flux", [](const auto& kr, const auto& p, const auto& mu)
+        {
+            const auto rho = 800.0 * Opm::exp(1.0e-5 * (p - 1.0));
+            const auto mob = kr / mu;
+            return -mob * (p - 1.0 - rho * 9.81 * 0.5) * 1.0e-12;
+        });
+    }
+
+    template <int numDerivs, class EagerKernel, class LazyKernel>
+    void compareLazy(const Options& opts, const std::string& name,
+                     EagerKernel&& eager, LazyKernel&& lazy)
+    {
+        using Eval = Opm::DenseAd::Evaluation<double, numDerivs>;
+
+        const double tEager = timeKernel<Eval>(opts, eager);
+        const double tLazy = timeKernel<Eval>(opts, lazy);
+
+        std::cout << std::left << std::setw(4) << numDerivs << std::setw(14) << name
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << tEager << " ns"
+                  << std::setw(12) << tLazy << " ns"
+                  << std::setw(10) << tEager / tLazy << "x\n";
+    }
+
+    template <int numDerivs>
+    void benchmarkLazy(const Options& opts)
+    {
+        using Opm::DenseAd::lazy;
+        using Eval = Opm::DenseAd::Evaluation<double, numDerivs>;
+
+        compareLazy<numDerivs>(opts, "arithmetic",
+            [](const auto& a, const auto& b, const auto& c)
+            { return (a*b + c) / (b - 2.0*c); },
+            [](const auto& a, const auto& b, const auto& c)
+            { return Eval((lazy(a)*b + c) / (lazy(b) - 2.0*lazy(c))); });
+
+        compareLazy<numDerivs>(opts, "chain rule",
+            [](const auto& a, const auto& b, const auto& c)
+            { return a*b + c/a - Opm::exp(b); },
+            [](const auto& a, const auto& b, const auto& c)
+            { return Eval(lazy(a)*b + lazy(c)/a - Opm::exp(lazy(b))); });
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    auto opts = Options{};
+
+    const auto status = Opm::Benchmark::parseOptions(argc, argv,
+        "densead_benchmark measures the throughput of dense-AD evaluations with\n"
+        "3 to 8 derivatives, with and without the vectorised kernels, and\n"
+        "of eagerly evaluated expressions and expression templates.",
+        {
+            {'n', "Number of evaluations per array (default 4096).", Opm::Benchmark::store(opts.numEvals)},
+            {'r', "Number of repetitions (default 2000).", Opm::Benchmark::store(opts.repetitions)},
+        });
+
+    if (status.has_value()) {
+        return *status;
+    }
+
+    std::cout << "Vectorised kernels: " << Opm::DenseAd::simd::isaName() << "\n\n"
+              << std::left << std::setw(4) << "n" << std::setw(14) << "kernel"
+              << std::right << std::setw(15) << "generic" << std::setw(15) << "SIMD"
+              << std::setw(11) << "speedup" << '\n';
+
+    [&opts]<int... Ns>(std::integer_sequence<int, Ns...>)
+    {
+        (benchmark<Ns>(opts), ...);
+    }(std::integer_sequence<int, 3, 4, 5, 6, 7, 8>{});
+
+    std::cout << "\nExpression templates\n\n"
+              << std::left << std::setw(4) << "n" << std::setw(14) << "kernel"
+              << std::right << std::setw(15) << "eager" << std::setw(15) << "lazy"
+              << std::setw(11) << "speedup" << '\n';
+
+    [&opts]<int... Ns>(std::integer_sequence<int, Ns...>)
+    {
+        (benchmarkLazy<Ns>(opts), ...);
+    }(std::integer_sequence<int, 3, 5, 8, 12, 20>{});
+
+    return EXIT_SUCCESS;
+}
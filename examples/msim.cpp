@@ -31,11 +31,106 @@
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <opm/msim/IOBenchmark.hpp>
 #include <opm/msim/msim.hpp>
 
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
 
-int main(int /* argc */, char** argv) {
-    std::string deck_file = argv[1];
+#include <getopt.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nmsim runs a simple mock simulation of DECK through the output layer.\n"
+              << "\nUsage: msim DECK\n"
+              << "       msim -b [-c cells] [-w wells] [-s steps] [-x actions] [-a pending] [-z] [-o file.json]\n"
+              << "\nOptions:\n\n"
+              << "-h Print help and exit.\n"
+              << "-b Run I/O throughput benchmark on a synthesised model instead of DECK.\n"
+              << "-c Approximate number of active cells in benchmark model (default 100000).\n"
+              << "-w Number of wells in benchmark model (default 10).\n"
+              << "-s Number of report steps in benchmark run (default 20).\n"
+              << "-x Number of ACTIONX blocks in benchmark model (default 5).\n"
+              << "-a Maximum number of pending asynchronous restart output events (default 0, synchronous).\n"
+              << "-z Write compressed restart companion files.\n"
+              << "-d Output directory of benchmark run (default current directory).\n"
+              << "-o Write JSON benchmark report to file rather than standard output.\n\n";
+}
+
+int runBenchmark(const Opm::IOBenchmark::Config& config, const std::string& jsonFile)
+{
+    const auto report = Opm::IOBenchmark { config }.run();
+
+    if (jsonFile.empty()) {
+        std::cout << report.json();
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream os { jsonFile };
+    os << report.json();
+
+    return os ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    int c = 0;
+    bool benchmark = false;
+    auto config = Opm::IOBenchmark::Config{};
+    std::string jsonFile;
+
+    while ((c = getopt(argc, argv, "hbc:w:s:x:a:zd:o:")) != -1) {
+        switch (c) {
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 'b':
+            benchmark = true;
+            break;
+        case 'c':
+            config.numCells = std::stoul(optarg);
+            break;
+        case 'w':
+            config.numWells = std::stoul(optarg);
+            break;
+        case 's':
+            config.numSteps = std::stoul(optarg);
+            break;
+        case 'x':
+            config.numActions = std::stoul(optarg);
+            break;
+        case 'a':
+            config.asyncRestart = std::stoul(optarg);
+            break;
+        case 'z':
+            config.compressedRestart = true;
+            break;
+        case 'd':
+            config.outputDir = optarg;
+            break;
+        case 'o':
+            jsonFile = optarg;
+            break;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (benchmark) {
+        return runBenchmark(config, jsonFile);
+    }
+
+    if (optind == argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    std::string deck_file = argv[optind];
     Opm::Parser parser;
     Opm::ParseContext parse_context;
     Opm::ErrorGuard error_guard;
@@ -0,0 +1,221 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Throughput of the PT flash for an SPE5-like six-component oil which is
+// displaced by a lean injection gas.  Compares the cell-by-cell flash,
+// PTFlash::solve(), with the batched flash, PTFlash::solveBatch(), both
+// without history and warm started from the previous time step.
+//
+// The binary interaction coefficients of SPE5 cannot be set without a
+// deck, so the fluid has none.
+//
+// Usage: ptflash_benchmark [-n cells] [-r repetitions]
+
+#include "config.h"
+
+#include <opm/material/constraintsolvers/PTFlash.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/fluidstates/CompositionalFluidState.hpp>
+#include <opm/material/fluidsystems/GenericOilGasWaterFluidSystem.hpp>
+
+#include <opm/input/eclipse/EclipseState/Compositional/CompositionalConfig.hpp>
+
+#include "BenchmarkUtility.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using Opm::Benchmark::bestTime;
+
+    using FluidSystem = Opm::GenericOilGasWaterFluidSystem<double, 6, false>;
+    constexpr int numComponents = FluidSystem::numComponents;
+
+    // pressure and the mole fractions of the first five components
+    using Evaluation = Opm::DenseAd::Evaluation<double, numComponents>;
+    using FluidState = Opm::CompositionalFluidState<Evaluation, FluidSystem>;
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    struct Options
+    {
+        std::size_t numCells { 2000 };
+        int repetitions { 3 };
+    };
+
+    void addSpe5Components()
+    {
+        using CompParm = FluidSystem::ComponentParam;
+
+        constexpr double R = 8.314462618;      // J/(mol K)
+        constexpr double rankine = 5.0 / 9.0;  // K/°R
+        constexpr double psia = 6894.7573;     // Pa/psia
+
+        // name, molar mass [g/mol], Tc [°R], pc [psia], Zc, acentric factor
+        struct Spe5Component { const char* name; double M, Tc, pc, Zc, omega; };
+        const std::array<Spe5Component, numComponents> components {{
+            {"C1",   16.04,  343.0, 667.8, 0.290, 0.0130},
+            {"C3",   44.10,  665.7, 616.3, 0.277, 0.1524},
+            {"C6",   86.18,  913.4, 436.9, 0.264, 0.3007},
+            {"C10", 142.29, 1111.8, 304.0, 0.257, 0.4885},
+            {"C15", 206.00, 1270.0, 200.0, 0.245, 0.65},
+            {"C20", 282.00, 1380.0, 162.0, 0.235, 0.85},
+        }};
+
+        FluidSystem::init();
+        for (const auto& c : components) {
+            const double Tc = c.Tc * rankine;
+            const double pc = c.pc * psia;
+            // critical volume in m^3/kmol
+            const double Vc = c.Zc * R * Tc / pc * 1.0e3;
+            FluidSystem::addComponent(CompParm{c.name, c.M, Tc, pc, Vc, c.omega});
+        }
+    }
+
+    /// Cells along a displacement front: the composition varies from the
+    /// reservoir oil to a mixture with 70% injection gas, for which the
+    /// stability test still converges at the injection pressure, and the
+    /// pressure from the injector to the producer.  The time step shifts
+    /// the front a little.
+    std::vector<FluidState> createCells(const std::size_t numCells, const double timeStep)
+    {
+        constexpr std::array<double, numComponents> oil {0.5, 0.03, 0.07, 0.2, 0.15, 0.05};
+        constexpr std::array<double, numComponents> gas {0.77, 0.2, 0.03, 0.0, 0.0, 0.0};
+
+        constexpr double T = (160.0 + 459.67) * 5.0 / 9.0; // 160 °F
+        constexpr double pInj = 4000.0 * 6894.7573;
+        constexpr double pProd = 1000.0 * 6894.7573;
+
+        auto cells = std::vector<FluidState>(numCells);
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            const double s = (cellIdx + 0.5) / numCells;
+            const double gasFraction = std::clamp(2.0 * (0.5 + 0.01 * timeStep - s), 0.0, 0.7);
+
+            auto& fs = cells[cellIdx];
+            const auto p = Evaluation::createVariable(pInj + (pProd - pInj) * s, 0);
+            fs.setPressure(FluidSystem::oilPhaseIdx, p);
+            fs.setPressure(FluidSystem::gasPhaseIdx, p);
+            fs.setTemperature(T);
+
+            Evaluation zLast = 1.0;
+            for (int compIdx = 0; compIdx < numComponents - 1; ++compIdx) {
+                const double z = (1.0 - gasFraction) * oil[compIdx] + gasFraction * gas[compIdx];
+                const auto zi = Evaluation::createVariable(z, compIdx + 1);
+                fs.setMoleFraction(compIdx, zi);
+                zLast -= zi;
+            }
+            fs.setMoleFraction(numComponents - 1, zLast);
+
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fs.setKvalue(compIdx, fs.wilsonK_(compIdx));
+            }
+            fs.setLvalue(1.0);
+        }
+
+        return cells;
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    auto opts = Options{};
+
+    const auto status = Opm::Benchmark::parseOptions(argc, argv,
+        "ptflash_benchmark measures the throughput of the cell-by-cell and\n"
+        "the batched PT flash for an SPE5-like six-component fluid.",
+        {
+            {'n', "Number of cells (default 2000).", Opm::Benchmark::store(opts.numCells)},
+            {'r', "Number of repetitions (default 3).", Opm::Benchmark::store(opts.repetitions)},
+        });
+
+    if (status.has_value()) {
+        return *status;
+    }
+
+    addSpe5Components();
+
+    const std::string method = "ssi+newton";
+    constexpr double tolerance = 1.0e-8;
+    constexpr auto eos = Opm::CompositionalConfig::EOSType::PR;
+
+    const auto initial = createCells(opts.numCells, 0.0);
+    const auto next = createCells(opts.numCells, 1.0);
+
+    auto cells = initial;
+    const double tSolve = bestTime(opts.repetitions, [&]()
+    {
+        cells = next;
+        for (auto& fs : cells) {
+            Flash::solve(fs, method, tolerance, eos);
+        }
+    });
+
+    auto history = std::vector<Flash::CellHistory>(opts.numCells);
+    Flash::BatchStatistics coldStats, warmStats;
+    const double tCold = bestTime(opts.repetitions, [&]()
+    {
+        cells = next;
+        std::fill(history.begin(), history.end(), Flash::CellHistory{});
+        coldStats = Flash::solveBatch(std::span(cells), std::span(history), method, tolerance, eos);
+    });
+
+    // the history of the initial state warm starts the flash of the next step
+    auto initialHistory = std::vector<Flash::CellHistory>(opts.numCells);
+    cells = initial;
+    Flash::solveBatch(std::span(cells), std::span(initialHistory), method, tolerance, eos);
+    const double tWarm = bestTime(opts.repetitions, [&]()
+    {
+        cells = next;
+        history = initialHistory;
+        warmStats = Flash::solveBatch(std::span(cells), std::span(history), method, tolerance, eos);
+    });
+
+    const auto report = [&opts, tSolve](const std::string& name, const double t,
+                                        const Flash::BatchStatistics* stats)
+    {
+        std::cout << std::left << std::setw(16) << name
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << 1.0e6 * t / opts.numCells << " us"
+                  << std::setw(10) << tSolve / t << "x";
+        if (stats != nullptr) {
+            std::cout << std::setw(10) << stats->numTwoPhase
+                      << std::setw(10) << stats->numStabilityTests
+                      << std::setw(10) << stats->numSkippedStabilityTests;
+        }
+        std::cout << '\n';
+    };
+
+    std::cout << opts.numCells << " cells, " << method << "\n\n"
+              << std::left << std::setw(16) << "flash"
+              << std::right << std::setw(15) << "per cell" << std::setw(11) << "speedup"
+              << std::setw(10) << "2-phase" << std::setw(10) << "tests" << std::setw(10) << "skipped" << '\n';
+    report("solve", tSolve, nullptr);
+    report("batch (cold)", tCold, &coldStats);
+    report("batch (warm)", tWarm, &warmStats);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,409 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Time spent building the well, connection, group and segment arrays of a
+// restart file, measured separately from the time spent writing those
+// arrays to disk.  The model is generated on the fly with a configurable
+// number of wells and connections per well.
+//
+// Usage: restart_aggregate_benchmark [-w wells] [-c connections] [-g wells per group]
+//                                    [-s MSW interval] [-r repetitions]
+//                                    [-t threads] [-d directory]
+
+#include "config.h"
+
+#include <opm/output/eclipse/AggregateConnectionData.hpp>
+#include <opm/output/eclipse/AggregateGroupData.hpp>
+#include <opm/output/eclipse/AggregateMSWData.hpp>
+#include <opm/output/eclipse/AggregateWellData.hpp>
+#include <opm/output/eclipse/WriteRestartHelpers.hpp>
+
+#include <opm/output/data/Wells.hpp>
+
+#include <opm/io/eclipse/OutputStream.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include "BenchmarkUtility.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+    using Opm::Benchmark::bestTime;
+
+    struct Options
+    {
+        int wells { 10'000 };
+        int connections { 100 };
+        int wellsPerGroup { 100 };
+        int mswInterval { 0 };
+        int repetitions { 5 };
+        int threads { 0 };
+        std::filesystem::path directory { std::filesystem::temp_directory_path() };
+    };
+
+    void report(const std::string& label, const double seconds)
+    {
+        Opm::Benchmark::report(label, 1000.0 * seconds, "ms");
+    }
+
+    bool isMultiSegment(const Options& opts, const int well)
+    {
+        return (opts.mswInterval > 0) && (well % opts.mswInterval == 0);
+    }
+
+    /// Single column of 'connections' cells for each well, all wells
+    /// producing.  Every opts.mswInterval'th well is a multi-segment well
+    /// with one segment per connection.
+    std::string modelDeck(const Options& opts, const int nx, const int ny)
+    {
+        const auto nz = opts.connections;
+        const auto ncells = nx * ny * nz;
+        const auto ngroups = (opts.wells + opts.wellsPerGroup - 1) / opts.wellsPerGroup;
+        const auto nmsw = (opts.mswInterval > 0)
+            ? (opts.wells + opts.mswInterval - 1) / opts.mswInterval : 0;
+
+        auto deck = fmt::format(R"(RUNSPEC
+DIMENS
+{0} {1} {2} /
+OIL
+WATER
+GAS
+METRIC
+START
+1 'JAN' 2026 /
+WELLDIMS
+{3} {2} {4} {5} /
+)", nx, ny, nz, opts.wells, ngroups + 1, opts.wellsPerGroup);
+
+        if (nmsw > 0) {
+            deck += fmt::format("WSEGDIMS\n{} {} 1 /\n", nmsw, nz + 1);
+        }
+
+        deck += fmt::format(R"(GRID
+DX
+{0}*100 /
+DY
+{0}*100 /
+DZ
+{0}*5 /
+TOPS
+{1}*2000 /
+PORO
+{0}*0.25 /
+PERMX
+{0}*100 /
+PERMY
+{0}*100 /
+PERMZ
+{0}*10 /
+SCHEDULE
+)", ncells, nx * ny);
+
+        deck += "WELSPECS\n";
+        for (auto w = 0; w < opts.wells; ++w) {
+            deck += fmt::format("'W{}' 'G{}' {} {} 1* 'OIL' /\n",
+                                w + 1, w / opts.wellsPerGroup + 1,
+                                w % nx + 1, w / nx + 1);
+        }
+        deck += "/\n";
+
+        deck += "COMPDAT\n";
+        for (auto w = 0; w < opts.wells; ++w) {
+            deck += fmt::format("'W{}' 2* 1 {} 'OPEN' 2* 0.2 /\n", w + 1, nz);
+        }
+        deck += "/\n";
+
+        for (auto w = 0; w < opts.wells; ++w) {
+            if (! isMultiSegment(opts, w)) {
+                continue;
+            }
+
+            deck += fmt::format(R"(WELSEGS
+'W{0}' 2000 2000 1* 'INC' /
+2 {1} 1 1 5.0 5.0 0.1 1.0E-5 /
+/
+COMPSEGS
+'W{0}' /
+)", w + 1, nz + 1);
+
+            for (auto k = 0; k < nz; ++k) {
+                deck += fmt::format("{} {} {} 1 {} {} /\n",
+                                    w % nx + 1, w / nx + 1, k + 1,
+                                    5.0 * k, 5.0 * (k + 1));
+            }
+            deck += "/\n";
+        }
+
+        deck += R"(WCONPROD
+'W*' 'OPEN' 'ORAT' 100.0 /
+/
+TSTEP
+1 /
+)";
+
+        return deck;
+    }
+
+    /// Dynamic results for all wells and connections.
+    Opm::data::Wells wellResults(const Opm::Schedule& sched, const std::size_t simStep)
+    {
+        using rt = Opm::data::Rates::opt;
+
+        auto xw = Opm::data::Wells{};
+
+        for (const auto& well : sched.getWells(simStep)) {
+            auto& xwel = xw[well.name()];
+
+            xwel.rates.set(rt::oil, -100.0).set(rt::wat, -10.0).set(rt::gas, -5000.0);
+            xwel.bhp = 150.0e5;
+            xwel.thp = 50.0e5;
+            xwel.dynamicStatus = Opm::Well::Status::OPEN;
+
+            for (const auto& conn : well.getConnections()) {
+                auto& xc = xwel.connections.emplace_back();
+
+                xc.index = conn.global_index();
+                xc.rates.set(rt::oil, -1.0).set(rt::wat, -0.1).set(rt::gas, -50.0);
+                xc.pressure = 160.0e5;
+                xc.reservoir_rate = -1.5;
+                xc.trans_factor = conn.CF();
+            }
+        }
+
+        return xw;
+    }
+
+    struct Model
+    {
+        explicit Model(const Opm::Deck& deck)
+            : es    { deck }
+            , grid  { deck }
+            , sched { deck, es, std::make_shared<Opm::Python>() }
+        {}
+
+        // Order requirement: 'es' must be declared/initialised before 'sched'.
+        Opm::EclipseState es;
+        Opm::EclipseGrid grid;
+        Opm::Schedule sched;
+    };
+
+    /// Restart arrays for a single report step.
+    struct RestartArrays
+    {
+        explicit RestartArrays(const std::vector<int>& ih)
+            : wellData  { ih }
+            , connData  { ih }
+            , groupData { ih }
+            , mswData   { ih }
+        {}
+
+        Opm::RestartIO::Helpers::AggregateWellData       wellData;
+        Opm::RestartIO::Helpers::AggregateConnectionData connData;
+        Opm::RestartIO::Helpers::AggregateGroupData      groupData;
+        Opm::RestartIO::Helpers::AggregateMSWData        mswData;
+    };
+
+    void writeArrays(const RestartArrays&                ra,
+                     const std::vector<int>&             ih,
+                     const Opm::EclIO::OutputStream::ResultSet& rset,
+                     const int                           reportStep)
+    {
+        auto rstFile = Opm::EclIO::OutputStream::Restart {
+            rset, reportStep,
+            Opm::EclIO::OutputStream::Formatted { false },
+            Opm::EclIO::OutputStream::Unified   { true }
+        };
+
+        rstFile.write("INTEHEAD", ih);
+
+        rstFile.write("IGRP", ra.groupData.getIGroup());
+        rstFile.write("SGRP", ra.groupData.getSGroup());
+        rstFile.write("XGRP", ra.groupData.getXGroup());
+        rstFile.write("ZGRP", ra.groupData.getZGroup());
+
+        rstFile.write("ISEG", ra.mswData.getISeg());
+        rstFile.write("ILBS", ra.mswData.getILBs());
+        rstFile.write("ILBR", ra.mswData.getILBr());
+        rstFile.write("RSEG", ra.mswData.getRSeg());
+
+        rstFile.write("IWEL", ra.wellData.getIWell());
+        rstFile.write("SWEL", ra.wellData.getSWell());
+        rstFile.write("XWEL", ra.wellData.getXWell());
+        rstFile.write("ZWEL", ra.wellData.getZWell());
+
+        rstFile.write("ICON", ra.connData.getIConn());
+        rstFile.write("SCON", ra.connData.getSConn());
+        rstFile.write("XCON", ra.connData.getXConn());
+    }
+
+    void runBenchmark(const Options& opts)
+    {
+        const auto nx = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(opts.wells))));
+        const auto ny = (opts.wells + nx - 1) / nx;
+
+        const auto setupStart = std::chrono::steady_clock::now();
+
+        const auto model = Model { Opm::Parser{}.parseString(modelDeck(opts, nx, ny)) };
+
+        const auto reportStep = 1;
+        const auto simStep = std::size_t{0};
+        const auto simTime = 86400.0;
+
+        const auto ih = Opm::RestartIO::Helpers::
+            createInteHead(model.es, model.grid, model.sched, simTime,
+                           reportStep, reportStep, static_cast<int>(simStep));
+
+        const auto xw = wellResults(model.sched, simStep);
+        const auto sumState = Opm::SummaryState { Opm::TimeService::now(), 0.0 };
+        const auto actionState = Opm::Action::State{};
+        const auto wtestState = Opm::WellTestState{};
+        const auto& units = model.es.getUnits();
+        const auto& tracers = model.es.tracer();
+
+        report("Model setup", std::chrono::duration<double>
+               (std::chrono::steady_clock::now() - setupStart).count());
+
+        auto ra = std::optional<RestartArrays>{};
+
+        const auto tWell = bestTime(opts.repetitions, [&]()
+        {
+            ra.emplace(ih);
+            ra->wellData.captureDeclaredWellData(model.sched, model.grid, tracers, simStep,
+                                                 actionState, wtestState, sumState, ih);
+            ra->wellData.captureDynamicWellData(model.sched, tracers, simStep, xw, sumState);
+        });
+
+        const auto tConn = bestTime(opts.repetitions, [&]()
+        {
+            ra->connData.captureDeclaredConnData(model.sched, model.grid, units,
+                                                 xw, sumState, simStep);
+        });
+
+        const auto tGroup = bestTime(opts.repetitions, [&]()
+        {
+            ra->groupData.captureDeclaredGroupData(model.sched, units, simStep, sumState, ih);
+        });
+
+        const auto tMSW = bestTime(opts.repetitions, [&]()
+        {
+            ra->mswData.captureDeclaredMSWData(model.sched, simStep, units, ih,
+                                               model.grid, sumState, xw);
+        });
+
+        const auto rset = Opm::EclIO::OutputStream::ResultSet {
+            opts.directory.string(), "RESTART_AGGREGATE_BENCHMARK"
+        };
+
+        const auto tWrite = bestTime(opts.repetitions, [&]()
+        {
+            writeArrays(*ra, ih, rset, reportStep);
+        });
+
+        report("IWEL/SWEL/XWEL/ZWEL", tWell);
+        report("ICON/SCON/XCON", tConn);
+        report("IGRP/SGRP/XGRP/ZGRP", tGroup);
+        report("ISEG/RSEG/ILBS/ILBR", tMSW);
+        report("Total array build", tWell + tConn + tGroup + tMSW);
+        report("Array output", tWrite);
+
+        std::filesystem::remove(opts.directory / "RESTART_AGGREGATE_BENCHMARK.UNRST");
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    auto opts = Options{};
+
+    const auto status = Opm::Benchmark::parseOptions(argc, argv,
+        "restart_aggregate_benchmark measures the time needed to build the well,\n"
+        "connection, group and segment arrays of a restart file, separately from\n"
+        "the time needed to write them.",
+        {
+            {'w', "Number of wells (default 10000).", Opm::Benchmark::store(opts.wells)},
+            {'c', "Number of connections per well (default 100).", Opm::Benchmark::store(opts.connections)},
+            {'g', "Number of wells per group (default 100).", Opm::Benchmark::store(opts.wellsPerGroup)},
+            {'s', "Make every n'th well a multi-segment well (default 0, none).",
+             Opm::Benchmark::store(opts.mswInterval)},
+            {'r', "Number of repetitions (default 5).", Opm::Benchmark::store(opts.repetitions)},
+            {'t', "Number of threads (default OpenMP setting).", Opm::Benchmark::store(opts.threads)},
+            {'d', "Directory for temporary restart file (default system temporary directory).",
+             Opm::Benchmark::store(opts.directory)},
+        });
+
+    if (status.has_value()) {
+        return *status;
+    }
+
+    if ((opts.wells < 1) || (opts.connections < 1) || (opts.wellsPerGroup < 1)) {
+        std::cerr << "Number of wells, connections and wells per group must be positive\n";
+        return EXIT_FAILURE;
+    }
+
+    auto threads = 1;
+#ifdef _OPENMP
+    if (opts.threads > 0) {
+        omp_set_num_threads(opts.threads);
+    }
+    threads = omp_get_max_threads();
+#endif
+
+    std::cout << "Restart array build (" << opts.wells << " wells, "
+              << opts.connections << " connections per well, "
+              << threads << " thread(s))\n";
+
+    try {
+        runBenchmark(opts);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
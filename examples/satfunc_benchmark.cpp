@@ -0,0 +1,253 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Throughput of the three-phase relative permeabilities and capillary
+// pressures of EclMaterialLaw::Manager.  Compares calling the material law
+// for each cell, as the simulator's intensive quantities do, with the
+// batched evaluation of a range of cells.  The model is generated on the
+// fly with a configurable number of cells and saturation regions, and the
+// regions alternate from cell to cell.
+//
+// Usage: satfunc_benchmark [-n cells] [-s regions] [-r repetitions]
+
+#include "config.h"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
+#include <opm/material/fluidstates/SimpleModularFluidState.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include "BenchmarkUtility.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    using Opm::Benchmark::bestTime;
+
+    struct Options
+    {
+        std::size_t numCells { 100'000 };
+        int numRegions { 4 };
+        int repetitions { 20 };
+    };
+
+    constexpr int waterPhaseIdx = 0;
+    constexpr int oilPhaseIdx = 1;
+    constexpr int gasPhaseIdx = 2;
+    constexpr int numPhases = 3;
+
+    using MaterialTraits = Opm::ThreePhaseMaterialTraits<double, waterPhaseIdx, oilPhaseIdx, gasPhaseIdx,
+                                                         /*enableHysteresis=*/true,
+                                                         /*enableEndpointScaling=*/true>;
+    using MaterialLawManager = Opm::EclMaterialLaw::Manager<MaterialTraits>;
+    using MaterialLaw = MaterialLawManager::MaterialLaw;
+
+    std::string createDeck(const Options& opts)
+    {
+        auto deck = fmt::format("RUNSPEC\nDIMENS\n {} 1 1 /\nTABDIMS\n {} /\n"
+                                "OIL\nGAS\nWATER\nDISGAS\nMETRIC\n"
+                                "GRID\nDX\n {}*10 /\nDY\n {}*10 /\nDZ\n {}*5 /\n"
+                                "TOPS\n {}*2000 /\nPORO\n {}*0.2 /\nPROPS\n",
+                                opts.numCells, opts.numRegions,
+                                opts.numCells, opts.numCells, opts.numCells,
+                                opts.numCells, opts.numCells);
+
+        // Quadratic curves with region dependent end points, tabulated at
+        // 20 saturations per table.
+        deck += "SWOF\n";
+        for (int region = 0; region < opts.numRegions; ++region) {
+            const double swc = 0.1 + 0.02 * region;
+            for (int i = 0; i <= 20; ++i) {
+                const double sw = swc + (1.0 - swc) * i / 20.0;
+                const double s = (sw - swc) / (1.0 - swc);
+                deck += fmt::format(" {:.6f} {:.6f} {:.6f} {:.6f}\n",
+                                    sw, 0.8*s*s, (1 - s)*(1 - s), 2.0*(1 - s));
+            }
+            deck += "/\n";
+        }
+
+        deck += "SGOF\n";
+        for (int region = 0; region < opts.numRegions; ++region) {
+            const double swc = 0.1 + 0.02 * region;
+            for (int i = 0; i <= 20; ++i) {
+                const double sg = (1.0 - swc) * i / 20.0;
+                const double s = sg / (1.0 - swc);
+                deck += fmt::format(" {:.6f} {:.6f} {:.6f} {:.6f}\n",
+                                    sg, 0.9*s*s, (1 - s)*(1 - s), 0.5*s);
+            }
+            deck += "/\n";
+        }
+
+        deck += "REGIONS\nSATNUM\n";
+        for (std::size_t cell = 0; cell < opts.numCells; ++cell) {
+            deck += fmt::format(" {}", 1 + cell % opts.numRegions);
+        }
+        deck += " /\n";
+
+        return deck;
+    }
+
+    template <class Evaluation>
+    void benchmark(const Options& opts,
+                   const MaterialLawManager& manager,
+                   const std::string& name)
+    {
+        using FluidState = Opm::SimpleModularFluidState<Evaluation,
+                                                        numPhases,
+                                                        /*numComponents=*/3,
+                                                        void,
+                                                        /*storePressure=*/false,
+                                                        /*storeTemperature=*/false,
+                                                        /*storeComposition=*/false,
+                                                        /*storeFugacity=*/false,
+                                                        /*storeSaturation=*/true,
+                                                        /*storeDensity=*/false,
+                                                        /*storeViscosity=*/false,
+                                                        /*storeEnthalpy=*/false>;
+
+        const std::size_t n = opts.numCells;
+
+        auto saturations = std::vector<Evaluation>(n * numPhases);
+        auto fluidStates = std::vector<FluidState>(n);
+        for (std::size_t cell = 0; cell < n; ++cell) {
+            const double sw = 0.15 + 0.7 * (cell % 97) / 97.0;
+            const double so = (1.0 - sw) * (cell % 13) / 13.0;
+
+            Evaluation s[numPhases];
+            s[waterPhaseIdx] = sw;
+            s[oilPhaseIdx] = so;
+            s[gasPhaseIdx] = 1.0 - sw - so;
+            if constexpr (!std::is_same_v<Evaluation, double>) {
+                s[waterPhaseIdx] = Evaluation::createVariable(sw, 0);
+                s[gasPhaseIdx] = Evaluation::createVariable(1.0 - sw - so, 1);
+                s[oilPhaseIdx] = 1.0 - s[waterPhaseIdx] - s[gasPhaseIdx];
+            }
+
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                saturations[cell*numPhases + phaseIdx] = s[phaseIdx];
+                fluidStates[cell].setSaturation(phaseIdx, s[phaseIdx]);
+            }
+        }
+
+        auto values = std::vector<Evaluation>(n * numPhases);
+        const auto report = [&](const std::string& kernel, const double tCell, const double tBatch)
+        {
+            std::cout << std::left << std::setw(10) << name << std::setw(10) << kernel
+                      << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(12) << 1.0e9 * tCell / n << " ns"
+                      << std::setw(12) << 1.0e9 * tBatch / n << " ns"
+                      << std::setw(10) << tCell / tBatch << "x\n";
+        };
+
+        const double tCellKr = bestTime(opts.repetitions, [&]()
+        {
+            for (std::size_t cell = 0; cell < n; ++cell) {
+                auto kr = std::span<Evaluation, numPhases> { values.data() + cell*numPhases, numPhases };
+                MaterialLaw::relativePermeabilities(kr, manager.materialLawParams(cell), fluidStates[cell]);
+            }
+        });
+
+        const double tBatchKr = bestTime(opts.repetitions, [&]()
+        {
+            manager.relativePermeabilities(0, std::span<const Evaluation> { saturations },
+                                           std::span<Evaluation> { values });
+        });
+
+        report("kr", tCellKr, tBatchKr);
+
+        const double tCellPc = bestTime(opts.repetitions, [&]()
+        {
+            for (std::size_t cell = 0; cell < n; ++cell) {
+                auto pc = std::span<Evaluation, numPhases> { values.data() + cell*numPhases, numPhases };
+                MaterialLaw::capillaryPressures(pc, manager.materialLawParams(cell), fluidStates[cell]);
+            }
+        });
+
+        const double tBatchPc = bestTime(opts.repetitions, [&]()
+        {
+            manager.capillaryPressures(0, std::span<const Evaluation> { saturations },
+                                       std::span<Evaluation> { values });
+        });
+
+        report("pc", tCellPc, tBatchPc);
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    auto opts = Options{};
+
+    const auto status = Opm::Benchmark::parseOptions(argc, argv,
+        "satfunc_benchmark measures the throughput of the relative permeabilities\n"
+        "and capillary pressures of EclMaterialLaw::Manager, per cell and for a\n"
+        "range of cells.",
+        {
+            {'n', "Number of cells (default 100000).", Opm::Benchmark::store(opts.numCells)},
+            {'s', "Number of saturation regions (default 4).", Opm::Benchmark::store(opts.numRegions)},
+            {'r', "Number of repetitions (default 20).", Opm::Benchmark::store(opts.repetitions)},
+        });
+
+    if (status.has_value()) {
+        return *status;
+    }
+
+    const auto deck = Opm::Parser{}.parseString(createDeck(opts));
+    const auto eclState = Opm::EclipseState { deck };
+
+    const auto fieldPropIntOnLeafAssigner =
+        [](const Opm::FieldPropsManager& fieldProps, const std::string& name, const bool needsTranslation)
+    {
+        auto values = fieldProps.get_int(name);
+        std::transform(values.begin(), values.end(), values.begin(),
+                       [needsTranslation](const int v) { return v - needsTranslation; });
+        return values;
+    };
+
+    auto manager = MaterialLawManager{};
+    manager.initFromState(eclState);
+    manager.initParamsForElements(eclState, opts.numCells, fieldPropIntOnLeafAssigner,
+                                  [](const unsigned elemIdx) { return elemIdx; });
+
+    std::cout << std::left << std::setw(10) << "type" << std::setw(10) << "kernel"
+              << std::right << std::setw(15) << "per cell" << std::setw(15) << "batch"
+              << std::setw(11) << "speedup" << '\n';
+
+    benchmark<double>(opts, manager, "double");
+    benchmark<Opm::DenseAd::Evaluation<double, 2>>(opts, manager, "AD(2)");
+
+    return EXIT_SUCCESS;
+}
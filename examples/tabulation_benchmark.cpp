@@ -0,0 +1,275 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Lookup throughput of Tabulated1DFunction and UniformXTabulated2DFunction
+// for tables of the size of typical PVDO, PVTO and SWOF tables.  Compares
+// a plain bisection with the default segment search, which uses O(1)
+// lookup for uniformly spaced tables, and with a per-cell segment cursor.
+//
+// Usage: tabulation_benchmark [-n cells] [-r repetitions]
+
+#include "config.h"
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/common/UniformXTabulated2DFunction.hpp>
+
+#include "BenchmarkUtility.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using Opm::Benchmark::bestTime;
+
+    struct Options
+    {
+        std::size_t numCells { 1'000'000 };
+        int repetitions { 10 };
+    };
+
+    void report(const std::string& label, const std::size_t lookups, const double seconds)
+    {
+        Opm::Benchmark::report(label, (lookups / seconds) / 1.0e6, "Mlookups/s", 36, 1);
+    }
+
+    /// Reference bisection over the sampling points, equivalent to the
+    /// segment search without uniform spacing detection and hints.
+    template <class XAt>
+    std::size_t bisection(const std::size_t n, const double x, XAt&& xAt)
+    {
+        if (x <= xAt(1)) {
+            return 0;
+        }
+        if (x >= xAt(n - 2)) {
+            return n - 2;
+        }
+
+        std::size_t lowerIdx = 1;
+        std::size_t upperIdx = n - 2;
+        while (lowerIdx + 1 < upperIdx) {
+            const std::size_t pivotIdx = (lowerIdx + upperIdx) / 2;
+            if (x < xAt(pivotIdx)) {
+                upperIdx = pivotIdx;
+            }
+            else {
+                lowerIdx = pivotIdx;
+            }
+        }
+
+        return lowerIdx;
+    }
+
+    /// Cell positions spread over [xMin, xMax], and a perturbation of
+    /// them emulating the change between two Newton iterations.
+    struct CellPositions
+    {
+        CellPositions(const std::size_t numCells, const double xMin, const double xMax)
+            : base(numCells)
+            , current(numCells)
+        {
+            std::mt19937 gen { 42 };
+            std::uniform_real_distribution<double> dist { xMin, xMax };
+            std::ranges::generate(base, [&]() { return dist(gen); });
+
+            delta = 1.0e-3 * (xMax - xMin);
+        }
+
+        const std::vector<double>& next()
+        {
+            const double shift = delta * std::sin(static_cast<double>(++iteration));
+            std::ranges::transform(base, current.begin(),
+                                   [shift](const double x) { return x + shift; });
+            return current;
+        }
+
+        std::vector<double> base;
+        std::vector<double> current;
+        double delta { 0.0 };
+        int iteration { 0 };
+    };
+
+    void benchmark1D(const Options& opts,
+                     const std::string& name,
+                     const Opm::Tabulated1DFunction<double>& table)
+    {
+        std::cout << '\n' << name << " (" << table.numSamples() << " rows, "
+                  << (table.uniformlySpaced() ? "uniform" : "non-uniform") << ")\n";
+
+        auto cells = CellPositions { opts.numCells, table.xMin(), table.xMax() };
+        auto cursors = std::vector<Opm::SegmentIndex>(opts.numCells, Opm::SegmentIndex{0});
+        volatile double sink = 0.0;
+
+        report("  bisection", opts.numCells, bestTime(opts.repetitions, [&]()
+        {
+            const auto& x = cells.next();
+            const auto& xValues = table.xValues();
+            double sum = 0.0;
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                const auto segIdx = bisection(xValues.size(), x[i],
+                                              [&xValues](const std::size_t j) { return xValues[j]; });
+                sum += table.eval(x[i], Opm::SegmentIndex{segIdx});
+            }
+            sink = sum;
+        }));
+
+        report("  findSegmentIndex", opts.numCells, bestTime(opts.repetitions, [&]()
+        {
+            const auto& x = cells.next();
+            double sum = 0.0;
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                sum += table.eval(x[i], /*extrapolate=*/true);
+            }
+            sink = sum;
+        }));
+
+        report("  per-cell cursor", opts.numCells, bestTime(opts.repetitions, [&]()
+        {
+            const auto& x = cells.next();
+            double sum = 0.0;
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                sum += table.eval(x[i], /*extrapolate=*/true, cursors[i]);
+            }
+            sink = sum;
+        }));
+
+        static_cast<void>(sink);
+    }
+
+    void benchmark2D(const Options& opts,
+                     const std::string& name,
+                     const Opm::UniformXTabulated2DFunction<double>& table)
+    {
+        std::cout << '\n' << name << " (" << table.numX() << " lines of "
+                  << table.numY(0) << " rows)\n";
+
+        // Search along a single line, as done for each of the two lines
+        // enclosing the x position of a cell.
+        const unsigned lineIdx = table.numX() / 2;
+        auto cells = CellPositions { opts.numCells, table.yMin(lineIdx), table.yMax(lineIdx) };
+        auto cursors = std::vector<unsigned>(opts.numCells, 0);
+        volatile unsigned sink = 0;
+
+        report("  bisection", opts.numCells, bestTime(opts.repetitions, [&]()
+        {
+            const auto& y = cells.next();
+            unsigned sum = 0;
+            for (std::size_t i = 0; i < y.size(); ++i) {
+                sum += bisection(table.numY(lineIdx), y[i],
+                                 [&table, lineIdx](const std::size_t j) { return table.jToY(lineIdx, j); });
+            }
+            sink = sum;
+        }));
+
+        report("  ySegmentIndex", opts.numCells, bestTime(opts.repetitions, [&]()
+        {
+            const auto& y = cells.next();
+            unsigned sum = 0;
+            for (std::size_t i = 0; i < y.size(); ++i) {
+                sum += table.ySegmentIndex(y[i], lineIdx, /*extrapolate=*/true);
+            }
+            sink = sum;
+        }));
+
+        report("  per-cell cursor", opts.numCells, bestTime(opts.repetitions, [&]()
+        {
+            const auto& y = cells.next();
+            unsigned sum = 0;
+            for (std::size_t i = 0; i < y.size(); ++i) {
+                cursors[i] = table.ySegmentIndex(y[i], lineIdx, /*extrapolate=*/true, cursors[i]);
+                sum += cursors[i];
+            }
+            sink = sum;
+        }));
+
+        static_cast<void>(sink);
+    }
+
+    /// Oil formation volume factor versus pressure [bar], at pressures
+    /// which are denser at low pressure as is typical for PVDO tables.
+    Opm::Tabulated1DFunction<double> pvdoTable()
+    {
+        std::vector<double> p, b;
+        for (int i = 0; i < 20; ++i) {
+            p.push_back(1.0 + 400.0 * std::pow(i / 19.0, 2.0));
+            b.push_back(1.2 - 1.0e-4 * p.back());
+        }
+
+        return { p.size(), p, b };
+    }
+
+    /// Water relative permeability versus uniformly spaced water saturations.
+    Opm::Tabulated1DFunction<double> swofTable()
+    {
+        std::vector<double> sw, krw;
+        for (int i = 0; i <= 40; ++i) {
+            sw.push_back(0.2 + 0.02 * i);
+            krw.push_back(std::pow((sw.back() - 0.2) / 0.8, 2.0));
+        }
+
+        return { sw.size(), sw, krw };
+    }
+
+    /// Inverse oil formation volume factor versus dissolved gas-oil ratio
+    /// and pressure [bar], with uniformly spaced undersaturated pressures.
+    Opm::UniformXTabulated2DFunction<double> pvtoTable()
+    {
+        Opm::UniformXTabulated2DFunction<double> table;
+        for (int i = 0; i < 25; ++i) {
+            const double rs = 5.0 * i;
+            const double pSat = 1.0 + 2.0 * rs;
+            const auto xIdx = table.appendXPos(rs);
+            for (int j = 0; j < 10; ++j) {
+                const double p = pSat + 25.0 * j;
+                table.appendSamplePoint(xIdx, p, 1.0 / (1.1 + 1.0e-3 * rs - 1.0e-4 * (p - pSat)));
+            }
+        }
+
+        return table;
+    }
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    auto opts = Options{};
+
+    const auto status = Opm::Benchmark::parseOptions(argc, argv,
+        "tabulation_benchmark measures the lookup throughput of tabulated\n"
+        "functions of the size of typical PVDO, PVTO and SWOF tables.",
+        {
+            {'n', "Number of cells per sweep (default 1000000).", Opm::Benchmark::store(opts.numCells)},
+            {'r', "Number of repetitions (default 10).", Opm::Benchmark::store(opts.repetitions)},
+        });
+
+    if (status.has_value()) {
+        return *status;
+    }
+
+    benchmark1D(opts, "PVDO", pvdoTable());
+    benchmark1D(opts, "SWOF", swofTable());
+    benchmark2D(opts, "PVTO", pvtoTable());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_MSIM_IO_BENCHMARK_HPP
+#define OPM_MSIM_IO_BENCHMARK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Opm {
+
+/// End-to-end throughput benchmark of the simulator facing output layer.
+///
+/// Synthesises a black-oil model with a configurable number of cells,
+/// wells, and report steps and runs it through msim.  Each report step
+/// evaluates the summary vectors, any UDQs and ACTIONX conditions, and
+/// writes summary, restart and RFT output.  The time and number of bytes
+/// of each phase is reported separately.
+class IOBenchmark
+{
+public:
+    /// Benchmark configuration.
+    struct Config
+    {
+        /// Approximate number of active cells.  Rounded to a box shaped
+        /// grid of at most ten layers.
+        std::size_t numCells{100'000};
+
+        /// Number of wells.  Every other well is a water injector.
+        std::size_t numWells{10};
+
+        /// Number of report steps.
+        std::size_t numSteps{20};
+
+        /// Number of ACTIONX blocks.  Their conditions are never
+        /// satisfied, so every block is evaluated at every report step.
+        std::size_t numActions{5};
+
+        /// Maximum number of pending asynchronous restart output events.
+        /// Zero for synchronous restart output.
+        std::size_t asyncRestart{0};
+
+        /// Whether or not to write compressed restart companion files.
+        bool compressedRestart{false};
+
+        /// Output directory.
+        std::string outputDir{"."};
+
+        /// Base name of output files.
+        std::string baseName{"IOBENCH"};
+    };
+
+    /// Time and output size of a single benchmark phase.
+    struct Phase
+    {
+        /// Accumulated wall-clock time, seconds.
+        double seconds{0.0};
+
+        /// Number of times the phase was performed.
+        std::size_t count{0};
+
+        /// Size of output files, bytes.  Zero for evaluation phases.
+        std::uintmax_t bytes{0};
+    };
+
+    /// Benchmark results.
+    struct Report
+    {
+        /// Number of active cells in synthesised model.
+        std::size_t numCells{0};
+
+        /// Number of wells in synthesised model.
+        std::size_t numWells{0};
+
+        /// Number of report steps.
+        std::size_t numSteps{0};
+
+        /// Summary vector evaluation.
+        Phase summaryEval{};
+
+        /// UDQ evaluation.
+        Phase udqEval{};
+
+        /// ACTIONX condition evaluation.
+        Phase actionEval{};
+
+        /// Summary file output.
+        Phase summaryWrite{};
+
+        /// Restart file output, including waiting for any pending
+        /// asynchronous output at the end of the run.
+        Phase restartWrite{};
+
+        /// RFT file output.
+        Phase rftWrite{};
+
+        /// Total wall-clock time of the run, including initial output.
+        double totalSeconds{0.0};
+
+        /// Report in JSON format.
+        std::string json() const;
+    };
+
+    /// Constructor.
+    ///
+    /// \param[in] config Benchmark configuration.
+    explicit IOBenchmark(const Config& config);
+
+    /// Input deck of the synthesised model.
+    std::string deck() const;
+
+    /// Run benchmark.
+    ///
+    /// Output files are created in the configured output directory.
+    Report run() const;
+
+private:
+    /// Benchmark configuration.
+    Config config_{};
+
+    /// Grid dimensions.
+    std::size_t nx_{1}, ny_{1}, nz_{1};
+};
+
+} // namespace Opm
+
+#endif // OPM_MSIM_IO_BENCHMARK_HPP
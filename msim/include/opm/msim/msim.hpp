@@ -34,6 +34,21 @@ public:
     using well_rate_function = double(const EclipseState&, const Schedule&, const SummaryState& st, const data::Solution&, size_t report_step, double seconds_elapsed);
     using solution_function = void(const EclipseState&, const Schedule&, data::Solution&, size_t report_step, double seconds_elapsed);
 
+    /// Accumulated wall-clock time, in seconds, of the non-output
+    /// processing steps performed on behalf of the simulator.
+    struct Timings
+    {
+        double summaryEval{0.0};
+        double udqEval{0.0};
+        double actionEval{0.0};
+        size_t numSummaryEval{0};
+        size_t numUdqEval{0};
+        size_t numActionEval{0};
+
+        /// Wall-clock time, in seconds, elapsed since \p start.
+        static double secondsSince(std::chrono::steady_clock::time_point start);
+    };
+
     msim(const EclipseState& state, const Schedule& schedule_arg);
 
     Opm::UDAValue uda_val();
@@ -47,6 +62,9 @@ public:
     /// \return True if any ACTIONX was applied.
     bool post_step(data::Solution& sol, data::Wells& well_data, data::GroupAndNetworkValues& group_nwrk_data, size_t report_step, const time_point& sim_time);
 
+    /// \brief Accumulated summary, UDQ, and ACTIONX evaluation times.
+    const Timings& timings() const { return this->timings_; }
+
 private:
     void run_step(const WellTestState& wtest_state,
                   UDQState& udq_state,
@@ -74,6 +92,7 @@ private:
     EclipseState state;
     std::map<std::string, std::map<data::Rates::opt, std::function<well_rate_function>>> well_rates;
     std::map<std::string, std::function<solution_function>> solutions;
+    Timings timings_{};
 
 public:
     Schedule schedule;
@@ -0,0 +1,400 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/msim/IOBenchmark.hpp>
+
+#include <opm/msim/msim.hpp>
+
+#include <opm/io/eclipse/CompressedRestart.hpp>
+#include <opm/io/eclipse/OutputStream.hpp>
+
+#include <opm/output/data/Solution.hpp>
+#include <opm/output/data/Wells.hpp>
+#include <opm/output/eclipse/EclipseIO.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    std::string wellName(const std::size_t well)
+    {
+        return fmt::format("{}{}", (well % 2 == 0) ? 'P' : 'I', well/2 + 1);
+    }
+
+    bool isProducer(const std::size_t well)
+    {
+        return well % 2 == 0;
+    }
+
+    /// Combined size of those files which exist.
+    std::uintmax_t fileSize(std::initializer_list<std::string> files)
+    {
+        auto size = std::uintmax_t{0};
+
+        for (const auto& file : files) {
+            auto ec = std::error_code{};
+            const auto fsize = std::filesystem::file_size(file, ec);
+
+            if (! ec) {
+                size += fsize;
+            }
+        }
+
+        return size;
+    }
+
+    /// Synthetic dynamic cell values.  FIELD units.
+    void solutionValue(const Opm::EclipseState&     es,
+                       Opm::data::Solution&         sol,
+                       const std::string&           name,
+                       const Opm::UnitSystem::measure m,
+                       const double                 seconds_elapsed,
+                       const double                 base,
+                       const double                 amplitude)
+    {
+        const auto numActive = es.getInputGrid().getNumActive();
+
+        if (! sol.has(name)) {
+            sol.insert(name, m, std::vector<double>(numActive),
+                       Opm::data::TargetType::RESTART_SOLUTION);
+        }
+
+        const auto& units = es.getUnits();
+        const auto phase = seconds_elapsed / (365.0 * 86400.0);
+
+        auto& values = sol.data<double>(name);
+        for (auto cell = std::size_t{0}; cell < values.size(); ++cell) {
+            const auto x = static_cast<double>(cell % 1009) / 1009.0;
+            values[cell] = units.to_si(m, base + amplitude*std::sin(x + phase));
+        }
+    }
+
+    void addPhase(std::string& json, const char* name,
+                  const Opm::IOBenchmark::Phase& phase, const bool last = false)
+    {
+        const auto throughput = (phase.seconds > 0.0)
+            ? static_cast<double>(phase.bytes) / phase.seconds
+            : 0.0;
+
+        json += fmt::format("    \"{}\": {{ \"seconds\": {:.6f}, \"count\": {}, "
+                            "\"bytes\": {}, \"bytes_per_second\": {:.1f} }}{}\n",
+                            name, phase.seconds, phase.count,
+                            phase.bytes, throughput, last ? "" : ",");
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+IOBenchmark::IOBenchmark(const Config& config)
+    : config_ { config }
+{
+    const auto numCells = std::max(this->config_.numCells, std::size_t{1});
+
+    this->nz_ = std::min(numCells, std::size_t{10});
+
+    const auto nxy = (numCells + this->nz_ - 1) / this->nz_;
+    this->nx_ = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(nxy))));
+    this->ny_ = (nxy + this->nx_ - 1) / this->nx_;
+
+    this->config_.numWells = std::clamp(this->config_.numWells,
+                                        std::size_t{1}, this->nx_ * this->ny_);
+    this->config_.numSteps = std::max(this->config_.numSteps, std::size_t{1});
+}
+
+std::string IOBenchmark::deck() const
+{
+    const auto numCells = this->nx_ * this->ny_ * this->nz_;
+    const auto numWells = this->config_.numWells;
+
+    auto deck = fmt::format(R"(RUNSPEC
+DIMENS
+ {} {} {} /
+OIL
+GAS
+WATER
+DISGAS
+FIELD
+START
+ 1 'JAN' 2020 /
+WELLDIMS
+ {} {} 1 {} /
+ACTDIMS
+ {} 10 80 4 /
+UNIFOUT
+GRID
+DX
+ {}*1000 /
+DY
+ {}*1000 /
+DZ
+ {}*20 /
+TOPS
+ {}*8325 /
+PORO
+ {}*0.3 /
+PERMX
+ {}*200 /
+PERMY
+ {}*200 /
+PERMZ
+ {}*20 /
+PROPS
+PVTW
+ 4017.55 1.038 3.22E-6 0.318 0.0 /
+ROCK
+ 14.7 3E-6 /
+SWOF
+0.12 0       1     0
+0.50 0.00001 0.10  0
+1.00 0.00010 0     0 /
+SGOF
+0    0     1     0
+0.50 0.72  0.001 0
+0.88 0.984 0     0 /
+DENSITY
+ 53.66 64.49 0.0533 /
+PVDG
+14.700 166.666 0.008000
+4014.7 0.81100 0.026800
+9014.7 0.38600 0.047000 /
+PVTO
+0.0010 14.7   1.0620 1.0400 /
+1.2700 4014.7 1.6950 0.5100
+       9014.7 1.5790 0.7400 /
+/
+SOLUTION
+EQUIL
+ 8400 4800 8450 0 8300 0 1 0 0 /
+RSVD
+ 8300 1.270
+ 8450 1.270 /
+SUMMARY
+FOPR
+FOPT
+FWPR
+FWPT
+FGPR
+FGPT
+FWIR
+FWIT
+FPR
+GOPR
+/
+)",
+        this->nx_, this->ny_, this->nz_,
+        numWells, this->nz_, numWells,
+        std::max(this->config_.numActions, std::size_t{1}),
+        numCells, numCells, numCells, this->nx_ * this->ny_,
+        numCells, numCells, numCells, numCells);
+
+    for (const auto* kw : { "WOPR", "WWPR", "WGPR", "WOPT", "WWPT",
+                            "WGPT", "WWIR", "WWIT", "WBHP", "WWCT" })
+    {
+        deck += fmt::format("{}\n/\n", kw);
+    }
+
+    deck += "SCHEDULE\nRPTRST\n 'BASIC=1' /\nWELSPECS\n";
+
+    const auto nxy = this->nx_ * this->ny_;
+    for (auto well = std::size_t{0}; well < numWells; ++well) {
+        const auto column = well * nxy / numWells;
+
+        deck += fmt::format(" '{}' 'G1' {} {} 1* '{}' /\n",
+                            wellName(well), column % this->nx_ + 1,
+                            column / this->nx_ + 1,
+                            isProducer(well) ? "OIL" : "WATER");
+    }
+
+    deck += "/\nCOMPDAT\n";
+    for (auto well = std::size_t{0}; well < numWells; ++well) {
+        deck += fmt::format(" '{}' 2* 1 {} 'OPEN' 2* 0.5 /\n",
+                            wellName(well), this->nz_);
+    }
+
+    deck += "/\nWCONPROD\n 'P*' 'OPEN' 'ORAT' 1000 /\n/\n";
+    if (numWells > 1) {
+        deck += "WCONINJE\n 'I*' 'WATER' 'OPEN' 'RATE' 1000 1* 6000 /\n/\n";
+    }
+
+    deck += "WRFTPLT\n '*' 'REPT' /\n/\n";
+
+    for (auto action = std::size_t{0}; action < this->config_.numActions; ++action) {
+        deck += fmt::format("ACTIONX\n 'ACT{}' 1000000 /\n{} > 1.0E+20 /\n/\n"
+                            "WELOPEN\n 'P1' 'SHUT' /\n/\nENDACTIO\n",
+                            action + 1,
+                            (action % 2 == 0) ? "WOPR 'P*'" : "FWPR");
+    }
+
+    deck += fmt::format("TSTEP\n {}*30 /\nEND\n", this->config_.numSteps);
+
+    return deck;
+}
+
+IOBenchmark::Report IOBenchmark::run() const
+{
+    const auto deck = Parser{}.parseString(this->deck());
+
+    auto es = EclipseState { deck };
+    es.getIOConfig().setOutputDir(this->config_.outputDir);
+    es.getIOConfig().setBaseName(this->config_.baseName);
+
+    const auto schedule = Schedule { deck, es, std::make_shared<Python>() };
+    const auto summaryConfig = SummaryConfig {
+        deck, schedule, es.fieldProps(), es.aquifer()
+    };
+
+    std::filesystem::create_directories(this->config_.outputDir);
+
+    auto sim = msim { es, schedule };
+
+    using measure = UnitSystem::measure;
+    for (const auto& [name, m, base, amplitude] :
+             { std::tuple { "PRESSURE", measure::pressure, 4000.0, 500.0 },
+               std::tuple { "SWAT", measure::identity, 0.5, 0.3 },
+               std::tuple { "SGAS", measure::identity, 0.1, 0.05 },
+               std::tuple { "RS", measure::gas_oil_ratio, 1.0, 0.2 } })
+    {
+        sim.solution(name, [name = std::string { name }, m = m, base = base, amplitude = amplitude]
+                     (const EclipseState& state, const Schedule&, data::Solution& sol,
+                      std::size_t, const double seconds_elapsed)
+        {
+            solutionValue(state, sol, name, m, seconds_elapsed, base, amplitude);
+        });
+    }
+
+    for (auto well = std::size_t{0}; well < this->config_.numWells; ++well) {
+        const auto rate = [scale = 1.0 + 0.01*well]
+            (const double value)
+        {
+            return [value = scale * value]
+                (const EclipseState& state, const Schedule&, const SummaryState&,
+                 const data::Solution&, std::size_t, double)
+            {
+                return state.getUnits().to_si(measure::liquid_surface_rate, value);
+            };
+        };
+
+        if (isProducer(well)) {
+            sim.well_rate(wellName(well), data::Rates::opt::oil, rate(-1000.0));
+            sim.well_rate(wellName(well), data::Rates::opt::wat, rate(-100.0));
+            sim.well_rate(wellName(well), data::Rates::opt::gas, rate(-500.0));
+        }
+        else {
+            sim.well_rate(wellName(well), data::Rates::opt::wat, rate(1000.0));
+        }
+    }
+
+    auto report = Report{};
+    report.numCells = es.getInputGrid().getNumActive();
+    report.numWells = this->config_.numWells;
+    report.numSteps = schedule.size() - 1;
+
+    {
+        auto io = EclipseIO { es, es.getInputGrid(), schedule, summaryConfig };
+        io.setAsyncRestartOutput(this->config_.asyncRestart);
+        io.setCompressedRestartOutput(this->config_.compressedRestart);
+
+        const auto start = std::chrono::steady_clock::now();
+
+        sim.run(io, true);
+
+        const auto pending = std::chrono::steady_clock::now();
+        io.waitForRestartOutput();
+        report.restartWrite.seconds += msim::Timings::secondsSince(pending);
+
+        report.totalSeconds = msim::Timings::secondsSince(start);
+
+        const auto& output = io.outputTimings();
+        report.summaryWrite.seconds = output.summary;
+        report.summaryWrite.count = output.numSummary;
+        report.restartWrite.seconds += output.restart;
+        report.restartWrite.count = output.numRestart;
+        report.rftWrite.seconds = output.rft;
+        report.rftWrite.count = output.numRft;
+    }
+
+    const auto& timings = sim.timings();
+    report.summaryEval.seconds = timings.summaryEval;
+    report.summaryEval.count = timings.numSummaryEval;
+    report.udqEval.seconds = timings.udqEval;
+    report.udqEval.count = timings.numUdqEval;
+    report.actionEval.seconds = timings.actionEval;
+    report.actionEval.count = timings.numActionEval;
+
+    const auto rset = EclIO::OutputStream::ResultSet {
+        this->config_.outputDir, this->config_.baseName
+    };
+
+    using EclIO::OutputStream::outputFileName;
+
+    const auto restartFile = outputFileName(rset, "UNRST");
+
+    report.summaryWrite.bytes = fileSize({ outputFileName(rset, "SMSPEC"),
+                                           outputFileName(rset, "UNSMRY") });
+    report.restartWrite.bytes = fileSize({ restartFile,
+                                           EclIO::CompressedRestart::companionName(restartFile) });
+    report.rftWrite.bytes = fileSize({ outputFileName(rset, "RFT") });
+
+    return report;
+}
+
+std::string IOBenchmark::Report::json() const
+{
+    auto json = fmt::format("{{\n  \"cells\": {},\n  \"wells\": {},\n"
+                            "  \"report_steps\": {},\n  \"total_seconds\": {:.6f},\n"
+                            "  \"phases\": {{\n",
+                            this->numCells, this->numWells,
+                            this->numSteps, this->totalSeconds);
+
+    addPhase(json, "summary_eval", this->summaryEval);
+    addPhase(json, "udq_eval", this->udqEval);
+    addPhase(json, "actionx_eval", this->actionEval);
+    addPhase(json, "summary_write", this->summaryWrite);
+    addPhase(json, "restart_write", this->restartWrite);
+    addPhase(json, "rft_write", this->rftWrite, true);
+
+    json += "  }\n}\n";
+
+    return json;
+}
+
+} // namespace Opm
@@ -74,6 +74,13 @@ namespace Opm {
 
 std::shared_ptr<Python> msim::python = std::make_shared<Python>();
 
+double msim::Timings::secondsSince(const std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double> {
+        std::chrono::steady_clock::now() - start
+    }.count();
+}
+
 msim::msim(const EclipseState& state_arg, const Schedule& schedule_arg)
     : state   (state_arg)
     , schedule(schedule_arg)
@@ -143,7 +150,11 @@ bool msim::post_step(data::Solution& /* sol */,
     };
 
     for (const auto& action : actions.pending(this->action_state, std::chrono::system_clock::to_time_t(sim_time))) {
+        const auto start = std::chrono::steady_clock::now();
         const auto result = action->eval(context);
+        this->timings_.actionEval += Timings::secondsSince(start);
+        ++this->timings_.numActionEval;
+
         if (result.conditionSatisfied()) {
             this->schedule.applyAction(report_step, *action, result.matches(),
                                        std::unordered_map<std::string,double>{}, true);
@@ -198,8 +209,12 @@ void msim::run_step(const WellTestState& wtest_state,
         values.well_solution = &well_data;
         values.group_and_nwrk_solution = &group_nwrk_data;
 
+        auto start = std::chrono::steady_clock::now();
         io.summary().eval(report_step, seconds_elapsed, values, this->st);
+        this->timings_.summaryEval += Timings::secondsSince(start);
+        ++this->timings_.numSummaryEval;
 
+        start = std::chrono::steady_clock::now();
         this->schedule.getUDQConfig(report_step - 1)
             .eval(report_step,
                   this->schedule.wellMatcher(report_step),
@@ -208,6 +223,8 @@ void msim::run_step(const WellTestState& wtest_state,
                   createRegionSetMatcherFactory(this->state),
                   this->st,
                   udq_state);
+        this->timings_.udqEval += Timings::secondsSince(start);
+        ++this->timings_.numUdqEval;
 
         this->output(wtest_state,
                      udq_state,
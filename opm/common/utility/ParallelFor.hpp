@@ -0,0 +1,72 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PARALLEL_FOR_HPP
+#define OPM_PARALLEL_FOR_HPP
+
+#include <cstddef>
+#include <exception>
+
+namespace Opm {
+
+//! \brief Invoke body(i) for all i in [0, n), using OpenMP threads if
+//!        available.
+//! \details Iterations must be independent.  The loop runs serially if
+//!          n is less than minParallel, or if OpenMP is disabled.
+//!          Exceptions cannot propagate out of an OpenMP region, so an
+//!          exception thrown by the body is captured and rethrown from
+//!          the calling thread once the loop completes.  If several
+//!          iterations throw, the exception from the lowest index is
+//!          rethrown, which matches what a serial loop would report.
+template <class Body>
+void parallelFor(const std::size_t n,
+                 const std::size_t minParallel,
+                 Body&&            body)
+{
+    auto error = std::exception_ptr{};
+    auto errorIndex = n;
+
+    [[maybe_unused]] const auto runParallel = n >= minParallel;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) if (runParallel)
+#endif
+    for (std::size_t i = 0; i < n; ++i) {
+        try {
+            body(i);
+        }
+        catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(opm_parallel_for_error)
+#endif
+            if (i < errorIndex) {
+                errorIndex = i;
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_PARALLEL_FOR_HPP
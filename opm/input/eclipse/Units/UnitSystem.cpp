@@ -1495,7 +1495,13 @@ namespace {
         auto iter = this->m_dimensions.find(dimension);
         if (iter == this->m_dimensions.end())
             throw std::out_of_range("The dimension: '" + dimension + "' was not recognized");
+
+        // Restart file decoding looks up dimensions from multiple threads.
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
         this->m_use_count++;
+
         return iter->second;
     }
 
@@ -1687,6 +1693,13 @@ namespace {
         std::ranges::transform(data, data.begin(), scale);
     }
 
+    std::pair<double, double> UnitSystem::from_si_factor_offset( measure m ) const {
+        return {
+            this->measure_table_from_si[ static_cast< int >( m ) ],
+            this->measure_table_to_si_offset[ static_cast< int >( m ) ]
+        };
+    }
+
     const char* UnitSystem::name( measure m ) const {
         return this->unit_name_table[ static_cast< int >( m ) ];
     }
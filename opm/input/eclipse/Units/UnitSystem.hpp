@@ -27,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -125,6 +126,12 @@ namespace Opm {
         double to_si( measure, double ) const;
         void from_si( measure, std::vector<double>& ) const;
         void to_si( measure, std::vector<double>& ) const;
+
+        /// Scale factor and offset of the conversion performed by
+        /// from_si(m, x), i.e., from_si(m, x) == (x - offset) * factor.
+        /// For callers which convert values while streaming them.
+        std::pair<double, double> from_si_factor_offset( measure m ) const;
+
         const char* name( measure ) const;
         std::string deck_name() const;
         std::size_t use_count() const;
@@ -0,0 +1,274 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_ARRAY_VIEW_HPP
+#define OPM_IO_ARRAY_VIEW_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EndianConversion.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+class MappedFile;
+
+/// Read-only, random access view of a numeric or logical array stored in
+/// a binary ECLIPSE-style file.
+///
+/// Elements are converted from big-endian on-disk representation when
+/// accessed.  No array data is copied or cached, and the view remains
+/// valid for as long as it exists, independently of the EclFile object
+/// which created it.  Use copy() or toVector() for bulk conversion.
+///
+/// Supported element types are int (INTE), float (REAL), double (DOUB)
+/// and bool (LOGI).
+template <typename T>
+class ArrayView
+{
+    static_assert(std::is_same_v<T, int>   || std::is_same_v<T, float> ||
+                  std::is_same_v<T, double>|| std::is_same_v<T, bool>,
+                  "ArrayView supports int, float, double and bool only");
+
+    /// On-disk element representation.
+    using Raw = std::conditional_t<std::is_same_v<T, double>, std::uint64_t, std::uint32_t>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /// Random access iterator over converted element values.
+    class const_iterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = T;
+        using pointer = void;
+
+        const_iterator() = default;
+        const_iterator(const ArrayView* view, const std::size_t i)
+            : view_ { view }, i_ { static_cast<difference_type>(i) }
+        {}
+
+        T operator*() const { return (*this->view_)[this->i_]; }
+        T operator[](const difference_type n) const { return (*this->view_)[this->i_ + n]; }
+
+        const_iterator& operator++() { ++this->i_; return *this; }
+        const_iterator& operator--() { --this->i_; return *this; }
+        const_iterator operator++(int) { auto t = *this; ++this->i_; return t; }
+        const_iterator operator--(int) { auto t = *this; --this->i_; return t; }
+
+        const_iterator& operator+=(const difference_type n) { this->i_ += n; return *this; }
+        const_iterator& operator-=(const difference_type n) { this->i_ -= n; return *this; }
+
+        friend const_iterator operator+(const_iterator it, const difference_type n) { return it += n; }
+        friend const_iterator operator+(const difference_type n, const_iterator it) { return it += n; }
+        friend const_iterator operator-(const_iterator it, const difference_type n) { return it -= n; }
+
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b)
+        { return a.i_ - b.i_; }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b)
+        { return a.i_ == b.i_; }
+
+        friend auto operator<=>(const const_iterator& a, const const_iterator& b)
+        { return a.i_ <=> b.i_; }
+
+    private:
+        const ArrayView* view_{nullptr};
+        difference_type i_{0};
+    };
+
+    /// Default constructor.  Empty view.
+    ArrayView() = default;
+
+    /// Constructor.
+    ///
+    /// Normally invoked through EclFile::getView().
+    ///
+    /// \param[in] data Start of array data in file, i.e., the record
+    ///   marker preceding the first data block.
+    ///
+    /// \param[in] size Number of array elements.
+    ///
+    /// \param[in] file Owner of \p data.  Kept alive by the view.
+    ArrayView(const unsigned char* data,
+              const std::size_t size,
+              std::shared_ptr<const MappedFile> file)
+        : data_ { data }
+        , size_ { size }
+        , file_ { std::move(file) }
+    {}
+
+    std::size_t size() const { return this->size_; }
+    bool empty() const { return this->size_ == 0; }
+
+    const_iterator begin() const { return { this, 0 }; }
+    const_iterator end() const { return { this, this->size_ }; }
+
+    /// Element value.  No bounds checking.
+    T operator[](const std::size_t i) const
+    {
+        auto raw = Raw{};
+        std::memcpy(&raw, this->elementAddress(i), sizeof raw);
+
+        return convert(raw);
+    }
+
+    /// Element value.  Throws std::out_of_range if \p i >= size().
+    T at(const std::size_t i) const
+    {
+        if (i >= this->size_) {
+            throw std::out_of_range {
+                "Array view index " + std::to_string(i) +
+                " out of bounds [0, " + std::to_string(this->size_) + ")"
+            };
+        }
+
+        return (*this)[i];
+    }
+
+    /// Convert a range of elements.
+    ///
+    /// \param[in] first Index of first element to convert.
+    ///
+    /// \param[out] dest Destination.  Receives min(dest.size(), size() -
+    ///   first) elements.
+    ///
+    /// \return Number of converted elements.
+    std::size_t copy(std::size_t first, std::span<T> dest) const
+    {
+        const auto n = (first < this->size_)
+            ? std::min(dest.size(), this->size_ - first)
+            : std::size_t{0};
+
+        auto done = std::size_t{0};
+        while (done < n) {
+            const auto i = first + done;
+            const auto count = std::min(n - done, perBlock - i % perBlock);
+
+            const auto* src = this->elementAddress(i);
+
+            if constexpr (std::is_same_v<T, bool>) {
+                for (auto k = 0*count; k < count; ++k) {
+                    auto raw = Raw{};
+                    std::memcpy(&raw, src + k*sizeof(Raw), sizeof raw);
+                    dest[done + k] = convert(raw);
+                }
+            }
+            else if constexpr (sizeof(Raw) == 4) {
+                byteSwap32(src, dest.data() + done, count, defaultByteSwapKernel());
+            }
+            else {
+                byteSwap64(src, dest.data() + done, count, defaultByteSwapKernel());
+            }
+
+            done += count;
+        }
+
+        return n;
+    }
+
+    /// Convert all elements.
+    std::vector<T> toVector() const
+    {
+        auto v = std::vector<T>(this->size_);
+
+        if constexpr (std::is_same_v<T, bool>) {
+            for (auto i = 0*this->size_; i < this->size_; ++i) {
+                v[i] = (*this)[i];
+            }
+        }
+        else {
+            this->copy(0, std::span<T>{ v });
+        }
+
+        return v;
+    }
+
+    /// Number of elements in each full on-disk block.
+    static constexpr std::size_t perBlock =
+        (std::is_same_v<T, double> ? MaxBlockSizeDoub : MaxBlockSizeInte) / sizeof(Raw);
+
+    /// Number of bytes, including record markers, in each full on-disk
+    /// block.
+    static constexpr std::size_t blockStride = perBlock * sizeof(Raw) + 2 * sizeof(std::int32_t);
+
+private:
+    /// Start of array data in file.
+    const unsigned char* data_{nullptr};
+
+    /// Number of array elements.
+    std::size_t size_{0};
+
+    /// Owner of array data.
+    std::shared_ptr<const MappedFile> file_{};
+
+    const unsigned char* elementAddress(const std::size_t i) const
+    {
+        return this->data_
+            + (i / perBlock) * blockStride
+            + sizeof(std::int32_t)
+            + (i % perBlock) * sizeof(Raw);
+    }
+
+    static T convert(const Raw raw)
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            // Both ECLIPSE and IX representations of 'true' are non-zero.
+            return raw != false_value;
+        }
+        else {
+            return std::bit_cast<T>(byteSwap(raw));
+        }
+    }
+
+    // Recognised as a single byte swap instruction by common compilers.
+    // Avoids including EclUtil.hpp, whose free functions would otherwise
+    // leak into every user of EclFile.hpp.
+    static Raw byteSwap(Raw raw)
+    {
+        auto swapped = Raw{0};
+        for (std::size_t b = 0; b < sizeof(Raw); ++b) {
+            swapped = static_cast<Raw>((swapped << 8) | (raw & 0xff));
+            raw >>= 8;
+        }
+
+        return swapped;
+    }
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ARRAY_VIEW_HPP
@@ -0,0 +1,1080 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/CompressedRestart.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/PaddedOutputString.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    using Opm::EclIO::CompressedRestart::Entry;
+
+    constexpr auto fileMagic   = std::array<char, 8>{ 'O', 'P', 'M', 'Z', 'R', 'S', 'T', ' ' };
+    constexpr auto footerMagic = std::array<char, 8>{ 'O', 'P', 'M', 'Z', 'I', 'D', 'X', ' ' };
+
+    /// File format version.  Increment if layout changes.
+    constexpr std::uint32_t formatVersion = 1;
+
+    /// Detects files created on machines of different byte order.
+    constexpr std::uint32_t byteOrderMark = 0x01020304u;
+
+    /// Magic, version and byte order mark.
+    constexpr std::uint64_t headerSize = 16;
+
+    /// Magic and index position.
+    constexpr std::uint64_t footerSize = 16;
+
+    /// Name, type, element size, size, report step, depth, reference and
+    /// data position of a single array in the index.
+    constexpr std::uint64_t indexEntrySize = 48;
+
+    /// Nominal number of uncompressed bytes in a single block.
+    constexpr std::size_t blockBytes = std::size_t{1} << 16;
+
+    /// Block table flag of blocks stored without run-length encoding.
+    constexpr std::uint32_t storedFlag = std::uint32_t{1} << 31;
+
+    // -----------------------------------------------------------------------
+
+    template <typename T>
+    void put(std::ostream& os, const T& x)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        os.write(reinterpret_cast<const char*>(&x), sizeof x);
+    }
+
+    template <typename T>
+    T take(std::istream& is)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        auto x = T{};
+        if (! is.read(reinterpret_cast<char*>(&x), sizeof x)) {
+            throw std::runtime_error { "Compressed restart file is truncated" };
+        }
+
+        return x;
+    }
+
+    /// Number of bytes per element in the uncompressed representation.
+    std::size_t elementBytes(const Entry& e)
+    {
+        switch (e.type) {
+        case Opm::EclIO::DOUB: return 8;
+        case Opm::EclIO::CHAR:
+        case Opm::EclIO::C0NN: return static_cast<std::size_t>(e.elementSize);
+        case Opm::EclIO::MESS: return 0;
+        default:               return 4;
+        }
+    }
+
+    /// Number of bytes gathered together by the byte shuffle.  One, i.e.,
+    /// no shuffle, for character data.
+    std::size_t shuffleWidth(const Entry& e)
+    {
+        switch (e.type) {
+        case Opm::EclIO::DOUB: return 8;
+        case Opm::EclIO::INTE:
+        case Opm::EclIO::REAL:
+        case Opm::EclIO::LOGI: return 4;
+        default:               return 1;
+        }
+    }
+
+    std::size_t elementsPerBlock(const Entry& e)
+    {
+        return std::max(blockBytes / std::max(elementBytes(e), std::size_t{1}),
+                        std::size_t{1});
+    }
+
+    std::size_t numBlocks(const Entry& e)
+    {
+        if (elementBytes(e) == 0) {
+            return 0;
+        }
+
+        const auto n = static_cast<std::size_t>(e.size);
+        const auto perBlock = elementsPerBlock(e);
+
+        return (n + perBlock - 1) / perBlock;
+    }
+
+    // -----------------------------------------------------------------------
+
+    /// Gather byte k of each element into plane k.
+    void shuffle(std::span<const unsigned char> in,
+                 const std::size_t              width,
+                 std::vector<unsigned char>&    out)
+    {
+        out.resize(in.size());
+
+        if (width == 1) {
+            std::copy(in.begin(), in.end(), out.begin());
+            return;
+        }
+
+        const auto n = in.size() / width;
+        for (auto k = 0*width; k < width; ++k) {
+            for (auto i = 0*n; i < n; ++i) {
+                out[k*n + i] = in[i*width + k];
+            }
+        }
+    }
+
+    void unshuffle(std::span<const unsigned char> in,
+                   const std::size_t              width,
+                   std::span<unsigned char>       out)
+    {
+        if (width == 1) {
+            std::copy(in.begin(), in.end(), out.begin());
+            return;
+        }
+
+        const auto n = in.size() / width;
+        for (auto k = 0*width; k < width; ++k) {
+            for (auto i = 0*n; i < n; ++i) {
+                out[i*width + k] = in[k*n + i];
+            }
+        }
+    }
+
+    /// Run-length encoding.
+    ///
+    /// Control byte c < 128 is followed by c + 1 literal bytes.  Control
+    /// byte c >= 128 is followed by a single byte repeated c - 125 times.
+    void encodeRuns(std::span<const unsigned char> in,
+                    std::vector<unsigned char>&    out)
+    {
+        constexpr auto minRun = std::size_t{3};
+        constexpr auto maxRun = std::size_t{130};
+        constexpr auto maxLiteral = std::size_t{128};
+
+        auto runLength = [&in](const std::size_t i)
+        {
+            auto n = std::size_t{1};
+            while ((i + n < in.size()) && (n < maxRun) && (in[i + n] == in[i])) {
+                ++n;
+            }
+
+            return n;
+        };
+
+        out.clear();
+
+        auto i = std::size_t{0};
+        while (i < in.size()) {
+            const auto run = runLength(i);
+            if (run >= minRun) {
+                out.push_back(static_cast<unsigned char>(128 + run - minRun));
+                out.push_back(in[i]);
+                i += run;
+                continue;
+            }
+
+            const auto start = i;
+            while ((i < in.size()) && (i - start < maxLiteral) &&
+                   ((i == start) || (runLength(i) < minRun)))
+            {
+                ++i;
+            }
+
+            out.push_back(static_cast<unsigned char>(i - start - 1));
+            out.insert(out.end(), in.begin() + start, in.begin() + i);
+        }
+    }
+
+    void decodeRuns(std::span<const unsigned char> in,
+                    std::span<unsigned char>       out)
+    {
+        auto corrupt = []()
+        {
+            return std::runtime_error { "Corrupt block in compressed restart file" };
+        };
+
+        auto o = std::size_t{0};
+        for (auto i = std::size_t{0}; i < in.size();) {
+            const auto c = std::size_t{in[i++]};
+
+            if (c < 128) {
+                const auto n = c + 1;
+                if ((i + n > in.size()) || (o + n > out.size())) {
+                    throw corrupt();
+                }
+
+                std::copy_n(in.begin() + i, n, out.begin() + o);
+                i += n;  o += n;
+            }
+            else {
+                const auto n = c - 125;
+                if ((i >= in.size()) || (o + n > out.size())) {
+                    throw corrupt();
+                }
+
+                std::fill_n(out.begin() + o, n, in[i++]);
+                o += n;
+            }
+        }
+
+        if (o != out.size()) {
+            throw corrupt();
+        }
+    }
+
+    // -----------------------------------------------------------------------
+
+    template <typename T>
+    std::vector<unsigned char> rawBytes(const std::vector<T>& data)
+    {
+        auto raw = std::vector<unsigned char>(data.size() * sizeof(T));
+        if (! data.empty()) {
+            std::memcpy(raw.data(), data.data(), raw.size());
+        }
+
+        return raw;
+    }
+
+    std::vector<unsigned char> rawBytes(const std::vector<bool>& data)
+    {
+        auto values = std::vector<std::int32_t>(data.size());
+        std::transform(data.begin(), data.end(), values.begin(),
+                       [](const bool b) { return b ? 1 : 0; });
+
+        return rawBytes(values);
+    }
+
+    std::vector<unsigned char> rawBytes(const std::vector<std::string>& data,
+                                        const std::size_t               width)
+    {
+        auto raw = std::vector<unsigned char>(data.size() * width, ' ');
+
+        for (auto i = 0*data.size(); i < data.size(); ++i) {
+            std::copy_n(data[i].begin(), std::min(data[i].size(), width),
+                        raw.begin() + i*width);
+        }
+
+        return raw;
+    }
+
+    // -----------------------------------------------------------------------
+
+    void writeHeader(std::ostream& os)
+    {
+        os.write(fileMagic.data(), fileMagic.size());
+        put(os, formatVersion);
+        put(os, byteOrderMark);
+    }
+
+    void writeIndex(std::ostream& os, const std::vector<Entry>& entries)
+    {
+        os.seekp(0, std::ios_base::end);
+        const auto indexPos = static_cast<std::uint64_t>(os.tellp());
+
+        put(os, static_cast<std::uint64_t>(entries.size()));
+
+        for (const auto& e : entries) {
+            auto name = std::array<char, 8>{};
+            name.fill(' ');
+            std::copy_n(e.name.begin(), std::min(e.name.size(), name.size()), name.begin());
+
+            os.write(name.data(), name.size());
+            put(os, static_cast<std::int32_t>(e.type));
+            put(os, static_cast<std::int32_t>(e.elementSize));
+            put(os, static_cast<std::int64_t>(e.size));
+            put(os, static_cast<std::int32_t>(e.seqnum));
+            put(os, static_cast<std::int32_t>(e.depth));
+            put(os, static_cast<std::int64_t>(e.reference));
+            put(os, static_cast<std::uint64_t>(e.dataPos));
+        }
+
+        os.write(footerMagic.data(), footerMagic.size());
+        put(os, indexPos);
+    }
+
+    struct Contents
+    {
+        std::vector<Entry> entries{};
+        std::uint64_t indexPos{0};
+        std::uint64_t endPos{0};
+    };
+
+    /// Array index of complete companion file.  Nullopt if the file is not
+    /// a companion file or if it was not closed properly.
+    std::optional<Contents> readIndex(std::istream& is)
+    {
+        auto magic = std::array<char, 8>{};
+
+        is.seekg(0, std::ios_base::end);
+        const auto endPos = static_cast<std::uint64_t>(is.tellg());
+        if (endPos < headerSize + footerSize + sizeof(std::uint64_t)) {
+            return std::nullopt;
+        }
+
+        is.seekg(0, std::ios_base::beg);
+        if (! is.read(magic.data(), magic.size()) || (magic != fileMagic)) {
+            return std::nullopt;
+        }
+
+        if (take<std::uint32_t>(is) != formatVersion) {
+            throw std::runtime_error {
+                "Unsupported compressed restart file version"
+            };
+        }
+
+        if (take<std::uint32_t>(is) != byteOrderMark) {
+            throw std::runtime_error {
+                "Compressed restart file created on machine of different byte order"
+            };
+        }
+
+        is.seekg(endPos - footerSize, std::ios_base::beg);
+        if (! is.read(magic.data(), magic.size()) || (magic != footerMagic)) {
+            return std::nullopt;
+        }
+
+        auto contents = Contents{};
+        contents.indexPos = take<std::uint64_t>(is);
+        contents.endPos = endPos;
+
+        if ((contents.indexPos < headerSize) || (contents.indexPos >= endPos - footerSize)) {
+            return std::nullopt;
+        }
+
+        is.seekg(contents.indexPos, std::ios_base::beg);
+
+        // Bound the entry count by the size of the index before allocating.
+        const auto indexBytes = endPos - footerSize - contents.indexPos;
+        const auto numEntries = take<std::uint64_t>(is);
+        if ((indexBytes < sizeof(std::uint64_t)) ||
+            (numEntries > (indexBytes - sizeof(std::uint64_t)) / indexEntrySize))
+        {
+            throw std::runtime_error { "Corrupt compressed restart file index" };
+        }
+
+        contents.entries.reserve(numEntries);
+
+        for (auto i = 0*numEntries; i < numEntries; ++i) {
+            auto name = std::array<char, 8>{};
+            if (! is.read(name.data(), name.size())) {
+                throw std::runtime_error { "Compressed restart file is truncated" };
+            }
+
+            auto& e = contents.entries.emplace_back();
+            e.name = Opm::EclIO::trimr(std::string(name.data(), name.size()));
+            e.type = static_cast<Opm::EclIO::eclArrType>(take<std::int32_t>(is));
+            e.elementSize = take<std::int32_t>(is);
+            e.size = take<std::int64_t>(is);
+            e.seqnum = take<std::int32_t>(is);
+            e.depth = take<std::int32_t>(is);
+            e.reference = take<std::int64_t>(is);
+            e.dataPos = take<std::uint64_t>(is);
+
+            if ((e.reference >= static_cast<std::int64_t>(i)) || (e.dataPos >= contents.indexPos)) {
+                throw std::runtime_error { "Corrupt compressed restart file index" };
+            }
+        }
+
+        return contents;
+    }
+
+    /// Uncompressed bytes of blocks [firstBlock, lastBlock) of a single
+    /// array, including any chain of differences.
+    std::vector<unsigned char>
+    decodeBlocks(std::istream&             is,
+                 const std::vector<Entry>& entries,
+                 const std::size_t         arrIndex,
+                 const std::size_t         firstBlock,
+                 const std::size_t         lastBlock)
+    {
+        const auto& e = entries[arrIndex];
+
+        const auto nBlocks = numBlocks(e);
+        const auto eBytes = elementBytes(e);
+        const auto perBlock = elementsPerBlock(e);
+        const auto n = static_cast<std::size_t>(e.size);
+
+        const auto firstElem = firstBlock * perBlock;
+        const auto lastElem = std::min(lastBlock * perBlock, n);
+
+        auto raw = std::vector<unsigned char>((lastElem - firstElem) * eBytes);
+        if (raw.empty()) {
+            return raw;
+        }
+
+        is.seekg(e.dataPos, std::ios_base::beg);
+        if (take<std::uint32_t>(is) != nBlocks) {
+            throw std::runtime_error { "Corrupt compressed restart file block table" };
+        }
+
+        auto table = std::vector<std::uint32_t>(nBlocks);
+        for (auto& size : table) {
+            size = take<std::uint32_t>(is);
+        }
+
+        auto pos = e.dataPos + sizeof(std::uint32_t) * (nBlocks + 1);
+        for (auto b = std::size_t{0}; b < firstBlock; ++b) {
+            pos += table[b] & ~storedFlag;
+        }
+
+        is.seekg(pos, std::ios_base::beg);
+
+        auto payload = std::vector<unsigned char>{};
+        auto shuffled = std::vector<unsigned char>{};
+
+        for (auto b = firstBlock; b < lastBlock; ++b) {
+            payload.resize(table[b] & ~storedFlag);
+            if (! is.read(reinterpret_cast<char*>(payload.data()), payload.size())) {
+                throw std::runtime_error { "Compressed restart file is truncated" };
+            }
+
+            const auto begin = (b*perBlock - firstElem) * eBytes;
+            const auto end = (std::min((b + 1)*perBlock, n) - firstElem) * eBytes;
+            const auto dest = std::span<unsigned char>{ raw.data() + begin, end - begin };
+
+            if ((table[b] & storedFlag) != 0) {
+                if (payload.size() != dest.size()) {
+                    throw std::runtime_error { "Corrupt block in compressed restart file" };
+                }
+
+                shuffled.swap(payload);
+            }
+            else {
+                shuffled.resize(dest.size());
+                decodeRuns(payload, shuffled);
+            }
+
+            unshuffle(shuffled, shuffleWidth(e), dest);
+        }
+
+        if (e.reference >= 0) {
+            const auto ref = decodeBlocks(is, entries, static_cast<std::size_t>(e.reference),
+                                          firstBlock, lastBlock);
+
+            std::transform(raw.begin(), raw.end(), ref.begin(), raw.begin(),
+                           [](const unsigned char x, const unsigned char y)
+                           { return static_cast<unsigned char>(x ^ y); });
+        }
+
+        return raw;
+    }
+
+    template <typename T>
+    std::vector<T> fromRaw(const std::vector<unsigned char>& raw)
+    {
+        auto values = std::vector<T>(raw.size() / sizeof(T));
+        if (! raw.empty()) {
+            std::memcpy(values.data(), raw.data(), raw.size());
+        }
+
+        return values;
+    }
+
+    std::ifstream openInput(const std::string& filename)
+    {
+        auto is = std::ifstream { filename, std::ios_base::in | std::ios_base::binary };
+        if (! is) {
+            throw std::runtime_error {
+                fmt::format("Can not open compressed restart file: {}", filename)
+            };
+        }
+
+        return is;
+    }
+
+} // Anonymous namespace
+
+// ===========================================================================
+
+std::string
+Opm::EclIO::CompressedRestart::companionName(const std::string& restartFile)
+{
+    return restartFile + ".OPMZ";
+}
+
+bool Opm::EclIO::CompressedRestart::isCompanionName(const std::string& filename)
+{
+    return std::filesystem::path { filename }.extension() == ".OPMZ";
+}
+
+// ===========================================================================
+
+Opm::EclIO::CompressedRestartWriter::
+CompressedRestartWriter(const std::string&                                 filename,
+                        const int                                          seqnum,
+                        const bool                                         existing,
+                        const int                                          keyframeInterval,
+                        std::shared_ptr<CompressedRestart::ReferenceCache> cache)
+    : filename_        { filename }
+    , seqnum_          { seqnum }
+    , keyframeInterval_{ std::max(keyframeInterval, 1) }
+    , cache_           { std::move(cache) }
+{
+    if (existing && std::filesystem::exists(filename)) {
+        this->openExisting();
+    }
+    else {
+        this->openNew();
+    }
+
+    if (this->cache_ != nullptr) {
+        this->cacheValid_ = ! this->entries_.empty()
+            && (this->cache_->filename == this->filename_)
+            && (this->cache_->seqnum == this->entries_.back().seqnum);
+
+        // Arrays are moved out of the cache while writing.  The cache is
+        // valid again once close() succeeds.
+        this->cache_->filename.clear();
+    }
+}
+
+Opm::EclIO::CompressedRestartWriter::~CompressedRestartWriter()
+{
+    try {
+        this->close();
+    }
+    catch (const std::exception&) {
+        // Companion file is incomplete and will be recreated when next
+        // written.  Readers reject incomplete files.
+    }
+}
+
+void Opm::EclIO::CompressedRestartWriter::openNew()
+{
+    this->file_.open(this->filename_, std::ios_base::out | std::ios_base::trunc |
+                     std::ios_base::binary);
+
+    if (! this->file_) {
+        throw std::runtime_error {
+            fmt::format("Unable to create compressed restart file {}", this->filename_)
+        };
+    }
+
+    writeHeader(this->file_);
+}
+
+void Opm::EclIO::CompressedRestartWriter::openExisting()
+{
+    auto contents = std::optional<Contents>{};
+    {
+        auto is = openInput(this->filename_);
+        try {
+            contents = readIndex(is);
+        }
+        catch (const std::exception&) {
+            contents.reset();
+        }
+    }
+
+    if (! contents.has_value()) {
+        // Incomplete or foreign file.  Start over.
+        this->openNew();
+        return;
+    }
+
+    // Drop report steps from seqnum onwards.  New data, and a new array
+    // index, is written from the position of the first dropped array.
+    auto& entries = contents->entries;
+    const auto firstDropped = std::ranges::find_if(entries, [this](const Entry& e)
+    { return e.seqnum >= this->seqnum_; });
+
+    const auto writePos = (firstDropped == entries.end())
+        ? contents->indexPos : firstDropped->dataPos;
+
+    entries.erase(firstDropped, entries.end());
+
+    std::filesystem::resize_file(this->filename_, writePos);
+
+    this->file_.open(this->filename_, std::ios_base::in | std::ios_base::out |
+                     std::ios_base::binary);
+
+    if (! this->file_) {
+        throw std::runtime_error {
+            fmt::format("Unable to open compressed restart file {}", this->filename_)
+        };
+    }
+
+    this->entries_ = std::move(entries);
+
+    if (! this->entries_.empty()) {
+        const auto lastStep = this->entries_.back().seqnum;
+        auto occurrence = std::map<std::string, int>{};
+
+        for (auto i = 0*this->entries_.size(); i < this->entries_.size(); ++i) {
+            const auto& e = this->entries_[i];
+            if (e.seqnum == lastStep) {
+                this->previous_.insert_or_assign({ e.name, occurrence[e.name]++ }, i);
+            }
+        }
+    }
+}
+
+void Opm::EclIO::CompressedRestartWriter::message(const std::string& msg)
+{
+    this->writeArray(msg, MESS, 4, 0, {});
+}
+
+void Opm::EclIO::CompressedRestartWriter::
+write(const std::string& name, const std::vector<int>& data)
+{
+    this->writeArray(name, INTE, 4, data.size(), rawBytes(data));
+}
+
+void Opm::EclIO::CompressedRestartWriter::
+write(const std::string& name, const std::vector<bool>& data)
+{
+    this->writeArray(name, LOGI, 4, data.size(), rawBytes(data));
+}
+
+void Opm::EclIO::CompressedRestartWriter::
+write(const std::string& name, const std::vector<float>& data)
+{
+    this->writeArray(name, REAL, 4, data.size(), rawBytes(data));
+}
+
+void Opm::EclIO::CompressedRestartWriter::
+write(const std::string& name, const std::vector<double>& data)
+{
+    this->writeArray(name, DOUB, 8, data.size(), rawBytes(data));
+}
+
+void Opm::EclIO::CompressedRestartWriter::
+write(const std::string& name, const std::vector<std::string>& data)
+{
+    auto width = std::size_t{sizeOfChar};
+    for (const auto& s : data) {
+        width = std::max(width, s.size());
+    }
+
+    const auto type = (width > static_cast<std::size_t>(sizeOfChar)) ? C0NN : CHAR;
+
+    this->writeArray(name, type, static_cast<int>(width),
+                     data.size(), rawBytes(data, width));
+}
+
+void Opm::EclIO::CompressedRestartWriter::
+write(const std::string& name, const std::vector<PaddedOutputString<8>>& data)
+{
+    auto strings = std::vector<std::string>{};
+    strings.reserve(data.size());
+
+    for (const auto& s : data) {
+        strings.emplace_back(s.c_str());
+    }
+
+    this->writeArray(name, CHAR, sizeOfChar, data.size(),
+                     rawBytes(strings, sizeOfChar));
+}
+
+namespace Opm { namespace EclIO {
+
+    template <typename T>
+    void CompressedRestartWriter::writeConverted(const std::string&            name,
+                                                 const std::span<const double> data,
+                                                 const double                  factor,
+                                                 const double                  offset)
+    {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                      "Converted arrays must be float or double");
+
+        auto raw = std::vector<unsigned char>(data.size() * sizeof(T));
+        for (auto i = 0*data.size(); i < data.size(); ++i) {
+            const auto x = static_cast<T>((data[i] - offset) * factor);
+            std::memcpy(raw.data() + i*sizeof(T), &x, sizeof(T));
+        }
+
+        if constexpr (std::is_same_v<T, float>) {
+            this->writeArray(name, REAL, 4, data.size(), std::move(raw));
+        }
+        else {
+            this->writeArray(name, DOUB, 8, data.size(), std::move(raw));
+        }
+    }
+
+    template void CompressedRestartWriter::writeConverted<float>(const std::string&, std::span<const double>, double, double);
+    template void CompressedRestartWriter::writeConverted<double>(const std::string&, std::span<const double>, double, double);
+
+}} // namespace Opm::EclIO
+
+void Opm::EclIO::CompressedRestartWriter::close()
+{
+    if (! this->file_.is_open()) {
+        return;
+    }
+
+    writeIndex(this->file_, this->entries_);
+
+    this->file_.close();
+    if (this->file_.fail()) {
+        throw std::runtime_error {
+            fmt::format("Failed to write compressed restart file {}", this->filename_)
+        };
+    }
+
+    if (this->cache_ != nullptr) {
+        this->cache_->filename = this->filename_;
+        this->cache_->seqnum = this->seqnum_;
+        this->cache_->arrays = std::move(this->current_);
+    }
+}
+
+std::vector<unsigned char>
+Opm::EclIO::CompressedRestartWriter::reference(const std::pair<std::string, int>& key,
+                                               const std::size_t                  index)
+{
+    const auto& e = this->entries_[index];
+
+    if (this->cacheValid_) {
+        auto pos = this->cache_->arrays.find(key);
+        if ((pos != this->cache_->arrays.end()) &&
+            (pos->second.size() == static_cast<std::size_t>(e.size * elementBytes(e))))
+        {
+            return std::move(pos->second);
+        }
+    }
+
+    return decodeBlocks(this->file_, this->entries_, index, 0, numBlocks(e));
+}
+
+void Opm::EclIO::CompressedRestartWriter::
+writeArray(const std::string&           name,
+           const eclArrType             type,
+           const int                    elementSize,
+           const std::int64_t           size,
+           std::vector<unsigned char>&& raw)
+{
+    auto entry = Entry { name, type, elementSize, size, this->seqnum_ };
+    const auto key = std::pair { name, this->occurrence_[name]++ };
+
+    // Form difference against the same array of the previous report step
+    // if the arrays are of the same shape and the chain of differences is
+    // not too long.  The difference is formed in the reference's buffer,
+    // so that 'raw' remains available for the cache.
+    auto diff = std::vector<unsigned char>{};
+
+    const auto prev = this->previous_.find(key);
+    if ((prev != this->previous_.end()) && (type != MESS)) {
+        const auto& p = this->entries_[prev->second];
+
+        if ((p.type == type) && (p.elementSize == elementSize) &&
+            (p.size == size) && (p.depth + 1 < this->keyframeInterval_))
+        {
+            diff = this->reference(key, prev->second);
+
+            std::transform(diff.begin(), diff.end(), raw.begin(), diff.begin(),
+                           [](const unsigned char x, const unsigned char y)
+                           { return static_cast<unsigned char>(x ^ y); });
+
+            entry.reference = static_cast<std::int64_t>(prev->second);
+            entry.depth = p.depth + 1;
+        }
+    }
+
+    const auto& data = (entry.reference >= 0) ? diff : raw;
+
+    this->file_.seekp(0, std::ios_base::end);
+    entry.dataPos = static_cast<std::uint64_t>(this->file_.tellp());
+
+    const auto nBlocks = numBlocks(entry);
+    const auto perBlock = elementsPerBlock(entry) * elementBytes(entry);
+
+    auto table = std::vector<std::uint32_t>(nBlocks);
+    auto payload = std::vector<unsigned char>{};
+    auto shuffled = std::vector<unsigned char>{};
+    auto encoded = std::vector<unsigned char>{};
+
+    for (auto b = 0*nBlocks; b < nBlocks; ++b) {
+        const auto begin = b * perBlock;
+        const auto end = std::min(begin + perBlock, data.size());
+
+        shuffle({ data.data() + begin, end - begin }, shuffleWidth(entry), shuffled);
+        encodeRuns(shuffled, encoded);
+
+        const auto& block = (encoded.size() < shuffled.size()) ? encoded : shuffled;
+
+        table[b] = static_cast<std::uint32_t>(block.size());
+        if (&block == &shuffled) {
+            table[b] |= storedFlag;
+        }
+
+        payload.insert(payload.end(), block.begin(), block.end());
+    }
+
+    put(this->file_, static_cast<std::uint32_t>(nBlocks));
+    for (const auto& blockSize : table) {
+        put(this->file_, blockSize);
+    }
+
+    this->file_.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+
+    if (! this->file_) {
+        throw std::runtime_error {
+            fmt::format("Failed to write array {} to compressed restart file {}",
+                        name, this->filename_)
+        };
+    }
+
+    this->entries_.push_back(std::move(entry));
+
+    if ((this->cache_ != nullptr) && (type != MESS)) {
+        this->current_.insert_or_assign(key, std::move(raw));
+    }
+}
+
+// ===========================================================================
+
+std::string
+Opm::EclIO::CompressedRestart::writeCompanionFile(const std::string& restartFile,
+                                                  const int          keyframeInterval)
+{
+    const auto companion = companionName(restartFile);
+
+    auto input = EclFile { restartFile };
+    const auto arrays = input.getList();
+
+    auto cache = std::make_shared<ReferenceCache>();
+    auto writer = std::unique_ptr<CompressedRestartWriter>{};
+
+    for (auto i = 0*arrays.size(); i < arrays.size(); ++i) {
+        const auto& [name, type, size] = arrays[i];
+        const auto arrIndex = static_cast<int>(i);
+
+        if ((name == "SEQNUM") && (type == INTE) && (size > 0)) {
+            const auto existing = writer != nullptr;
+            if (existing) {
+                writer->close();
+            }
+
+            writer = std::make_unique<CompressedRestartWriter>
+                (companion, input.get<int>(arrIndex).front(),
+                 existing, keyframeInterval, cache);
+        }
+
+        if (writer == nullptr) {
+            throw std::runtime_error {
+                fmt::format("Restart file {} does not start with SEQNUM", restartFile)
+            };
+        }
+
+        switch (type) {
+        case INTE: writer->write(name, input.get<int>(arrIndex));         break;
+        case REAL: writer->write(name, input.get<float>(arrIndex));       break;
+        case DOUB: writer->write(name, input.get<double>(arrIndex));      break;
+        case LOGI: writer->write(name, input.get<bool>(arrIndex));        break;
+        case C0NN: writer->write(name, input.get<std::string>(arrIndex)); break;
+        case MESS: writer->message(name);                                 break;
+
+        case CHAR: {
+            const auto& strings = input.get<std::string>(arrIndex);
+            writer->write(name, std::vector<PaddedOutputString<8>>(strings.begin(), strings.end()));
+            break;
+        }
+
+        default:
+            throw std::runtime_error {
+                fmt::format("Array {} of restart file {} has unsupported type",
+                            name, restartFile)
+            };
+        }
+    }
+
+    if (writer != nullptr) {
+        writer->close();
+    }
+
+    return companion;
+}
+
+// ===========================================================================
+
+Opm::EclIO::CompressedRestartFile::CompressedRestartFile(const std::string& filename)
+    : filename_ { filename }
+{
+    auto is = openInput(filename);
+
+    auto contents = readIndex(is);
+    if (! contents.has_value()) {
+        throw std::runtime_error {
+            fmt::format("File {} is not a complete compressed restart file", filename)
+        };
+    }
+
+    this->entries_ = std::move(contents->entries);
+    this->endPos_ = contents->endPos;
+}
+
+Opm::EclIO::EclIndex Opm::EclIO::CompressedRestartFile::index() const
+{
+    auto entries = std::vector<EclIndex::Entry>{};
+    entries.reserve(this->entries_.size());
+
+    for (const auto& e : this->entries_) {
+        entries.push_back({ e.name, e.type, e.elementSize, e.size, e.dataPos });
+    }
+
+    return { false, std::move(entries), this->endPos_ };
+}
+
+std::vector<unsigned char>
+Opm::EclIO::CompressedRestartFile::rawElements(const std::size_t arrIndex,
+                                               const std::size_t first,
+                                               const std::size_t count) const
+{
+    const auto& e = this->entries_.at(arrIndex);
+    const auto n = static_cast<std::size_t>(e.size);
+
+    if ((first > n) || (count > n - first)) {
+        throw std::out_of_range {
+            fmt::format("Element range [{}, {}) outside array {} of size {}",
+                        first, first + count, e.name, n)
+        };
+    }
+
+    if (count == 0) {
+        return {};
+    }
+
+    const auto perBlock = elementsPerBlock(e);
+    const auto firstBlock = first / perBlock;
+    const auto lastBlock = (first + count + perBlock - 1) / perBlock;
+
+    auto is = openInput(this->filename_);
+    auto raw = decodeBlocks(is, this->entries_, arrIndex, firstBlock, lastBlock);
+
+    const auto eBytes = elementBytes(e);
+    const auto skip = (first - firstBlock*perBlock) * eBytes;
+
+    return { raw.begin() + skip, raw.begin() + skip + count*eBytes };
+}
+
+namespace Opm::EclIO {
+
+template <typename T>
+std::vector<T>
+CompressedRestartFile::getRange(const std::size_t arrIndex,
+                                const std::size_t first,
+                                const std::size_t count) const
+{
+    auto expectType = INTE;
+    if constexpr (std::is_same_v<T, float>)  { expectType = REAL; }
+    if constexpr (std::is_same_v<T, double>) { expectType = DOUB; }
+    if constexpr (std::is_same_v<T, bool>)   { expectType = LOGI; }
+
+    if (this->entries_.at(arrIndex).type != expectType) {
+        throw std::runtime_error {
+            fmt::format("Array with index {} is of a different type", arrIndex)
+        };
+    }
+
+    const auto raw = this->rawElements(arrIndex, first, count);
+
+    if constexpr (std::is_same_v<T, bool>) {
+        const auto values = fromRaw<std::int32_t>(raw);
+        return { values.begin(), values.end() };
+    }
+    else {
+        return fromRaw<T>(raw);
+    }
+}
+
+template <typename T>
+std::vector<T> CompressedRestartFile::get(const std::size_t arrIndex) const
+{
+    if constexpr (std::is_same_v<T, std::string>) {
+        const auto& e = this->entries_.at(arrIndex);
+        if ((e.type != CHAR) && (e.type != C0NN)) {
+            throw std::runtime_error {
+                fmt::format("Array with index {} is not of type std::string", arrIndex)
+            };
+        }
+
+        const auto n = static_cast<std::size_t>(e.size);
+        const auto width = elementBytes(e);
+        const auto raw = this->rawElements(arrIndex, 0, n);
+
+        auto strings = std::vector<std::string>{};
+        strings.reserve(n);
+
+        for (auto i = 0*n; i < n; ++i) {
+            strings.push_back(trimr(std::string(reinterpret_cast<const char*>(raw.data()) + i*width, width)));
+        }
+
+        return strings;
+    }
+    else {
+        return this->getRange<T>(arrIndex, 0,
+                                 static_cast<std::size_t>(this->entries_.at(arrIndex).size));
+    }
+}
+
+template std::vector<int>         CompressedRestartFile::get<int>(std::size_t) const;
+template std::vector<float>       CompressedRestartFile::get<float>(std::size_t) const;
+template std::vector<double>      CompressedRestartFile::get<double>(std::size_t) const;
+template std::vector<bool>        CompressedRestartFile::get<bool>(std::size_t) const;
+template std::vector<std::string> CompressedRestartFile::get<std::string>(std::size_t) const;
+
+template std::vector<int>    CompressedRestartFile::getRange<int>(std::size_t, std::size_t, std::size_t) const;
+template std::vector<float>  CompressedRestartFile::getRange<float>(std::size_t, std::size_t, std::size_t) const;
+template std::vector<double> CompressedRestartFile::getRange<double>(std::size_t, std::size_t, std::size_t) const;
+template std::vector<bool>   CompressedRestartFile::getRange<bool>(std::size_t, std::size_t, std::size_t) const;
+
+} // namespace Opm::EclIO
+
+void Opm::EclIO::CompressedRestartFile::
+writeRestartFile(const std::string& restartFile, const bool formatted) const
+{
+    auto output = EclOutput { restartFile, formatted };
+
+    for (auto i = 0*this->entries_.size(); i < this->entries_.size(); ++i) {
+        const auto& e = this->entries_[i];
+
+        switch (e.type) {
+        case INTE: output.write(e.name, this->get<int>(i));         break;
+        case REAL: output.write(e.name, this->get<float>(i));       break;
+        case DOUB: output.write(e.name, this->get<double>(i));      break;
+        case LOGI: output.write(e.name, this->get<bool>(i));        break;
+        case CHAR: output.write(e.name, this->get<std::string>(i)); break;
+        case C0NN: output.write(e.name, this->get<std::string>(i), e.elementSize); break;
+        case MESS: output.message(e.name);                          break;
+        default:
+            throw std::runtime_error {
+                fmt::format("Unexpected type of array {} in compressed restart file", e.name)
+            };
+        }
+    }
+}
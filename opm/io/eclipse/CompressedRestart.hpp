@@ -0,0 +1,303 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_COMPRESSED_RESTART_HPP
+#define OPM_IO_COMPRESSED_RESTART_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclIndex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Opm::EclIO {
+
+template <std::size_t N> class PaddedOutputString;
+
+/// OPM-native compressed companion of an ECLIPSE-style restart file.
+///
+/// Many restart arrays, e.g., saturations and dissolution ratios away
+/// from the displacement fronts, change little between report steps.  The
+/// companion file, CASE.UNRST -> CASE.UNRST.OPMZ, holds the same arrays as
+/// the restart file, in the same order, but stores each array
+///
+///   -# as the bitwise difference (XOR) against the array of the same name
+///      and occurrence in the previous report step, unless the array starts
+///      a new chain of differences (key frame),
+///   -# byte shuffled, i.e., with byte k of all elements stored together,
+///   -# run-length encoded in independently decoded blocks of 64 KiB.
+///
+/// An array index at the end of the file gives random access to single
+/// arrays and to element ranges of a single array.  The number of arrays
+/// in a chain of differences is bounded by the key frame interval, which
+/// in turn bounds the amount of data decoded to read a single array.
+///
+/// The file uses the byte order of the machine that created it.
+namespace CompressedRestart {
+
+    /// Name of compressed companion of a restart file.
+    ///
+    /// \param[in] restartFile Name of restart file, e.g., CASE.UNRST.
+    std::string companionName(const std::string& restartFile);
+
+    /// Whether or not a file name refers to a compressed companion file.
+    bool isCompanionName(const std::string& filename);
+
+    /// Default maximum number of arrays in a chain of differences.
+    constexpr int defaultKeyframeInterval = 10;
+
+    /// Location and description of a single array in a companion file.
+    struct Entry
+    {
+        /// Array name.  Trailing blanks removed.
+        std::string name{};
+
+        /// Array element type.
+        eclArrType type{MESS};
+
+        /// Size, in bytes, of a single element in the restart file.
+        int elementSize{4};
+
+        /// Number of array elements.
+        std::int64_t size{0};
+
+        /// Report step, SEQNUM, to which the array belongs.
+        int seqnum{0};
+
+        /// Position in chain of differences.  Zero for key frames.
+        int depth{0};
+
+        /// Index of the array against which this array is stored as a
+        /// difference.  Negative for key frames.
+        std::int64_t reference{-1};
+
+        /// File position of the array's block table.
+        std::uint64_t dataPos{0};
+    };
+
+    /// Uncompressed arrays of the last report step written to a companion
+    /// file.
+    ///
+    /// Lets the writer of the next report step form differences without
+    /// reading back and decoding chains of differences from the file.
+    /// Holds one report step's worth of array data.
+    struct ReferenceCache
+    {
+        /// Name of companion file.  Empty if the cache holds no valid
+        /// report step.
+        std::string filename{};
+
+        /// Report step of the cached arrays.
+        int seqnum{0};
+
+        /// Raw bytes of each array, keyed by name and occurrence.
+        std::map<std::pair<std::string, int>, std::vector<unsigned char>> arrays{};
+    };
+
+} // namespace CompressedRestart
+
+/// Writer of compressed restart companion files.
+///
+/// Writes the arrays of a single report step.  Differences are formed
+/// against the last report step, prior to \c seqnum, already in the file.
+class CompressedRestartWriter
+{
+public:
+    /// Constructor.
+    ///
+    /// \param[in] filename Name of companion file.
+    ///
+    /// \param[in] seqnum Report step of arrays written to this object.
+    ///
+    /// \param[in] existing Whether or not to add to an existing companion
+    ///   file of a unified restart file.  Report steps from \p seqnum
+    ///   onwards are removed from the existing file.  A new file is
+    ///   created if the existing file is incomplete or missing.
+    ///
+    /// \param[in] keyframeInterval Maximum number of arrays in a chain of
+    ///   differences.  One disables differences.
+    ///
+    /// \param[in] cache Arrays of the previous report step.  Used if it
+    ///   holds the last report step of the existing file, and updated with
+    ///   the arrays of \p seqnum by close().  Null to decode the previous
+    ///   report step from the file.
+    CompressedRestartWriter(const std::string& filename,
+                            int                seqnum,
+                            bool               existing,
+                            int                keyframeInterval = CompressedRestart::defaultKeyframeInterval,
+                            std::shared_ptr<CompressedRestart::ReferenceCache> cache = {});
+
+    ~CompressedRestartWriter();
+
+    CompressedRestartWriter(const CompressedRestartWriter&) = delete;
+    CompressedRestartWriter& operator=(const CompressedRestartWriter&) = delete;
+
+    void message(const std::string& msg);
+
+    void write(const std::string& name, const std::vector<int>& data);
+    void write(const std::string& name, const std::vector<bool>& data);
+    void write(const std::string& name, const std::vector<float>& data);
+    void write(const std::string& name, const std::vector<double>& data);
+
+    /// Character data.  CHAR if no string is longer than eight characters,
+    /// C0NN otherwise.  Same convention as EclOutput.
+    void write(const std::string& name, const std::vector<std::string>& data);
+
+    void write(const std::string& name, const std::vector<PaddedOutputString<8>>& data);
+
+    /// Double precision data, output as (x - offset) * factor converted
+    /// to T.  Same result as write() of the converted values, without a
+    /// converted copy of the array.
+    template <typename T>
+    void writeConverted(const std::string&      name,
+                        std::span<const double> data,
+                        double                  factor,
+                        double                  offset);
+
+    /// Write array index and close file.  Called by the destructor, but
+    /// the destructor does not report errors.
+    void close();
+
+private:
+    std::string filename_{};
+    std::fstream file_{};
+    int seqnum_{0};
+    int keyframeInterval_{CompressedRestart::defaultKeyframeInterval};
+
+    /// All arrays in the file, including those of earlier report steps.
+    std::vector<CompressedRestart::Entry> entries_{};
+
+    /// Arrays of previous report step, keyed by name and occurrence.
+    std::map<std::pair<std::string, int>, std::size_t> previous_{};
+
+    /// Number of arrays of each name written at this report step.
+    std::map<std::string, int> occurrence_{};
+
+    /// Arrays of previous and, after close(), of this report step.  Null
+    /// if not caching.
+    std::shared_ptr<CompressedRestart::ReferenceCache> cache_{};
+
+    /// Whether or not cache_ holds the arrays referenced by previous_.
+    bool cacheValid_{false};
+
+    /// Raw bytes of arrays written at this report step, for cache_.
+    std::map<std::pair<std::string, int>, std::vector<unsigned char>> current_{};
+
+    /// Raw bytes of an array of the previous report step.
+    ///
+    /// \param[in] key Name and occurrence of array.
+    ///
+    /// \param[in] index Position of array in entries_.
+    std::vector<unsigned char> reference(const std::pair<std::string, int>& key,
+                                         std::size_t                        index);
+
+    void openExisting();
+    void openNew();
+
+    void writeArray(const std::string&                name,
+                    eclArrType                        type,
+                    int                               elementSize,
+                    std::int64_t                      size,
+                    std::vector<unsigned char>&&      raw);
+};
+
+namespace CompressedRestart {
+
+    /// Create the compressed companion of an existing unified restart
+    /// file, e.g., CASE.UNRST -> CASE.UNRST.OPMZ.  Replaces an existing
+    /// companion file.  Character arrays follow the EclOutput convention,
+    /// so C0NN arrays without strings longer than eight characters are
+    /// stored as CHAR.
+    ///
+    /// \param[in] restartFile Name of unified restart file.
+    ///
+    /// \param[in] keyframeInterval Maximum number of arrays in a chain of
+    ///   differences.
+    ///
+    /// \return Name of companion file.
+    std::string writeCompanionFile(const std::string& restartFile,
+                                   int                keyframeInterval = defaultKeyframeInterval);
+
+} // namespace CompressedRestart
+
+/// Reader of compressed restart companion files.
+///
+/// Opened files are not locked, and each read operation reopens the file.
+class CompressedRestartFile
+{
+public:
+    /// Constructor.
+    ///
+    /// Throws if \p filename is not a complete companion file.
+    explicit CompressedRestartFile(const std::string& filename);
+
+    const std::string& filename() const { return this->filename_; }
+
+    /// Array descriptors in order of appearance.
+    const std::vector<CompressedRestart::Entry>& entries() const
+    {
+        return this->entries_;
+    }
+
+    /// Array index in the form used by EclFile.  File positions refer to
+    /// the companion file.
+    EclIndex index() const;
+
+    /// All elements of a single array.
+    ///
+    /// \tparam T Element type.  int, float, double, bool or std::string,
+    ///   matching the array's type.
+    template <typename T>
+    std::vector<T> get(std::size_t arrIndex) const;
+
+    /// Elements [first, first + count) of a single numeric or logical
+    /// array.  Decodes only the blocks spanned by the range.
+    template <typename T>
+    std::vector<T> getRange(std::size_t arrIndex,
+                            std::size_t first,
+                            std::size_t count) const;
+
+    /// Write a standard restart file with the same arrays.
+    ///
+    /// \param[in] restartFile Name of output file.
+    ///
+    /// \param[in] formatted Whether or not to create a formatted file.
+    void writeRestartFile(const std::string& restartFile,
+                          bool               formatted) const;
+
+private:
+    std::string filename_{};
+    std::vector<CompressedRestart::Entry> entries_{};
+    std::uint64_t endPos_{0};
+
+    std::vector<unsigned char>
+    rawElements(std::size_t arrIndex,
+                std::size_t first,
+                std::size_t count) const;
+};
+
+}  // namespace Opm::EclIO
+
+#endif // OPM_IO_COMPRESSED_RESTART_HPP
@@ -19,6 +19,7 @@
 #include <opm/io/eclipse/EGrid.hpp>
 #include <opm/io/eclipse/EInit.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/EndianConversion.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
@@ -585,8 +586,8 @@ std::vector<float> EGrid::  get_zcorn_from_disk(int layer, bool bottom)
         std::vector<float> buf(next_block);
         fileH.read(reinterpret_cast<char*>(buf.data()), buf.size()*sizeof(float));
 
-        for (size_t n = 0; n < next_block; n++)
-            zcorn_layer.push_back(Opm::EclIO::flipEndianFloat(buf[n]));
+        Opm::EclIO::flipEndianArray(buf.data(), buf.size());
+        zcorn_layer.insert(zcorn_layer.end(), buf.begin(), buf.end());
 
         p1 = p1 + next_block;
 
@@ -31,7 +31,6 @@ namespace Opm::EclIO {
 
 ERft::ERft(const std::string &filename) : EclFile(filename)
 {
-    loadData();
     std::vector<int> first;
 
     std::vector<std::string> wellName;
@@ -39,24 +38,40 @@ ERft::ERft(const std::string &filename) : EclFile(filename)
 
     auto listOfArrays = getList();
 
+    // Only the small record headers are needed to index the file.  All
+    // other arrays are read from file on access through getRft().
+    {
+        std::vector<int> headerArrays;
+
+        for (size_t i = 0; i < listOfArrays.size(); i++) {
+            const auto& name = std::get<0>(listOfArrays[i]);
+
+            if ((name == "TIME") || (name == "DATE") || (name == "WELLETC")) {
+                headerArrays.push_back(i);
+            }
+        }
+
+        loadData(headerArrays);
+    }
+
     for (size_t i = 0; i < listOfArrays.size(); i++) {
         std::string name = std::get<0>(listOfArrays[i]);
 
         if (name == "TIME") {
             first.push_back(i);
-            auto vect1 = get<float>(i);
+            const auto& vect1 = get<float>(i);
             timeList.push_back(vect1[0]);
         }
 
         if (name == "DATE") {
-            auto vect1 = get<int>(i);
+            const auto& vect1 = get<int>(i);
             RftDate date(vect1[2],vect1[1],vect1[0]);
             dateList.insert(date);
             dates.push_back(date);
         }
 
         if (name == "WELLETC"){
-            auto vect1 = get<std::string>(i);
+            const auto& vect1 = get<std::string>(i);
             wellList.insert(vect1[1]);
             wellName.push_back(vect1[1]);
         }
@@ -187,7 +202,7 @@ int ERft::getArrayIndex(const std::string& name, int reportIndex) const
 }
 
 
-template<> const std::vector<float>&
+template<> std::vector<float>
 ERft::getRft<float>(const std::string& name, const std::string &wellName,
                     const RftDate& date) const
 {
@@ -199,12 +214,11 @@ ERft::getRft<float>(const std::string& name, const std::string &wellName,
                   "date and well, but called with wrong type");
     }
 
-    auto search_array = real_array.find(arrInd);
-    return search_array->second;
+    return readArray<float>(arrInd);
 }
 
 
-template<> const std::vector<double>&
+template<> std::vector<double>
 ERft::getRft<double>(const std::string& name, const std::string& wellName,
                      const RftDate& date) const
 {
@@ -216,12 +230,11 @@ ERft::getRft<double>(const std::string& name, const std::string& wellName,
                   "date and well, but called with wrong type");
     }
 
-    auto search_array = doub_array.find(arrInd);
-    return search_array->second;
+    return readArray<double>(arrInd);
 }
 
 
-template<> const std::vector<int>&
+template<> std::vector<int>
 ERft::getRft<int>(const std::string& name, const std::string& wellName,
                   const RftDate& date) const
 {
@@ -233,12 +246,11 @@ ERft::getRft<int>(const std::string& name, const std::string& wellName,
                   "date and well, but called with wrong type");
     }
 
-    auto search_array = inte_array.find(arrInd);
-    return search_array->second;
+    return readArray<int>(arrInd);
 }
 
 
-template<> const std::vector<bool>&
+template<> std::vector<bool>
 ERft::getRft<bool>(const std::string& name, const std::string& wellName,
                    const RftDate& date) const
 {
@@ -250,12 +262,11 @@ ERft::getRft<bool>(const std::string& name, const std::string& wellName,
                   "date and well, but called with wrong type");
     }
 
-    auto search_array = logi_array.find(arrInd);
-    return search_array->second;
+    return readArray<bool>(arrInd);
 }
 
 
-template<> const std::vector<std::string>&
+template<> std::vector<std::string>
 ERft::getRft<std::string>(const std::string& name, const std::string& wellName,
                           const RftDate& date) const
 {
@@ -267,12 +278,11 @@ ERft::getRft<std::string>(const std::string& name, const std::string& wellName,
                   "date and well, but called with wrong type");
     }
 
-    auto search_array = char_array.find(arrInd);
-    return search_array->second;
+    return readArray<std::string>(arrInd);
 }
 
 
-template<> const std::vector<int>&
+template<> std::vector<int>
 ERft::getRft<int>(const std::string& name, const std::string& wellName,
                   int year, int month, int day) const
 {
@@ -280,7 +290,7 @@ ERft::getRft<int>(const std::string& name, const std::string& wellName,
 }
 
 
-template<> const std::vector<float>&
+template<> std::vector<float>
 ERft::getRft<float>(const std::string& name, const std::string& wellName,
                     int year, int month, int day) const
 {
@@ -288,7 +298,7 @@ ERft::getRft<float>(const std::string& name, const std::string& wellName,
 }
 
 
-template<> const std::vector<double>&
+template<> std::vector<double>
 ERft::getRft<double>(const std::string& name, const std::string& wellName,
                      int year, int month, int day) const
 {
@@ -296,7 +306,7 @@ ERft::getRft<double>(const std::string& name, const std::string& wellName,
 }
 
 
-template<> const std::vector<std::string>&
+template<> std::vector<std::string>
 ERft::getRft<std::string>(const std::string& name, const std::string& wellName,
                           int year, int month, int day) const
 {
@@ -304,7 +314,7 @@ ERft::getRft<std::string>(const std::string& name, const std::string& wellName,
 }
 
 
-template<> const std::vector<bool>&
+template<> std::vector<bool>
 ERft::getRft<bool>(const std::string& name, const std::string& wellName,
                    int year, int month, int day) const
 {
@@ -312,7 +322,7 @@ ERft::getRft<bool>(const std::string& name, const std::string& wellName,
 }
 
 
-template<> const std::vector<float>&
+template<> std::vector<float>
 ERft::getRft<float>(const std::string& name, int reportIndex) const
 {
     int arrInd = getArrayIndex(name, reportIndex);
@@ -323,12 +333,11 @@ ERft::getRft<float>(const std::string& name, int reportIndex) const
                   "report, but called with wrong type");
     }
 
-    auto search_array = real_array.find(arrInd);
-    return search_array->second;
+    return readArray<float>(arrInd);
 }
 
 
-template<> const std::vector<double>&
+template<> std::vector<double>
 ERft::getRft<double>(const std::string& name, int reportIndex) const
 {
     int arrInd = getArrayIndex(name, reportIndex);
@@ -339,12 +348,11 @@ ERft::getRft<double>(const std::string& name, int reportIndex) const
                   "report, but called with wrong type");
     }
 
-    auto search_array = doub_array.find(arrInd);
-    return search_array->second;
+    return readArray<double>(arrInd);
 }
 
 
-template<> const std::vector<int>&
+template<> std::vector<int>
 ERft::getRft<int>(const std::string& name, int reportIndex) const
 {
     int arrInd = getArrayIndex(name, reportIndex);
@@ -355,12 +363,11 @@ ERft::getRft<int>(const std::string& name, int reportIndex) const
                   "report, but called with wrong type");
     }
 
-    auto search_array = inte_array.find(arrInd);
-    return search_array->second;
+    return readArray<int>(arrInd);
 }
 
 
-template<> const std::vector<bool>&
+template<> std::vector<bool>
 ERft::getRft<bool>(const std::string& name, int reportIndex) const
 {
     int arrInd = getArrayIndex(name, reportIndex);
@@ -371,12 +378,11 @@ ERft::getRft<bool>(const std::string& name, int reportIndex) const
                   "report, but called with wrong type");
     }
 
-    auto search_array = logi_array.find(arrInd);
-    return search_array->second;
+    return readArray<bool>(arrInd);
 }
 
 
-template<> const std::vector<std::string>&
+template<> std::vector<std::string>
 ERft::getRft<std::string>(const std::string& name, int reportIndex) const
 {
     int arrInd = getArrayIndex(name, reportIndex);
@@ -387,8 +393,7 @@ ERft::getRft<std::string>(const std::string& name, int reportIndex) const
                   "report, but called with wrong type");
     }
 
-    auto search_array = char_array.find(arrInd);
-    return search_array->second;
+    return readArray<std::string>(arrInd);
 }
 
 
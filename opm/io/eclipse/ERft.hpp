@@ -31,21 +31,46 @@
 
 namespace Opm { namespace EclIO {
 
+/// Reader for RFT files.
+///
+/// Only the TIME, DATE and WELLETC arrays of each RFT record are read when
+/// opening the file.  All other arrays are read from file on access through
+/// getRft(), and a side-car array index, if one is available, is used
+/// instead of scanning all array headers in the file.
+///
+/// getRft() returns copies of the arrays, and does not keep them in the
+/// array cache of EclFile, so the results stay valid independently of the
+/// cache's memory budget.  Consequently, each call reads and converts the
+/// array from file unless it was loaded through loadData() beforehand.
+/// getRft() is meant to be called once per array, keeping the result for
+/// as long as needed.  Callers which access the same arrays repeatedly
+/// should call loadData() first, in which case getRft() copies the arrays
+/// from memory.
 class ERft : public EclFile
 {
 public:
     explicit ERft(const std::string &filename);
 
     using RftDate = std::tuple<int,int,int>;
+
+    // Copy of RFT array.  Reads the array from file unless loaded.
     template <typename T>
-    const std::vector<T>& getRft(const std::string& name, const std::string& wellName,
-                                 const RftDate& date) const;
+    std::vector<T> getRft(const std::string& name, const std::string& wellName,
+                          const RftDate& date) const;
 
     template <typename T>
-    const std::vector<T>& getRft(const std::string& name, const std::string& wellName,
-                                 int year, int month, int day) const;
+    std::vector<T> getRft(const std::string& name, const std::string& wellName,
+                          int year, int month, int day) const;
+    template <typename T>
+    std::vector<T> getRft(const std::string& name, int reportIndex) const;
+
+    // Zero-copy view of RFT array, see EclFile::getView().
     template <typename T>
-    const std::vector<T>& getRft(const std::string& name, int reportIndex) const;
+    ArrayView<T> getRftView(const std::string& name, const std::string& wellName,
+                            const RftDate& date)
+    {
+        return this->getView<T>(this->getArrayIndex(name, wellName, date));
+    }
 
     std::vector<std::string> listOfWells() const;
     std::vector<RftDate> listOfdates() const;
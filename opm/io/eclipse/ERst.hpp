@@ -21,6 +21,7 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 
+#include <cstddef>
 #include <ios>
 #include <map>
 #include <string>
@@ -70,6 +71,24 @@ public:
     template <typename T>
     const std::vector<T>& getRestartData(int index, int reportStepNumber, const std::string& lgr_name);
 
+    // Zero-copy view of restart array, see EclFile::getView().  Does not
+    // load the report step.
+    template <typename T>
+    ArrayView<T> getRestartView(const std::string& name, int reportStepNumber, int occurrence = 0)
+    {
+        return this->getView<T>(this->getArrayIndex(name, reportStepNumber, occurrence));
+    }
+
+    // Copy of elements [first, first + count) of restart array, see
+    // EclFile::getRange().  Does not load the report step.
+    template <typename T>
+    std::vector<T> getRestartRange(const std::string& name, int reportStepNumber,
+                                   std::size_t first, std::size_t count, int occurrence = 0)
+    {
+        return this->getRange<T>(this->getArrayIndex(name, reportStepNumber, occurrence),
+                                 first, count);
+    }
+
     int occurrence_count(const std::string& name, int reportStepNumber) const;
     size_t numberOfReportSteps() const { return seqnum.size(); };
 
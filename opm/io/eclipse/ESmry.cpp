@@ -25,7 +25,9 @@
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclIndex.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/EndianConversion.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 
 #include <algorithm>
@@ -673,8 +675,7 @@ void ESmry::read_ministeps_from_disk()
         if (formattedFiles[specInd]) {
             ministep_value = read_ministep_formatted(fileH);
         } else {
-            std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-            auto ministep_vect = readBinaryArray<int,int>(fileH, 1, Opm::EclIO::INTE, f, sizeOfInte);
+            auto ministep_vect = readBinaryInteArray(fileH, 1);
             ministep_value = ministep_vect[0];
         }
 
@@ -919,6 +920,8 @@ void ESmry::loadData() const
             std::int64_t rest = static_cast<int64_t>(nParamsSpecFile[specInd]);
             std::size_t p = 0;
 
+            std::vector<float> block;
+
             while (rest > 0) {
                 int dhead;
                 fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
@@ -929,12 +932,13 @@ void ESmry::loadData() const
                     OPM_THROW(std::runtime_error, "??Error reading binary data, inconsistent header "
                                                   "data or incorrect number of elements");
 
-                for (int i = 0; i < num; ++i, ++p) {
-                    float value;
-                    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
+                block.resize(num);
+                fileH.read(reinterpret_cast<char*>(block.data()), num * sizeOfReal);
+                Opm::EclIO::flipEndianArray(block.data(), block.size());
 
+                for (int i = 0; i < num; ++i, ++p) {
                     if ((keywpos[p] > -1) && !vectorLoaded[keywpos[p]])
-                        vectorData[keywpos[p]].push_back(Opm::EclIO::flipEndianFloat(value));
+                        vectorData[keywpos[p]].push_back(block[i]);
                 }
 
                 rest -= num;
@@ -964,6 +968,19 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
 {
     std::vector<std::tuple <std::string, uint64_t>> resultVect;
 
+    if (const auto index = EclIndex::load(filename, formatted); index.has_value()) {
+        const auto& entries = index->entries();
+        resultVect.reserve(entries.size());
+
+        for (const auto& entry : entries) {
+            if (std::ranges::find(ignore_keyword_list, entry.name) == ignore_keyword_list.end()) {
+                resultVect.emplace_back(entry.name, entry.dataPos);
+            }
+        }
+
+        return resultVect;
+    }
+
     FILE *ptr;
     char arrName[9];
     char numstr[13];
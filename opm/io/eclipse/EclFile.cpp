@@ -17,15 +17,23 @@
    */
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/CompressedRestart.hpp>
+#include <opm/io/eclipse/EclIndex.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <cstring>
 #include <cstddef>
 #include <fstream>
+#include <memory>
+#include <stdexcept>
 #include <string>
 #include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <cmath>
 
 #include <fmt/format.h>
@@ -33,63 +41,40 @@
 namespace Opm { namespace EclIO {
 
 void EclFile::load(bool preload) {
-    std::fstream fileH;
-
-    if (formatted) {
-        fileH.open(this->inputFilename, std::ios::in);
-    } else {
-        fileH.open(this->inputFilename, std::ios::in |  std::ios::binary);
+    // Use side-car index of array headers if one exists and matches the
+    // current file contents.  Otherwise, visit every array header.
+    auto index = (this->compressed_ != nullptr)
+        ? std::optional<EclIndex>{ this->compressed_->index() }
+        : EclIndex::load(this->inputFilename, this->formatted);
+
+    if (! index.has_value()) {
+        index = EclIndex::scan(this->inputFilename, this->formatted);
     }
 
-    if (!fileH)
-        throw std::runtime_error(fmt::format("Can not open EclFile: {}", this->inputFilename));
-
-    int n = 0;
-    while (!isEOF(&fileH)) {
-        std::string arrName(8,' ');
-        eclArrType arrType;
-        std::int64_t num;
-        int sizeOfElement;
+    const auto& entries = index->entries();
+    const auto numArrays = entries.size();
 
-        try {
-            if (formatted) {
-                readFormattedHeader(fileH,arrName,num,arrType, sizeOfElement);
-            } else {
-                readBinaryHeader(fileH,arrName,num, arrType, sizeOfElement);
-            }
-        } catch (const std::exception& e){
-            OPM_THROW(std::runtime_error,
-                fmt::format("Unable to read array header from {}: {} \nPlease check if the file is corrupt!", this->inputFilename, e.what()));
-        }
+    array_size.reserve(numArrays);
+    array_type.reserve(numArrays);
+    array_name.reserve(numArrays);
+    array_element_size.reserve(numArrays);
+    ifStreamPos.reserve(numArrays + 1);
+    arrayLoaded.reserve(numArrays);
 
-        array_size.push_back(num);
-        array_type.push_back(arrType);
-        array_name.push_back(trimr(arrName));
-        array_element_size.push_back(sizeOfElement);
+    for (const auto& entry : entries) {
+        array_size.push_back(entry.size);
+        array_type.push_back(entry.type);
+        array_name.push_back(entry.name);
+        array_element_size.push_back(entry.elementSize);
 
-        array_index[array_name[n]] = n;
+        array_index[entry.name] = static_cast<int>(array_name.size()) - 1;
 
-        std::uint64_t pos = fileH.tellg();
-        ifStreamPos.push_back(pos);
+        ifStreamPos.push_back(entry.dataPos);
 
         arrayLoaded.push_back(false);
+    }
 
-        if (num > 0){
-            if (formatted) {
-                std::uint64_t sizeOfNextArray = sizeOnDiskFormatted(num, arrType, sizeOfElement);
-                fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
-            } else {
-                std::uint64_t sizeOfNextArray = sizeOnDiskBinary(num, arrType, sizeOfElement);
-                fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
-            }
-        }
-
-        n++;
-    };
-
-    fileH.seekg(0, std::ios_base::end);
-    this->ifStreamPos.push_back(static_cast<std::uint64_t>(fileH.tellg()));
-    fileH.close();
+    this->ifStreamPos.push_back(index->endPosition());
 
     if (preload)
         this->loadData();
@@ -107,6 +92,18 @@ EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool prelo
 EclFile::EclFile(const std::string& filename, bool preload) :
     inputFilename(filename)
 {
+    const auto companion = CompressedRestart::isCompanionName(filename)
+        ? filename : CompressedRestart::companionName(filename);
+
+    if ((companion == filename) ||
+        (!fileExists(filename) && fileExists(companion)))
+    {
+        this->compressed_ = std::make_shared<const CompressedRestartFile>(companion);
+        this->formatted = false;
+        this->load(preload);
+        return;
+    }
+
     if (!fileExists(filename))
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
 
@@ -145,7 +142,36 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
         break;
     }
 
-    arrayLoaded[arrIndex] = true;
+    this->markLoaded(static_cast<int>(arrIndex));
+}
+
+void EclFile::loadCompressedArray(std::size_t arrIndex)
+{
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array[arrIndex] = compressed_->get<int>(arrIndex);
+        break;
+    case REAL:
+        real_array[arrIndex] = compressed_->get<float>(arrIndex);
+        break;
+    case DOUB:
+        doub_array[arrIndex] = compressed_->get<double>(arrIndex);
+        break;
+    case LOGI:
+        logi_array[arrIndex] = compressed_->get<bool>(arrIndex);
+        break;
+    case CHAR:
+    case C0NN:
+        char_array[arrIndex] = compressed_->get<std::string>(arrIndex);
+        break;
+    case MESS:
+        break;
+    default:
+        OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
+        break;
+    }
+
+    this->markLoaded(static_cast<int>(arrIndex));
 }
 
 void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
@@ -177,12 +203,19 @@ void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrInde
         break;
     }
 
-    arrayLoaded[arrIndex] = true;
+    this->markLoaded(static_cast<int>(arrIndex));
 }
 
 
 void EclFile::loadData()
 {
+    if (compressed_) {
+        for (std::size_t i = 0; i < array_name.size(); i++) {
+            loadCompressedArray(i);
+        }
+
+        return;
+    }
 
     if (formatted) {
 
@@ -211,6 +244,15 @@ void EclFile::loadData()
 
 void EclFile::loadData(const std::string& name)
 {
+    if (compressed_) {
+        for (std::size_t i = 0; i < array_name.size(); i++) {
+            if (array_name[i] == name) {
+                loadCompressedArray(i);
+            }
+        }
+
+        return;
+    }
 
     if (formatted) {
 
@@ -256,6 +298,13 @@ void EclFile::loadData(const std::string& name)
 
 void EclFile::loadData(const std::vector<int>& arrIndex)
 {
+    if (compressed_) {
+        for (int ind : arrIndex) {
+            loadCompressedArray(ind);
+        }
+
+        return;
+    }
 
     if (formatted) {
 
@@ -295,6 +344,11 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
 
 void EclFile::loadData(int arrIndex)
 {
+    if (compressed_) {
+        loadCompressedArray(arrIndex);
+        return;
+    }
+
     if (formatted) {
 
         std::ifstream inFile(inputFilename);
@@ -335,6 +389,12 @@ bool EclFile::is_ix() const
     // Binary files,
     //   >> if logi array exists in file, look for IX spes binary representation of true value
 
+    if (compressed_) {
+        // Logical values are stored as zero or one in compressed files.
+        return std::ranges::any_of(array_type, [](const eclArrType type)
+                                   { return type == Opm::EclIO::C0NN; });
+    }
+
     if (formatted) {
         for (size_t n=0; n < array_type.size(); n++) {
             if (array_type[n] == Opm::EclIO::C0NN) {
@@ -438,6 +498,21 @@ std::vector<EclFile::EclEntry> EclFile::getList() const
 }
 
 
+EclIndex EclFile::index() const
+{
+    auto entries = std::vector<EclIndex::Entry>{};
+    entries.reserve(this->array_name.size());
+
+    for (std::size_t i = 0; i < this->array_name.size(); ++i) {
+        entries.push_back({ this->array_name[i], this->array_type[i],
+                            this->array_element_size[i], this->array_size[i],
+                            this->ifStreamPos[i] });
+    }
+
+    return { this->formatted, std::move(entries), this->ifStreamPos.back() };
+}
+
+
 template<>
 const std::vector<int>& EclFile::get<int>(int arrIndex)
 {
@@ -478,6 +553,109 @@ const std::vector<std::string>& EclFile::get<std::string>(int arrIndex)
 }
 
 
+template <typename T>
+std::vector<T> EclFile::readArray(const int arrIndex) const
+{
+    const auto type = array_type[arrIndex];
+
+    auto typeOk = false;
+    if constexpr (std::is_same_v<T, int>)    { typeOk = type == INTE; }
+    if constexpr (std::is_same_v<T, float>)  { typeOk = type == REAL; }
+    if constexpr (std::is_same_v<T, double>) { typeOk = type == DOUB; }
+    if constexpr (std::is_same_v<T, bool>)   { typeOk = type == LOGI; }
+    if constexpr (std::is_same_v<T, std::string>) { typeOk = (type == CHAR) || (type == C0NN); }
+
+    if (! typeOk) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array with index {} is not of the requested type", arrIndex));
+    }
+
+    if (arrayLoaded[arrIndex]) {
+        if constexpr (std::is_same_v<T, int>)    { return inte_array.at(arrIndex); }
+        if constexpr (std::is_same_v<T, float>)  { return real_array.at(arrIndex); }
+        if constexpr (std::is_same_v<T, double>) { return doub_array.at(arrIndex); }
+        if constexpr (std::is_same_v<T, bool>)   { return logi_array.at(arrIndex); }
+        if constexpr (std::is_same_v<T, std::string>) { return char_array.at(arrIndex); }
+    }
+
+    if (compressed_) {
+        return compressed_->get<T>(arrIndex);
+    }
+
+    const auto size = array_size[arrIndex];
+
+    if (formatted) {
+        std::ifstream inFile(inputFilename);
+        inFile.seekg(ifStreamPos[arrIndex]);
+
+        const std::size_t disk_size = sizeOnDiskFormatted(size, type, array_element_size[arrIndex]) + 1;
+        std::vector<char> buffer(disk_size);
+        inFile.read(buffer.data(), disk_size);
+
+        const auto fileStr = std::string(buffer.data(), disk_size);
+
+        if constexpr (std::is_same_v<T, int>)    { return readFormattedInteArray(fileStr, size, 0); }
+        if constexpr (std::is_same_v<T, float>)  { return readFormattedRealArray(fileStr, size, 0); }
+        if constexpr (std::is_same_v<T, double>) { return readFormattedDoubArray(fileStr, size, 0); }
+        if constexpr (std::is_same_v<T, bool>)   { return readFormattedLogiArray(fileStr, size, 0); }
+        if constexpr (std::is_same_v<T, std::string>) {
+            return readFormattedCharArray(fileStr, size, 0,
+                                          (type == CHAR) ? sizeOfChar : array_element_size[arrIndex]);
+        }
+    }
+
+    std::fstream fileH;
+    fileH.open(inputFilename, std::ios::in | std::ios::binary);
+
+    if (!fileH) {
+        OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
+    }
+
+    fileH.seekg(ifStreamPos[arrIndex], fileH.beg);
+
+    if constexpr (std::is_same_v<T, int>)    { return readBinaryInteArray(fileH, size); }
+    if constexpr (std::is_same_v<T, float>)  { return readBinaryRealArray(fileH, size); }
+    if constexpr (std::is_same_v<T, double>) { return readBinaryDoubArray(fileH, size); }
+    if constexpr (std::is_same_v<T, bool>)   { return readBinaryLogiArray(fileH, size); }
+    if constexpr (std::is_same_v<T, std::string>) {
+        return (type == CHAR)
+            ? readBinaryCharArray(fileH, size)
+            : readBinaryC0nnArray(fileH, size, array_element_size[arrIndex]);
+    }
+}
+
+template std::vector<int>         EclFile::readArray<int>(int) const;
+template std::vector<float>       EclFile::readArray<float>(int) const;
+template std::vector<double>      EclFile::readArray<double>(int) const;
+template std::vector<bool>        EclFile::readArray<bool>(int) const;
+template std::vector<std::string> EclFile::readArray<std::string>(int) const;
+
+template <typename T>
+std::vector<T> EclFile::getRange(const int arrIndex,
+                                 const std::size_t first,
+                                 const std::size_t count) const
+{
+    if (compressed_) {
+        return compressed_->getRange<T>(arrIndex, first, count);
+    }
+
+    const auto n = static_cast<std::size_t>(array_size[arrIndex]);
+    if ((first > n) || (count > n - first)) {
+        OPM_THROW(std::out_of_range,
+                  fmt::format("Element range [{}, {}) outside array {} of size {}",
+                              first, first + count, array_name[arrIndex], n));
+    }
+
+    const auto values = readArray<T>(arrIndex);
+    return { values.begin() + first, values.begin() + first + count };
+}
+
+template std::vector<int>    EclFile::getRange<int>(int, std::size_t, std::size_t) const;
+template std::vector<float>  EclFile::getRange<float>(int, std::size_t, std::size_t) const;
+template std::vector<double> EclFile::getRange<double>(int, std::size_t, std::size_t) const;
+template std::vector<bool>   EclFile::getRange<bool>(int, std::size_t, std::size_t) const;
+
+
 bool EclFile::hasKey(const std::string &name) const
 {
     auto search = array_index.find(name);
@@ -537,6 +715,12 @@ EclFile::seekPosition(const std::vector<std::string>::size_type arrIndex) const
     //       +------+------------+------+------+------+
     //
 
+    if (this->compressed_ != nullptr) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Array header positions not available in "
+                              "compressed file {}", this->compressed_->filename()));
+    }
+
     const auto headerSize = this->formatted ? 30ul : 24ul;
     const auto datapos    = this->ifStreamPos[arrIndex];
     const auto seekpos    = (datapos <= headerSize)
@@ -627,11 +811,199 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
     if (!arrayLoaded[arrIndex]) {
         loadData(arrIndex);
     }
+    else {
+        this->touch(arrIndex);
+    }
 
     return array.at(arrIndex);
 }
 
 
+template <typename T>
+ArrayView<T> EclFile::getView(int arrIndex)
+{
+    if (this->formatted) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Array views not supported for formatted file {}",
+                              this->inputFilename));
+    }
+
+    if (this->compressed_ != nullptr) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Array views not supported for compressed file {}",
+                              this->compressed_->filename()));
+    }
+
+    auto expectType = INTE;
+    auto typeStr = "int";
+    if constexpr (std::is_same_v<T, float>) {
+        expectType = REAL;  typeStr = "float";
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+        expectType = DOUB;  typeStr = "double";
+    }
+    else if constexpr (std::is_same_v<T, bool>) {
+        expectType = LOGI;  typeStr = "bool";
+    }
+
+    if (array_type[arrIndex] != expectType) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array with index {} is not of type {}", arrIndex, typeStr));
+    }
+
+    const auto begin = ifStreamPos[arrIndex];
+    const auto end = begin + sizeOnDiskBinary(array_size[arrIndex],
+                                              array_type[arrIndex],
+                                              array_element_size[arrIndex]);
+
+    // (Re-)map file if it did not exist, or was shorter, when last mapped.
+    if ((this->mapping_ == nullptr) || (this->mapping_->size() < end)) {
+        this->mapping_ = std::make_shared<const MappedFile>(this->inputFilename);
+    }
+
+    if (this->mapping_->size() < end) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array {} extends beyond end of file {}",
+                              array_name[arrIndex], this->inputFilename));
+    }
+
+    auto view = ArrayView<T> {
+        this->mapping_->data() + begin,
+        static_cast<std::size_t>(array_size[arrIndex]),
+        this->mapping_
+    };
+
+    // Validate leading record marker of each block.
+    const auto* block = this->mapping_->data() + begin;
+    for (auto rest = static_cast<std::size_t>(array_size[arrIndex]); rest > 0;) {
+        const auto num = std::min(rest, ArrayView<T>::perBlock);
+
+        int dhead;
+        std::memcpy(&dhead, block, sizeof dhead);
+
+        if (static_cast<std::size_t>(flipEndianInt(dhead)) != num * (sizeof(T) == 8 ? 8 : 4)) {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Error reading binary data, inconsistent header "
+                                  "data for array {} in {}",
+                                  array_name[arrIndex], this->inputFilename));
+        }
+
+        block += ArrayView<T>::blockStride;
+        rest -= num;
+    }
+
+    return view;
+}
+
+template <typename T>
+ArrayView<T> EclFile::getView(const std::string& name)
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("key '{}' not found", name));
+    }
+
+    return this->getView<T>(search->second);
+}
+
+template ArrayView<int>    EclFile::getView<int>(int);
+template ArrayView<float>  EclFile::getView<float>(int);
+template ArrayView<double> EclFile::getView<double>(int);
+template ArrayView<bool>   EclFile::getView<bool>(int);
+
+template ArrayView<int>    EclFile::getView<int>(const std::string&);
+template ArrayView<float>  EclFile::getView<float>(const std::string&);
+template ArrayView<double> EclFile::getView<double>(const std::string&);
+template ArrayView<bool>   EclFile::getView<bool>(const std::string&);
+
+
+void EclFile::setMemoryBudget(const std::size_t bytes)
+{
+    this->memoryBudget_ = bytes;
+    this->enforceMemoryBudget();
+}
+
+
+void EclFile::markLoaded(const int arrIndex)
+{
+    if (! arrayLoaded[arrIndex]) {
+        arrayLoaded[arrIndex] = true;
+        this->loadedBytes_ += this->loadedSize(arrIndex);
+
+        this->lru_.order.push_front(arrIndex);
+        this->lru_.position[arrIndex] = this->lru_.order.begin();
+    }
+    else {
+        this->touch(arrIndex);
+    }
+
+    this->enforceMemoryBudget();
+}
+
+
+void EclFile::touch(const int arrIndex)
+{
+    auto pos = this->lru_.position.find(arrIndex);
+    if (pos != this->lru_.position.end()) {
+        this->lru_.order.splice(this->lru_.order.begin(), this->lru_.order, pos->second);
+    }
+}
+
+
+void EclFile::evict(const int arrIndex)
+{
+    switch (array_type[arrIndex]) {
+    case INTE: inte_array.erase(arrIndex); break;
+    case REAL: real_array.erase(arrIndex); break;
+    case DOUB: doub_array.erase(arrIndex); break;
+    case LOGI: logi_array.erase(arrIndex); break;
+    case CHAR:
+    case C0NN: char_array.erase(arrIndex); break;
+    default: break;
+    }
+
+    auto pos = this->lru_.position.find(arrIndex);
+    if (pos != this->lru_.position.end()) {
+        this->lru_.order.erase(pos->second);
+        this->lru_.position.erase(pos);
+    }
+
+    this->loadedBytes_ -= std::min(this->loadedBytes_, this->loadedSize(arrIndex));
+    arrayLoaded[arrIndex] = false;
+}
+
+
+void EclFile::enforceMemoryBudget()
+{
+    if (this->memoryBudget_ == 0) {
+        return;
+    }
+
+    // Never evict the most recently used array.
+    while ((this->loadedBytes_ > this->memoryBudget_) && (this->lru_.order.size() > 1)) {
+        this->evict(this->lru_.order.back());
+    }
+}
+
+
+std::size_t EclFile::loadedSize(const int arrIndex) const
+{
+    const auto n = static_cast<std::size_t>(array_size[arrIndex]);
+
+    switch (array_type[arrIndex]) {
+    case INTE: return n * sizeof(int);
+    case REAL: return n * sizeof(float);
+    case DOUB: return n * sizeof(double);
+    case LOGI: return (n + 7) / 8;
+    case CHAR:
+    case C0NN: return n * (sizeof(std::string) + array_element_size[arrIndex]);
+    default:   return 0;
+    }
+}
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
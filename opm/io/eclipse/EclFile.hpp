@@ -19,10 +19,15 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/ArrayView.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclIndex.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -31,6 +36,9 @@
 
 namespace Opm { namespace EclIO {
 
+class CompressedRestartFile;
+class MappedFile;
+
 class EclFile
 {
 public:
@@ -38,10 +46,19 @@ public:
         bool value;
     };
 
+    /// Constructor.
+    ///
+    /// Reads the compressed companion, e.g., CASE.UNRST.OPMZ, of a
+    /// restart file if \p filename names such a companion file, or if
+    /// \p filename does not exist but its companion file does.
     explicit EclFile(const std::string& filename, bool preload = false);
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
     bool formattedInput() const { return formatted; }
 
+    /// Whether or not arrays are read from a compressed companion file.
+    /// Array views are not supported for such files.
+    bool compressedInput() const { return compressed_ != nullptr; }
+
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
@@ -56,19 +73,75 @@ public:
       char_array.clear();
 
       std::fill(arrayLoaded.begin(), arrayLoaded.end(), false);
+
+      lru_.order.clear();
+      lru_.position.clear();
+      loadedBytes_ = 0;
     }
 
+    /// Limit the amount of memory held by arrays loaded through get() or
+    /// loadData().
+    ///
+    /// Once the limit is exceeded, the least recently used arrays are
+    /// released until the loaded arrays fit within the limit again.  The
+    /// most recently loaded array is never released, so a single array
+    /// larger than the limit may still be loaded.  With a limit in place,
+    /// references returned from get() are only valid until the next call
+    /// to get() or loadData().
+    ///
+    /// \param[in] bytes Memory limit.  Zero, the default, means no limit.
+    void setMemoryBudget(std::size_t bytes);
+
+    /// Approximate number of bytes held by currently loaded arrays.
+    std::size_t memoryInUse() const { return loadedBytes_; }
+
     using EclEntry = std::tuple<std::string, eclArrType, std::int64_t>;
     std::vector<EclEntry> getList() const;
 
     const std::vector<int>& getElementSizeList() const { return array_element_size; }
 
+    /// Array header index of this file.  Suitable for writing a side-car
+    /// index with EclIndex::write().
+    EclIndex index() const;
+
     template <typename T>
     const std::vector<T>& get(int arrIndex);
 
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    /// Read-only view of a numeric or logical array in a binary file.
+    ///
+    /// The file is memory mapped and elements are converted on access.
+    /// No data is loaded into, or evicted from, the array cache used by
+    /// get().  Supported for element types int, float, double and bool,
+    /// and for binary files only.
+    ///
+    /// \param[in] arrIndex Array index.
+    template <typename T>
+    ArrayView<T> getView(int arrIndex);
+
+    /// Read-only view of first array with a particular name.
+    ///
+    /// \param[in] name Array name.
+    template <typename T>
+    ArrayView<T> getView(const std::string& name);
+
+    /// Copy of elements [first, first + count) of a numeric or logical
+    /// array.
+    ///
+    /// Only the blocks spanned by the range are decoded from a compressed
+    /// companion file.  Other files are read in full unless the array is
+    /// already loaded.  No data is loaded into, or evicted from, the array
+    /// cache used by get(), and concurrent calls are safe.  Supported for
+    /// element types int, float, double and bool.
+    ///
+    /// \param[in] arrIndex Array index.
+    /// \param[in] first First element of range.
+    /// \param[in] count Number of elements in range.
+    template <typename T>
+    std::vector<T> getRange(int arrIndex, std::size_t first, std::size_t count) const;
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -103,10 +176,82 @@ protected:
     std::streampos
     seekPosition(const std::vector<std::string>::size_type arrIndex) const;
 
+    /// Copy of an array.
+    ///
+    /// Copied from the array cache used by get() if the array is loaded,
+    /// and read from file otherwise.  Neither loads the array into, nor
+    /// evicts arrays from, that cache.
+    ///
+    /// \param[in] arrIndex Array index.
+    template <typename T>
+    std::vector<T> readArray(int arrIndex) const;
+
 private:
     std::vector<bool> arrayLoaded;
 
+    /// File contents backing array views.  Created on first use.
+    std::shared_ptr<const MappedFile> mapping_{};
+
+    /// Compressed companion file.  Null unless reading such a file.
+    std::shared_ptr<const CompressedRestartFile> compressed_{};
+
+    /// Memory limit for loaded arrays.  Zero means no limit.
+    std::size_t memoryBudget_{0};
+
+    /// Approximate number of bytes held by loaded arrays.
+    std::size_t loadedBytes_{0};
+
+    /// Loaded arrays in order of use.
+    ///
+    /// The positions refer into the list, so copies rebuild them rather
+    /// than copy them.  Moves keep them valid.
+    struct UsageOrder
+    {
+        /// Loaded arrays.  Most recently used first.
+        std::list<int> order{};
+
+        /// Position of each loaded array in order.
+        std::unordered_map<int, std::list<int>::iterator> position{};
+
+        UsageOrder() = default;
+        UsageOrder(UsageOrder&&) = default;
+        UsageOrder& operator=(UsageOrder&&) = default;
+
+        UsageOrder(const UsageOrder& rhs)
+            : order { rhs.order }
+        {
+            this->rebuild();
+        }
+
+        UsageOrder& operator=(const UsageOrder& rhs)
+        {
+            if (this != &rhs) {
+                this->order = rhs.order;
+                this->rebuild();
+            }
+
+            return *this;
+        }
+
+        void rebuild()
+        {
+            this->position.clear();
+            for (auto pos = this->order.begin(); pos != this->order.end(); ++pos) {
+                this->position.emplace(*pos, pos);
+            }
+        }
+    };
+
+    UsageOrder lru_{};
+
+    void markLoaded(int arrIndex);
+    void touch(int arrIndex);
+    void evict(int arrIndex);
+    void enforceMemoryBudget();
+    std::size_t loadedSize(int arrIndex) const;
+
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void loadCompressedArray(std::size_t arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
     void load(bool preload);
 
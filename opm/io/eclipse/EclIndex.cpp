@@ -0,0 +1,343 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/EclIndex.hpp>
+
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/PaddedOutputString.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    /// Side-car index format version.  Increment if layout changes.
+    constexpr int indexVersion = 1;
+
+    namespace Ix {
+        constexpr auto Version   = std::size_t{0};
+        constexpr auto Formatted = std::size_t{1};
+        constexpr auto NumArrays = std::size_t{2};
+
+        constexpr auto Size = std::size_t{3};
+    } // namespace Ix
+
+    struct IndexArrays
+    {
+        std::vector<int> head{};
+        std::vector<double> endPos{};
+        std::vector<std::string> names{};
+        std::vector<int> types{};
+        std::vector<int> elementSizes{};
+        std::vector<double> sizes{};
+        std::vector<double> positions{};
+    };
+
+    IndexArrays readIndexArrays(const std::string& indexFile)
+    {
+        std::fstream fileH(indexFile, std::ios::in | std::ios::binary);
+        if (! fileH) {
+            throw std::runtime_error {
+                fmt::format("Can not open index file: {}", indexFile)
+            };
+        }
+
+        auto arrays = IndexArrays{};
+
+        while (! Opm::EclIO::isEOF(&fileH)) {
+            auto name = std::string(8, ' ');
+            auto type = Opm::EclIO::eclArrType{};
+            auto num = std::int64_t{0};
+            auto elementSize = 0;
+
+            Opm::EclIO::readBinaryHeader(fileH, name, num, type, elementSize);
+            name = Opm::EclIO::trimr(name);
+
+            if (name == "IDXHEAD") {
+                arrays.head = Opm::EclIO::readBinaryInteArray(fileH, num);
+            }
+            else if (name == "ENDPOS") {
+                arrays.endPos = Opm::EclIO::readBinaryDoubArray(fileH, num);
+            }
+            else if (name == "NAME") {
+                arrays.names = Opm::EclIO::readBinaryCharArray(fileH, num);
+            }
+            else if (name == "TYPE") {
+                arrays.types = Opm::EclIO::readBinaryInteArray(fileH, num);
+            }
+            else if (name == "ELMSIZE") {
+                arrays.elementSizes = Opm::EclIO::readBinaryInteArray(fileH, num);
+            }
+            else if (name == "NUMELEM") {
+                arrays.sizes = Opm::EclIO::readBinaryDoubArray(fileH, num);
+            }
+            else if (name == "DATAPOS") {
+                arrays.positions = Opm::EclIO::readBinaryDoubArray(fileH, num);
+            }
+            else if (num > 0) {
+                // Unknown array.  Possibly from a later format version.
+                const auto size = Opm::EclIO::sizeOnDiskBinary(num, type, elementSize);
+                fileH.seekg(static_cast<std::streamoff>(size), std::ios_base::cur);
+            }
+        }
+
+        return arrays;
+    }
+
+    bool isConsistent(const IndexArrays& arrays)
+    {
+        if ((arrays.head.size() < Ix::Size) ||
+            (arrays.head[Ix::Version] != indexVersion) ||
+            (arrays.endPos.size() != 1))
+        {
+            return false;
+        }
+
+        const auto n = static_cast<std::size_t>(arrays.head[Ix::NumArrays]);
+
+        return (arrays.names.size() == n)
+            && (arrays.types.size() == n)
+            && (arrays.elementSizes.size() == n)
+            && (arrays.sizes.size() == n)
+            && (arrays.positions.size() == n);
+    }
+
+    /// Whether or not index file was written after last modification of
+    /// result file.
+    bool isCurrent(const std::filesystem::path& dataFile,
+                   const std::filesystem::path& indexFile)
+    {
+        auto ec = std::error_code{};
+
+        const auto dataTime = std::filesystem::last_write_time(dataFile, ec);
+        if (ec) { return false; }
+
+        const auto indexTime = std::filesystem::last_write_time(indexFile, ec);
+        if (ec) { return false; }
+
+        return ! (indexTime < dataTime);
+    }
+
+} // Anonymous namespace
+
+namespace Opm::EclIO {
+
+EclIndex::EclIndex(const bool          formatted,
+                   std::vector<Entry>  entries,
+                   const std::uint64_t endPos)
+    : formatted_ { formatted }
+    , entries_   { std::move(entries) }
+    , endPos_    { endPos }
+{}
+
+EclIndex EclIndex::scan(const std::string& filename, const bool formatted)
+{
+    std::fstream fileH;
+
+    if (formatted) {
+        fileH.open(filename, std::ios::in);
+    } else {
+        fileH.open(filename, std::ios::in |  std::ios::binary);
+    }
+
+    if (!fileH)
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+    auto index = EclIndex{};
+    index.formatted_ = formatted;
+
+    while (!isEOF(&fileH)) {
+        std::string arrName(8,' ');
+        eclArrType arrType;
+        std::int64_t num;
+        int sizeOfElement;
+
+        try {
+            if (formatted) {
+                readFormattedHeader(fileH,arrName,num,arrType, sizeOfElement);
+            } else {
+                readBinaryHeader(fileH,arrName,num, arrType, sizeOfElement);
+            }
+        } catch (const std::exception& e){
+            OPM_THROW(std::runtime_error,
+                fmt::format("Unable to read array header from {}: {} \nPlease check if the file is corrupt!", filename, e.what()));
+        }
+
+        const std::uint64_t pos = fileH.tellg();
+
+        index.entries_.push_back({ trimr(arrName), arrType, sizeOfElement, num, pos });
+
+        if (num > 0){
+            if (formatted) {
+                std::uint64_t sizeOfNextArray = sizeOnDiskFormatted(num, arrType, sizeOfElement);
+                fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
+            } else {
+                std::uint64_t sizeOfNextArray = sizeOnDiskBinary(num, arrType, sizeOfElement);
+                fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
+            }
+        }
+    };
+
+    fileH.clear();
+    fileH.seekg(0, std::ios_base::end);
+    index.endPos_ = static_cast<std::uint64_t>(fileH.tellg());
+
+    return index;
+}
+
+std::optional<EclIndex>
+EclIndex::load(const std::string& filename, const bool formatted)
+{
+    const auto indexFile = indexFileName(filename);
+
+    auto ec = std::error_code{};
+    if (! std::filesystem::is_regular_file(indexFile, ec) ||
+        ! isCurrent(filename, indexFile))
+    {
+        return std::nullopt;
+    }
+
+    const auto fileSize = std::filesystem::file_size(filename, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    auto arrays = IndexArrays{};
+    try {
+        arrays = readIndexArrays(indexFile);
+    }
+    catch (const std::exception&) {
+        // Corrupt or truncated index.  Caller will scan result file.
+        return std::nullopt;
+    }
+
+    if (! isConsistent(arrays) ||
+        ((arrays.head[Ix::Formatted] != 0) != formatted) ||
+        (static_cast<std::uintmax_t>(arrays.endPos.front()) != fileSize))
+    {
+        return std::nullopt;
+    }
+
+    auto entries = std::vector<Entry>(arrays.names.size());
+    for (auto i = 0*entries.size(); i < entries.size(); ++i) {
+        auto& entry = entries[i];
+
+        entry.name        = arrays.names[i];
+        entry.type        = static_cast<eclArrType>(arrays.types[i]);
+        entry.elementSize = arrays.elementSizes[i];
+        entry.size        = static_cast<std::int64_t>(arrays.sizes[i]);
+        entry.dataPos     = static_cast<std::uint64_t>(arrays.positions[i]);
+    }
+
+    return EclIndex { formatted, std::move(entries), fileSize };
+}
+
+std::string EclIndex::indexFileName(const std::string& filename)
+{
+    return filename + ".IDX";
+}
+
+void EclIndex::remove(const std::string& filename)
+{
+    auto ec = std::error_code{};
+    std::filesystem::remove(indexFileName(filename), ec);
+}
+
+void EclIndex::write(const std::string& filename)
+{
+    this->endPos_ = std::filesystem::file_size(filename);
+
+    const auto n = this->entries_.size();
+
+    auto names = std::vector<PaddedOutputString<8>>{};
+    auto types = std::vector<int>{};
+    auto elementSizes = std::vector<int>{};
+    auto sizes = std::vector<double>{};
+    auto positions = std::vector<double>{};
+
+    names.reserve(n);
+    types.reserve(n);
+    elementSizes.reserve(n);
+    sizes.reserve(n);
+    positions.reserve(n);
+
+    for (const auto& entry : this->entries_) {
+        names.emplace_back(entry.name);
+        types.push_back(static_cast<int>(entry.type));
+        elementSizes.push_back(entry.elementSize);
+        sizes.push_back(static_cast<double>(entry.size));
+        positions.push_back(static_cast<double>(entry.dataPos));
+    }
+
+    auto head = std::vector<int>(Ix::Size, 0);
+    head[Ix::Version]   = indexVersion;
+    head[Ix::Formatted] = this->formatted_ ? 1 : 0;
+    head[Ix::NumArrays] = static_cast<int>(n);
+
+    // Write to temporary file and rename into place to ensure that
+    // concurrent readers never see a partially written index.
+    const auto indexFile = indexFileName(filename);
+    const auto tmpFile = indexFile + ".tmp";
+
+    {
+        EclOutput output { tmpFile, false, std::ios::out };
+
+        output.write("IDXHEAD", head);
+        output.write("ENDPOS",  std::vector<double>{ static_cast<double>(this->endPos_) });
+        output.write("NAME",    names);
+        output.write("TYPE",    types);
+        output.write("ELMSIZE", elementSizes);
+        output.write("NUMELEM", sizes);
+        output.write("DATAPOS", positions);
+    }
+
+    std::filesystem::rename(tmpFile, indexFile);
+}
+
+void EclIndex::add(Entry entry)
+{
+    this->entries_.push_back(std::move(entry));
+}
+
+void EclIndex::truncate(const std::uint64_t pos)
+{
+    // Array headers are never empty so an array whose header starts at
+    // 'pos' has its data strictly after 'pos'.  Zero-sized arrays, e.g.,
+    // ENDSOL, ending at 'pos' on the other hand have dataPos == pos.
+    auto end = std::find_if(this->entries_.begin(), this->entries_.end(),
+                            [pos](const Entry& entry)
+                            { return entry.dataPos > pos; });
+
+    this->entries_.erase(end, this->entries_.end());
+    this->endPos_ = pos;
+}
+
+} // namespace Opm::EclIO
@@ -0,0 +1,144 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLINDEX_HPP
+#define OPM_IO_ECLINDEX_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm::EclIO {
+
+/// Array header index of an ECLIPSE-style result file.
+///
+/// Opening a large unified restart or summary file requires visiting
+/// every array header in the file to learn the array names, types, sizes
+/// and file positions.  This class captures that information and is able
+/// to store it in a compact side-car file, CASE.UNRST -> CASE.UNRST.IDX,
+/// from which it can be recovered without touching the result file.
+///
+/// The side-car file is itself a binary ECLIPSE-style file.  Array sizes
+/// and file positions are stored as DOUB values which represent integers
+/// exactly up to 2^53 bytes.
+///
+/// A side-car index is only used if it was written after the last
+/// modification of the result file and if it describes a file of the same
+/// size and format as the one on disk.  Readers fall back to scanning the
+/// result file in all other cases.
+class EclIndex
+{
+public:
+    /// Location and description of a single array in a result file.
+    struct Entry
+    {
+        /// Array name.  Trailing blanks removed.
+        std::string name{};
+
+        /// Array element type.
+        eclArrType type{MESS};
+
+        /// Size, in bytes, of a single array element.
+        int elementSize{4};
+
+        /// Number of array elements.
+        std::int64_t size{0};
+
+        /// File position of first data item following array header.
+        std::uint64_t dataPos{0};
+
+        bool operator==(const Entry& that) const = default;
+    };
+
+    /// Default constructor.  Empty index.
+    EclIndex() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] formatted Whether or not the indexed file is formatted.
+    ///
+    /// \param[in] entries Array descriptors, in order of appearance.
+    ///
+    /// \param[in] endPos Size, in bytes, of the indexed file.
+    EclIndex(const bool           formatted,
+             std::vector<Entry>   entries,
+             const std::uint64_t  endPos);
+
+    /// Build index by reading all array headers of an existing file.
+    ///
+    /// \param[in] filename Name of result file.
+    ///
+    /// \param[in] formatted Whether or not \p filename is formatted.
+    static EclIndex scan(const std::string& filename, const bool formatted);
+
+    /// Load side-car index of an existing result file.
+    ///
+    /// \param[in] filename Name of result file.  Not name of index file.
+    ///
+    /// \param[in] formatted Whether or not \p filename is formatted.
+    ///
+    /// \return Side-car index if it exists and is valid for the current
+    ///    contents of \p filename.  Nullopt otherwise.
+    static std::optional<EclIndex>
+    load(const std::string& filename, const bool formatted);
+
+    /// Name of side-car index file pertaining to a result file.
+    static std::string indexFileName(const std::string& filename);
+
+    /// Remove side-car index of result file, if any.
+    static void remove(const std::string& filename);
+
+    /// Write side-car index for result file.
+    ///
+    /// Index end position is taken from the current size of \p filename
+    /// and the write is therefore expected to happen after all data has
+    /// been flushed to \p filename.
+    ///
+    /// \param[in] filename Name of result file.  Not name of index file.
+    void write(const std::string& filename);
+
+    /// Append array descriptor.
+    void add(Entry entry);
+
+    /// Remove all array descriptors whose header starts at or after \p pos.
+    ///
+    /// Typical use case is reopening a unified restart file at a
+    /// particular report step.
+    void truncate(const std::uint64_t pos);
+
+    bool formatted() const { return this->formatted_; }
+    const std::vector<Entry>& entries() const { return this->entries_; }
+    std::uint64_t endPosition() const { return this->endPos_; }
+
+private:
+    /// Whether or not the indexed file is formatted.
+    bool formatted_{false};
+
+    /// Array descriptors, in order of appearance.
+    std::vector<Entry> entries_{};
+
+    /// Size, in bytes, of indexed file.
+    std::uint64_t endPos_{0};
+};
+
+} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLINDEX_HPP
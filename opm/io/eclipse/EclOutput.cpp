@@ -18,11 +18,13 @@
 
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/EndianConversion.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <iterator>
@@ -32,6 +34,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace Opm { namespace EclIO {
 
@@ -39,6 +42,7 @@ EclOutput::EclOutput(const std::string&            filename,
                      const bool                    formatted,
                      const std::ios_base::openmode mode)
     : isFormatted{formatted}
+    , filename_{filename}
 {
     const auto binmode = mode | std::ios_base::binary;
     ix_standard = false;
@@ -141,6 +145,74 @@ void EclOutput::write<PaddedOutputString<8>>
     }
 }
 
+template <typename T>
+void EclOutput::writeConverted(const std::string&            name,
+                               const std::span<const double> data,
+                               const double                  factor,
+                               const double                  offset)
+{
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "EclOutput::writeConverted<T>: T must be float or double");
+
+    const auto arrType = std::is_same_v<T, float> ? REAL : DOUB;
+    const auto elementSize = static_cast<int>(sizeof(T));
+    const auto size = static_cast<int64_t>(data.size());
+
+    // Convert one output block at a time.  Chunks never straddle a block
+    // boundary, so the file layout is identical to that of write().
+    const auto chunkSize = static_cast<int64_t>
+        (this->isFormatted
+         ? std::get<0>(block_size_data_formatted(arrType))
+         : std::get<1>(block_size_data_binary(arrType)) / elementSize);
+
+    auto buffer = std::vector<T>(std::min(size, chunkSize));
+
+    auto convertChunk = [&data, &buffer, factor, offset]
+        (const int64_t begin, const int64_t num)
+    {
+        std::transform(data.begin() + begin, data.begin() + begin + num, buffer.begin(),
+                       [factor, offset](const double x)
+                       { return static_cast<T>((x - offset) * factor); });
+    };
+
+    if (this->isFormatted) {
+        writeFormattedHeader(name, data.size(), arrType, elementSize);
+
+        for (auto begin = int64_t{0}; begin < size; begin += chunkSize) {
+            const auto num = std::min(chunkSize, size - begin);
+
+            convertChunk(begin, num);
+            buffer.resize(num);
+
+            writeFormattedArray(buffer);
+        }
+
+        return;
+    }
+
+    writeBinaryHeader(name, size, arrType, elementSize);
+
+    if (!ofileH.is_open()) {
+        OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
+    }
+
+    for (auto begin = int64_t{0}; begin < size; begin += chunkSize) {
+        const auto num = std::min(chunkSize, size - begin);
+
+        convertChunk(begin, num);
+        flipEndianArray(buffer.data(), num);
+
+        int dhead = flipEndianInt(static_cast<int>(num) * elementSize);
+
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        ofileH.write(reinterpret_cast<char*>(buffer.data()), num * sizeof(T));
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+    }
+}
+
+template void EclOutput::writeConverted<float>(const std::string&, std::span<const double>, double, double);
+template void EclOutput::writeConverted<double>(const std::string&, std::span<const double>, double, double);
+
 void EclOutput::message(const std::string& msg)
 {
     // Generate message, i.e., output vector of type eclArrType::MESS,
@@ -155,10 +227,39 @@ void EclOutput::flushStream()
     this->ofileH.flush();
 }
 
+void EclOutput::recordIndex(EclIndex existing)
+{
+    this->ofileH.seekp(0, std::ios_base::end);
+
+    this->index_ = std::move(existing);
+}
+
+void EclOutput::writeIndex()
+{
+    if (! this->index_.has_value()) {
+        return;
+    }
+
+    this->flushStream();
+    this->index_->write(this->filename_);
+}
+
+void EclOutput::recordArray(const std::string& arrName, int64_t size, eclArrType arrType, int element_size)
+{
+    if (! this->index_.has_value()) {
+        return;
+    }
+
+    const auto pos = static_cast<std::uint64_t>(this->ofileH.tellp());
+
+    this->index_->add({ trimr(arrName), arrType, element_size, size, pos });
+}
+
 void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclArrType arrType, int element_size)
 {
     int bhead = flipEndianInt(16);
     std::string name = arrName + std::string(8 - arrName.size(),' ');
+    const int64_t size_total = size;
 
     // write X231 header if size larger that limits for 4 byte integers
     if (size > std::numeric_limits<int>::max()) {
@@ -216,6 +317,8 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
     }
 
     ofileH.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
+
+    this->recordArray(arrName, size_total, arrType, element_size);
 }
 
 template <typename T>
@@ -257,6 +360,19 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
     offset = 0;
 
+    // Conversion buffers.  Allocated once and reused for all blocks.
+    const auto bufferSize = std::min(size, static_cast<int64_t>(maxNumberOfElements));
+
+    std::vector<T> flipped_data;
+    std::vector<int> logi_data;
+
+    if constexpr (std::is_same_v<T, bool>) {
+        logi_data.resize(bufferSize, 0);
+    }
+    else if constexpr (! std::is_same_v<T, char>) {
+        flipped_data.resize(bufferSize);
+    }
+
     while (rest > 0) {
         if (rest > maxBlockSize) {
             rest -= maxBlockSize;
@@ -270,54 +386,21 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
-        if (arrType == INTE) {
-
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
+        if constexpr (std::is_same_v<T, int> ||
+                      std::is_same_v<T, float> ||
+                      std::is_same_v<T, double>)
+        {
+            flipEndianArray(data.data() + offset, flipped_data.data(), num);
 
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianInt(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
+            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), num * sizeof(T));
 
-        } else if (arrType == REAL) {
-
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
+        } else if constexpr (std::is_same_v<T, bool>) {
 
             for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
+                logi_data[m] = data[m + offset] ? logi_true_val : false_value;
             }
 
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
-
-        } else if (arrType == DOUB) {
-
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
-
-            std::vector<int> logi_data;
-            logi_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                if (data[m + offset]) {
-                    logi_data[m] = logi_true_val;
-                }
-                else {
-                    logi_data[m] = false_value;
-                }
-            }
-
-            ofileH.write(reinterpret_cast<char*>(logi_data.data()), logi_data.size() * sizeof(int)) ;
+            ofileH.write(reinterpret_cast<char*>(logi_data.data()), num * sizeof(int)) ;
 
         } else {
 
@@ -459,6 +542,8 @@ void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclAr
         ofileH << " 'MESS'" <<  std::endl;
         break;
     }
+
+    this->recordArray(arrName, size, arrType, element_size);
 }
 
 
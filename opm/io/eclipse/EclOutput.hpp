@@ -19,10 +19,13 @@
 #define OPM_IO_ECLOUTPUT_HPP
 
 #include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclIndex.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 
 #include <fstream>
 #include <ios>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -30,6 +33,7 @@
 
 namespace Opm::EclIO::OutputStream {
     class Restart;
+    class RFT;
     class SummarySpecification;
 } // namespace Opm::EclIO::OutputStream
 
@@ -92,6 +96,29 @@ public:
         }
     }
 
+    /// Write floating point array converted from double precision
+    /// values while writing.
+    ///
+    /// Element x of \p data is output as (x - offset) * factor, rounded
+    /// to T.  Conversion and byte order reversal happen one output block
+    /// at a time, so no full-size copy of the array is created and \p
+    /// data itself is not modified.
+    ///
+    /// \tparam T Output element type.  float (REAL) or double (DOUB).
+    ///
+    /// \param[in] name Array name.
+    ///
+    /// \param[in] data Input values.
+    ///
+    /// \param[in] factor Scale factor.
+    ///
+    /// \param[in] offset Offset subtracted before scaling.
+    template <typename T>
+    void writeConverted(const std::string&      name,
+                        std::span<const double> data,
+                        double                  factor,
+                        double                  offset = 0.0);
+
     // when this function is used array type will be assumed C0NN (not CHAR).
     // Also in cases where element size is 8 or less, element size will be 8.
 
@@ -102,7 +129,21 @@ public:
 
     void set_ix() { ix_standard = true; }
 
+    /// Record location of all arrays subsequently written to this stream.
+    ///
+    /// Places output position at the end of the file.
+    ///
+    /// \param[in] existing Index of arrays already present in the output
+    ///    file, e.g., from earlier report steps of a unified restart file.
+    void recordIndex(EclIndex existing = EclIndex{});
+
+    /// Flush stream and write side-car index of recorded arrays.
+    ///
+    /// No-op unless recordIndex() has been called.
+    void writeIndex();
+
     friend class OutputStream::Restart;
+    friend class OutputStream::RFT;
     friend class OutputStream::SummarySpecification;
 
 private:
@@ -128,8 +169,12 @@ private:
     std::string make_doub_string_ecl(double value) const;
     std::string make_doub_string_ix(double value) const;
 
+    void recordArray(const std::string& arrName, int64_t size, eclArrType arrType, int element_size);
+
     bool isFormatted, ix_standard;
+    std::string filename_;
     std::ofstream ofileH;
+    std::optional<EclIndex> index_{};
 };
 
 
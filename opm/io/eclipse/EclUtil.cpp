@@ -18,11 +18,13 @@
 */
 
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/EndianConversion.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cmath>
 #include <cstring>
 #include <filesystem>
@@ -61,23 +63,13 @@ std::int64_t Opm::EclIO::flipEndianLongInt(int64_t num)
 
 float Opm::EclIO::flipEndianFloat(float num)
 {
-    float value = num;
-
-    char* floatToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(floatToConvert, floatToConvert+4);
-
-    return value;
+    return std::bit_cast<float>(flipEndianInt(std::bit_cast<int>(num)));
 }
 
 
 double Opm::EclIO::flipEndianDouble(double num)
 {
-    double value = num;
-
-    char* doubleToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(doubleToConvert, doubleToConvert+8);
-
-    return value;
+    return std::bit_cast<double>(flipEndianLongInt(std::bit_cast<std::int64_t>(num)));
 }
 
 bool Opm::EclIO::fileExists(const std::string& filename){
@@ -505,53 +497,119 @@ std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64
 }
 
 
+template std::vector<int>
+Opm::EclIO::readBinaryArray(std::fstream&, const std::int64_t, Opm::EclIO::eclArrType,
+                            std::function<int(int)>&, int);
+
+template std::vector<float>
+Opm::EclIO::readBinaryArray(std::fstream&, const std::int64_t, Opm::EclIO::eclArrType,
+                            std::function<float(float)>&, int);
+
+template std::vector<double>
+Opm::EclIO::readBinaryArray(std::fstream&, const std::int64_t, Opm::EclIO::eclArrType,
+                            std::function<double(double)>&, int);
+
+namespace {
+
+    /// Read binary array of 32-bit or 64-bit elements directly into the
+    /// result vector, one block at a time.  Converts each block from
+    /// big-endian representation while it is still in cache if SwapBytes
+    /// is true.
+    template <typename T, bool SwapBytes>
+    std::vector<T> readBinaryNumericArray(std::fstream& fileH,
+                                          const std::int64_t size,
+                                          const Opm::EclIO::eclArrType type)
+    {
+        const auto sizeData = Opm::EclIO::block_size_data_binary(type);
+
+        const int sizeOfElement = std::get<0>(sizeData);
+        const int maxBlockSize = std::get<1>(sizeData);
+        const int maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+        auto arr = std::vector<T>(size);
+
+        std::int64_t rest = size;
+        auto* dest = arr.data();
+
+        while (rest > 0) {
+            int dhead;
+            fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+            dhead = Opm::EclIO::flipEndianInt(dhead);
+            const int num = dhead / sizeOfElement;
+
+            if ((num > maxNumberOfElements) || (num < 0)) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+            }
+
+            if ((num > rest) || (num < maxNumberOfElements && num != rest)) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, incorrect number of elements");
+            }
+
+            fileH.read(reinterpret_cast<char*>(dest), num * sizeof(T));
+
+            if constexpr (SwapBytes) {
+                Opm::EclIO::flipEndianArray(dest, num);
+            }
+
+            dest += num;
+            rest -= num;
+
+            int dtail;
+            fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+            dtail = Opm::EclIO::flipEndianInt(dtail);
+
+            if (dhead != dtail) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+            }
+        }
+
+        return arr;
+    }
+
+} // Anonymous namespace
+
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    return readBinaryNumericArray<int, true>(fileH, size, Opm::EclIO::INTE);
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    return readBinaryNumericArray<float, true>(fileH, size, Opm::EclIO::REAL);
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    return readBinaryNumericArray<double, true>(fileH, size, Opm::EclIO::DOUB);
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<bool(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              bool value = false;
-                                              if (intVal == Opm::EclIO::true_value_ecl) {
-                                                  value = true;
-                                              } else if (intVal == Opm::EclIO::false_value) {
-                                                  value = false;
-                                              } else if (intVal == Opm::EclIO::true_value_ix) {
-                                                  value = true;
-                                              } else {
-                                                  OPM_THROW(std::runtime_error, "Error reading logi value");
-                                              }
-
-                                              return value;
-                                          };
-    return readBinaryArray<bool,unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    // Logical values are compared in their on-disk representation.
+    const auto raw = readBinaryRawLogiArray(fileH, size);
+
+    std::vector<bool> arr(raw.size());
+    for (std::size_t i = 0; i < raw.size(); ++i) {
+        const auto intVal = raw[i];
+
+        if ((intVal == Opm::EclIO::true_value_ecl) ||
+            (intVal == Opm::EclIO::true_value_ix))
+        {
+            arr[i] = true;
+        }
+        else if (intVal != Opm::EclIO::false_value) {
+            OPM_THROW(std::runtime_error, "Error reading logi value");
+        }
+    }
+
+    return arr;
 }
 
 std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<unsigned int(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              return intVal;
-                                          };
-    return readBinaryArray<unsigned int, unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    return readBinaryNumericArray<unsigned int, false>(fileH, size, Opm::EclIO::LOGI);
 }
 
 
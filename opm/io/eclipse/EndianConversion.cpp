@@ -0,0 +1,264 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/EndianConversion.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define OPM_ECLIO_HAVE_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define OPM_ECLIO_HAVE_NEON_KERNEL 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+    std::uint32_t bswap(const std::uint32_t x)
+    {
+#ifdef _MSC_VER
+        return _byteswap_ulong(x);
+#else
+        return __builtin_bswap32(x);
+#endif
+    }
+
+    std::uint64_t bswap(const std::uint64_t x)
+    {
+#ifdef _MSC_VER
+        return _byteswap_uint64(x);
+#else
+        return __builtin_bswap64(x);
+#endif
+    }
+
+    // Element-by-element reversal.  Uses memcpy() to support unaligned
+    // and type-punned input and output buffers.  Also handles the tail
+    // end of the vectorised kernels.
+    template <typename UInt>
+    void portableSwap(const unsigned char* src, unsigned char* dst, const std::size_t n)
+    {
+        for (auto i = 0*n; i < n; ++i) {
+            auto x = UInt{};
+            std::memcpy(&x, src + i*sizeof x, sizeof x);
+
+            x = bswap(x);
+            std::memcpy(dst + i*sizeof x, &x, sizeof x);
+        }
+    }
+
+#if OPM_ECLIO_HAVE_AVX2_KERNEL
+    // Byte permutations reversing each 4-byte or 8-byte lane of a 128-bit
+    // half.  _mm256_shuffle_epi8() operates independently on each half.
+    __attribute__((target("avx2")))
+    __m256i reverseMask32()
+    {
+        return _mm256_setr_epi8( 3,  2,  1,  0,  7,  6,  5,  4,
+                                11, 10,  9,  8, 15, 14, 13, 12,
+                                 3,  2,  1,  0,  7,  6,  5,  4,
+                                11, 10,  9,  8, 15, 14, 13, 12);
+    }
+
+    __attribute__((target("avx2")))
+    __m256i reverseMask64()
+    {
+        return _mm256_setr_epi8( 7,  6,  5,  4,  3,  2,  1,  0,
+                                15, 14, 13, 12, 11, 10,  9,  8,
+                                 7,  6,  5,  4,  3,  2,  1,  0,
+                                15, 14, 13, 12, 11, 10,  9,  8);
+    }
+
+    template <typename UInt>
+    __attribute__((target("avx2")))
+    void avx2Swap(const unsigned char* src, unsigned char* dst, const std::size_t n)
+    {
+        constexpr auto perVector = sizeof(__m256i) / sizeof(UInt);
+
+        const auto mask = (sizeof(UInt) == 4) ? reverseMask32() : reverseMask64();
+
+        auto i = 0*n;
+
+        // Unroll by two to hide shuffle latency.
+        for (; i + 2*perVector <= n; i += 2*perVector) {
+            const auto* s = src + i*sizeof(UInt);
+            auto*       d = dst + i*sizeof(UInt);
+
+            const auto x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+            const auto x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + sizeof(__m256i)));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(d),
+                                _mm256_shuffle_epi8(x0, mask));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + sizeof(__m256i)),
+                                _mm256_shuffle_epi8(x1, mask));
+        }
+
+        for (; i + perVector <= n; i += perVector) {
+            const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i*sizeof(UInt)));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i*sizeof(UInt)),
+                                _mm256_shuffle_epi8(x, mask));
+        }
+
+        portableSwap<UInt>(src + i*sizeof(UInt), dst + i*sizeof(UInt), n - i);
+    }
+#endif // OPM_ECLIO_HAVE_AVX2_KERNEL
+
+#if OPM_ECLIO_HAVE_NEON_KERNEL
+    template <typename UInt>
+    void neonSwap(const unsigned char* src, unsigned char* dst, const std::size_t n)
+    {
+        constexpr auto perVector = std::size_t{16} / sizeof(UInt);
+
+        auto i = 0*n;
+        for (; i + perVector <= n; i += perVector) {
+            const auto x = vld1q_u8(src + i*sizeof(UInt));
+
+            if constexpr (sizeof(UInt) == 4) {
+                vst1q_u8(dst + i*sizeof(UInt), vrev32q_u8(x));
+            }
+            else {
+                vst1q_u8(dst + i*sizeof(UInt), vrev64q_u8(x));
+            }
+        }
+
+        portableSwap<UInt>(src + i*sizeof(UInt), dst + i*sizeof(UInt), n - i);
+    }
+#endif // OPM_ECLIO_HAVE_NEON_KERNEL
+
+    template <typename UInt>
+    void byteSwap(const void* src, void* dst, const std::size_t n,
+                  const Opm::EclIO::ByteSwapKernel kernel)
+    {
+        const auto* s = static_cast<const unsigned char*>(src);
+        auto*       d = static_cast<unsigned char*>(dst);
+
+        switch (kernel) {
+        case Opm::EclIO::ByteSwapKernel::Portable:
+            portableSwap<UInt>(s, d, n);
+            return;
+
+#if OPM_ECLIO_HAVE_AVX2_KERNEL
+        case Opm::EclIO::ByteSwapKernel::AVX2:
+            if (Opm::EclIO::isAvailable(kernel)) {
+                avx2Swap<UInt>(s, d, n);
+                return;
+            }
+            break;
+#endif
+
+#if OPM_ECLIO_HAVE_NEON_KERNEL
+        case Opm::EclIO::ByteSwapKernel::NEON:
+            neonSwap<UInt>(s, d, n);
+            return;
+#endif
+
+        default:
+            break;
+        }
+
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Byte swap kernel {} is not "
+                              "available on this CPU",
+                              Opm::EclIO::kernelName(kernel)));
+    }
+
+} // Anonymous namespace
+
+bool Opm::EclIO::isAvailable(const ByteSwapKernel kernel)
+{
+    switch (kernel) {
+    case ByteSwapKernel::Portable:
+        return true;
+
+    case ByteSwapKernel::AVX2:
+#if OPM_ECLIO_HAVE_AVX2_KERNEL
+    {
+        static const bool haveAVX2 = __builtin_cpu_supports("avx2");
+        return haveAVX2;
+    }
+#else
+        return false;
+#endif
+
+    case ByteSwapKernel::NEON:
+#if OPM_ECLIO_HAVE_NEON_KERNEL
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    return false;
+}
+
+Opm::EclIO::ByteSwapKernel Opm::EclIO::defaultByteSwapKernel()
+{
+    static const auto kernel = []()
+    {
+        for (const auto candidate : { ByteSwapKernel::AVX2, ByteSwapKernel::NEON }) {
+            if (isAvailable(candidate)) {
+                return candidate;
+            }
+        }
+
+        return ByteSwapKernel::Portable;
+    }();
+
+    return kernel;
+}
+
+std::string_view Opm::EclIO::kernelName(const ByteSwapKernel kernel)
+{
+    switch (kernel) {
+    case ByteSwapKernel::Portable: return "Portable";
+    case ByteSwapKernel::AVX2:     return "AVX2";
+    case ByteSwapKernel::NEON:     return "NEON";
+    }
+
+    return "Unknown";
+}
+
+void Opm::EclIO::byteSwap32(const void* src, void* dst,
+                            const std::size_t n,
+                            const ByteSwapKernel kernel)
+{
+    byteSwap<std::uint32_t>(src, dst, n, kernel);
+}
+
+void Opm::EclIO::byteSwap64(const void* src, void* dst,
+                            const std::size_t n,
+                            const ByteSwapKernel kernel)
+{
+    byteSwap<std::uint64_t>(src, dst, n, kernel);
+}
@@ -0,0 +1,91 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_ENDIAN_CONVERSION_HPP
+#define OPM_IO_ENDIAN_CONVERSION_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+namespace Opm { namespace EclIO {
+
+    /// Implementations of bulk byte order reversal.
+    enum class ByteSwapKernel {
+        /// Scalar loop.  Always available.
+        Portable,
+
+        /// 256-bit byte shuffles.  Available on x86-64 CPUs with AVX2.
+        AVX2,
+
+        /// 128-bit byte reversal.  Available on all AArch64 CPUs.
+        NEON,
+    };
+
+    /// Whether or not a particular kernel may be used on the current CPU.
+    bool isAvailable(ByteSwapKernel kernel);
+
+    /// Fastest kernel available on the current CPU.  Determined once, on
+    /// first use, and used by the flipEndianArray() functions.
+    ByteSwapKernel defaultByteSwapKernel();
+
+    /// Human readable kernel name.  Mainly for diagnostic purposes.
+    std::string_view kernelName(ByteSwapKernel kernel);
+
+    /// Reverse byte order of a sequence of 32-bit quantities.
+    ///
+    /// \param[in] src Start of input sequence.
+    /// \param[out] dst Start of output sequence.  May be the same as \p
+    ///   src for in-place conversion, but must not otherwise overlap.
+    /// \param[in] n Number of 32-bit elements.
+    /// \param[in] kernel Implementation.  Must be available.
+    void byteSwap32(const void* src, void* dst, std::size_t n, ByteSwapKernel kernel);
+
+    /// Reverse byte order of a sequence of 64-bit quantities.
+    ///
+    /// Same conventions as byteSwap32().
+    void byteSwap64(const void* src, void* dst, std::size_t n, ByteSwapKernel kernel);
+
+    /// Reverse byte order of \p n elements of arithmetic type.  Converts
+    /// between native representation and the big-endian representation
+    /// used in binary ECLIPSE-style files.
+    template <typename T>
+    void flipEndianArray(const T* src, T* dst, const std::size_t n)
+    {
+        static_assert(std::is_arithmetic_v<T> && ((sizeof(T) == 4) || (sizeof(T) == 8)),
+                      "Byte order reversal supported for 32-bit and 64-bit types only");
+
+        if constexpr (sizeof(T) == 4) {
+            byteSwap32(src, dst, n, defaultByteSwapKernel());
+        }
+        else {
+            byteSwap64(src, dst, n, defaultByteSwapKernel());
+        }
+    }
+
+    /// In-place version of flipEndianArray().
+    template <typename T>
+    void flipEndianArray(T* data, const std::size_t n)
+    {
+        flipEndianArray(data, data, n);
+    }
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ENDIAN_CONVERSION_HPP
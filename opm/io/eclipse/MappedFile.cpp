@@ -0,0 +1,100 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OPM_ECLIO_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if OPM_ECLIO_HAVE_MMAP
+
+Opm::EclIO::MappedFile::MappedFile(const std::string& filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Could not open file: '{}'", filename));
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Could not determine size of file: '{}'", filename));
+    }
+
+    this->size_ = static_cast<std::size_t>(st.st_size);
+
+    if (this->size_ > 0) {
+        void* addr = ::mmap(nullptr, this->size_, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Could not map file: '{}'", filename));
+        }
+
+        this->data_ = static_cast<const unsigned char*>(addr);
+    }
+
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+}
+
+Opm::EclIO::MappedFile::~MappedFile()
+{
+    if (this->data_ != nullptr) {
+        ::munmap(const_cast<unsigned char*>(this->data_), this->size_);
+    }
+}
+
+#else // !OPM_ECLIO_HAVE_MMAP
+
+Opm::EclIO::MappedFile::MappedFile(const std::string& filename)
+{
+    std::ifstream fileH(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    if (! fileH) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Could not open file: '{}'", filename));
+    }
+
+    this->buffer_.resize(static_cast<std::size_t>(fileH.tellg()));
+
+    fileH.seekg(0, std::ios_base::beg);
+    fileH.read(reinterpret_cast<char*>(this->buffer_.data()), this->buffer_.size());
+
+    this->size_ = this->buffer_.size();
+    this->data_ = this->buffer_.empty() ? nullptr : this->buffer_.data();
+}
+
+Opm::EclIO::MappedFile::~MappedFile() = default;
+
+#endif // OPM_ECLIO_HAVE_MMAP
@@ -0,0 +1,68 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_MAPPED_FILE_HPP
+#define OPM_IO_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Read-only view of the full contents of a file.
+///
+/// Uses a memory mapping on POSIX systems, meaning pages are read from
+/// disk on first access and may be dropped by the operating system under
+/// memory pressure.  Reads the entire file into memory on other systems.
+class MappedFile
+{
+public:
+    /// Constructor.
+    ///
+    /// Throws std::runtime_error if the file cannot be opened or mapped.
+    ///
+    /// \param[in] filename Name of file.
+    explicit MappedFile(const std::string& filename);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Start of file contents.  Null if file is empty.
+    const unsigned char* data() const { return this->data_; }
+
+    /// Size of file in bytes.
+    std::size_t size() const { return this->size_; }
+
+private:
+    /// Start of file contents.
+    const unsigned char* data_{nullptr};
+
+    /// Size of file contents.
+    std::size_t size_{0};
+
+    /// File contents on systems without memory mappings.
+    std::vector<unsigned char> buffer_{};
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_MAPPED_FILE_HPP
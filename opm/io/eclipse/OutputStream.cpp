@@ -23,11 +23,15 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/utility/String.hpp>
 
+#include <opm/io/eclipse/CompressedRestart.hpp>
+#include <opm/io/eclipse/EclIndex.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/RestartOutputPolicy.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <exception>
 #include <filesystem>
@@ -36,9 +40,11 @@
 #include <ios>
 #include <map>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -299,6 +305,18 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         this->stream().write(kw, data);
     }
 
+    template <typename T>
+    void Init::writeConverted(const std::string&            kw,
+                              const std::span<const double> data,
+                              const double                  factor,
+                              const double                  offset)
+    {
+        this->stream().writeConverted<T>(kw, data, factor, offset);
+    }
+
+    template void Init::writeConverted<float>(const std::string&, std::span<const double>, double, double);
+    template void Init::writeConverted<double>(const std::string&, std::span<const double>, double, double);
+
 }}}
 
 // =====================================================================
@@ -308,44 +326,135 @@ Restart(const ResultSet& rset,
         const int        seqnum,
         const Formatted& fmt,
         const Unified&   unif)
+    : Restart { rset, seqnum, fmt, unif, Compressed { false } }
+{}
+
+Opm::EclIO::OutputStream::Restart::
+Restart(const ResultSet&  rset,
+        const int         seqnum,
+        const Formatted&  fmt,
+        const Unified&    unif,
+        const Compressed& comp)
+    : Restart { rset, seqnum, fmt, unif, comp, Deferred { false } }
+{}
+
+Opm::EclIO::OutputStream::Restart::
+Restart(const ResultSet&  rset,
+        const int         seqnum,
+        const Formatted&  fmt,
+        const Unified&    unif,
+        const Compressed& comp,
+        const Deferred&   defer)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
 
-    const auto fname = outputFileName(rset, ext);
-
-    if (unif.set) {
-        // Run uses unified restart files.
-        this->openUnified(fname, fmt.set, seqnum);
+    const auto target = Target {
+        outputFileName(rset, ext), seqnum, fmt.set, unif.set, comp.set, comp.cache
+    };
 
-        // Write SEQNUM value to stream to start new output sequence.
-        this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
+    if (defer.set) {
+        this->deferred_ = target;
     }
     else {
-        // Run uses separate, not unified, restart files.  Create a
-        // new output file and open an output stream on it.
-        this->openNew(fname, fmt.set);
+        this->open(target);
+    }
+
+    if (unif.set) {
+        // Write SEQNUM value to stream to start new output sequence.
+        this->write("SEQNUM", std::vector<int>{ seqnum });
     }
 }
 
 Opm::EclIO::OutputStream::Restart::~Restart()
-{}
+{
+    this->closeStream();
+}
 
 Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
-    : stream_{ std::move(rhs.stream_) }
+    : stream_    { std::move(rhs.stream_) }
+    , compressed_{ std::move(rhs.compressed_) }
+    , policy_    { std::move(rhs.policy_) }
+    , inSolution_{ rhs.inSolution_ }
+    , deferred_  { std::move(rhs.deferred_) }
+    , pending_   { std::move(rhs.pending_) }
+    , owners_    { std::move(rhs.owners_) }
 {}
 
 Opm::EclIO::OutputStream::Restart&
 Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
 {
+    this->closeStream();
+
     this->stream_ = std::move(rhs.stream_);
+    this->compressed_ = std::move(rhs.compressed_);
+    this->policy_ = std::move(rhs.policy_);
+    this->inSolution_ = rhs.inSolution_;
+    this->deferred_ = std::move(rhs.deferred_);
+    this->pending_ = std::move(rhs.pending_);
+    this->owners_ = std::move(rhs.owners_);
 
     return *this;
 }
 
 void Opm::EclIO::OutputStream::Restart::message(const std::string& msg)
 {
-    this->stream().message(msg);
+    this->writeMessage(msg);
+
+    if (msg == "STARTSOL") {
+        this->inSolution_ = true;
+
+        if ((this->policy_ != nullptr) && this->policy_->hasCellSelection()) {
+            this->writeArray(RestartOutputPolicy::cellArrayName, this->policy_->cells());
+        }
+    }
+    else if (msg == "ENDSOL") {
+        this->inSolution_ = false;
+    }
+}
+
+void Opm::EclIO::OutputStream::Restart::
+setOutputPolicy(std::shared_ptr<const RestartOutputPolicy> policy)
+{
+    this->policy_ = std::move(policy);
+}
+
+void Opm::EclIO::OutputStream::Restart::
+shareOwnership(std::shared_ptr<const void> owner)
+{
+    if (this->deferred_.has_value()) {
+        this->owners_.push_back(std::move(owner));
+    }
+}
+
+void Opm::EclIO::OutputStream::Restart::commit()
+{
+    if (! this->deferred_.has_value()) {
+        return;
+    }
+
+    const auto target = *std::exchange(this->deferred_, std::nullopt);
+    this->open(target);
+
+    for (const auto& operation : std::exchange(this->pending_, {})) {
+        operation(*this);
+    }
+
+    this->owners_.clear();
+
+    // Complete the companion file here rather than in the destructor, so
+    // that failures are reported to the caller instead of the log.
+    if (this->compressed_ != nullptr) {
+        std::exchange(this->compressed_, nullptr)->close();
+    }
+}
+
+bool Opm::EclIO::OutputStream::Restart::policyApplies(const std::size_t size) const
+{
+    return this->inSolution_
+        && (this->policy_ != nullptr)
+        && ! this->policy_->fullOutput()
+        && this->policy_->perCell(size);
 }
 
 void
@@ -391,6 +500,65 @@ write(const std::string&                        kw,
     this->writeImpl(kw, data);
 }
 
+namespace Opm { namespace EclIO { namespace OutputStream {
+
+    template <typename T>
+    void Restart::writeConverted(const std::string&            kw,
+                                 const std::span<const double> data,
+                                 const double                  factor,
+                                 const double                  offset)
+    {
+        if (this->policyApplies(data.size())) {
+            if (! this->policy_->selected(kw)) {
+                return;
+            }
+
+            // Quantize in output precision, so that rounding to T does
+            // not violate the policy's error bounds.
+            const auto selected = this->policy_->gather(data);
+            auto values = std::vector<T>(selected.size());
+            std::transform(selected.begin(), selected.end(), values.begin(),
+                           [factor, offset](const double x)
+                           { return static_cast<T>((x - offset) * factor); });
+
+            this->policy_->quantize(kw, std::span<T>{ values });
+            this->writeArray(kw, values);
+
+            return;
+        }
+
+        this->writeConvertedArray<T>(kw, data, factor, offset);
+    }
+
+    template void Restart::writeConverted<float>(const std::string&, std::span<const double>, double, double);
+    template void Restart::writeConverted<double>(const std::string&, std::span<const double>, double, double);
+
+}}}
+
+void
+Opm::EclIO::OutputStream::Restart::open(const Target& target)
+{
+    // Only unified restart files accumulate report steps.  The companion
+    // of a separate restart file is always created anew.
+    const auto existing = target.unified && std::filesystem::exists(target.fname);
+
+    if (target.unified) {
+        // Run uses unified restart files.
+        this->openUnified(target.fname, target.formatted, target.seqnum);
+    }
+    else {
+        // Run uses separate, not unified, restart files.  Create a
+        // new output file and open an output stream on it.
+        this->openNew(target.fname, target.formatted);
+    }
+
+    if (target.compressed) {
+        this->compressed_ = std::make_unique<CompressedRestartWriter>
+            (CompressedRestart::companionName(target.fname), target.seqnum, existing,
+             CompressedRestart::defaultKeyframeInterval, target.cache);
+    }
+}
+
 void
 Opm::EclIO::OutputStream::Restart::
 openUnified(const std::string& fname,
@@ -402,9 +570,13 @@ openUnified(const std::string& fname,
     // write position.
     auto rst = Open::Restart::read(fname);
 
+    // Any existing side-car index is about to become stale.
+    EclIndex::remove(fname);
+
     if (rst == nullptr) {
         // No such unified restart file exists.  Create new file.
         this->openNew(fname, formatted);
+        this->stream_->recordIndex(EclIndex{ formatted, {}, 0 });
     }
     else if (! rst->hasKey("SEQNUM")) {
         // File with correct filename exists but does not appear
@@ -419,8 +591,19 @@ openUnified(const std::string& fname,
         // Restart file exists and appears to be a unified restart
         // resource.  Open writable restart stream backed by the
         // specific file.
-        this->openExisting(fname, formatted,
-                           rst->restartStepWritePosition(seqnum));
+        const auto writePos = rst->restartStepWritePosition(seqnum);
+
+        this->openExisting(fname, formatted, writePos);
+
+        // Carry forward array index of all report steps preceding
+        // 'seqnum'.  The unified restart file is indexed after the last
+        // array of the new report step has been written.
+        auto index = rst->index();
+        if (writePos != std::streampos(-1)) {
+            index.truncate(static_cast<std::uint64_t>(std::streamoff(writePos)));
+        }
+
+        this->stream_->recordIndex(std::move(index));
     }
 }
 
@@ -476,13 +659,137 @@ Opm::EclIO::OutputStream::Restart::stream()
     return *this->stream_;
 }
 
+void Opm::EclIO::OutputStream::Restart::closeStream()
+{
+    if (this->stream_ == nullptr) {
+        return;
+    }
+
+    try {
+        this->stream_->writeIndex();
+    }
+    catch (const std::exception&) {
+        // The side-car index is an optional accelerator.  Readers fall
+        // back to scanning the restart file if the index is missing.
+        EclIndex::remove(this->stream_->filename_);
+    }
+
+    this->stream_.reset();
+
+    if (this->compressed_ != nullptr) {
+        try {
+            this->compressed_->close();
+        }
+        catch (const std::exception& e) {
+            // The companion file is incomplete.  Readers reject such
+            // files and the next report step recreates it.
+            OpmLog::warning("Failed to complete compressed restart file: "
+                            + std::string { e.what() });
+        }
+
+        this->compressed_.reset();
+    }
+}
+
 namespace Opm { namespace EclIO { namespace OutputStream {
 
     template <typename T>
     void Restart::writeImpl(const std::string&    kw,
                             const std::vector<T>& data)
     {
+        constexpr auto isNumeric = std::is_same_v<T, int>
+            || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+        if constexpr (isNumeric) {
+            if (this->policyApplies(data.size())) {
+                if (! this->policy_->selected(kw)) {
+                    return;
+                }
+
+                auto values = this->policy_->gather(std::span<const T>{ data });
+
+                if constexpr (! std::is_same_v<T, int>) {
+                    this->policy_->quantize(kw, std::span<T>{ values });
+                }
+
+                this->writeArray(kw, values);
+                return;
+            }
+        }
+
+        this->writeArray(kw, data);
+    }
+
+    template <typename T>
+    void Restart::writeArray(const std::string&    kw,
+                             const std::vector<T>& data)
+    {
+        if (this->deferred_.has_value()) {
+            this->pending_.emplace_back([kw, data](Restart& rst)
+            {
+                rst.writeArray(kw, data);
+            });
+
+            return;
+        }
+
         this->stream().write(kw, data);
+
+        if (this->compressed_ != nullptr) {
+            this->compressed_->write(kw, data);
+        }
+    }
+
+    template <typename T>
+    void Restart::writeConvertedArray(const std::string&            kw,
+                                      const std::span<const double> data,
+                                      const double                  factor,
+                                      const double                  offset)
+    {
+        if (this->deferred_.has_value()) {
+            // Unit conversion is left to commit().  Arrays of a shared
+            // owner stay valid until then, others must be copied.
+            if (! this->owners_.empty()) {
+                this->pending_.emplace_back([kw, data, factor, offset](Restart& rst)
+                {
+                    rst.writeConvertedArray<T>(kw, data, factor, offset);
+                });
+            }
+            else {
+                this->pending_.emplace_back
+                    ([kw, values = std::vector<double>(data.begin(), data.end()),
+                      factor, offset](Restart& rst)
+                {
+                    rst.writeConvertedArray<T>(kw, values, factor, offset);
+                });
+            }
+
+            return;
+        }
+
+        this->stream().writeConverted<T>(kw, data, factor, offset);
+
+        if (this->compressed_ != nullptr) {
+            this->compressed_->writeConverted<T>(kw, data, factor, offset);
+        }
+    }
+
+    void Restart::writeMessage(const std::string& msg)
+    {
+        if (this->deferred_.has_value()) {
+            this->pending_.emplace_back([msg](Restart& rst)
+            {
+                rst.writeMessage(msg);
+            });
+
+            return;
+        }
+
+        this->stream().message(msg);
+
+        if (this->compressed_ != nullptr) {
+            this->compressed_->message(msg);
+        }
     }
 
 }}}
@@ -500,7 +807,9 @@ RFT(const ResultSet&    rset,
 }
 
 Opm::EclIO::OutputStream::RFT::~RFT()
-{}
+{
+    this->closeStream();
+}
 
 Opm::EclIO::OutputStream::RFT::RFT(RFT&& rhs)
     : stream_{ std::move(rhs.stream_) }
@@ -509,6 +818,8 @@ Opm::EclIO::OutputStream::RFT::RFT(RFT&& rhs)
 Opm::EclIO::OutputStream::RFT&
 Opm::EclIO::OutputStream::RFT::operator=(RFT&& rhs)
 {
+    this->closeStream();
+
     this->stream_ = std::move(rhs.stream_);
 
     return *this;
@@ -542,9 +853,52 @@ open(const std::string& fname,
      const bool         formatted,
      const bool         existing)
 {
+    // RFT files are reopened at each report step with RFT output.  Carry
+    // forward the array index of the existing file, scanning the file
+    // only if its side-car index is missing or stale.
+    auto index = std::optional<EclIndex>{ EclIndex{ formatted, {}, 0 } };
+    if (existing && std::filesystem::exists(fname)) {
+        index = EclIndex::load(fname, formatted);
+
+        if (! index.has_value()) {
+            try {
+                index = EclIndex::scan(fname, formatted);
+            }
+            catch (const std::exception&) {
+                // Not a readable RFT file.  Append without an index.
+                index.reset();
+            }
+        }
+    }
+
+    // Any existing side-car index is about to become stale.
+    EclIndex::remove(fname);
+
     this->stream_ = existing
         ? Open::Rft::writeExisting(fname, formatted)
         : Open::Rft::writeNew     (fname, formatted);
+
+    if (index.has_value()) {
+        this->stream_->recordIndex(std::move(*index));
+    }
+}
+
+void Opm::EclIO::OutputStream::RFT::closeStream()
+{
+    if (this->stream_ == nullptr) {
+        return;
+    }
+
+    try {
+        this->stream_->writeIndex();
+    }
+    catch (const std::exception&) {
+        // The side-car index is an optional accelerator.  Readers fall
+        // back to scanning the RFT file if the index is missing.
+        EclIndex::remove(this->stream_->filename_);
+    }
+
+    this->stream_.reset();
 }
 
 Opm::EclIO::EclOutput&
@@ -944,13 +1298,23 @@ Opm::EclIO::OutputStream::createSummaryFile(const ResultSet& rset,
                                             const Unified&   unif)
 {
     const auto ext = FileExtension::summary(seqnum, fmt.set, unif.set);
+    const auto fname = outputFileName(rset, ext);
 
-    return std::unique_ptr<Opm::EclIO::EclOutput> {
+    auto stream = std::unique_ptr<Opm::EclIO::EclOutput> {
         new Opm::EclIO::EclOutput {
-            outputFileName(rset, ext),
-            fmt.set, std::ios_base::out
+            fname, fmt.set, std::ios_base::out
         }
     };
+
+    if (unif.set) {
+        // Unified summary files may grow large.  Record array locations
+        // for a side-car index which the caller writes, through
+        // EclOutput::writeIndex(), once the file is complete.
+        EclIndex::remove(fname);
+        stream->recordIndex(EclIndex{ fmt.set, {}, 0 });
+    }
+
+    return stream;
 }
 
 // =====================================================================
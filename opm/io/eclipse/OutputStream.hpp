@@ -27,15 +27,20 @@
 
 #include <array>
 #include <chrono>
+#include <functional>
 #include <ios>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace Opm { namespace EclIO {
 
+    class CompressedRestartWriter;
     class EclOutput;
+    namespace CompressedRestart { struct ReferenceCache; }
+    class RestartOutputPolicy;
 
 }} // namespace Opm::EclIO
 
@@ -43,6 +48,16 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 
     struct Formatted { bool set; };
     struct Unified   { bool set; };
+    struct Compressed
+    {
+        bool set;
+
+        /// Arrays of the previous report step, shared by the restart
+        /// streams of a run.  Null to read the previous report step back
+        /// from the companion file.
+        std::shared_ptr<CompressedRestart::ReferenceCache> cache{};
+    };
+    struct Deferred  { bool set; };
 
     /// Abstract representation of an ECLIPSE-style result set.
     struct ResultSet
@@ -119,6 +134,26 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&                        kw,
                    const std::vector<PaddedOutputString<8>>& data);
 
+        /// Write double precision data, converted on the fly, to
+        /// underlying output stream.
+        ///
+        /// Element x is output as (x - offset) * factor.  No full-size
+        /// copy of \p data is created, and \p data is not modified.
+        ///
+        /// \tparam T Output element type.  float (REAL) or double (DOUB).
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Input values, e.g., in SI units.
+        ///
+        /// \param[in] factor Scale factor, e.g., of unit conversion.
+        ///
+        /// \param[in] offset Offset subtracted before scaling.
+        template <typename T>
+        void writeConverted(const std::string&      kw,
+                            std::span<const double> data,
+                            double                  factor,
+                            double                  offset = 0.0);
 
         /// \param[in] msg Message string (e.g., "STARTSOL").
         void message(const std::string& msg);
@@ -173,6 +208,38 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                          const Formatted& fmt,
                          const Unified&   unif);
 
+        /// Constructor.
+        ///
+        /// Same as above, but optionally also writes all arrays to the
+        /// compressed companion file, e.g., CASE.UNRST.OPMZ, of the
+        /// restart file.  See CompressedRestartWriter.
+        ///
+        /// \param[in] comp Whether or not to create compressed companion
+        ///    file.
+        explicit Restart(const ResultSet&  rset,
+                         const int         seqnum,
+                         const Formatted&  fmt,
+                         const Unified&    unif,
+                         const Compressed& comp);
+
+        /// Constructor.
+        ///
+        /// Same as above, but optionally defers all file output to
+        /// commit().  A deferred stream applies the output policy and
+        /// keeps copies of all arrays in memory, except those of owners
+        /// passed to shareOwnership(), without accessing the file system,
+        /// so that the restart file can be created on another thread once
+        /// the simulator state has moved on.
+        ///
+        /// \param[in] defer Whether or not to defer file output to
+        ///    commit().
+        explicit Restart(const ResultSet&  rset,
+                         const int         seqnum,
+                         const Formatted&  fmt,
+                         const Unified&    unif,
+                         const Compressed& comp,
+                         const Deferred&   defer);
+
         ~Restart();
 
         Restart(const Restart& rhs) = delete;
@@ -238,10 +305,117 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&                        kw,
                    const std::vector<PaddedOutputString<8>>& data);
 
+        /// Write double precision data, converted on the fly, to
+        /// underlying output stream.
+        ///
+        /// Element x is output as (x - offset) * factor.  No full-size
+        /// copy of \p data is created, and \p data is not modified.
+        ///
+        /// \tparam T Output element type.  float (REAL) or double (DOUB).
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Input values, e.g., in SI units.
+        ///
+        /// \param[in] factor Scale factor, e.g., of unit conversion.
+        ///
+        /// \param[in] offset Offset subtracted before scaling.
+        template <typename T>
+        void writeConverted(const std::string&      kw,
+                            std::span<const double> data,
+                            double                  factor,
+                            double                  offset = 0.0);
+
+        /// Select and round per-cell solution arrays written after this
+        /// call.  See RestartOutputPolicy.
+        ///
+        /// The output cannot be used to restart a simulation run, so the
+        /// stream should not write to the run's regular restart file.
+        /// Use a result set whose base name has the suffix
+        /// RestartOutputPolicy::monitorSuffix.
+        ///
+        /// \param[in] policy Output policy.  Null for full output.
+        void setOutputPolicy(std::shared_ptr<const RestartOutputPolicy> policy);
+
+        /// Share ownership of the arrays passed to writeConverted().
+        ///
+        /// A deferred stream keeps \p owner alive until commit() and
+        /// records the arrays passed to writeConverted() after this call
+        /// by reference rather than by copy.  Those arrays must therefore
+        /// be part of \p owner and must not change before commit().  No
+        /// effect on streams which write directly.
+        ///
+        /// \param[in] owner Object holding the arrays.
+        void shareOwnership(std::shared_ptr<const void> owner);
+
+        /// Create the output files of a deferred stream and write all
+        /// arrays collected so far.
+        ///
+        /// Subsequent output goes directly to the files.  Errors, also
+        /// those of the compressed companion file, are reported by
+        /// exception.  No operation unless the stream is deferred.
+        void commit();
+
     private:
+        /// Output files of a deferred stream.
+        struct Target
+        {
+            /// Name of restart file.
+            std::string fname;
+
+            /// Sequence number of new report.
+            int seqnum;
+
+            /// Whether or not to create a formatted output file.
+            bool formatted;
+
+            /// Whether or not to create a unified output file.
+            bool unified;
+
+            /// Whether or not to create the compressed companion file.
+            bool compressed;
+
+            /// Arrays of the previous report step of the companion file.
+            std::shared_ptr<CompressedRestart::ReferenceCache> cache;
+        };
+
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Compressed companion output stream.  Null unless requested.
+        std::unique_ptr<CompressedRestartWriter> compressed_;
+
+        /// Selection and precision of per-cell arrays.  Null for full
+        /// output.
+        std::shared_ptr<const RestartOutputPolicy> policy_{};
+
+        /// Whether or not the stream is between STARTSOL and ENDSOL.
+        bool inSolution_{false};
+
+        /// Output files of a deferred stream.  Nullopt once the files are
+        /// open.
+        std::optional<Target> deferred_{};
+
+        /// Output operations recorded by a deferred stream, replayed by
+        /// commit().
+        std::vector<std::function<void(Restart&)>> pending_{};
+
+        /// Objects holding the arrays referenced by pending_.  Released by
+        /// commit().
+        std::vector<std::shared_ptr<const void>> owners_{};
+
+        /// Open output files and, for unified restart files, place the
+        /// output indicator at the start of the new report step.
+        void open(const Target& target);
+
+        /// Whether or not the output policy applies to an array of a
+        /// given size.
+        bool policyApplies(std::size_t size) const;
+
+        /// Write side-car array index of unified restart file and
+        /// release output streams.
+        void closeStream();
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
@@ -290,9 +464,26 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         EclOutput& stream();
 
         /// Implementation function for public \c write overload set.
+        /// Applies output policy.
         template <typename T>
         void writeImpl(const std::string&    kw,
                        const std::vector<T>& data);
+
+        /// Write array to restart and compressed output streams.
+        template <typename T>
+        void writeArray(const std::string&    kw,
+                        const std::vector<T>& data);
+
+        /// Write unit converted array to restart and compressed output
+        /// streams.
+        template <typename T>
+        void writeConvertedArray(const std::string&      kw,
+                                 std::span<const double> data,
+                                 double                  factor,
+                                 double                  offset);
+
+        /// Write message to restart and compressed output streams.
+        void writeMessage(const std::string& msg);
     };
 
     /// File manager for RFT output streams
@@ -367,6 +558,10 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                   const bool         formatted,
                   const bool         existing);
 
+        /// Write side-car array index of RFT file and release output
+        /// stream.
+        void closeStream();
+
         /// Access writable output stream.
         EclOutput& stream();
 
@@ -467,6 +662,11 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         EclOutput& stream();
     };
 
+    /// Create summary (UNSMRY or Snnnn) output stream.
+    ///
+    /// Unified output streams record the location of all arrays written
+    /// to them.  Call EclOutput::writeIndex() to store a side-car index of
+    /// the completed file.
     std::unique_ptr<EclOutput>
     createSummaryFile(const ResultSet& rset,
                       const int        seqnum,
@@ -0,0 +1,235 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/RestartOutputPolicy.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    /// Round to nearest multiple of 2*maxError, in output precision T.
+    ///
+    /// The multiple need not be representable in T.  If rounding it to T
+    /// violates the error bound, the nearest value of type T within the
+    /// bound is used instead, or the value itself if the bound is smaller
+    /// than the precision of T.
+    template <typename T>
+    T roundAbsolute(const T x, const double maxError)
+    {
+        const auto step = 2.0 * maxError;
+        const auto q = static_cast<T>(std::round(x / step) * step);
+
+        if (std::abs(static_cast<double>(q) - x) <= maxError) {
+            return q;
+        }
+
+        const auto r = std::nextafter(q, x);
+        return (std::abs(static_cast<double>(r) - x) <= maxError) ? r : x;
+    }
+
+    /// Round significand to 'bits' bits after the leading bit.  At most
+    /// the number of significand bits of T are retained.
+    template <typename T>
+    T roundSignificand(const T x, const int bits)
+    {
+        constexpr auto maxBits = std::numeric_limits<T>::digits - 1;
+
+        if ((x == T{0}) || ! std::isfinite(x) || (bits >= maxBits)) {
+            return x;
+        }
+
+        auto exponent = 0;
+        const auto fraction = std::frexp(x, &exponent);  // [0.5, 1)
+
+        return std::ldexp(std::round(std::ldexp(fraction, bits + 1)),
+                          exponent - (bits + 1));
+    }
+
+    template <typename T>
+    void quantizeValues(const std::unordered_map<std::string, double>& absoluteError,
+                        const std::optional<int>&                      significandBits,
+                        const std::string&                             name,
+                        const std::span<T>                             values)
+    {
+        if (auto pos = absoluteError.find(name); pos != absoluteError.end()) {
+            std::transform(values.begin(), values.end(), values.begin(),
+                           [maxError = pos->second](const T x)
+                           { return std::isfinite(x) ? roundAbsolute(x, maxError) : x; });
+        }
+        else if (significandBits.has_value()) {
+            std::transform(values.begin(), values.end(), values.begin(),
+                           [bits = *significandBits](const T x)
+                           { return roundSignificand(x, bits); });
+        }
+    }
+
+} // Anonymous namespace
+
+Opm::EclIO::RestartOutputPolicy::RestartOutputPolicy(const std::size_t numActive)
+    : numActive_ { numActive }
+{}
+
+template <typename Predicate>
+void Opm::EclIO::RestartOutputPolicy::restrictCells(Predicate&& pred)
+{
+    auto cells = this->cells();
+    std::erase_if(cells, [&pred](const int cell)
+    { return ! pred(static_cast<std::size_t>(cell)); });
+
+    this->cells_ = std::move(cells);
+}
+
+Opm::EclIO::RestartOutputPolicy&
+Opm::EclIO::RestartOutputPolicy::selectArrays(const std::vector<std::string>& names)
+{
+    this->arrays_.emplace(names.begin(), names.end());
+    return *this;
+}
+
+Opm::EclIO::RestartOutputPolicy&
+Opm::EclIO::RestartOutputPolicy::selectCellRange(const std::size_t begin,
+                                                 const std::size_t end)
+{
+    const auto last = std::min(end, this->numActive_);
+
+    this->restrictCells([begin, last](const std::size_t cell)
+    { return (cell >= begin) && (cell < last); });
+
+    return *this;
+}
+
+Opm::EclIO::RestartOutputPolicy&
+Opm::EclIO::RestartOutputPolicy::selectRegions(const std::vector<int>& regionID,
+                                               const std::vector<int>& regions)
+{
+    if (regionID.size() != this->numActive_) {
+        throw std::invalid_argument {
+            fmt::format("Region array size {} does not match "
+                        "number of active cells {}",
+                        regionID.size(), this->numActive_)
+        };
+    }
+
+    const auto selected = std::unordered_set<int>(regions.begin(), regions.end());
+
+    this->restrictCells([&regionID, &selected](const std::size_t cell)
+    { return selected.contains(regionID[cell]); });
+
+    return *this;
+}
+
+Opm::EclIO::RestartOutputPolicy&
+Opm::EclIO::RestartOutputPolicy::setAbsoluteError(const std::string& name,
+                                                  const double       maxError)
+{
+    if (maxError > 0.0) {
+        this->absoluteError_.insert_or_assign(name, maxError);
+    }
+    else {
+        this->absoluteError_.erase(name);
+    }
+
+    return *this;
+}
+
+Opm::EclIO::RestartOutputPolicy&
+Opm::EclIO::RestartOutputPolicy::setSignificandBits(const int bits)
+{
+    if ((bits >= 0) && (bits < 52)) {
+        this->significandBits_ = bits;
+    }
+    else {
+        this->significandBits_.reset();
+    }
+
+    return *this;
+}
+
+bool Opm::EclIO::RestartOutputPolicy::fullOutput() const
+{
+    return (this->numActive_ == 0)
+        || (! this->arrays_.has_value() &&
+            ! this->cells_.has_value() &&
+            this->absoluteError_.empty() &&
+            ! this->significandBits_.has_value());
+}
+
+bool Opm::EclIO::RestartOutputPolicy::selected(const std::string& name) const
+{
+    return ! this->arrays_.has_value() || this->arrays_->contains(name);
+}
+
+std::vector<int> Opm::EclIO::RestartOutputPolicy::cells() const
+{
+    if (this->cells_.has_value()) {
+        return *this->cells_;
+    }
+
+    auto all = std::vector<int>(this->numActive_);
+    std::iota(all.begin(), all.end(), 0);
+
+    return all;
+}
+
+template <typename T>
+std::vector<T>
+Opm::EclIO::RestartOutputPolicy::gather(std::span<const T> values) const
+{
+    if (! this->cells_.has_value()) {
+        return { values.begin(), values.end() };
+    }
+
+    auto subset = std::vector<T>{};
+    subset.reserve(this->cells_->size());
+
+    for (const auto& cell : *this->cells_) {
+        subset.push_back(values[cell]);
+    }
+
+    return subset;
+}
+
+void Opm::EclIO::RestartOutputPolicy::quantize(const std::string&     name,
+                                               const std::span<double> values) const
+{
+    quantizeValues(this->absoluteError_, this->significandBits_, name, values);
+}
+
+void Opm::EclIO::RestartOutputPolicy::quantize(const std::string&    name,
+                                               const std::span<float> values) const
+{
+    quantizeValues(this->absoluteError_, this->significandBits_, name, values);
+}
+
+template std::vector<int>    Opm::EclIO::RestartOutputPolicy::gather(std::span<const int>) const;
+template std::vector<float>  Opm::EclIO::RestartOutputPolicy::gather(std::span<const float>) const;
+template std::vector<double> Opm::EclIO::RestartOutputPolicy::gather(std::span<const double>) const;
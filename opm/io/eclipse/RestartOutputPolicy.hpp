@@ -0,0 +1,176 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_RESTART_OUTPUT_POLICY_HPP
+#define OPM_IO_RESTART_OUTPUT_POLICY_HPP
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Opm::EclIO {
+
+/// Selection and precision of per-cell restart arrays.
+///
+/// Intended for light-weight monitoring restart files written more
+/// frequently than regular restart files.  The policy applies to per-cell
+/// arrays, i.e., arrays in the solution section (between the STARTSOL and
+/// ENDSOL messages) which have one value per active cell.  All other
+/// arrays, such as the header, well and group arrays, are written
+/// unchanged so that the output remains a valid restart file.  A restart
+/// file written with a cell selection cannot be used to restart a
+/// simulation run, so monitoring output goes to a separate restart file,
+/// e.g., CASE_MON.UNRST, whose base name has the suffix monitorSuffix.
+/// The regular restart file remains complete.
+///
+/// A default constructed policy selects all arrays, all cells and full
+/// precision.
+class RestartOutputPolicy
+{
+public:
+    /// Name of the array of selected active cells.  Zero-based active
+    /// cell indices.  Written at the start of each solution section if
+    /// the policy has a cell selection.
+    static constexpr auto cellArrayName = "OPMCELLS";
+
+    /// Suffix appended to the run's base name to form the base name of
+    /// the monitoring restart file.
+    static constexpr auto monitorSuffix = "_MON";
+
+    /// Default constructor.  Full output.
+    RestartOutputPolicy() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] numActive Number of active cells in model.  Only
+    ///   solution arrays of this size are subject to the policy.
+    explicit RestartOutputPolicy(std::size_t numActive);
+
+    /// Restrict output to a set of named per-cell arrays.  Other per-cell
+    /// arrays are not written.
+    ///
+    /// \param[in] names Array names, e.g., PRESSURE and SWAT.
+    RestartOutputPolicy& selectArrays(const std::vector<std::string>& names);
+
+    /// Restrict output to a range of active cells.  Intersected with any
+    /// existing cell selection.
+    ///
+    /// \param[in] begin First active cell, zero-based.
+    ///
+    /// \param[in] end One past last active cell.  Clamped to the number
+    ///   of active cells.
+    RestartOutputPolicy& selectCellRange(std::size_t begin, std::size_t end);
+
+    /// Restrict output to cells in a set of regions.  Intersected with any
+    /// existing cell selection.
+    ///
+    /// \param[in] regionID Region ID, e.g., FIPNUM, of each active cell.
+    ///
+    /// \param[in] regions Selected region IDs.
+    RestartOutputPolicy& selectRegions(const std::vector<int>& regionID,
+                                       const std::vector<int>& regions);
+
+    /// Round values of a single array to multiples of 2*maxError.
+    ///
+    /// Single precision arrays are rounded in single precision.  Where a
+    /// multiple is not representable, the nearest single precision value
+    /// within the error bound is written instead, so the bound holds for
+    /// the output values.
+    ///
+    /// \param[in] name Array name.
+    ///
+    /// \param[in] maxError Maximum absolute error, in output units.
+    ///   Non-positive values disable rounding of this array.
+    RestartOutputPolicy& setAbsoluteError(const std::string& name, double maxError);
+
+    /// Round values of all floating-point arrays without an absolute
+    /// error bound to a reduced number of significand bits.  The relative
+    /// error is at most 2^-(bits + 1).  Single precision arrays retain at
+    /// most their 23 significand bits, i.e., their relative error is at
+    /// most max(2^-(bits + 1), 2^-24).
+    ///
+    /// \param[in] bits Number of significand bits retained after the
+    ///   leading bit.  Values outside [0, 52) disable rounding.
+    RestartOutputPolicy& setSignificandBits(int bits);
+
+    /// Whether or not this policy changes output at all.
+    bool fullOutput() const;
+
+    /// Whether or not an array is subject to this policy.
+    ///
+    /// \param[in] size Number of array elements.
+    bool perCell(std::size_t size) const
+    {
+        return (this->numActive_ > 0) && (size == this->numActive_);
+    }
+
+    /// Whether or not to write a per-cell array.
+    bool selected(const std::string& name) const;
+
+    /// Whether or not this policy restricts the set of cells.
+    bool hasCellSelection() const { return this->cells_.has_value(); }
+
+    /// Selected active cells, zero-based, in increasing order.  All
+    /// active cells if there is no cell selection.
+    std::vector<int> cells() const;
+
+    /// Values of selected cells.
+    ///
+    /// \param[in] values Per-cell values.
+    template <typename T>
+    std::vector<T> gather(std::span<const T> values) const;
+
+    /// Round values of a single floating-point array in place.
+    ///
+    /// \param[in] name Array name.
+    ///
+    /// \param[in,out] values Array values in output units and output
+    ///   precision.
+    void quantize(const std::string& name, std::span<double> values) const;
+
+    /// Round values of a single single precision array in place.
+    void quantize(const std::string& name, std::span<float> values) const;
+
+private:
+    /// Number of active cells in model.
+    std::size_t numActive_{0};
+
+    /// Selected arrays.  Nullopt for all arrays.
+    std::optional<std::unordered_set<std::string>> arrays_{};
+
+    /// Selected cells.  Nullopt for all cells.
+    std::optional<std::vector<int>> cells_{};
+
+    /// Absolute error bounds of individual arrays.
+    std::unordered_map<std::string, double> absoluteError_{};
+
+    /// Retained significand bits.  Nullopt for full precision.
+    std::optional<int> significandBits_{};
+
+    /// Intersect cell selection with cells for which pred(cell) is true.
+    template <typename Predicate>
+    void restrictCells(Predicate&& pred);
+};
+
+} // namespace Opm::EclIO
+
+#endif // OPM_IO_RESTART_OUTPUT_POLICY_HPP
@@ -31,6 +31,7 @@
 #include <opm/io/eclipse/rst/udq.hpp>
 #include <opm/io/eclipse/rst/well.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
@@ -362,6 +363,30 @@ namespace {
                           doubhead[VI::doubhead::OilVapPropensity],
                           doubhead[VI::doubhead::OilVapDensPropensity]);
     }
+
+    /// Minimum number of wells or groups for which to decode restart
+    /// objects in parallel.
+    constexpr auto minParallelObjects = std::size_t{32};
+
+    /// Decode n independent restart objects, possibly in parallel, and
+    /// append them in index order to \p objects.
+    template <typename T, typename MakeObject>
+    void appendDecoded(const std::size_t n,
+                       MakeObject&&      makeObject,
+                       std::vector<T>&   objects)
+    {
+        auto decoded = std::vector<std::optional<T>>(n);
+
+        Opm::parallelFor(n, minParallelObjects, [&decoded, &makeObject](const std::size_t i)
+        {
+            decoded[i].emplace(makeObject(i));
+        });
+
+        objects.reserve(objects.size() + n);
+        for (auto& object : decoded) {
+            objects.push_back(std::move(*object));
+        }
+    }
 }
 
 namespace Opm::RestartIO {
@@ -461,17 +486,18 @@ void RstState::add_groups(const std::vector<std::string>& zgrp,
         std::size_t sgrp_offset = ig * this->header.nsgrpz;
         std::size_t xgrp_offset = ig * this->header.nxgrpz;
 
-        this->groups.emplace_back(this->unit_system,
-                                  this->header,
-                                  zgrp.data() + zgrp_offset,
-                                  igrp.data() + igrp_offset,
-                                  sgrp.data() + sgrp_offset,
-                                  xgrp.data() + xgrp_offset);
+        return RstGroup { this->unit_system,
+                          this->header,
+                          zgrp.data() + zgrp_offset,
+                          igrp.data() + igrp_offset,
+                          sgrp.data() + sgrp_offset,
+                          xgrp.data() + xgrp_offset };
     };
 
     // Load active named/user-defined groups.
-    for (int ig=0; ig < this->header.ngroup; ig++)
-        load_group(ig);
+    appendDecoded(this->header.ngroup,
+                  [&load_group](const std::size_t ig) { return load_group(ig); },
+                  this->groups);
 
     // Load FIELD group from zero-based window index NGMAX in the *GRP
     // arrays.  Needed to reconstruct any field-wide constraints (e.g.,
@@ -480,7 +506,7 @@ void RstState::add_groups(const std::vector<std::string>& zgrp,
     // Recall that 'max_groups_in_field' is really NGMAX + 1 here as FIELD
     // is also included in this value in the restart file.  Subtract one to
     // get the actual NGMAX value.
-    load_group(this->header.max_groups_in_field - 1);
+    this->groups.push_back(load_group(this->header.max_groups_in_field - 1));
 }
 
 void RstState::add_wells(const std::vector<std::string>& zwel,
@@ -491,8 +517,11 @@ void RstState::add_wells(const std::vector<std::string>& zwel,
                          const std::vector<float>& scon,
                          const std::vector<double>& xcon)
 {
-
-    for (int iw = 0; iw < this->header.num_wells; iw++) {
+    // Wells, and their connections, are independent of each other.  The
+    // well constructor reads directly from the restart arrays, so decode
+    // them in parallel.
+    appendDecoded(this->header.num_wells, [&, this](const std::size_t iw)
+    {
         std::size_t zwel_offset = iw * this->header.nzwelz;
         std::size_t iwel_offset = iw * this->header.niwelz;
         std::size_t swel_offset = iw * this->header.nswelz;
@@ -501,22 +530,24 @@ void RstState::add_wells(const std::vector<std::string>& zwel,
         std::size_t scon_offset = iw * this->header.nsconz * this->header.ncwmax;
         std::size_t xcon_offset = iw * this->header.nxconz * this->header.ncwmax;
         int group_index = iwel[ iwel_offset + VI::IWell::Group ] - 1;
-        const std::string group = this->groups[group_index].name;
-
-        this->wells.emplace_back(this->unit_system,
-                                 this->header,
-                                 group,
-                                 zwel.data() + zwel_offset,
-                                 iwel.data() + iwel_offset,
-                                 swel.data() + swel_offset,
-                                 xwel.data() + xwel_offset,
-                                 icon.data() + icon_offset,
-                                 scon.data() + scon_offset,
-                                 xcon.data() + xcon_offset);
-
-        if (this->wells.back().msw_index)
+        const std::string& group = this->groups[group_index].name;
+
+        auto well = RstWell { this->unit_system,
+                              this->header,
+                              group,
+                              zwel.data() + zwel_offset,
+                              iwel.data() + iwel_offset,
+                              swel.data() + swel_offset,
+                              xwel.data() + xwel_offset,
+                              icon.data() + icon_offset,
+                              scon.data() + scon_offset,
+                              xcon.data() + xcon_offset };
+
+        if (well.msw_index)
             throw std::logic_error("MSW data not accounted for in this constructor");
-    }
+
+        return well;
+    }, this->wells);
 }
 
 void RstState::add_msw(const std::vector<std::string>& zwel,
@@ -529,8 +560,10 @@ void RstState::add_msw(const std::vector<std::string>& zwel,
                        const std::vector<int>& iseg,
                        const std::vector<double>& rseg)
 {
-
-    for (int iw = 0; iw < this->header.num_wells; iw++) {
+    // Segments are stored per multi-segmented well, so wells remain
+    // independent of each other.
+    appendDecoded(this->header.num_wells, [&, this](const std::size_t iw)
+    {
         std::size_t zwel_offset = iw * this->header.nzwelz;
         std::size_t iwel_offset = iw * this->header.niwelz;
         std::size_t swel_offset = iw * this->header.nswelz;
@@ -539,21 +572,21 @@ void RstState::add_msw(const std::vector<std::string>& zwel,
         std::size_t scon_offset = iw * this->header.nsconz * this->header.ncwmax;
         std::size_t xcon_offset = iw * this->header.nxconz * this->header.ncwmax;
         int group_index = iwel[ iwel_offset + VI::IWell::Group ] - 1;
-        const std::string group = this->groups[group_index].name;
-
-        this->wells.emplace_back(this->unit_system,
-                                 this->header,
-                                 group,
-                                 zwel.data() + zwel_offset,
-                                 iwel.data() + iwel_offset,
-                                 swel.data() + swel_offset,
-                                 xwel.data() + xwel_offset,
-                                 icon.data() + icon_offset,
-                                 scon.data() + scon_offset,
-                                 xcon.data() + xcon_offset,
-                                 iseg,
-                                 rseg);
-    }
+        const std::string& group = this->groups[group_index].name;
+
+        return RstWell { this->unit_system,
+                         this->header,
+                         group,
+                         zwel.data() + zwel_offset,
+                         iwel.data() + iwel_offset,
+                         swel.data() + swel_offset,
+                         xwel.data() + xwel_offset,
+                         icon.data() + icon_offset,
+                         scon.data() + scon_offset,
+                         xcon.data() + xcon_offset,
+                         iseg,
+                         rseg };
+    }, this->wells);
 }
 
 void RstState::add_udqs(std::shared_ptr<EclIO::RestartFileView> rstView)
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iosfwd>
 #include <stdexcept>
 #include <vector>
@@ -123,6 +124,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateUniformSpacing_();
     }
 
     /*!
@@ -147,6 +150,8 @@ public:
             else if (xValues_[0] > xValues_[numSamples() - 1])
                 reverseSamplingPoints_();
         }
+
+        updateUniformSpacing_();
     }
 
     /*!
@@ -171,6 +176,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateUniformSpacing_();
     }
 
     /*!
@@ -207,6 +214,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateUniformSpacing_();
     }
 
     /*!
@@ -236,6 +245,13 @@ public:
     const std::vector<Scalar>& xValues() const
     { return xValues_; }
 
+    /*!
+     * \brief Returns true if the sampling points are (nearly) uniformly
+     *        spaced, so that the segment search does not need a bisection.
+     */
+    bool uniformlySpaced() const
+    { return uniformDx_ > 0.0; }
+
     const std::vector<Scalar>& yValues() const
     { return yValues_; }
 
@@ -281,6 +297,22 @@ public:
         return y0 + (y1 - y0)*(x - x0)/(x1 - x0);
     }
 
+    /*!
+     * \brief Evaluate the function at a given position, using \p segIdx
+     *        as a cursor.
+     *
+     * The segment search starts at \p segIdx, which is then updated to the
+     * segment of \p x.  This is useful when the function is evaluated
+     * repeatedly for slowly changing positions, e.g., for the same cell in
+     * subsequent Newton iterations.
+     */
+    template <class Evaluation>
+    Evaluation eval(const Evaluation& x, bool extrapolate, SegmentIndex& segIdx) const
+    {
+        segIdx = findSegmentIndex(x, extrapolate, segIdx);
+        return eval(x, segIdx);
+    }
+
     /*!
      * \brief Evaluate the spline's derivative at a given position.
      *
@@ -460,6 +492,15 @@ public:
         else if (x >= xValues_[xValues_.size() - 2])
             return SegmentIndex{xValues_.size() - 2};
         else {
+            if (uniformlySpaced()) {
+                // the segment is at most one away from the one on the uniform grid
+                const Scalar pos = (Opm::getValue(x) - xValues_[0]) / uniformDx_;
+                size_t segIdx = std::min(static_cast<size_t>(std::max(pos, Scalar{0})),
+                                         xValues_.size() - 2);
+                if (findNearbySegment_(x, segIdx))
+                    return SegmentIndex{segIdx};
+            }
+
             // bisection
             size_t lowerIdx = 1;
             size_t upperIdx = xValues_.size() - 2;
@@ -503,7 +544,63 @@ public:
         }
     }
 
+    /*!
+     * \brief Find the segment containing \p x, starting at a previously
+     *        found segment.
+     *
+     * Returns the same segment as findSegmentIndex(x, extrapolate), but
+     * without a full search if \p x lies in segment \p hint or one of its
+     * neighbours, e.g., when evaluating the function for a sequence of
+     * nearby positions.
+     */
+    template <class Evaluation>
+    SegmentIndex findSegmentIndex(const Evaluation& x, bool extrapolate, SegmentIndex hint) const
+    {
+        const size_t n = numSamples();
+        if ((n > 2) && (hint.value < n - 1) && isfinite(x) && (extrapolate || applies(x))) {
+            size_t segIdx = hint.value;
+            if (findNearbySegment_(x, segIdx))
+                return SegmentIndex{segIdx};
+        }
+
+        return findSegmentIndex(x, extrapolate);
+    }
+
 private:
+    // Set segIdx to the segment of x if that is segIdx or one of its
+    // neighbours.  Returns false if x lies further away.
+    template <class Evaluation>
+    bool findNearbySegment_(const Evaluation& x, size_t& segIdx) const
+    {
+        if (segmentContains_(segIdx, x))
+            return true;
+
+        if ((segIdx + 2 < xValues_.size()) && segmentContains_(segIdx + 1, x)) {
+            ++segIdx;
+            return true;
+        }
+
+        if ((segIdx > 0) && segmentContains_(segIdx - 1, x)) {
+            --segIdx;
+            return true;
+        }
+
+        return false;
+    }
+
+    // Whether or not findSegmentIndex() returns segment segIdx for x.
+    template <class Evaluation>
+    bool segmentContains_(size_t segIdx, const Evaluation& x) const
+    {
+        const size_t lastSegIdx = xValues_.size() - 2;
+        if (x <= xValues_[1])
+            return segIdx == 0;
+        else if (x >= xValues_[lastSegIdx])
+            return segIdx == lastSegIdx;
+        else
+            return (xValues_[segIdx] <= x) && (x < xValues_[segIdx + 1]);
+    }
+
     template <class Evaluation>
     Evaluation evalDerivative_(const Evaluation& x, size_t segIdx) const
     {
@@ -605,6 +702,34 @@ private:
         }
     }
 
+    /*!
+     * \brief Detect (nearly) uniformly spaced sampling points.
+     *
+     * The spacing is considered uniform if no sampling point deviates by
+     * more than a quarter of the mean spacing from its position on the
+     * uniform grid.  The segment on the uniform grid is then at most one
+     * away from the actual segment of any position.
+     */
+    void updateUniformSpacing_()
+    {
+        uniformDx_ = 0.0;
+
+        const size_t n = numSamples();
+        if (n < 3)
+            return;
+
+        const Scalar dx = (xValues_[n - 1] - xValues_[0]) / (n - 1);
+        if (!(dx > 0.0))
+            return;
+
+        for (size_t i = 1; i < n - 1; ++i) {
+            if (std::abs(xValues_[i] - (xValues_[0] + i*dx)) > dx/4)
+                return;
+        }
+
+        uniformDx_ = dx;
+    }
+
     /*!
      * \brief Resizes the internal vectors to store the sample points.
      */
@@ -616,6 +741,9 @@ private:
 
     std::vector<Scalar> xValues_;
     std::vector<Scalar> yValues_;
+
+    // spacing of the sampling points if they are uniformly spaced, zero otherwise
+    Scalar uniformDx_{0.0};
 };
 
 } // namespace Opm
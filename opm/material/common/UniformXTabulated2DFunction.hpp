@@ -33,6 +33,7 @@
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/common/MathToolbox.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iosfwd>
@@ -84,7 +85,11 @@ public:
         , xPos_(xPos)
         , yPos_(yPos)
         , interpolationGuide_(interpolationGuide)
-    { }
+    {
+        yUniformDy_.resize(samples_.size());
+        for (size_t i = 0; i < samples_.size(); ++i)
+            updateUniformYSpacing_(i);
+    }
 
     /*!
      * \brief Returns the minimum of the X coordinate of the sampling points.
@@ -249,6 +254,20 @@ public:
         else {
             assert(colSamplePoints.size() >= 3);
 
+            const Scalar dy = yUniformDy_[xSampleIdx];
+            const Scalar pos = dy > 0.0
+                ? (decay<Scalar>(y) - std::get<1>(colSamplePoints.front())) / dy
+                : Scalar{0};
+            // NaN ends up here since it fails both comparisons above, and
+            // converting it to an integer is undefined
+            if (dy > 0.0 && std::isfinite(pos)) {
+                // the segment is at most one away from the one on the uniform grid
+                unsigned segIdx = std::min(static_cast<unsigned>(std::max(pos, Scalar{0})),
+                                           static_cast<unsigned>(colSamplePoints.size() - 2));
+                if (findNearbyYSegment_(y, xSampleIdx, segIdx))
+                    return segIdx;
+            }
+
             // bisection
             unsigned lowerIdx = 1;
             unsigned upperIdx = colSamplePoints.size() - 2;
@@ -264,6 +283,31 @@ public:
         }
     }
 
+    /*!
+     * \brief Return the interval index of a given position on the y-axis,
+     *        starting at a previously found interval.
+     *
+     * Returns the same interval as ySegmentIndex(y, xSampleIdx, extrapolate),
+     * but without a full search if \p y lies in interval \p hint or one of
+     * its neighbours.
+     */
+    template <class Evaluation>
+    unsigned ySegmentIndex(const Evaluation& y, unsigned xSampleIdx,
+                           bool extrapolate, unsigned hint) const
+    {
+        assert(xSampleIdx < numX());
+
+        unsigned segIdx = hint;
+        if ((samples_[xSampleIdx].size() > 2) &&
+            (segIdx < samples_[xSampleIdx].size() - 1) &&
+            findNearbyYSegment_(y, xSampleIdx, segIdx))
+        {
+            return segIdx;
+        }
+
+        return ySegmentIndex(y, xSampleIdx, extrapolate);
+    }
+
     /*!
      * \brief Return the relative position of an y value in an interval
      *
@@ -420,6 +464,7 @@ public:
             xPos_.push_back(nextX);
             yPos_.push_back(std::numeric_limits<Scalar>::lowest() / 2);
             samples_.push_back({});
+            yUniformDy_.push_back(0.0);
             return xPos_.size() - 1;
         }
         else if (xPos_.front() > nextX) {
@@ -427,6 +472,7 @@ public:
             xPos_.insert(xPos_.begin(), nextX);
             yPos_.insert(yPos_.begin(), std::numeric_limits<Scalar>::lowest() / 2);
             samples_.insert(samples_.begin(), std::vector<SamplePoint>());
+            yUniformDy_.insert(yUniformDy_.begin(), 0.0);
             return 0;
         }
         throw std::invalid_argument("Sampling points should be specified either monotonically "
@@ -452,6 +498,7 @@ public:
             if (interpolationGuide_ == InterpolationPolicy::RightExtreme) {
                 yPos_[i] = y;
             }
+            updateUniformYSpacing_(i);
             return samples_[i].size() - 1;
         }
         else if (std::get<1>(samples_[i].front()) > y) {
@@ -460,6 +507,7 @@ public:
             if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
                 yPos_[i] = y;
             }
+            updateUniformYSpacing_(i);
             return 0;
         }
 
@@ -483,6 +531,68 @@ public:
     }
 
 private:
+    // Whether or not ySegmentIndex() returns interval segIdx for y.
+    template <class Evaluation>
+    bool ySegmentContains_(const Evaluation& y, unsigned xSampleIdx, unsigned segIdx) const
+    {
+        const auto& colSamplePoints = samples_[xSampleIdx];
+        const unsigned lastSegIdx = colSamplePoints.size() - 2;
+        if (y <= std::get<1>(colSamplePoints[1]))
+            return segIdx == 0;
+        else if (y >= std::get<1>(colSamplePoints[lastSegIdx]))
+            return segIdx == lastSegIdx;
+        else
+            return (std::get<1>(colSamplePoints[segIdx]) <= y) &&
+                   (y < std::get<1>(colSamplePoints[segIdx + 1]));
+    }
+
+    // Set segIdx to the interval of y if that is segIdx or one of its
+    // neighbours.  Returns false if y lies further away.
+    template <class Evaluation>
+    bool findNearbyYSegment_(const Evaluation& y, unsigned xSampleIdx, unsigned& segIdx) const
+    {
+        if (ySegmentContains_(y, xSampleIdx, segIdx))
+            return true;
+
+        if ((segIdx + 2 < samples_[xSampleIdx].size()) &&
+            ySegmentContains_(y, xSampleIdx, segIdx + 1))
+        {
+            ++segIdx;
+            return true;
+        }
+
+        if ((segIdx > 0) && ySegmentContains_(y, xSampleIdx, segIdx - 1)) {
+            --segIdx;
+            return true;
+        }
+
+        return false;
+    }
+
+    // Detect (nearly) uniformly spaced sampling points along line i, using
+    // the same criterion as Tabulated1DFunction.
+    void updateUniformYSpacing_(size_t i)
+    {
+        const auto& colSamplePoints = samples_[i];
+        yUniformDy_[i] = 0.0;
+
+        const size_t n = colSamplePoints.size();
+        if (n < 3)
+            return;
+
+        const Scalar y0 = std::get<1>(colSamplePoints.front());
+        const Scalar dy = (std::get<1>(colSamplePoints.back()) - y0) / (n - 1);
+        if (!(dy > 0.0))
+            return;
+
+        for (size_t j = 1; j < n - 1; ++j) {
+            if (std::abs(std::get<1>(colSamplePoints[j]) - (y0 + j*dy)) > dy/4)
+                return;
+        }
+
+        yUniformDy_[i] = dy;
+    }
+
     // the vector which contains the values of the sample points
     // f(x_i, y_j). don't use this directly, use getSamplePoint(i,j)
     // instead!
@@ -493,6 +603,9 @@ private:
     // the position on the y-axis of the guide point
     std::vector<Scalar> yPos_;
     InterpolationPolicy interpolationGuide_;
+    // spacing of the sampling points along each vertical line if they are
+    // uniformly spaced, zero otherwise
+    std::vector<Scalar> yUniformDy_;
 };
 } // namespace Opm
 
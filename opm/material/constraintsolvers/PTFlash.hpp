@@ -48,9 +48,15 @@
 #include <dune/common/fmatrix.hh>
 #include <dune/common/classname.hh>
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -88,39 +94,193 @@ public:
                       const EOSType& eos_type,
                       int verbosity = 0)
     {
-        using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
-        ScalarFluidState fluid_state_scalar;
+        auto fluid_state_scalar = scalarFluidState_(fluid_state);
 
-        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx) ) );
-            fluid_state_scalar.setMoleFraction(compIdx, Opm::getValue(fluid_state.moleFraction(compIdx) ) );
-        }
+        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
 
-        fluid_state_scalar.setLvalue(Opm::getValue(fluid_state.L()));
-        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
-        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
-        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
+        copyFlashResults_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
 
-        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
+        return is_single_phase;
+    } //end solve
 
-        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
+    /*!
+     * \brief Results of the flash calculation of a cell which are carried
+     *        over to the next batched flash calculation of the same cell.
+     *
+     * An empty (default constructed) history makes the flash start from
+     * the K-values and the liquid fraction L of the fluid state.
+     */
+    struct CellHistory
+    {
+        //! K-values of the last flash calculation
+        std::array<Scalar, numComponents> K{};
 
-        // the flash solution process were performed in scalar form, after the flash calculation finishes,
-        // ensure that things in fluid_state_scalar is transformed to fluid_state
-        for (int compIdx=0; compIdx<numComponents; ++compIdx){
-                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
-                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+        //! Liquid mole fraction of the last flash calculation
+        Scalar L{};
+
+        //! Pressure [Pa], temperature [K] and global composition at the
+        //! last phase stability test
+        Scalar stabilityPressure{};
+        Scalar stabilityTemperature{};
+        std::array<Scalar, numComponents> stabilityComposition{};
+
+        //! One minus the largest mole number sum of the trial phases of
+        //! the last stability test if it found the cell single-phase and
+        //! neither trial phase was trivial, zero otherwise
+        Scalar stabilityMargin{};
+
+        //! Whether the history holds the results of a flash calculation
+        bool valid{false};
+    };
+
+    /*!
+     * \brief Criteria for skipping the phase stability test of a cell
+     *        which was single-phase in its last batched flash calculation.
+     *
+     * The test is skipped if its last result was single-phase by at least
+     * the given margin and the state of the cell changed by less than the
+     * given amounts since that test.  The changes are measured from the
+     * state of the last test rather than of the last call, so slow drifts
+     * towards the phase boundary eventually trigger a new test.  Cells
+     * whose last test had a trial phase converge to the trivial solution,
+     * e.g. near the critical point, are always tested again.
+     */
+    struct BatchParameters
+    {
+        Scalar minStabilityMargin{0.1};
+        Scalar maxRelativePressureChange{0.02};
+        Scalar maxTemperatureChange{1.0}; // [K]
+        Scalar maxCompositionChange{0.005};
+    };
+
+    //! Counters of a batched flash calculation.
+    struct BatchStatistics
+    {
+        std::size_t numTwoPhase{0};
+        std::size_t numStabilityTests{0};
+        std::size_t numSkippedStabilityTests{0};
+    };
+
+    /*!
+     * \brief Calculates the fluid states of a batch of cells from the global
+     *        mole fractions of the components and the phase pressures.
+     *
+     * Each cell is flashed as by solve(), except that
+     *  - the K-values and L are taken from the history of the cell if it
+     *    is not empty, i.e., the flash is warm started from the results of
+     *    the previous call,
+     *  - the stability test of a cell which was clearly single-phase in
+     *    the previous call is skipped if the state of the cell changed only
+     *    little, see BatchParameters,
+     *  - the Rachford-Rice equations of all two-phase cells are solved
+     *    together, see solveRachfordRiceBatch_g_().
+     *
+     * The history of each cell is updated with the results of the flash.
+     */
+    template <class FluidState>
+    static BatchStatistics solveBatch(std::span<FluidState> fluid_states,
+                                      std::span<CellHistory> history,
+                                      const std::string& twoPhaseMethod,
+                                      Scalar flash_tolerance,
+                                      const EOSType& eos_type,
+                                      const BatchParameters& parameters = {},
+                                      int verbosity = 0)
+    {
+        using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
+        using ScalarVector = Dune::FieldVector<Scalar, numComponents>;
+
+        assert(history.size() == fluid_states.size());
+        const std::size_t numCells = fluid_states.size();
+
+        BatchStatistics statistics;
+        std::vector<ScalarFluidState> fluid_states_scalar;
+        fluid_states_scalar.reserve(numCells);
+        std::vector<ScalarVector> K(numCells);
+        std::vector<ScalarVector> z(numCells);
+        std::vector<unsigned char> is_single_phase(numCells, false);
+        std::vector<std::size_t> two_phase_cells;
+
+        // stability tests
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            auto& fluid_state = fluid_states_scalar.emplace_back(scalarFluidState_(fluid_states[cellIdx]));
+            auto& cell_history = history[cellIdx];
+            if (cell_history.valid) {
+                for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    fluid_state.setKvalue(compIdx, cell_history.K[compIdx]);
+                }
+                fluid_state.setLvalue(cell_history.L);
+            }
+
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                K[cellIdx][compIdx] = fluid_state.K(compIdx);
+                z[cellIdx][compIdx] = fluid_state.moleFraction(compIdx);
+            }
+
+            bool is_stable = false;
+            const Scalar L = fluid_state.L();
+            if ( L <= 0 || L == 1 ) {
+                if (canSkipStabilityTest_(cell_history, fluid_state, z[cellIdx], parameters)) {
+                    is_stable = true;
+                    ++statistics.numSkippedStabilityTests;
+                }
+                else {
+                    Scalar margin = 0.0;
+                    phaseStabilityTest_(is_stable, K[cellIdx], fluid_state, z[cellIdx], eos_type, verbosity, margin);
+                    ++statistics.numStabilityTests;
+
+                    cell_history.stabilityPressure = fluid_state.pressure(0);
+                    cell_history.stabilityTemperature = fluid_state.temperature(0);
+                    std::copy(z[cellIdx].begin(), z[cellIdx].end(), cell_history.stabilityComposition.begin());
+                    cell_history.stabilityMargin = is_stable ? margin : 0.0;
+                }
+            }
+
+            is_single_phase[cellIdx] = is_stable;
+            if (!is_stable) {
+                two_phase_cells.push_back(cellIdx);
+            }
+        }
+        statistics.numTwoPhase = two_phase_cells.size();
+
+        // initial L of the two-phase cells
+        const std::size_t numTwoPhase = two_phase_cells.size();
+        std::vector<Scalar> K_batch(numComponents * numTwoPhase);
+        std::vector<Scalar> z_batch(numComponents * numTwoPhase);
+        std::vector<Scalar> L_batch(numTwoPhase);
+        for (std::size_t i = 0; i < numTwoPhase; ++i) {
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                K_batch[compIdx * numTwoPhase + i] = K[two_phase_cells[i]][compIdx];
+                z_batch[compIdx * numTwoPhase + i] = z[two_phase_cells[i]][compIdx];
+            }
+        }
+        solveRachfordRiceBatch_g_(std::span<const Scalar>(K_batch), std::span<const Scalar>(z_batch),
+                                  std::span<Scalar>(L_batch), verbosity);
+
+        // phase compositions
+        for (std::size_t i = 0; i < numTwoPhase; ++i) {
+            const std::size_t cellIdx = two_phase_cells[i];
+            Scalar L = L_batch[i];
+            flash_2ph(z[cellIdx], twoPhaseMethod, K[cellIdx], L, fluid_states_scalar[cellIdx],
+                      flash_tolerance, eos_type, verbosity);
+            fluid_states_scalar[cellIdx].setLvalue(L);
         }
 
-        // we update the derivatives in fluid_state
-        updateDerivatives_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            auto& fluid_state = fluid_states_scalar[cellIdx];
+            if (is_single_phase[cellIdx]) {
+                fluid_state.setLvalue(li_single_phase_label_(fluid_state, z[cellIdx], verbosity));
+            }
 
-        return is_single_phase;
-    } //end solve
+            copyFlashResults_(fluid_state, fluid_states[cellIdx], eos_type, is_single_phase[cellIdx]);
+
+            auto& cell_history = history[cellIdx];
+            std::copy(K[cellIdx].begin(), K[cellIdx].end(), cell_history.K.begin());
+            cell_history.L = fluid_state.L();
+            cell_history.valid = true;
+        }
+
+        return statistics;
+    } //end solveBatch
 
     /*!
      * \brief Calculates the chemical equilibrium from the component
@@ -229,6 +389,96 @@ public:
         OPM_THROW(std::runtime_error, " Rachford-Rice did not converge within maximum number of iterations");
     }
 
+    /*!
+     * \brief Solves the Rachford-Rice equations of a batch of cells.
+     *
+     * The K-values and global mole fractions are stored component by
+     * component, i.e., K[compIdx*numCells + cellIdx], so that the Newton
+     * iterations are vectorised across the cells.  Cells whose iterates
+     * leave the bracket of the solution or which do not converge within a
+     * few iterations are solved by solveRachfordRice_g_().
+     *
+     * \return The liquid mole fraction L of each cell in L.
+     */
+    static void solveRachfordRiceBatch_g_(std::span<const Scalar> K,
+                                          std::span<const Scalar> z,
+                                          std::span<Scalar> L,
+                                          int verbosity)
+    {
+        constexpr Scalar tol = 1e-12;
+        constexpr int itmax = 50;
+
+        const std::size_t numCells = L.size();
+        assert(K.size() == numComponents * numCells);
+        assert(z.size() == numComponents * numCells);
+
+        // bracket and initial guess of the vapour fraction V
+        std::vector<Scalar> V(numCells), Vmin(numCells), Vmax(numCells);
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            Scalar Kmin = K[cellIdx];
+            Scalar Kmax = K[cellIdx];
+            for (unsigned compIdx = 1; compIdx < numComponents; ++compIdx) {
+                Kmin = std::min(Kmin, K[compIdx * numCells + cellIdx]);
+                Kmax = std::max(Kmax, K[compIdx * numCells + cellIdx]);
+            }
+            Vmin[cellIdx] = 1 / (1 - Kmax);
+            Vmax[cellIdx] = 1 / (1 - Kmin);
+            V[cellIdx] = (Vmin[cellIdx] + Vmax[cellIdx]) / 2;
+        }
+
+        // 0: iterating, 1: converged, 2: needs the scalar solver
+        std::vector<unsigned char> status(numCells, 0);
+        std::vector<Scalar> r(numCells), denum(numCells);
+        std::size_t numActive = numCells;
+        for (int iteration = 1; iteration < itmax && numActive > 0; ++iteration) {
+            std::fill(r.begin(), r.end(), 0.0);
+            std::fill(denum.begin(), denum.end(), 0.0);
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const Scalar* Kc = K.data() + compIdx * numCells;
+                const Scalar* zc = z.data() + compIdx * numCells;
+                for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                    const Scalar dK = Kc[cellIdx] - 1.0;
+                    const Scalar b = 1 + V[cellIdx] * dK;
+                    r[cellIdx] += zc[cellIdx] * dK / b;
+                    denum[cellIdx] += zc[cellIdx] * (dK*dK) / (b*b);
+                }
+            }
+
+            numActive = 0;
+            for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                if (status[cellIdx] != 0) {
+                    continue;
+                }
+
+                V[cellIdx] += r[cellIdx] / denum[cellIdx];
+                if (V[cellIdx] < Vmin[cellIdx] || V[cellIdx] > Vmax[cellIdx]) {
+                    status[cellIdx] = 2;
+                }
+                else if (Opm::abs(r[cellIdx]) < tol) {
+                    status[cellIdx] = 1;
+                    L[cellIdx] = 1 - V[cellIdx];
+                }
+                else {
+                    ++numActive;
+                }
+            }
+        }
+
+        using ScalarVector = Dune::FieldVector<Scalar, numComponents>;
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            if (status[cellIdx] == 1) {
+                continue;
+            }
+
+            ScalarVector Kcell, zcell;
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                Kcell[compIdx] = K[compIdx * numCells + cellIdx];
+                zcell[compIdx] = z[compIdx * numCells + cellIdx];
+            }
+            L[cellIdx] = solveRachfordRice_g_(Kcell, zcell, verbosity);
+        }
+    }
+
     // performing the flash calculation, which is done with Scalar without touching derivatives
     template <typename FluidState>
     static bool flash_solve_scalar_(FluidState& fluid_state,
@@ -381,6 +631,23 @@ public:
 
     template <class FlashFluidState, class ComponentVector>
     static void phaseStabilityTest_(bool& isStable, ComponentVector& K, FlashFluidState& fluid_state, const ComponentVector& z, const EOSType& eos_type, int verbosity)
+    {
+        typename FlashFluidState::ValueType margin;
+        phaseStabilityTest_(isStable, K, fluid_state, z, eos_type, verbosity, margin);
+    }
+
+    /*!
+     * \brief Phase stability test which also returns how clearly a
+     *        single-phase cell is stable.
+     *
+     * The margin is one minus the largest mole number sum of the trial
+     * phases.  It is zero if either trial phase converged to the trivial
+     * solution, since the test then says nothing about the distance to the
+     * phase boundary.  It is only meaningful if the cell is stable.
+     */
+    template <class FlashFluidState, class ComponentVector>
+    static void phaseStabilityTest_(bool& isStable, ComponentVector& K, FlashFluidState& fluid_state, const ComponentVector& z, const EOSType& eos_type, int verbosity,
+                                    typename FlashFluidState::ValueType& margin)
     {
         // Declarations
         bool isTrivialL, isTrivialV;
@@ -405,6 +672,12 @@ public:
 
         // L-stable means success in making liquid, V-unstable means no success in making vapour
         isStable = L_stable && V_unstable;
+        if (isTrivialV || isTrivialL) {
+            margin = 0.0;
+        }
+        else {
+            margin = 1.0 - Opm::max(S_v, S_l);
+        }
         if (isStable) {
             // Single phase, i.e. phase composition is equivalent to the global composition
             // Update fluid_state with mole fraction
@@ -423,6 +696,73 @@ public:
 
 protected:
 
+    template <class FluidState>
+    static CompositionalFluidState<Scalar, FluidSystem> scalarFluidState_(const FluidState& fluid_state)
+    {
+        CompositionalFluidState<Scalar, FluidSystem> fluid_state_scalar;
+
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx) ) );
+            fluid_state_scalar.setMoleFraction(compIdx, Opm::getValue(fluid_state.moleFraction(compIdx) ) );
+        }
+
+        fluid_state_scalar.setLvalue(Opm::getValue(fluid_state.L()));
+        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
+        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
+        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
+
+        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
+
+        return fluid_state_scalar;
+    }
+
+    template <class FlashFluidStateScalar, class FluidState>
+    static void copyFlashResults_(const FlashFluidStateScalar& fluid_state_scalar,
+                                  FluidState& fluid_state,
+                                  const EOSType& eos_type,
+                                  bool is_single_phase)
+    {
+        // the flash solution process were performed in scalar form, after the flash calculation finishes,
+        // ensure that things in fluid_state_scalar is transformed to fluid_state
+        for (int compIdx=0; compIdx<numComponents; ++compIdx){
+                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
+                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+        }
+
+        // we update the derivatives in fluid_state
+        updateDerivatives_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
+    }
+
+    template <class FlashFluidState, class ComponentVector>
+    static bool canSkipStabilityTest_(const CellHistory& history,
+                                      const FlashFluidState& fluid_state,
+                                      const ComponentVector& z,
+                                      const BatchParameters& parameters)
+    {
+        if (!history.valid || history.stabilityMargin < parameters.minStabilityMargin) {
+            return false;
+        }
+
+        const Scalar p = fluid_state.pressure(0);
+        const Scalar T = fluid_state.temperature(0);
+        if (Opm::abs(p - history.stabilityPressure) > parameters.maxRelativePressureChange * history.stabilityPressure ||
+            Opm::abs(T - history.stabilityTemperature) > parameters.maxTemperatureChange) {
+            return false;
+        }
+
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            if (Opm::abs(z[compIdx] - history.stabilityComposition[compIdx]) > parameters.maxCompositionChange) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     template <class FlashFluidState>
     static typename FlashFluidState::ValueType wilsonK_(const FlashFluidState& fluid_state, int compIdx)
     {
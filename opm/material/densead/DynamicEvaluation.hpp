@@ -133,11 +133,24 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation(const RhsValueType& c)
         : Evaluation(0, c)
     {
     }
 
+    // evaluate an expression template of ExpressionTemplates.hpp
+    //
+    // the value and all derivatives are computed in a single pass, without
+    // creating temporary Evaluation objects for the sub-expressions.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation(const Expr& expr)
+        : data_(1 + expr.size(), 0.0)
+    {
+        assignExpression_(expr);
+    }
+
     // create an evaluation representing a variable with the variable position of varPos
     // The value is set to c, all derivatives are zero except for the one at varPos, which is set to 1.
     template <class RhsValueType>
@@ -239,6 +252,14 @@ public:
             data_[i] = other.data_[i];
     }
 
+    // multiply all derivatives by a factor, leaving the value unchanged,
+    // e.g., to apply the chain rule
+    OPM_HOST_DEVICE void scaleDerivatives(const ValueType& factor)
+    {
+        for (int i = dstart_(); i < dend_(); ++i)
+            data_[i] *= factor;
+    }
+
 
     // add value and derivatives from other to this value and derivatives
     OPM_HOST_DEVICE Evaluation& operator+=(const Evaluation& other)
@@ -273,6 +294,7 @@ public:
 
     // add value from other to this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator+=(const RhsValueType& other)
     {
         // value is added, derivatives stay the same
@@ -313,6 +335,7 @@ public:
 
     // subtract other's value from this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator-=(const RhsValueType& other)
     {
         // for constants, values are subtracted, derivatives stay the same
@@ -367,6 +390,7 @@ public:
 
     // m(c*u)' = c*u'
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
         for (int i = 0; i < length_(); ++i)
@@ -433,6 +457,7 @@ public:
 
     // divide value and derivatives by value of other
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator/=(const RhsValueType& other)
     {
         const ValueType tmp = 1.0/other;
@@ -463,6 +488,7 @@ public:
 
     // add constant to this object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator+(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -492,6 +518,7 @@ public:
 
     // subtract constant from evaluation object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator-(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -531,6 +558,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator*(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -558,6 +586,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator/(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -568,6 +597,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator=(const RhsValueType& other)
     {
         setValue( other );
@@ -579,6 +609,20 @@ public:
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
+    // evaluate an expression template of ExpressionTemplates.hpp in place
+    //
+    // the expression may refer to this object, since the derivative i of an
+    // expression only depends on the derivatives i of its operands.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation& operator=(const Expr& expr)
+    {
+        data_.resize(1 + expr.size());
+        assignExpression_(expr);
+
+        return *this;
+    }
+
     template <class RhsValueType>
     OPM_HOST_DEVICE bool operator==(const RhsValueType& other) const
     { return value() == other; }
@@ -710,6 +754,16 @@ public:
     }
 
 private:
+    template <class Expr>
+    OPM_HOST_DEVICE void assignExpression_(const Expr& expr)
+    {
+        assert(size() == expr.size());
+
+        data_[valuepos_()] = expr.value();
+        for (int i = dstart_(); i < dend_(); ++i)
+            data_[i] = expr.derivative(i - dstart_());
+    }
+
     FastSmallVector<ValueT, staticSize> data_;
 
     void appendDerivativesToConstant(size_t numDer) {
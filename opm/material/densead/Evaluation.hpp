@@ -55,6 +55,15 @@ namespace DenseAd {
 //! is run-time determined
 static constexpr int DynamicSize = -1;
 
+//! Indicates whether a type is a node of the expression templates of
+//! ExpressionTemplates.hpp. The scalar overloads of the Evaluation operators
+//! do not accept such nodes.
+template <class T>
+struct is_expression
+{
+    static constexpr bool value = false;
+};
+
 /*!
  * \brief Represents a function evaluation and its derivatives w.r.t. a fixed set of
  *        variables.
@@ -114,6 +123,7 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE constexpr Evaluation(const RhsValueType& c): data_{}
     {
         setValue(c);
@@ -122,6 +132,17 @@ public:
         //checkDefined_();
     }
 
+    // evaluate an expression template of ExpressionTemplates.hpp
+    //
+    // the value and all derivatives are computed in a single pass, without
+    // creating temporary Evaluation objects for the sub-expressions.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation(const Expr& expr)
+    {
+        assignExpression_(expr);
+    }
+
     // create an evaluation representing a variable with the variable position of varPos
     // The value is set to c, all derivatives are zero except for the one at varPos, which is set to 1.
     template <class RhsValueType>
@@ -230,6 +251,14 @@ public:
             data_[i] = other.data_[i];
     }
 
+    // multiply all derivatives by a factor, leaving the value unchanged,
+    // e.g., to apply the chain rule
+    OPM_HOST_DEVICE void scaleDerivatives(const ValueType& factor)
+    {
+        for (int i = dstart_(); i < dend_(); ++i)
+            data_[i] *= factor;
+    }
+
 
     // add value and derivatives from other to this value and derivatives
     OPM_HOST_DEVICE Evaluation& operator+=(const Evaluation& other)
@@ -244,6 +273,7 @@ public:
 
     // add value from other to this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator+=(const RhsValueType& other)
     {
         // value is added, derivatives stay the same
@@ -265,6 +295,7 @@ public:
 
     // subtract other's value from this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator-=(const RhsValueType& other)
     {
         // for constants, values are subtracted, derivatives stay the same
@@ -295,6 +326,7 @@ public:
 
     // m(c*u)' = c*u'
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
         for (int i = 0; i < length_(); ++i)
@@ -325,6 +357,7 @@ public:
 
     // divide value and derivatives by value of other
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator/=(const RhsValueType& other)
     {
         const ValueType tmp = 1.0/other;
@@ -349,6 +382,7 @@ public:
 
     // add constant to this object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator+(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -372,6 +406,7 @@ public:
 
     // subtract constant from evaluation object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator-(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -405,6 +440,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator*(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -426,6 +462,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator/(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -436,6 +473,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator=(const RhsValueType& other)
     {
         setValue( other );
@@ -447,6 +485,19 @@ public:
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
+    // evaluate an expression template of ExpressionTemplates.hpp in place
+    //
+    // the expression may refer to this object, since the derivative i of an
+    // expression only depends on the derivatives i of its operands.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation& operator=(const Expr& expr)
+    {
+        assignExpression_(expr);
+
+        return *this;
+    }
+
     template <class RhsValueType>
     OPM_HOST_DEVICE bool operator==(const RhsValueType& other) const
     { return value() == other; }
@@ -546,6 +597,16 @@ public:
     }
 
 private:
+    template <class Expr>
+    OPM_HOST_DEVICE void assignExpression_(const Expr& expr)
+    {
+        assert(size() == expr.size());
+
+        data_[valuepos_()] = expr.value();
+        for (int i = dstart_(); i < dend_(); ++i)
+            data_[i] = expr.derivative(i - dstart_());
+    }
+
     std::array<ValueT, numDerivs + 1> data_;
 };
 
@@ -101,6 +101,7 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE constexpr Evaluation(const RhsValueType& c): data_{}
     {
         setValue(c);
@@ -109,6 +110,17 @@ public:
         //checkDefined_();
     }
 
+    // evaluate an expression template of ExpressionTemplates.hpp
+    //
+    // the value and all derivatives are computed in a single pass, without
+    // creating temporary Evaluation objects for the sub-expressions.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation(const Expr& expr)
+    {
+        assignExpression_(expr);
+    }
+
     // create an evaluation representing a variable with the variable position of varPos
     // The value is set to c, all derivatives are zero except for the one at varPos, which is set to 1.
     template <class RhsValueType>
@@ -215,6 +227,13 @@ public:
         data_[1] = other.data_[1];
     }
 
+    // multiply all derivatives by a factor, leaving the value unchanged,
+    // e.g., to apply the chain rule
+    OPM_HOST_DEVICE void scaleDerivatives(const ValueType& factor)
+    {
+        data_[1] *= factor;
+    }
+
 
     // add value and derivatives from other to this value and derivatives
     OPM_HOST_DEVICE Evaluation& operator+=(const Evaluation& other)
@@ -229,6 +248,7 @@ public:
 
     // add value from other to this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator+=(const RhsValueType& other)
     {
         // value is added, derivatives stay the same
@@ -250,6 +270,7 @@ public:
 
     // subtract other's value from this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator-=(const RhsValueType& other)
     {
         // for constants, values are subtracted, derivatives stay the same
@@ -279,6 +300,7 @@ public:
 
     // m(c*u)' = c*u'
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
         data_[0] *= other;
@@ -304,6 +326,7 @@ public:
 
     // divide value and derivatives by value of other
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator/=(const RhsValueType& other)
     {
         const ValueType tmp = 1.0/other;
@@ -328,6 +351,7 @@ public:
 
     // add constant to this object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator+(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -351,6 +375,7 @@ public:
 
     // subtract constant from evaluation object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator-(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -384,6 +409,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator*(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -405,6 +431,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator/(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -415,6 +442,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator=(const RhsValueType& other)
     {
         setValue( other );
@@ -426,6 +454,19 @@ public:
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
+    // evaluate an expression template of ExpressionTemplates.hpp in place
+    //
+    // the expression may refer to this object, since the derivative i of an
+    // expression only depends on the derivatives i of its operands.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation& operator=(const Expr& expr)
+    {
+        assignExpression_(expr);
+
+        return *this;
+    }
+
     template <class RhsValueType>
     OPM_HOST_DEVICE bool operator==(const RhsValueType& other) const
     { return value() == other; }
@@ -525,6 +566,15 @@ public:
     }
 
 private:
+    template <class Expr>
+    OPM_HOST_DEVICE void assignExpression_(const Expr& expr)
+    {
+        assert(size() == expr.size());
+
+        data_[valuepos_()] = expr.value();
+        data_[1] = expr.derivative(0);
+    }
+
     std::array<ValueT, 2> data_;
 };
 
@@ -101,6 +101,7 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE constexpr Evaluation(const RhsValueType& c): data_{}
     {
         setValue(c);
@@ -109,6 +110,17 @@ public:
         //checkDefined_();
     }
 
+    // evaluate an expression template of ExpressionTemplates.hpp
+    //
+    // the value and all derivatives are computed in a single pass, without
+    // creating temporary Evaluation objects for the sub-expressions.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation(const Expr& expr)
+    {
+        assignExpression_(expr);
+    }
+
     // create an evaluation representing a variable with the variable position of varPos
     // The value is set to c, all derivatives are zero except for the one at varPos, which is set to 1.
     template <class RhsValueType>
@@ -233,6 +245,22 @@ public:
         data_[10] = other.data_[10];
     }
 
+    // multiply all derivatives by a factor, leaving the value unchanged,
+    // e.g., to apply the chain rule
+    OPM_HOST_DEVICE void scaleDerivatives(const ValueType& factor)
+    {
+        data_[1] *= factor;
+        data_[2] *= factor;
+        data_[3] *= factor;
+        data_[4] *= factor;
+        data_[5] *= factor;
+        data_[6] *= factor;
+        data_[7] *= factor;
+        data_[8] *= factor;
+        data_[9] *= factor;
+        data_[10] *= factor;
+    }
+
 
     // add value and derivatives from other to this value and derivatives
     OPM_HOST_DEVICE Evaluation& operator+=(const Evaluation& other)
@@ -256,6 +284,7 @@ public:
 
     // add value from other to this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator+=(const RhsValueType& other)
     {
         // value is added, derivatives stay the same
@@ -286,6 +315,7 @@ public:
 
     // subtract other's value from this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator-=(const RhsValueType& other)
     {
         // for constants, values are subtracted, derivatives stay the same
@@ -324,6 +354,7 @@ public:
 
     // m(c*u)' = c*u'
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
         data_[0] *= other;
@@ -367,6 +398,7 @@ public:
 
     // divide value and derivatives by value of other
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator/=(const RhsValueType& other)
     {
         const ValueType tmp = 1.0/other;
@@ -400,6 +432,7 @@ public:
 
     // add constant to this object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator+(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -423,6 +456,7 @@ public:
 
     // subtract constant from evaluation object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator-(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -465,6 +499,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator*(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -486,6 +521,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator/(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -496,6 +532,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator=(const RhsValueType& other)
     {
         setValue( other );
@@ -507,6 +544,19 @@ public:
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
+    // evaluate an expression template of ExpressionTemplates.hpp in place
+    //
+    // the expression may refer to this object, since the derivative i of an
+    // expression only depends on the derivatives i of its operands.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation& operator=(const Expr& expr)
+    {
+        assignExpression_(expr);
+
+        return *this;
+    }
+
     template <class RhsValueType>
     OPM_HOST_DEVICE bool operator==(const RhsValueType& other) const
     { return value() == other; }
@@ -606,6 +656,24 @@ public:
     }
 
 private:
+    template <class Expr>
+    OPM_HOST_DEVICE void assignExpression_(const Expr& expr)
+    {
+        assert(size() == expr.size());
+
+        data_[valuepos_()] = expr.value();
+        data_[1] = expr.derivative(0);
+        data_[2] = expr.derivative(1);
+        data_[3] = expr.derivative(2);
+        data_[4] = expr.derivative(3);
+        data_[5] = expr.derivative(4);
+        data_[6] = expr.derivative(5);
+        data_[7] = expr.derivative(6);
+        data_[8] = expr.derivative(7);
+        data_[9] = expr.derivative(8);
+        data_[10] = expr.derivative(9);
+    }
+
     std::array<ValueT, 11> data_;
 };
 
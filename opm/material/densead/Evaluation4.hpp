@@ -42,6 +42,7 @@
 
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/utility/gpuDecorators.hpp>
+#include <opm/material/densead/EvaluationSimd.hpp>
 
 namespace Opm {
 namespace DenseAd {
@@ -101,6 +102,7 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE constexpr Evaluation(const RhsValueType& c): data_{}
     {
         setValue(c);
@@ -109,6 +111,17 @@ public:
         //checkDefined_();
     }
 
+    // evaluate an expression template of ExpressionTemplates.hpp
+    //
+    // the value and all derivatives are computed in a single pass, without
+    // creating temporary Evaluation objects for the sub-expressions.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation(const Expr& expr)
+    {
+        assignExpression_(expr);
+    }
+
     // create an evaluation representing a variable with the variable position of varPos
     // The value is set to c, all derivatives are zero except for the one at varPos, which is set to 1.
     template <class RhsValueType>
@@ -221,12 +234,32 @@ public:
         data_[4] = other.data_[4];
     }
 
+    // multiply all derivatives by a factor, leaving the value unchanged,
+    // e.g., to apply the chain rule
+    OPM_HOST_DEVICE void scaleDerivatives(const ValueType& factor)
+    {
+        if constexpr (simd::enabled<ValueT>) {
+            simd::scaleDerivatives<5>(data_.data(), factor);
+            return;
+        }
+
+        data_[1] *= factor;
+        data_[2] *= factor;
+        data_[3] *= factor;
+        data_[4] *= factor;
+    }
+
 
     // add value and derivatives from other to this value and derivatives
     OPM_HOST_DEVICE Evaluation& operator+=(const Evaluation& other)
     {
         assert(size() == other.size());
 
+        if constexpr (simd::enabled<ValueT>) {
+            simd::add<5>(data_.data(), other.data_.data());
+            return *this;
+        }
+
         data_[0] += other.data_[0];
         data_[1] += other.data_[1];
         data_[2] += other.data_[2];
@@ -238,8 +271,14 @@ public:
 
     // add value from other to this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator+=(const RhsValueType& other)
     {
+        if constexpr (simd::enabled<ValueT> && std::is_arithmetic_v<RhsValueType>) {
+            simd::addValue<5>(data_.data(), other);
+            return *this;
+        }
+
         // value is added, derivatives stay the same
         data_[valuepos_()] += other;
 
@@ -251,6 +290,11 @@ public:
     {
         assert(size() == other.size());
 
+        if constexpr (simd::enabled<ValueT>) {
+            simd::sub<5>(data_.data(), other.data_.data());
+            return *this;
+        }
+
         data_[0] -= other.data_[0];
         data_[1] -= other.data_[1];
         data_[2] -= other.data_[2];
@@ -262,8 +306,14 @@ public:
 
     // subtract other's value from this values
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator-=(const RhsValueType& other)
     {
+        if constexpr (simd::enabled<ValueT> && std::is_arithmetic_v<RhsValueType>) {
+            simd::subValue<5>(data_.data(), other);
+            return *this;
+        }
+
         // for constants, values are subtracted, derivatives stay the same
         data_[valuepos_()] -= other;
 
@@ -275,6 +325,11 @@ public:
     {
         assert(size() == other.size());
 
+        if constexpr (simd::enabled<ValueT>) {
+            simd::mul<5>(data_.data(), other.data_.data());
+            return *this;
+        }
+
         // while the values are multiplied, the derivatives follow the product rule,
         // i.e., (u*v)' = (v'u + u'v).
         const ValueType u = this->value();
@@ -294,8 +349,14 @@ public:
 
     // m(c*u)' = c*u'
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
+        if constexpr (simd::enabled<ValueT> && std::is_arithmetic_v<RhsValueType>) {
+            simd::scale<5>(data_.data(), other);
+            return *this;
+        }
+
         data_[0] *= other;
         data_[1] *= other;
         data_[2] *= other;
@@ -310,6 +371,11 @@ public:
     {
         assert(size() == other.size());
 
+        if constexpr (simd::enabled<ValueT>) {
+            simd::div<5>(data_.data(), other.data_.data());
+            return *this;
+        }
+
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
         // u'v)/v^2.
         ValueType& u = data_[valuepos_()];
@@ -325,10 +391,16 @@ public:
 
     // divide value and derivatives by value of other
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator/=(const RhsValueType& other)
     {
         const ValueType tmp = 1.0/other;
 
+        if constexpr (simd::enabled<ValueT>) {
+            simd::scale<5>(data_.data(), tmp);
+            return *this;
+        }
+
         data_[0] *= tmp;
         data_[1] *= tmp;
         data_[2] *= tmp;
@@ -352,6 +424,7 @@ public:
 
     // add constant to this object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator+(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -375,6 +448,7 @@ public:
 
     // subtract constant from evaluation object
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator-(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -390,6 +464,11 @@ public:
         Evaluation result;
 
         // set value and derivatives to negative
+        if constexpr (simd::enabled<ValueT>) {
+            simd::negate<5>(result.data_.data(), data_.data());
+            return result;
+        }
+
         result.data_[0] = - data_[0];
         result.data_[1] = - data_[1];
         result.data_[2] = - data_[2];
@@ -411,6 +490,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator*(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -432,6 +512,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation operator/(const RhsValueType& other) const
     {
         Evaluation result(*this);
@@ -442,6 +523,7 @@ public:
     }
 
     template <class RhsValueType>
+    requires (!is_expression<RhsValueType>::value)
     OPM_HOST_DEVICE Evaluation& operator=(const RhsValueType& other)
     {
         setValue( other );
@@ -453,6 +535,19 @@ public:
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
+    // evaluate an expression template of ExpressionTemplates.hpp in place
+    //
+    // the expression may refer to this object, since the derivative i of an
+    // expression only depends on the derivatives i of its operands.
+    template <class Expr>
+    requires (is_expression<Expr>::value)
+    OPM_HOST_DEVICE Evaluation& operator=(const Expr& expr)
+    {
+        assignExpression_(expr);
+
+        return *this;
+    }
+
     template <class RhsValueType>
     OPM_HOST_DEVICE bool operator==(const RhsValueType& other) const
     { return value() == other; }
@@ -527,7 +622,16 @@ public:
     // set value of variable
     template <class RhsValueType>
     OPM_HOST_DEVICE constexpr void setValue(const RhsValueType& val)
-    { data_[valuepos_()] = val; }
+    {
+        if constexpr (simd::enabled<ValueT> && std::is_arithmetic_v<RhsValueType>) {
+            if (!std::is_constant_evaluated()) {
+                simd::setValue<5>(data_.data(), val);
+                return;
+            }
+        }
+
+        data_[valuepos_()] = val;
+    }
 
     // return varIdx'th derivative
     OPM_HOST_DEVICE const ValueType& derivative(int varIdx) const
@@ -552,6 +656,18 @@ public:
     }
 
 private:
+    template <class Expr>
+    OPM_HOST_DEVICE void assignExpression_(const Expr& expr)
+    {
+        assert(size() == expr.size());
+
+        data_[valuepos_()] = expr.value();
+        data_[1] = expr.derivative(0);
+        data_[2] = expr.derivative(1);
+        data_[3] = expr.derivative(2);
+        data_[4] = expr.derivative(3);
+    }
+
     std::array<ValueT, 5> data_;
 };
 
@@ -0,0 +1,311 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Explicitly vectorised kernels for the arithmetic of the dense-AD
+ *        Evaluation specializations.
+ *
+ * The kernels operate on the value and all derivatives of an Evaluation at
+ * once, i.e., on arrays of numDerivs + 1 doubles, in 128-bit registers:
+ * SSE2 on x86-64 and NEON on AArch64.  The kernels are never used in device
+ * code and can be disabled by defining OPM_DENSEAD_DISABLE_SIMD, in which
+ * case the Evaluation specializations fall back to their element-by-element
+ * loops.
+ *
+ * The kernels are also disabled if the code is compiled for AVX (e.g., with
+ * -march=native).  The compiler then vectorises the remaining members of
+ * the Evaluation, e.g., the constructors, with 256-bit registers, and the
+ * mix with the kernels' loads and stores of other widths defeats store
+ * forwarding.  Speedup of densead_benchmark over the generic Evaluation
+ * template at -O3, 3 and 6 derivatives:
+ *
+ *   kernels                   arithmetic 3/6    flux 3/6
+ *   SSE2, -O3                 1.05 / 1.38       0.96 / 1.15
+ *   AVX, -O3 -march=native    0.50 / 0.37       0.99 / 0.30
+ *   SSE2 ops, -march=native   0.63 / 1.17       0.25 / 0.36
+ *   none, -march=native       1.00 / 1.04       1.04 / 1.00
+ *
+ * Using 256-bit registers only for 8 derivatives, the one case where they
+ * win for arithmetic (1.18x), still loses 0.58x for the flux kernel.
+ * Because of the flux result, the kernels are only used for 4 to 8
+ * derivatives; see minSimdDerivs in bin/genEvalSpecializations.py.
+ *
+ * All kernels evaluate the same expressions in the same order as the
+ * element-by-element code, so both produce identical results unless the
+ * compiler contracts the latter into fused multiply-add instructions.
+ */
+#ifndef OPM_DENSEAD_EVALUATION_SIMD_HPP
+#define OPM_DENSEAD_EVALUATION_SIMD_HPP
+
+#include <type_traits>
+
+#if !defined(OPM_DENSEAD_DISABLE_SIMD) && !defined(__CUDACC__) && !defined(__HIPCC__)
+#  if defined(__AVX__)
+     // Compiler's own vectorisation is faster, see above.
+#  elif defined(__SSE2__) || defined(_M_X64)
+#    define OPM_DENSEAD_SIMD_SSE2 1
+#    include <emmintrin.h>
+#  elif defined(__aarch64__) && defined(__ARM_NEON)
+#    define OPM_DENSEAD_SIMD_NEON 1
+#    include <arm_neon.h>
+#  endif
+#endif
+
+#if defined(OPM_DENSEAD_SIMD_SSE2) || defined(OPM_DENSEAD_SIMD_NEON)
+#define OPM_DENSEAD_SIMD 1
+#else
+#define OPM_DENSEAD_SIMD 0
+#endif
+
+namespace Opm {
+namespace DenseAd {
+namespace simd {
+
+//! Whether the arithmetic of Evaluations with the given value type uses the
+//! vectorised kernels.
+template <class ValueT>
+inline constexpr bool enabled = OPM_DENSEAD_SIMD && std::is_same_v<ValueT, double>;
+
+//! Name of the instruction set used by the kernels.
+constexpr const char* isaName()
+{
+#if defined(OPM_DENSEAD_SIMD_SSE2)
+    return "SSE2";
+#elif defined(OPM_DENSEAD_SIMD_NEON)
+    return "NEON";
+#else
+    return "none";
+#endif
+}
+
+namespace detail {
+
+// Thin wrapper around the vector registers of the selected instruction set.
+struct Pack
+{
+#if defined(OPM_DENSEAD_SIMD_SSE2)
+    using Reg = __m128d;
+    static constexpr int width = 2;
+
+    static Reg load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, Reg x) { _mm_storeu_pd(p, x); }
+    static Reg set1(double x) { return _mm_set1_pd(x); }
+    static Reg add(Reg x, Reg y) { return _mm_add_pd(x, y); }
+    static Reg sub(Reg x, Reg y) { return _mm_sub_pd(x, y); }
+    static Reg mul(Reg x, Reg y) { return _mm_mul_pd(x, y); }
+    static Reg div(Reg x, Reg y) { return _mm_div_pd(x, y); }
+    static Reg neg(Reg x) { return _mm_xor_pd(x, _mm_set1_pd(-0.0)); }
+    static Reg setFirst(Reg x, double v) { return _mm_move_sd(x, _mm_set_sd(v)); }
+    static Reg first(double v) { return _mm_set_sd(v); }
+#elif defined(OPM_DENSEAD_SIMD_NEON)
+    using Reg = float64x2_t;
+    static constexpr int width = 2;
+
+    static Reg load(const double* p) { return vld1q_f64(p); }
+    static void store(double* p, Reg x) { vst1q_f64(p, x); }
+    static Reg set1(double x) { return vdupq_n_f64(x); }
+    static Reg add(Reg x, Reg y) { return vaddq_f64(x, y); }
+    static Reg sub(Reg x, Reg y) { return vsubq_f64(x, y); }
+    static Reg mul(Reg x, Reg y) { return vmulq_f64(x, y); }
+    static Reg div(Reg x, Reg y) { return vdivq_f64(x, y); }
+    static Reg neg(Reg x) { return vnegq_f64(x); }
+    static Reg setFirst(Reg x, double v) { return vsetq_lane_f64(v, x, 0); }
+    static Reg first(double v) { return vsetq_lane_f64(v, vdupq_n_f64(0.0), 0); }
+#else
+    using Reg = double;
+    static constexpr int width = 1;
+
+    static Reg load(const double* p) { return *p; }
+    static void store(double* p, Reg x) { *p = x; }
+    static Reg set1(double x) { return x; }
+    static Reg add(Reg x, Reg y) { return x + y; }
+    static Reg sub(Reg x, Reg y) { return x - y; }
+    static Reg mul(Reg x, Reg y) { return x*y; }
+    static Reg div(Reg x, Reg y) { return x/y; }
+    static Reg neg(Reg x) { return -x; }
+    static Reg setFirst(Reg, double v) { return v; }
+    static Reg first(double v) { return v; }
+#endif
+};
+
+} // namespace detail
+
+//! a += b
+template <int N>
+inline void add(double* a, const double* b)
+{
+    using P = detail::Pack;
+
+    int i = 0;
+    for (; i + P::width <= N; i += P::width)
+        P::store(a + i, P::add(P::load(a + i), P::load(b + i)));
+    for (; i < N; ++i)
+        a[i] += b[i];
+}
+
+//! a -= b
+template <int N>
+inline void sub(double* a, const double* b)
+{
+    using P = detail::Pack;
+
+    int i = 0;
+    for (; i + P::width <= N; i += P::width)
+        P::store(a + i, P::sub(P::load(a + i), P::load(b + i)));
+    for (; i < N; ++i)
+        a[i] -= b[i];
+}
+
+//! a[0] = c
+template <int N>
+inline void setValue(double* a, double c)
+{
+    using P = detail::Pack;
+    static_assert(P::width <= N);
+
+    P::store(a, P::setFirst(P::load(a), c));
+}
+
+//! a[0] += c
+//!
+//! Updates the whole first register rather than only a[0], since a narrow
+//! store followed by a wide load of the same memory stalls the pipeline.
+//! The other lanes add -0.0, which leaves every value, including -0.0,
+//! unchanged.
+template <int N>
+inline void addValue(double* a, double c)
+{
+    using P = detail::Pack;
+    static_assert(P::width <= N);
+
+    P::store(a, P::add(P::load(a), P::setFirst(P::set1(-0.0), c)));
+}
+
+//! a[0] -= c
+template <int N>
+inline void subValue(double* a, double c)
+{
+    using P = detail::Pack;
+    static_assert(P::width <= N);
+
+    P::store(a, P::sub(P::load(a), P::first(c)));
+}
+
+//! a *= c
+template <int N>
+inline void scale(double* a, double c)
+{
+    using P = detail::Pack;
+
+    const auto cc = P::set1(c);
+    int i = 0;
+    for (; i + P::width <= N; i += P::width)
+        P::store(a + i, P::mul(P::load(a + i), cc));
+    for (; i < N; ++i)
+        a[i] *= c;
+}
+
+//! a' *= c, leaving the value a[0] unchanged
+template <int N>
+inline void scaleDerivatives(double* a, double c)
+{
+    using P = detail::Pack;
+    static_assert(P::width <= N);
+
+    const double value = a[0];
+    const auto cc = P::set1(c);
+    P::store(a, P::setFirst(P::mul(P::load(a), cc), value));
+
+    int i = P::width;
+    for (; i + P::width <= N; i += P::width)
+        P::store(a + i, P::mul(P::load(a + i), cc));
+    for (; i < N; ++i)
+        a[i] *= c;
+}
+
+//! dst = -src
+template <int N>
+inline void negate(double* dst, const double* src)
+{
+    using P = detail::Pack;
+
+    int i = 0;
+    for (; i + P::width <= N; i += P::width)
+        P::store(dst + i, P::neg(P::load(src + i)));
+    for (; i < N; ++i)
+        dst[i] = -src[i];
+}
+
+//! Product rule: a = u*v, a' = a'*v + b'*u, where u = a[0] and v = b[0].
+template <int N>
+inline void mul(double* a, const double* b)
+{
+    using P = detail::Pack;
+    static_assert(P::width <= N);
+
+    const double u = a[0];
+    const double v = b[0];
+    const auto uu = P::set1(u);
+    const auto vv = P::set1(v);
+
+    // the value is inserted into the first register to avoid a scalar store
+    // into the vector just written
+    P::store(a, P::setFirst(P::add(P::mul(P::load(a), vv), P::mul(P::load(b), uu)), u*v));
+
+    int i = P::width;
+    for (; i + P::width <= N; i += P::width)
+        P::store(a + i, P::add(P::mul(P::load(a + i), vv), P::mul(P::load(b + i), uu)));
+    for (; i < N; ++i)
+        a[i] = a[i]*v + b[i]*u;
+}
+
+//! Quotient rule: a = u/v, a' = (v*a' - u*b')/v^2, where u = a[0] and v = b[0].
+template <int N>
+inline void div(double* a, const double* b)
+{
+    using P = detail::Pack;
+    static_assert(P::width <= N);
+
+    const double u = a[0];
+    const double v = b[0];
+    const auto uu = P::set1(u);
+    const auto vv = P::set1(v);
+    const auto v2 = P::set1(v*v);
+
+    // the value is inserted into the first register to avoid a scalar store
+    // into the vector just written
+    P::store(a, P::setFirst(P::div(P::sub(P::mul(vv, P::load(a)), P::mul(uu, P::load(b))), v2), u/v));
+
+    int i = P::width;
+    for (; i + P::width <= N; i += P::width)
+        P::store(a + i, P::div(P::sub(P::mul(vv, P::load(a + i)), P::mul(uu, P::load(b + i))), v2));
+    for (; i < N; ++i)
+        a[i] = (v*a[i] - u*b[i])/(v*v);
+}
+
+} // namespace simd
+} // namespace DenseAd
+} // namespace Opm
+
+#endif // OPM_DENSEAD_EVALUATION_SIMD_HPP
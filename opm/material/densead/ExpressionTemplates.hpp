@@ -0,0 +1,516 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Opt-in expression templates for the dense-AD Evaluation classes.
+ *
+ * Every operator and function of Evaluation.hpp and Math.hpp returns a new
+ * Evaluation, i.e., the value and all derivatives of each intermediate
+ * result are computed and stored before the next operation is applied.
+ * Wrapping an operand into DenseAd::lazy() makes the operators and the
+ * functions of this file return expression nodes instead. These only store
+ * the value of the sub-expression and its partial derivatives w.r.t. the
+ * operands, and the derivatives of the whole expression are computed in a
+ * single pass once it is assigned to an Evaluation:
+ *
+ * \code
+ * using Opm::DenseAd::lazy;
+ * Eval r = lazy(a)*b + lazy(c)/d - Opm::exp(lazy(e));
+ * \endcode
+ *
+ * An operation is lazy if at least one of its operands is an expression
+ * node, the other one may be an Evaluation or a scalar. (In the example
+ * above, c/d would create a temporary Evaluation.) Expression nodes refer
+ * to the Evaluation objects they are created from, so they must be
+ * assigned within the full-expression which creates them, i.e., they must
+ * not be stored in \c auto variables.
+ *
+ * Only Evaluations of floating point values are supported. Since each
+ * derivative is computed by traversing the whole expression, the expression
+ * templates pay off for expressions with several operations on Evaluations
+ * with more than about four derivatives.
+ */
+#ifndef OPM_DENSEAD_EXPRESSION_TEMPLATES_HPP
+#define OPM_DENSEAD_EXPRESSION_TEMPLATES_HPP
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <opm/common/utility/gpuDecorators.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+
+/*!
+ * \brief An Evaluation object as the operand of an expression.
+ */
+template <class Eval>
+class LeafExpression
+{
+    static_assert(std::is_floating_point_v<typename Eval::ValueType>,
+                  "Expression templates are only available for Evaluations of floating point values");
+
+public:
+    typedef Eval EvalType;
+    typedef typename Eval::ValueType ValueType;
+
+    OPM_HOST_DEVICE explicit LeafExpression(const Eval& eval)
+        : eval_(eval)
+    {}
+
+    OPM_HOST_DEVICE int size() const
+    { return eval_.size(); }
+
+    OPM_HOST_DEVICE ValueType value() const
+    { return eval_.value(); }
+
+    OPM_HOST_DEVICE ValueType derivative(int varIdx) const
+    { return eval_.derivative(varIdx); }
+
+    OPM_HOST_DEVICE EvalType evaluate() const
+    { return EvalType(*this); }
+
+private:
+    const Eval& eval_;
+};
+
+/*!
+ * \brief The result of a function f(u) of an expression u.
+ *
+ * The derivatives are f'(u)*u', where f'(u) is computed when the node is
+ * created.
+ */
+template <class Arg>
+class UnaryExpression
+{
+public:
+    typedef typename Arg::EvalType EvalType;
+    typedef typename Arg::ValueType ValueType;
+
+    OPM_HOST_DEVICE UnaryExpression(const Arg& arg,
+                                    const ValueType& value,
+                                    const ValueType& df_du)
+        : arg_(arg)
+        , value_(value)
+        , df_du_(df_du)
+    {}
+
+    OPM_HOST_DEVICE int size() const
+    { return arg_.size(); }
+
+    OPM_HOST_DEVICE ValueType value() const
+    { return value_; }
+
+    OPM_HOST_DEVICE ValueType derivative(int varIdx) const
+    { return df_du_*arg_.derivative(varIdx); }
+
+    OPM_HOST_DEVICE EvalType evaluate() const
+    { return EvalType(*this); }
+
+private:
+    Arg arg_;
+    ValueType value_;
+    ValueType df_du_;
+};
+
+/*!
+ * \brief The result of a function f(u, v) of two expressions u and v.
+ *
+ * The derivatives are df/du*u' + df/dv*v', where the partial derivatives
+ * are computed when the node is created.
+ */
+template <class Lhs, class Rhs>
+class BinaryExpression
+{
+    static_assert(std::is_same_v<typename Lhs::EvalType, typename Rhs::EvalType>,
+                  "The operands of an expression must be of the same Evaluation type");
+
+public:
+    typedef typename Lhs::EvalType EvalType;
+    typedef typename Lhs::ValueType ValueType;
+
+    OPM_HOST_DEVICE BinaryExpression(const Lhs& lhs,
+                                     const Rhs& rhs,
+                                     const ValueType& value,
+                                     const ValueType& df_du,
+                                     const ValueType& df_dv)
+        : lhs_(lhs)
+        , rhs_(rhs)
+        , value_(value)
+        , df_du_(df_du)
+        , df_dv_(df_dv)
+    {
+        assert(lhs.size() == rhs.size());
+    }
+
+    OPM_HOST_DEVICE int size() const
+    { return lhs_.size(); }
+
+    OPM_HOST_DEVICE ValueType value() const
+    { return value_; }
+
+    OPM_HOST_DEVICE ValueType derivative(int varIdx) const
+    { return df_du_*lhs_.derivative(varIdx) + df_dv_*rhs_.derivative(varIdx); }
+
+    OPM_HOST_DEVICE EvalType evaluate() const
+    { return EvalType(*this); }
+
+private:
+    Lhs lhs_;
+    Rhs rhs_;
+    ValueType value_;
+    ValueType df_du_;
+    ValueType df_dv_;
+};
+
+template <class Eval>
+struct is_expression<LeafExpression<Eval>>
+{
+    static constexpr bool value = true;
+};
+
+template <class Arg>
+struct is_expression<UnaryExpression<Arg>>
+{
+    static constexpr bool value = true;
+};
+
+template <class Lhs, class Rhs>
+struct is_expression<BinaryExpression<Lhs, Rhs>>
+{
+    static constexpr bool value = true;
+};
+
+//! Use an Evaluation as the operand of an expression template.
+template <class ValueType, int numVars, unsigned staticSize>
+OPM_HOST_DEVICE LeafExpression<Evaluation<ValueType, numVars, staticSize>>
+lazy(const Evaluation<ValueType, numVars, staticSize>& eval)
+{ return LeafExpression<Evaluation<ValueType, numVars, staticSize>>(eval); }
+
+namespace detail {
+
+// an operand of an expression which has derivatives
+template <class T>
+inline constexpr bool isDifferentiable = is_expression<T>::value || is_evaluation<T>::value;
+
+// whether the operation on the given operands creates an expression node
+template <class Lhs, class Rhs>
+inline constexpr bool isLazyOperation =
+    (is_expression<Lhs>::value && (isDifferentiable<Rhs> || std::is_arithmetic_v<Rhs>)) ||
+    (is_expression<Rhs>::value && (isDifferentiable<Lhs> || std::is_arithmetic_v<Lhs>));
+
+template <class T>
+OPM_HOST_DEVICE auto asExpression(const T& x)
+{
+    if constexpr (is_expression<T>::value)
+        return x;
+    else
+        return LeafExpression<T>(x);
+}
+
+template <class Arg, class ValueType>
+OPM_HOST_DEVICE UnaryExpression<Arg> unary(const Arg& u, const ValueType& value, const ValueType& df_du)
+{ return UnaryExpression<Arg>(u, value, df_du); }
+
+template <class Lhs, class Rhs, class ValueType>
+OPM_HOST_DEVICE BinaryExpression<Lhs, Rhs> binary(const Lhs& u, const Rhs& v, const ValueType& value,
+                                                  const ValueType& df_du, const ValueType& df_dv)
+{ return BinaryExpression<Lhs, Rhs>(u, v, value, df_du, df_dv); }
+
+template <class Lhs, class Rhs>
+OPM_HOST_DEVICE auto add(const Lhs& a, const Rhs& b)
+{
+    if constexpr (!isDifferentiable<Rhs>) {
+        const auto u = asExpression(a);
+        using ValueType = typename decltype(u)::ValueType;
+        return unary(u, ValueType(u.value() + b), ValueType(1.0));
+    }
+    else if constexpr (!isDifferentiable<Lhs>) {
+        return add(b, a);
+    }
+    else {
+        const auto u = asExpression(a);
+        const auto v = asExpression(b);
+        using ValueType = typename decltype(u)::ValueType;
+        return binary(u, v, ValueType(u.value() + v.value()), ValueType(1.0), ValueType(1.0));
+    }
+}
+
+template <class Lhs, class Rhs>
+OPM_HOST_DEVICE auto subtract(const Lhs& a, const Rhs& b)
+{
+    if constexpr (!isDifferentiable<Rhs>) {
+        const auto u = asExpression(a);
+        using ValueType = typename decltype(u)::ValueType;
+        return unary(u, ValueType(u.value() - b), ValueType(1.0));
+    }
+    else if constexpr (!isDifferentiable<Lhs>) {
+        const auto v = asExpression(b);
+        using ValueType = typename decltype(v)::ValueType;
+        return unary(v, ValueType(a - v.value()), ValueType(-1.0));
+    }
+    else {
+        const auto u = asExpression(a);
+        const auto v = asExpression(b);
+        using ValueType = typename decltype(u)::ValueType;
+        return binary(u, v, ValueType(u.value() - v.value()), ValueType(1.0), ValueType(-1.0));
+    }
+}
+
+template <class Lhs, class Rhs>
+OPM_HOST_DEVICE auto multiply(const Lhs& a, const Rhs& b)
+{
+    if constexpr (!isDifferentiable<Rhs>) {
+        const auto u = asExpression(a);
+        using ValueType = typename decltype(u)::ValueType;
+        return unary(u, ValueType(u.value()*b), ValueType(b));
+    }
+    else if constexpr (!isDifferentiable<Lhs>) {
+        return multiply(b, a);
+    }
+    else {
+        // (u*v)' = v*u' + u*v'
+        const auto u = asExpression(a);
+        const auto v = asExpression(b);
+        return binary(u, v, u.value()*v.value(), v.value(), u.value());
+    }
+}
+
+template <class Lhs, class Rhs>
+OPM_HOST_DEVICE auto divide(const Lhs& a, const Rhs& b)
+{
+    if constexpr (!isDifferentiable<Rhs>) {
+        const auto u = asExpression(a);
+        using ValueType = typename decltype(u)::ValueType;
+        const ValueType inv = 1.0/b;
+        return unary(u, u.value()*inv, inv);
+    }
+    else if constexpr (!isDifferentiable<Lhs>) {
+        // (a/v)' = -a*v'/v^2
+        const auto v = asExpression(b);
+        using ValueType = typename decltype(v)::ValueType;
+        const ValueType inv = 1.0/v.value();
+        return unary(v, ValueType(a*inv), ValueType(-a*inv*inv));
+    }
+    else {
+        // (u/v)' = u'/v - u*v'/v^2
+        const auto u = asExpression(a);
+        const auto v = asExpression(b);
+        using ValueType = typename decltype(u)::ValueType;
+        const ValueType inv = 1.0/v.value();
+        const ValueType value = u.value()*inv;
+        return binary(u, v, value, inv, -value*inv);
+    }
+}
+
+} // namespace detail
+
+template <class Lhs, class Rhs>
+requires (detail::isLazyOperation<Lhs, Rhs>)
+OPM_HOST_DEVICE auto operator+(const Lhs& a, const Rhs& b)
+{ return detail::add(a, b); }
+
+template <class Lhs, class Rhs>
+requires (detail::isLazyOperation<Lhs, Rhs>)
+OPM_HOST_DEVICE auto operator-(const Lhs& a, const Rhs& b)
+{ return detail::subtract(a, b); }
+
+template <class Lhs, class Rhs>
+requires (detail::isLazyOperation<Lhs, Rhs>)
+OPM_HOST_DEVICE auto operator*(const Lhs& a, const Rhs& b)
+{ return detail::multiply(a, b); }
+
+template <class Lhs, class Rhs>
+requires (detail::isLazyOperation<Lhs, Rhs>)
+OPM_HOST_DEVICE auto operator/(const Lhs& a, const Rhs& b)
+{ return detail::divide(a, b); }
+
+// The operators for an expression and an Evaluation need the same template
+// parameters as the operators for a scalar and an Evaluation of
+// Evaluation.hpp, since they are otherwise considered less specialized.
+template <class Lhs, class ValueType, int numVars, unsigned staticSize>
+requires (is_expression<Lhs>::value)
+OPM_HOST_DEVICE auto operator+(const Lhs& a, const Evaluation<ValueType, numVars, staticSize>& b)
+{ return detail::add(a, b); }
+
+template <class Lhs, class ValueType, int numVars, unsigned staticSize>
+requires (is_expression<Lhs>::value)
+OPM_HOST_DEVICE auto operator-(const Lhs& a, const Evaluation<ValueType, numVars, staticSize>& b)
+{ return detail::subtract(a, b); }
+
+template <class Lhs, class ValueType, int numVars, unsigned staticSize>
+requires (is_expression<Lhs>::value)
+OPM_HOST_DEVICE auto operator*(const Lhs& a, const Evaluation<ValueType, numVars, staticSize>& b)
+{ return detail::multiply(a, b); }
+
+template <class Lhs, class ValueType, int numVars, unsigned staticSize>
+requires (is_expression<Lhs>::value)
+OPM_HOST_DEVICE auto operator/(const Lhs& a, const Evaluation<ValueType, numVars, staticSize>& b)
+{ return detail::divide(a, b); }
+
+template <class Arg>
+requires (is_expression<Arg>::value)
+OPM_HOST_DEVICE auto operator-(const Arg& u)
+{
+    using ValueType = typename Arg::ValueType;
+    return detail::unary(u, ValueType(-u.value()), ValueType(-1.0));
+}
+
+} // namespace DenseAd
+
+// The functions take precedence over the generic ones of MathToolbox.hpp
+// because they are more constrained.
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto abs(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType x = u.value();
+    return DenseAd::detail::unary(u, ValueType((x > 0.0) ? x : -x), ValueType((x > 0.0) ? 1.0 : -1.0));
+}
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto exp(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType exp_x = std::exp(u.value());
+    return DenseAd::detail::unary(u, exp_x, exp_x);
+}
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto log(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType x = u.value();
+    return DenseAd::detail::unary(u, ValueType(std::log(x)), ValueType(1.0/x));
+}
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto log10(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType x = u.value();
+    return DenseAd::detail::unary(u, ValueType(std::log10(x)), ValueType(1.0/(x*std::log(10.0))));
+}
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto sqrt(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType sqrt_x = std::sqrt(u.value());
+    return DenseAd::detail::unary(u, sqrt_x, ValueType(0.5/sqrt_x));
+}
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto sin(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType x = u.value();
+    return DenseAd::detail::unary(u, ValueType(std::sin(x)), ValueType(std::cos(x)));
+}
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto cos(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType x = u.value();
+    return DenseAd::detail::unary(u, ValueType(std::cos(x)), ValueType(-std::sin(x)));
+}
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto tan(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType cos_x = std::cos(u.value());
+    return DenseAd::detail::unary(u, ValueType(std::tan(u.value())), ValueType(1.0/(cos_x*cos_x)));
+}
+
+template <class Expr>
+requires (DenseAd::is_expression<Expr>::value)
+OPM_HOST_DEVICE auto atan(const Expr& u)
+{
+    using ValueType = typename Expr::ValueType;
+    const ValueType x = u.value();
+    return DenseAd::detail::unary(u, ValueType(std::atan(x)), ValueType(1.0/(1.0 + x*x)));
+}
+
+// like the pow() functions of Math.hpp, a zero base yields zero and zero
+// derivatives
+template <class Base, class Exp>
+requires (DenseAd::detail::isLazyOperation<Base, Exp>)
+OPM_HOST_DEVICE auto pow(const Base& base, const Exp& exp)
+{
+    using DenseAd::detail::asExpression;
+    using DenseAd::detail::isDifferentiable;
+
+    if constexpr (!isDifferentiable<Exp>) {
+        const auto u = asExpression(base);
+        using ValueType = typename decltype(u)::ValueType;
+        const ValueType x = u.value();
+        if (x == 0.0)
+            return DenseAd::detail::unary(u, ValueType(0.0), ValueType(0.0));
+
+        const ValueType pow_x = std::pow(x, exp);
+        return DenseAd::detail::unary(u, pow_x, ValueType(pow_x/x*exp));
+    }
+    else if constexpr (!isDifferentiable<Base>) {
+        const auto v = asExpression(exp);
+        using ValueType = typename decltype(v)::ValueType;
+        if (base == 0.0)
+            return DenseAd::detail::unary(v, ValueType(0.0), ValueType(0.0));
+
+        const ValueType lnBase = std::log(base);
+        const ValueType pow_x = std::exp(lnBase*v.value());
+        return DenseAd::detail::unary(v, pow_x, ValueType(lnBase*pow_x));
+    }
+    else {
+        // (f^g)' = (g*f'/f + ln(f)*g')*f^g
+        const auto u = asExpression(base);
+        const auto v = asExpression(exp);
+        using ValueType = typename decltype(u)::ValueType;
+        const ValueType f = u.value();
+        if (f == 0.0)
+            return DenseAd::detail::binary(u, v, ValueType(0.0), ValueType(0.0), ValueType(0.0));
+
+        const ValueType g = v.value();
+        const ValueType pow_x = std::pow(f, g);
+        return DenseAd::detail::binary(u, v, pow_x, ValueType(g/f*pow_x), ValueType(std::log(f)*pow_x));
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_DENSEAD_EXPRESSION_TEMPLATES_HPP
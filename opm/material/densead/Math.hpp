@@ -106,8 +106,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> tan(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1 + tmp*tmp;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -123,8 +122,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> atan(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1/(1 + x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -203,8 +201,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sin(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = ValueTypeToolbox::cos(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -220,8 +217,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> asin(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(1 - x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -237,8 +233,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sinh(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = ValueTypeToolbox::cosh(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -254,8 +249,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> asinh(const Evaluatio
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(x.value()*x.value() + 1);
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -271,8 +265,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> cos(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = -ValueTypeToolbox::sin(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -288,8 +281,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> acos(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = - 1.0/ValueTypeToolbox::sqrt(1 - x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -305,8 +297,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> cosh(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = ValueTypeToolbox::sinh(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -322,8 +313,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> acosh(const Evaluatio
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(x.value()*x.value() - 1);
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -340,9 +330,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sqrt(const Evaluation
 
     // derivatives use the chain rule
     ValueType df_dx = 0.5/sqrt_x;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-    }
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -358,8 +346,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> exp(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = exp_x;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -383,8 +370,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<
     else {
         // derivatives use the chain rule
         const ValueType& df_dx = pow_x/base.value()*exp;
-        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-            result.setDerivative(curVarIdx, df_dx*base.derivative(curVarIdx));
+        result.scaleDerivatives(df_dx);
     }
 
     return result;
@@ -410,8 +396,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const BaseType& b
 
         // derivatives use the chain rule
         const ValueType& df_dx = lnBase*result.value();
-        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-            result.setDerivative(curVarIdx, df_dx*exp.derivative(curVarIdx));
+        result.scaleDerivatives(df_dx);
     }
 
     return result;
@@ -462,8 +447,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> log(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1/x.value();
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -480,8 +464,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> log10(const Evaluatio
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1/x.value() * ValueTypeToolbox::log10(ValueTypeToolbox::exp(1.0));
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    result.scaleDerivatives(df_dx);
 
     return result;
 }
@@ -0,0 +1,365 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::CubicEOSBatch
+ */
+#ifndef CUBIC_EOS_BATCH_HPP
+#define CUBIC_EOS_BATCH_HPP
+
+#include <opm/material/Constants.hpp>
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/Valgrind.hpp>
+
+#include <opm/input/eclipse/EclipseState/Compositional/CompositionalConfig.hpp>
+
+#include <opm/material/eos/PRParams.hpp>
+#include <opm/material/eos/RKParams.hpp>
+#include <opm/material/eos/SRKParams.hpp>
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+
+namespace Opm
+{
+
+/*!
+ * \brief Evaluates the cubic equation of state of CubicEOS for a batch of
+ *        cells at the same temperature.
+ *
+ * The mixing parameters sqrt(a_i a_j)(1 - k_ij) only depend on the
+ * temperature.  They are computed once by updateTemperature() and scaled
+ * by the pressure of each cell, instead of being recomputed for every
+ * cell and phase as by CubicEOSParams.
+ *
+ * The per-cell quantities are stored component by component, i.e., the
+ * mole fraction of component compIdx in cell cellIdx is
+ * x[compIdx*numCells + cellIdx], so that the innermost loops of the
+ * kernels run over the cells.  The kernels accept both Scalars and
+ * Evaluations, in which case the derivatives w.r.t. pressure and
+ * composition are propagated.  Derivatives w.r.t. temperature are not.
+ *
+ * Apart from round-off, the results equal those of
+ * CubicEOS::computeMolarVolume() and CubicEOS::computeFugacityCoefficient()
+ * for mole fractions in [0, 1].
+ */
+template <class Scalar, class FluidSystem>
+class CubicEOSBatch
+{
+    enum { numComponents = FluidSystem::numComponents };
+
+    using EOSType = CompositionalConfig::EOSType;
+    using PR = Opm::PRParams<Scalar, FluidSystem>;
+    using RK = Opm::RKParams<Scalar, FluidSystem>;
+    using SRK = Opm::SRKParams<Scalar, FluidSystem>;
+
+public:
+    explicit CubicEOSBatch(const EOSType eos_type)
+        : eosType_(eos_type)
+    {
+        switch (eosType_) {
+            case EOSType::PRCORR:
+            case EOSType::PR:
+                m1_ = PR::calcm1();
+                m2_ = PR::calcm2();
+                omegaB_ = PR::calcOmegaB();
+                break;
+            case EOSType::RK:
+                m1_ = RK::calcm1();
+                m2_ = RK::calcm2();
+                omegaB_ = RK::calcOmegaB();
+                break;
+            case EOSType::SRK:
+                m1_ = SRK::calcm1();
+                m2_ = SRK::calcm2();
+                omegaB_ = SRK::calcOmegaB();
+                break;
+            default:
+                throw std::runtime_error("EOS type not implemented!");
+        }
+    }
+
+    /*!
+     * \brief Compute the mixing parameters for a temperature [K].
+     */
+    void updateTemperature(const Scalar temperature)
+    {
+        Valgrind::CheckDefined(temperature);
+        temperature_ = temperature;
+
+        // A_i = OmegaA_i p_r / T_r^2 = p * a_i and B_i = OmegaB p_r / T_r = p * b_i
+        std::array<Scalar, numComponents> sqrtA;
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const Scalar pc = FluidSystem::criticalPressure(compIdx);
+            const Scalar Tr = temperature / FluidSystem::criticalTemperature(compIdx);
+            sqrtA[compIdx] = sqrt(OmegaA_(temperature, compIdx) / (pc * Tr * Tr));
+            Bi_[compIdx] = omegaB_ / (pc * Tr);
+        }
+
+        for (unsigned compIIdx = 0; compIIdx < numComponents; ++compIIdx) {
+            for (unsigned compJIdx = 0; compJIdx <= compIIdx; ++compJIdx) {
+                const Scalar Psi = FluidSystem::interactionCoefficient(compIIdx, compJIdx);
+                aCache_[compIIdx][compJIdx] = sqrtA[compIIdx] * sqrtA[compJIdx] * (1 - Psi);
+                aCache_[compJIdx][compIIdx] = aCache_[compIIdx][compJIdx];
+            }
+        }
+    }
+
+    Scalar temperature() const
+    { return temperature_; }
+
+    //! The mixing parameter A_ij of CubicEOSParams divided by the pressure.
+    Scalar aCache(unsigned compIIdx, unsigned compJIdx) const
+    { return aCache_[compIIdx][compJIdx]; }
+
+    //! The parameter B_i of CubicEOSParams divided by the pressure.
+    Scalar Bi(unsigned compIdx) const
+    { return Bi_[compIdx]; }
+
+    Scalar m1() const
+    { return m1_; }
+
+    Scalar m2() const
+    { return m2_; }
+
+    /*!
+     * \brief Mixing rule for the cells of a batch.
+     *
+     * \param pressure Pressure [Pa] of each cell.
+     * \param moleFractions Mole fractions of the phase, clamped to [0, 1].
+     * \param A Mixture parameter A of each cell.
+     * \param B Mixture parameter B of each cell.
+     * \param ASum Sum over j of A_ij x_j of each component and cell, which
+     *             enters the fugacity coefficients.
+     */
+    template <class Evaluation>
+    void mix(std::span<const Evaluation> pressure,
+             std::span<const Evaluation> moleFractions,
+             std::span<Evaluation> A,
+             std::span<Evaluation> B,
+             std::span<Evaluation> ASum) const
+    {
+        const std::size_t numCells = pressure.size();
+        assert(moleFractions.size() == numComponents * numCells);
+        assert(A.size() == numCells && B.size() == numCells);
+        assert(ASum.size() == numComponents * numCells);
+
+        const auto x = [&](const unsigned compIdx, const std::size_t cellIdx) -> Evaluation
+        {
+            return max(0.0, min(1.0, moleFractions[compIdx * numCells + cellIdx]));
+        };
+
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            A[cellIdx] = 0.0;
+            B[cellIdx] = 0.0;
+        }
+
+        for (unsigned compIIdx = 0; compIIdx < numComponents; ++compIIdx) {
+            Evaluation* sumI = ASum.data() + compIIdx * numCells;
+            for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                sumI[cellIdx] = 0.0;
+            }
+
+            for (unsigned compJIdx = 0; compJIdx < numComponents; ++compJIdx) {
+                const Scalar aij = aCache_[compIIdx][compJIdx];
+                for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                    sumI[cellIdx] += aij * x(compJIdx, cellIdx);
+                }
+            }
+
+            for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                sumI[cellIdx] *= pressure[cellIdx];
+                const Evaluation xi = x(compIIdx, cellIdx);
+                A[cellIdx] += xi * sumI[cellIdx];
+                B[cellIdx] += xi * Bi_[compIIdx];
+            }
+        }
+
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            B[cellIdx] *= pressure[cellIdx];
+            assert(std::isfinite(scalarValue(A[cellIdx])));
+            assert(std::isfinite(scalarValue(B[cellIdx])));
+        }
+    }
+
+    /*!
+     * \brief Compressibility factors of the cells of a batch.
+     *
+     * Picks the same root of the cubic as CubicEOS::computeMolarVolume(),
+     * i.e., the largest one for the gas phase and the smallest one for
+     * the liquid phase if there are three real roots.  The root is
+     * computed analytically on the values only.  The derivatives follow
+     * from one Newton step on the cubic with Evaluations, which also
+     * polishes the value.
+     */
+    template <class Evaluation>
+    void compressibilityFactor(std::span<const Evaluation> A,
+                               std::span<const Evaluation> B,
+                               const bool isGasPhase,
+                               std::span<Evaluation> Z) const
+    {
+        const std::size_t numCells = A.size();
+        assert(B.size() == numCells && Z.size() == numCells);
+
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            const Evaluation& a = A[cellIdx];
+            const Evaluation& b = B[cellIdx];
+
+            // coefficients of Z^3 + a2 Z^2 + a3 Z + a4
+            const Evaluation a2 = (m1_ + m2_ - 1) * b - 1;
+            const Evaluation a3 = a + m1_ * m2_ * b * b - (m1_ + m2_) * b * (b + 1);
+            const Evaluation a4 = -a * b - m1_ * m2_ * b * b * (b + 1);
+
+            const Scalar z = cubicRoot_(scalarValue(a2), scalarValue(a3), scalarValue(a4), isGasPhase);
+
+            const Evaluation dfdz = (3 * z + 2 * a2) * z + a3;
+            if (std::abs(scalarValue(dfdz)) > 1e-12) {
+                Z[cellIdx] = z - (((z + a2) * z + a3) * z + a4) / dfdz;
+            }
+            else {
+                // multiple root, the derivatives are undefined
+                Z[cellIdx] = z;
+            }
+            assert(std::isfinite(scalarValue(Z[cellIdx])));
+        }
+    }
+
+    /*!
+     * \brief Fugacity coefficients of all components in the cells of a
+     *        batch.
+     *
+     * \param pressure Pressure [Pa] of each cell.
+     * \param A, B, ASum The results of mix().
+     * \param Z The result of compressibilityFactor().
+     * \param fugacityCoefficients The fugacity coefficient of each
+     *                             component and cell, limited to
+     *                             [1e-10, 1e10] like CubicEOS does.
+     */
+    template <class Evaluation>
+    void fugacityCoefficients(std::span<const Evaluation> pressure,
+                              std::span<const Evaluation> A,
+                              std::span<const Evaluation> B,
+                              std::span<const Evaluation> ASum,
+                              std::span<const Evaluation> Z,
+                              std::span<Evaluation> fugacityCoefficients) const
+    {
+        const std::size_t numCells = pressure.size();
+        assert(A.size() == numCells && B.size() == numCells && Z.size() == numCells);
+        assert(ASum.size() == numComponents * numCells);
+        assert(fugacityCoefficients.size() == numComponents * numCells);
+
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            const Evaluation& a = A[cellIdx];
+            const Evaluation& b = B[cellIdx];
+            const Evaluation& z = Z[cellIdx];
+            const Evaluation& p = pressure[cellIdx];
+
+            // the terms which are the same for all components
+            const Evaluation alpha0 = -log(z - b);
+            const Evaluation beta = log((z + m2_ * b) / (z + m1_ * b)) * a / ((m1_ - m2_) * b);
+            const Evaluation p_b = p / b;
+            const Evaluation twoBeta_a = 2 * beta / a;
+
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const Evaluation Bi_B = Bi_[compIdx] * p_b;
+                const Evaluation ln_phi = alpha0 + Bi_B * (z - 1)
+                    + twoBeta_a * ASum[compIdx * numCells + cellIdx] - beta * Bi_B;
+
+                Evaluation& fugCoeff = fugacityCoefficients[compIdx * numCells + cellIdx];
+                fugCoeff = max(1e-10, min(1e10, exp(ln_phi)));
+            }
+        }
+    }
+
+private:
+    Scalar OmegaA_(const Scalar temperature, const unsigned compIdx) const
+    {
+        switch (eosType_) {
+            case EOSType::PRCORR:
+                return PR::calcOmegaA(temperature, compIdx, /*modified=*/true);
+            case EOSType::PR:
+                return PR::calcOmegaA(temperature, compIdx, /*modified=*/false);
+            case EOSType::RK:
+                return RK::calcOmegaA(temperature, compIdx);
+            case EOSType::SRK:
+                return SRK::calcOmegaA(temperature, compIdx);
+            default:
+                throw std::runtime_error("EOS type not implemented!");
+        }
+    }
+
+    // Root of Z^3 + a2 Z^2 + a3 Z + a4 by the same method as cubicRoots(),
+    // but only computing the root which is selected for the phase.
+    static Scalar cubicRoot_(const Scalar a2, const Scalar a3, const Scalar a4, const bool isGasPhase)
+    {
+        // depressed cubic t^3 + p t + q with Z = t - a2/3
+        const Scalar shift = a2 / 3;
+        const Scalar p = a3 - a2 * shift;
+        const Scalar q = (2 * a2 * a2 * a2 - 9 * a2 * a3 + 27 * a4) / 27;
+
+        const Scalar discr = 4 * p * p * p + 27 * q * q;
+        if (discr < 0.0) {
+            // three real roots, the largest at k = 0 and the smallest at k = 2
+            const Scalar theta = std::acos(((3 * q) / (2 * p)) * std::sqrt(-3 / p)) / 3;
+            const Scalar k = isGasPhase ? 0 : 2;
+            return 2 * std::sqrt(-p / 3) * std::cos(theta - k * 2 * std::numbers::pi_v<Scalar> / 3) - shift;
+        }
+        else if (discr > 0.0) {
+            // a single real root
+            if (p < 0) {
+                const Scalar theta = std::acosh(((-3 * std::abs(q)) / (2 * p)) * std::sqrt(-3 / p)) / 3;
+                return ((-2 * std::abs(q)) / q) * std::sqrt(-p / 3) * std::cosh(theta) - shift;
+            }
+            else if (p > 0) {
+                const Scalar theta = std::asinh(((3 * q) / (2 * p)) * std::sqrt(3 / p)) / 3;
+                return -2 * std::sqrt(p / 3) * std::sinh(theta) - shift;
+            }
+            return std::cbrt(-q) - shift;
+        }
+
+        // multiple roots
+        if (p == 0) {
+            return -shift;
+        }
+        const Scalar simple = 3 * q / p;
+        const Scalar twofold = -3 * q / (2 * p);
+        return (isGasPhase ? std::max(simple, twofold) : std::min(simple, twofold)) - shift;
+    }
+
+    EOSType eosType_;
+    Scalar m1_{};
+    Scalar m2_{};
+    Scalar omegaB_{};
+    Scalar temperature_{};
+    std::array<Scalar, numComponents> Bi_{};
+    std::array<std::array<Scalar, numComponents>, numComponents> aCache_{};
+};
+
+}  // namespace Opm
+
+#endif
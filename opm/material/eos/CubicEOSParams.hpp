@@ -31,6 +31,8 @@
 #include <opm/material/eos/RKParams.hpp>
 #include <opm/material/eos/SRKParams.hpp>
 
+#include <array>
+
 namespace Opm
 {
 
@@ -86,25 +88,27 @@ public:
     {
         using FlashEval = typename FluidState::ValueType;
 
+        std::array<FlashEval, numComponents> x;
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const FlashEval moleFrac = fs.moleFraction(phaseIdx, compIdx);
+            x[compIdx] = max(0.0, min(1.0, moleFrac));
+            Valgrind::CheckDefined(x[compIdx]);
+        }
+
         FlashEval newA = 0;
         FlashEval newB = 0;
         for (unsigned compIIdx = 0; compIIdx < numComponents; ++compIIdx) {
-            const FlashEval moleFracI = fs.moleFraction(phaseIdx, compIIdx);
-            FlashEval xi = max(0.0, min(1.0, moleFracI));
-            Valgrind::CheckDefined(xi);
-
+            FlashEval sumI = 0;
             for (unsigned compJIdx = 0; compJIdx < numComponents; ++compJIdx) {
-                const FlashEval moleFracJ = fs.moleFraction(phaseIdx, compJIdx );
-                FlashEval xj = max(0.0, min(1.0, moleFracJ));
-                Valgrind::CheckDefined(xj);
-
-                // Calculate A
-                newA +=  xi * xj * aCache_[compIIdx][compJIdx];
-                assert(std::isfinite(scalarValue(newA)));
+                sumI += x[compJIdx] * aCache_[compIIdx][compJIdx];
             }
 
+            // Calculate A
+            newA += x[compIIdx] * sumI;
+            assert(std::isfinite(scalarValue(newA)));
+
             // Calculate B
-            newB += max(0.0, xi) * Bi(compIIdx);
+            newB += x[compIIdx] * Bi(compIIdx);
             assert(std::isfinite(scalarValue(newB)));
         }
 
@@ -209,12 +213,19 @@ protected:
 private:
     void updateACache_()
     {
+        // sqrt(A_i A_j) = sqrt(A_i) sqrt(A_j), and the matrix is symmetric
+        std::array<Scalar, numComponents> sqrtA;
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            sqrtA[compIdx] = sqrt(Ai(compIdx));
+        }
+
         for (unsigned compIIdx = 0; compIIdx < numComponents; ++ compIIdx) {
-            for (unsigned compJIdx = 0; compJIdx < numComponents; ++ compJIdx) {
+            for (unsigned compJIdx = 0; compJIdx <= compIIdx; ++ compJIdx) {
                 // interaction coefficient as given in SPE5
                 Scalar Psi = FluidSystem::interactionCoefficient(compIIdx, compJIdx);
 
-                aCache_[compIIdx][compJIdx] = sqrt(Ai(compIIdx) * Ai(compJIdx)) * (1 - Psi);
+                aCache_[compIIdx][compJIdx] = sqrtA[compIIdx] * sqrtA[compJIdx] * (1 - Psi);
+                aCache_[compJIdx][compIIdx] = aCache_[compIIdx][compJIdx];
             }
         }
     }
@@ -148,26 +148,27 @@ public:
         //
         // See: R. Reid, et al.: The Properties of Gases and Liquids,
         // 4th edition, McGraw-Hill, 1987, p. 82
+        FlashEval x[numComponents];
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const FlashEval moleFrac = fs.moleFraction(phaseIdx, compIdx);
+            x[compIdx] = max(0.0, min(1.0, moleFrac));
+            Valgrind::CheckDefined(x[compIdx]);
+        }
+
         FlashEval newA = 0;
         FlashEval newB = 0;
         for (unsigned compIIdx = 0; compIIdx < numComponents; ++compIIdx) {
-            const FlashEval moleFracI = fs.moleFraction(phaseIdx, compIIdx);
-            FlashEval xi = max(0.0, min(1.0, moleFracI));
-            Valgrind::CheckDefined(xi);
-
+            FlashEval sumI = 0;
             for (unsigned compJIdx = 0; compJIdx < numComponents; ++compJIdx) {
-                const FlashEval moleFracJ = fs.moleFraction(phaseIdx, compJIdx );
-                FlashEval xj = max(0.0, min(1.0, moleFracJ));
-                Valgrind::CheckDefined(xj);
-
-                // mixing rule from Reid, page 82
-                newA +=  xi * xj * aCache_[compIIdx][compJIdx];
-
-                assert(std::isfinite(scalarValue(newA)));
+                sumI += x[compJIdx] * aCache_[compIIdx][compJIdx];
             }
 
             // mixing rule from Reid, page 82
-            newB += max(0.0, xi) * this->pureParams_[compIIdx].b();
+            newA += x[compIIdx] * sumI;
+            assert(std::isfinite(scalarValue(newA)));
+
+            // mixing rule from Reid, page 82
+            newB += x[compIIdx] * this->pureParams_[compIIdx].b();
             assert(std::isfinite(scalarValue(newB)));
         }
 
@@ -231,15 +232,19 @@ protected:
 private:
     void updateACache_()
     {
+        // sqrt(a_i a_j) = sqrt(a_i) sqrt(a_j), and the matrix is symmetric
+        Scalar sqrtA[numComponents];
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            sqrtA[compIdx] = sqrt(this->pureParams_[compIdx].a());
+        }
+
         for (unsigned compIIdx = 0; compIIdx < numComponents; ++ compIIdx) {
-            for (unsigned compJIdx = 0; compJIdx < numComponents; ++ compJIdx) {
+            for (unsigned compJIdx = 0; compJIdx <= compIIdx; ++ compJIdx) {
                 // interaction coefficient as given in SPE5
                 Scalar Psi = FluidSystem::interactionCoefficient(compIIdx, compJIdx);
 
-                aCache_[compIIdx][compJIdx] =
-                    sqrt(this->pureParams_[compIIdx].a()
-                                  * this->pureParams_[compJIdx].a())
-                    * (1 - Psi);
+                aCache_[compIIdx][compJIdx] = sqrtA[compIIdx] * sqrtA[compJIdx] * (1 - Psi);
+                aCache_[compJIdx][compIIdx] = aCache_[compIIdx][compJIdx];
             }
         }
     }
@@ -0,0 +1,170 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+
+#include <opm/material/fluidmatrixinteractions/EclEpsScalingPointsStore.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace {
+    template <typename Scalar>
+    void hashCombine(std::size_t& seed, const Scalar value)
+    {
+        seed ^= std::hash<Scalar>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+} // Anonymous namespace
+
+template <class Scalar>
+std::size_t
+Opm::EclEpsScalingPointsStore<Scalar>::Hash::
+operator()(const Info& info) const
+{
+    auto seed = std::size_t{0};
+
+    for (const auto value : { info.Swl, info.Sgl, info.Swcr, info.Sgcr,
+                              info.Sowcr, info.Sogcr, info.Swu, info.Sgu,
+                              info.maxPcow, info.maxPcgo,
+                              info.pcowLeverettFactor, info.pcgoLeverettFactor,
+                              info.Krwr, info.Krgr, info.Krorw, info.Krorg,
+                              info.maxKrw, info.maxKrow, info.maxKrog, info.maxKrg })
+    {
+        hashCombine(seed, value);
+    }
+
+    return seed;
+}
+
+template <class Scalar>
+void
+Opm::EclEpsScalingPointsStore<Scalar>::Builder::
+set(const std::size_t cell, const Info& info)
+{
+    auto [pos, inserted] = this->lookup_.try_emplace(info, static_cast<std::uint32_t>(this->values_.size()));
+    if (inserted) {
+        this->values_.push_back(info);
+    }
+
+    this->cells_.emplace_back(cell, pos->second);
+}
+
+template <class Scalar>
+Opm::EclEpsScalingPointsStore<Scalar>::
+EclEpsScalingPointsStore(const EclEpsScalingPointsStore& rhs)
+    : shared_(rhs.shared_)
+    , index_ (rhs.index_)
+{
+    this->unique_.reserve(rhs.unique_.size());
+    for (const auto& value : rhs.unique_) {
+        this->unique_.push_back(value ? std::make_unique<Info>(*value) : nullptr);
+    }
+}
+
+template <class Scalar>
+Opm::EclEpsScalingPointsStore<Scalar>&
+Opm::EclEpsScalingPointsStore<Scalar>::
+operator=(const EclEpsScalingPointsStore& rhs)
+{
+    if (this != &rhs) {
+        *this = EclEpsScalingPointsStore { rhs };
+    }
+
+    return *this;
+}
+
+template <class Scalar>
+void
+Opm::EclEpsScalingPointsStore<Scalar>::
+resize(const std::size_t numCells)
+{
+    this->shared_.assign(1, Info{});
+    this->index_.assign(numCells, 0);
+
+    this->unique_.clear();
+    this->unique_.resize(numCells);
+}
+
+template <class Scalar>
+typename Opm::EclEpsScalingPointsStore<Scalar>::Info&
+Opm::EclEpsScalingPointsStore<Scalar>::
+unique(const std::size_t cell)
+{
+    if (! this->unique_[cell]) {
+        this->unique_[cell] = std::make_unique<Info>(this->shared_[this->index_[cell]]);
+    }
+
+    return *this->unique_[cell];
+}
+
+template <class Scalar>
+void
+Opm::EclEpsScalingPointsStore<Scalar>::
+merge(std::vector<Builder>& builders)
+{
+    auto lookup = std::unordered_map<Info, std::uint32_t, Hash>{};
+    for (auto i = 0*this->shared_.size(); i < this->shared_.size(); ++i) {
+        lookup.try_emplace(this->shared_[i], static_cast<std::uint32_t>(i));
+    }
+
+    for (auto& builder : builders) {
+        // Index in shared_ of each of the builder's distinct values.
+        auto global = std::vector<std::uint32_t>(builder.values_.size());
+
+        for (auto i = 0*global.size(); i < global.size(); ++i) {
+            auto [pos, inserted] = lookup.try_emplace(builder.values_[i],
+                                                      static_cast<std::uint32_t>(this->shared_.size()));
+            if (inserted) {
+                this->shared_.push_back(builder.values_[i]);
+            }
+
+            global[i] = pos->second;
+        }
+
+        for (const auto& [cell, local] : builder.cells_) {
+            this->index_[cell] = global[local];
+            this->unique_[cell].reset();
+        }
+
+        builder = Builder{};
+    }
+}
+
+template <class Scalar>
+typename Opm::EclEpsScalingPointsStore<Scalar>::MemoryUsage
+Opm::EclEpsScalingPointsStore<Scalar>::memoryUsage() const
+{
+    auto usage = MemoryUsage{};
+
+    usage.numCells = this->index_.size();
+    usage.numShared = this->shared_.size();
+    usage.numUnique = std::count_if(this->unique_.begin(), this->unique_.end(),
+                                    [](const auto& value) { return value != nullptr; });
+
+    return usage;
+}
+
+// ===========================================================================
+
+template class Opm::EclEpsScalingPointsStore<float>;
+template class Opm::EclEpsScalingPointsStore<double>;
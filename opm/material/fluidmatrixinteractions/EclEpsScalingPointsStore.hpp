@@ -0,0 +1,163 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::EclEpsScalingPointsStore
+ */
+#ifndef OPM_ECL_EPS_SCALING_POINTS_STORE_HPP
+#define OPM_ECL_EPS_SCALING_POINTS_STORE_HPP
+
+#include <opm/material/fluidmatrixinteractions/EclEpsScalingPoints.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \ingroup FluidMatrixInteractions
+ *
+ * \brief Compact per-cell storage of the scaled end-point information.
+ *
+ * Most cells of a model see the same scaled end-points as the other
+ * cells of their saturation region, because only a few of them have
+ * end-point arrays such as SWL or SWCR that differ from the table values.
+ * Each distinct value is therefore stored only once, in a contiguous
+ * table, and each cell holds the index of its value in that table.  Cells
+ * whose end-points are modified after initialisation, e.g., by SWATINIT,
+ * get a private copy.
+ *
+ * The store is filled through one Builder per thread, which are merged
+ * into the store once the parallel section is done.  Copies of the store
+ * are independent of each other.
+ */
+template <class Scalar>
+class EclEpsScalingPointsStore
+{
+public:
+    using Info = EclEpsScalingPointsInfo<Scalar>;
+
+    /*!
+     * \brief Memory consumption of the store.
+     */
+    struct MemoryUsage
+    {
+        //! Number of cells.
+        std::size_t numCells{0};
+
+        //! Number of distinct, shared values.
+        std::size_t numShared{0};
+
+        //! Number of private values created by unique().
+        std::size_t numUnique{0};
+
+        //! Number of bytes used by the store.
+        std::size_t bytesStored() const
+        {
+            return (numShared + numUnique) * sizeof(Info)
+                + numCells * (sizeof(std::uint32_t) + sizeof(std::unique_ptr<Info>));
+        }
+
+        //! Number of bytes needed if every cell had its own copy.
+        std::size_t bytesUnshared() const
+        { return numCells * sizeof(Info); }
+    };
+
+private:
+    struct Hash
+    {
+        std::size_t operator()(const Info& info) const;
+    };
+
+public:
+    /*!
+     * \brief Collects the values of the cells processed by a single thread.
+     */
+    class Builder
+    {
+    public:
+        /*!
+         * \brief Assigns \p info to \p cell.
+         */
+        void set(std::size_t cell, const Info& info);
+
+    private:
+        friend class EclEpsScalingPointsStore;
+
+        std::vector<Info> values_{};
+        std::unordered_map<Info, std::uint32_t, Hash> lookup_{};
+        std::vector<std::pair<std::size_t, std::uint32_t>> cells_{};
+    };
+
+    EclEpsScalingPointsStore() = default;
+    EclEpsScalingPointsStore(const EclEpsScalingPointsStore& rhs);
+    EclEpsScalingPointsStore(EclEpsScalingPointsStore&&) = default;
+    EclEpsScalingPointsStore& operator=(const EclEpsScalingPointsStore& rhs);
+    EclEpsScalingPointsStore& operator=(EclEpsScalingPointsStore&&) = default;
+
+    /*!
+     * \brief Sets the number of cells.  All cells get a value-initialised
+     *        entry.
+     */
+    void resize(std::size_t numCells);
+
+    std::size_t size() const
+    { return index_.size(); }
+
+    const Info& operator[](std::size_t cell) const
+    { return unique_[cell] ? *unique_[cell] : shared_[index_[cell]]; }
+
+    /*!
+     * \brief Returns the value of \p cell for modification.
+     *
+     * Creates a private copy unless the cell already has one.  Safe to call
+     * concurrently for distinct cells.
+     */
+    Info& unique(std::size_t cell);
+
+    /*!
+     * \brief Moves the values of \p builders into the store.
+     *
+     * If several builders assign the same cell, the last one wins.  The
+     * builders are empty afterwards.
+     */
+    void merge(std::vector<Builder>& builders);
+
+    /*!
+     * \brief Returns the memory consumption of the store.
+     */
+    MemoryUsage memoryUsage() const;
+
+private:
+    std::vector<Info> shared_{};
+    std::vector<std::uint32_t> index_{};
+    std::vector<std::unique_ptr<Info>> unique_{};
+};
+
+} // namespace Opm
+
+#endif
@@ -31,11 +31,13 @@ namespace Opm::EclMaterialLaw {
 template <class Traits>
 HystParams<Traits>::
 HystParams(typename Manager<Traits>::Params& params,
+           typename EclEpsScalingPointsStore<Scalar>::Builder& scaledInfo,
            const EclEpsGridProperties& epsGridProperties,
            const EclEpsGridProperties* epsImbGridProperties,
            const EclipseState& eclState,
            const Manager<Traits>& parent)
     : params_(params)
+    , scaledInfo_(scaledInfo)
     , epsGridProperties_(epsGridProperties)
     , epsImbGridProperties_(epsImbGridProperties)
     , eclState_(eclState)
@@ -148,7 +150,8 @@ setDrainageParamsOilWater(unsigned elemIdx, unsigned satRegionIdx,
     //  since we currently does not support facedir for the scaling points info
     //  When such support is added, we need to extend the below vector which has info for each cell
     //   to include three more vectors, one with info for each facedir of a cell
-    params_.oilWaterScaledEpsInfoDrainage[elemIdx] = oilWaterScaledInfo;
+    scaledInfo_.set(elemIdx, oilWaterScaledInfo);
+    oilWaterScaledInfo_ = oilWaterScaledInfo;
     if (hasOilWater_()) {
         typename TwoPhaseTypes<Traits>::OilWaterEpsParams oilWaterDrainParams;
         oilWaterDrainParams.setConfig(this->parent_.oilWaterConfig());
@@ -28,6 +28,7 @@
 #ifndef OPM_ECL_MATERIAL_LAW_HYST_PARAMS_HPP
 #define OPM_ECL_MATERIAL_LAW_HYST_PARAMS_HPP
 
+#include <opm/material/fluidmatrixinteractions/EclEpsScalingPointsStore.hpp>
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawTwoPhaseTypes.hpp>
 
 #include <functional>
@@ -52,7 +53,10 @@ public:
     using GasWaterHystParams = typename TwoPhaseTypes<Traits>::GasWaterHystParams;
     using OilWaterHystParams = typename TwoPhaseTypes<Traits>::OilWaterHystParams;
 
+    // Argument 'scaledInfo' collects the oil-water drainage end-points of
+    // the cells processed by the calling thread, see EclEpsScalingPointsStore.
     HystParams(typename Manager<Traits>::Params& params,
+               typename EclEpsScalingPointsStore<Scalar>::Builder& scaledInfo,
                const EclEpsGridProperties& epsGridProperties,
                const EclEpsGridProperties* epsImbGridProperties,
                const EclipseState& eclState,
@@ -69,6 +73,9 @@ public:
     std::shared_ptr<GasWaterHystParams> getGasWaterParams()
     { return gasWaterParams_; }
 
+    const EclEpsScalingPointsInfo<Scalar>& oilWaterScaledEpsInfoDrainage() const
+    { return oilWaterScaledInfo_; }
+
     void setConfig(unsigned satRegionIdx);
 
     // Function argument 'lookupIdxOnLevelZeroAssigner' is added to lookup, for each
@@ -122,6 +129,8 @@ private:
     std::shared_ptr<GasWaterHystParams> gasWaterParams_;
 
     typename Manager<Traits>::Params& params_;
+    typename EclEpsScalingPointsStore<Scalar>::Builder& scaledInfo_;
+    EclEpsScalingPointsInfo<Scalar> oilWaterScaledInfo_{};
     const EclEpsGridProperties& epsGridProperties_;
     const EclEpsGridProperties* epsImbGridProperties_;
     const EclipseState& eclState_;
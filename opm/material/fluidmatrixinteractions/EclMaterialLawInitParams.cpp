@@ -32,6 +32,10 @@
 
 #include <cassert>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace {
 
 unsigned satOrImbRegion(const std::vector<int>& array,
@@ -85,15 +89,28 @@ run(const IntLookupFunction& fieldPropIntOnLeafAssigner,
     std::vector<std::vector<MaterialLawParams>*> mlpArray;
     initArrays_(satnumArray, imbnumArray, mlpArray);
     const auto num_arrays = mlpArray.size();
+#ifdef _OPENMP
+    const int num_threads = omp_get_max_threads();
+#else
+    const int num_threads = 1;
+#endif
     for (unsigned i = 0; i < num_arrays; i++) {
+        // One builder per thread, merged after the parallel section.
+        std::vector<typename EclEpsScalingPointsStore<Scalar>::Builder> scaledInfo(num_threads);
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
         for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
             unsigned satRegionIdx = satRegion_(*satnumArray[i], elemIdx);
             //unsigned satNumCell = this->parent_.satnumRegionArray_[elemIdx];
+#ifdef _OPENMP
+            auto& threadScaledInfo = scaledInfo[omp_get_thread_num()];
+#else
+            auto& threadScaledInfo = scaledInfo[0];
+#endif
             HystParams<Traits> hystParams{
                 params_,
+                threadScaledInfo,
                 epsGridProperties_,
                 epsImbGridProperties_.get(),
                 this->eclState_,
@@ -111,8 +128,9 @@ run(const IntLookupFunction& fieldPropIntOnLeafAssigner,
                 hystParams.setImbibitionParamsGasWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
             }
             hystParams.finalize();
-            initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
+            initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx);
         }
+        params_.oilWaterScaledEpsInfoDrainage.merge(scaledInfo);
     }
 }
 
@@ -228,10 +246,9 @@ void
 InitParams<Traits>::
 initThreePhaseParams_(HystParams<Traits>& hystParams,
                       MaterialLawParams& materialParams,
-                      unsigned satRegionIdx,
-                      unsigned elemIdx)
+                      unsigned satRegionIdx)
 {
-    const auto& epsInfo = this->params_.oilWaterScaledEpsInfoDrainage[elemIdx];
+    const auto& epsInfo = hystParams.oilWaterScaledEpsInfoDrainage();
 
     auto oilWaterParams = hystParams.getOilWaterParams();
     auto gasOilParams = hystParams.getGasOilParams();
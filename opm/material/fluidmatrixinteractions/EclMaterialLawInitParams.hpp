@@ -98,8 +98,7 @@ private:
 
     void initThreePhaseParams_(HystParams<Traits>& hystParams,
                                MaterialLawParams& materialParams,
-                               unsigned satRegionIdx,
-                               unsigned elemIdx);
+                               unsigned satRegionIdx);
 
     void readEffectiveParameters_();
 
@@ -35,6 +35,8 @@
 #include <opm/material/fluidstates/SimpleModularFluidState.hpp>
 
 #include <algorithm>
+#include <cassert>
+#include <span>
 
 namespace Opm::EclMaterialLaw {
 
@@ -142,7 +144,7 @@ applySwatinit(unsigned elemIdx,
         return {Sw, /*newSwatInit*/ true};
     }
 
-    auto& elemScaledEpsInfo = params_.oilWaterScaledEpsInfoDrainage[elemIdx];
+    const auto& elemScaledEpsInfo = params_.oilWaterScaledEpsInfoDrainage[elemIdx];
     if (Sw <= elemScaledEpsInfo.Swl)
         Sw = elemScaledEpsInfo.Swl;
 
@@ -177,6 +179,9 @@ applySwatinit(unsigned elemIdx,
     // Sufficiently positive value, continue with max. capillary pressure (PCW) scaling to honor SWATINIT value
     Scalar newMaxPcow = elemScaledEpsInfo.maxPcow * (pcow/pcowAtSw);
 
+    // The end-points of this cell are modified, so give it its own copy.
+    auto& scaledEpsInfo = params_.oilWaterScaledEpsInfoDrainage.unique(elemIdx);
+
     // Limit max. capillary pressure with PPCWMAX
     bool newSwatInit = false;
     int satRegionIdx = satnumRegionIdx(elemIdx);
@@ -186,19 +191,19 @@ applySwatinit(unsigned elemIdx,
         newSwatInit = true;
         if (modifySwl_[satRegionIdx] == false) {
             // Max. cap. pressure set to PCWO in PPCWMAX
-            elemScaledEpsInfo.maxPcow = maxAllowPc_[satRegionIdx];
+            scaledEpsInfo.maxPcow = maxAllowPc_[satRegionIdx];
         }
         else {
             // Max. cap. pressure remains unscaled and connate Sw is set to SWATINIT value
-            elemScaledEpsInfo.Swl = Sw;
+            scaledEpsInfo.Swl = Sw;
         }
     }
     // Max. cap. pressure adjusted from SWATINIT data
     else
-        elemScaledEpsInfo.maxPcow = newMaxPcow;
+        scaledEpsInfo.maxPcow = newMaxPcow;
 
     auto& elemEclEpsScalingPoints = oilWaterScaledEpsPointsDrainage(elemIdx);
-    elemEclEpsScalingPoints.init(elemScaledEpsInfo,
+    elemEclEpsScalingPoints.init(scaledEpsInfo,
                                  oilWaterConfig_,
                                  EclTwoPhaseSystemType::OilWater);
 
@@ -214,7 +219,7 @@ applyRestartSwatInit(const unsigned elemIdx,
     // Maximum capillary pressure adjusted from SWATINIT data.
 
     auto& elemScaledEpsInfo =
-        this->params_.oilWaterScaledEpsInfoDrainage[elemIdx];
+        this->params_.oilWaterScaledEpsInfoDrainage.unique(elemIdx);
 
     elemScaledEpsInfo.maxPcow = maxPcow;
 
@@ -544,6 +549,80 @@ readGlobalThreePhaseOptions_(const Runspec& runspec)
     }
 }
 
+template<class TraitsT>
+std::size_t
+Manager<TraitsT>::
+updateHysteresis(const unsigned firstElem,
+                 std::span<const Scalar> saturations,
+                 std::vector<bool>& changed)
+{
+    OPM_TIMEFUNCTION_LOCAL(Subsystem::SatProps);
+
+    assert(saturations.size() % numPhases == 0);
+    changed.assign(saturations.size() / numPhases, false);
+
+    if (!enableHysteresis()) {
+        return 0;
+    }
+
+    switch (threePhaseApproach_) {
+    case EclMultiplexerApproach::Stone1:
+        return updateHysteresisCells_<typename MaterialLaw::Stone1Material,
+                                      EclMultiplexerApproach::Stone1>(firstElem, saturations, changed);
+    case EclMultiplexerApproach::Stone2:
+        return updateHysteresisCells_<typename MaterialLaw::Stone2Material,
+                                      EclMultiplexerApproach::Stone2>(firstElem, saturations, changed);
+    case EclMultiplexerApproach::Default:
+        return updateHysteresisCells_<typename MaterialLaw::DefaultMaterial,
+                                      EclMultiplexerApproach::Default>(firstElem, saturations, changed);
+    case EclMultiplexerApproach::TwoPhase:
+        return updateHysteresisCells_<typename MaterialLaw::TwoPhaseMaterial,
+                                      EclMultiplexerApproach::TwoPhase>(firstElem, saturations, changed);
+    case EclMultiplexerApproach::OnePhase:
+        return 0;
+    }
+
+    return 0;
+}
+
+template<class TraitsT>
+template<class ActualLaw, EclMultiplexerApproach approach>
+std::size_t
+Manager<TraitsT>::
+updateHysteresisCells_(const unsigned firstElem,
+                       std::span<const Scalar> saturations,
+                       std::vector<bool>& changed)
+{
+    using Dir = FaceDir::DirEnum;
+    using State = SaturationState_<Scalar>;
+
+    const bool directional = hasDirectionalRelperms() || hasDirectionalImbnum();
+
+    auto numChanged = std::size_t{0};
+    for (auto cell = std::size_t{0}; cell < changed.size(); ++cell) {
+        const auto elemIdx = static_cast<unsigned>(firstElem + cell);
+        const auto state = State { saturations.data() + cell*numPhases };
+
+        bool cellChanged = ActualLaw::updateHysteresis
+            (params_.materialLawParams[elemIdx].template getRealParams<approach>(), state);
+
+        if (directional) {
+            for (const auto facedir : {Dir::XPlus, Dir::YPlus, Dir::ZPlus}) {
+                const bool dirChanged = ActualLaw::updateHysteresis
+                    (materialLawParams(elemIdx, facedir).template getRealParams<approach>(), state);
+                cellChanged = cellChanged || dirChanged;
+            }
+        }
+
+        if (cellChanged) {
+            changed[cell] = true;
+            ++numChanged;
+        }
+    }
+
+    return numChanged;
+}
+
 template class Manager<ThreePhaseMaterialTraits<double,0,1,2,true,true>>;
 template class Manager<ThreePhaseMaterialTraits<float,0,1,2,true,true>>;
 template class Manager<ThreePhaseMaterialTraits<double,2,0,1,true,true>>;
@@ -32,6 +32,7 @@
 #include <opm/input/eclipse/EclipseState/WagHysteresisConfig.hpp>
 
 #include <opm/material/fluidmatrixinteractions/EclEpsConfig.hpp>
+#include <opm/material/fluidmatrixinteractions/EclEpsScalingPointsStore.hpp>
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawTwoPhaseTypes.hpp>
 #include <opm/material/fluidmatrixinteractions/EclEpsTwoPhaseLaw.hpp>
 #include <opm/material/fluidmatrixinteractions/SatCurveMultiplexer.hpp>
@@ -41,8 +42,10 @@
 #include <opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp>
 
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace Opm {
@@ -98,7 +101,7 @@ private:
     using GasOilScalingPointsVector = std::vector<std::shared_ptr<EclEpsScalingPoints<Scalar>>>;
     using OilWaterScalingPointsVector = std::vector<std::shared_ptr<EclEpsScalingPoints<Scalar>>>;
     using GasWaterScalingPointsVector = std::vector<std::shared_ptr<EclEpsScalingPoints<Scalar>>>;
-    using OilWaterScalingInfoVector = std::vector<EclEpsScalingPointsInfo<Scalar>>;
+    using OilWaterScalingInfoVector = EclEpsScalingPointsStore<Scalar>;
     using MaterialLawParamsVector = std::vector<std::shared_ptr<MaterialLawParams>>;
 
 public:
@@ -289,6 +292,63 @@ public:
         return changed;
     }
 
+    /*!
+     * \brief Update the hysteresis parameters of a contiguous range of cells.
+     *
+     * Equivalent to calling updateHysteresis() for each cell, including the
+     * directional parameters, but the three-phase approach is resolved once
+     * per call rather than once per cell.
+     *
+     * \param firstElem Index of the first cell of the range.
+     * \param saturations Phase saturations, numPhases consecutive values per
+     *        cell in phase index order.  Defines the size of the range.
+     * \param changed Whether or not the hysteresis parameters of each cell
+     *        of the range changed.  Resized to the number of cells.
+     *
+     * \return Number of cells whose hysteresis parameters changed.
+     */
+    std::size_t updateHysteresis(unsigned firstElem,
+                                 std::span<const Scalar> saturations,
+                                 std::vector<bool>& changed);
+
+    /*!
+     * \brief Relative permeabilities of a contiguous range of cells.
+     *
+     * Equivalent to calling MaterialLaw::relativePermeabilities() for each
+     * cell, but the three-phase approach and the saturation curve type are
+     * resolved once per call rather than once per cell.  Cells are visited
+     * in order, so that the saturations, the results and the per-cell
+     * parameters are all accessed sequentially.
+     *
+     * \param firstElem Index of the first cell of the range.
+     * \param saturations Phase saturations, numPhases consecutive values per
+     *        cell in phase index order.  Defines the size of the range.
+     * \param values Relative permeabilities, same layout as \p saturations.
+     */
+    template <class Evaluation>
+    void relativePermeabilities(unsigned firstElem,
+                                std::span<const Evaluation> saturations,
+                                std::span<Evaluation> values) const
+    {
+        OPM_TIMEFUNCTION_LOCAL(Subsystem::SatProps);
+        evaluateRange_</*relperm=*/true>(firstElem, saturations, values);
+    }
+
+    /*!
+     * \brief Capillary pressures of a contiguous range of cells.
+     *
+     * Batched counterpart of MaterialLaw::capillaryPressures().  See
+     * relativePermeabilities() for the layout of the arguments.
+     */
+    template <class Evaluation>
+    void capillaryPressures(unsigned firstElem,
+                            std::span<const Evaluation> saturations,
+                            std::span<Evaluation> values) const
+    {
+        OPM_TIMEFUNCTION_LOCAL(Subsystem::SatProps);
+        evaluateRange_</*relperm=*/false>(firstElem, saturations, values);
+    }
+
     void oilWaterHysteresisParams(Scalar& soMax,
                                   Scalar& swMax,
                                   Scalar& swMin,
@@ -314,6 +374,18 @@ public:
     const EclEpsScalingPointsInfo<Scalar>& oilWaterScaledEpsInfoDrainage(size_t elemIdx) const
     { return params_.oilWaterScaledEpsInfoDrainage[elemIdx]; }
 
+    /*!
+     * \brief Returns the memory consumption of the oil-water scaled
+     *        end-point information of all cells.
+     *
+     * Identical values are stored only once, so the number of stored
+     * values is typically close to the number of saturation regions unless
+     * the end-points are scaled per cell or modified by SWATINIT.
+     */
+    typename EclEpsScalingPointsStore<Scalar>::MemoryUsage
+    scaledEpsInfoMemoryUsage() const
+    { return params_.oilWaterScaledEpsInfoDrainage.memoryUsage(); }
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
@@ -332,6 +404,95 @@ public:
     }
 
 private:
+    // Minimal fluid state for the batched evaluation API.  Saturations only.
+    template <class Evaluation>
+    struct SaturationState_
+    {
+        using ValueType = Evaluation;
+
+        const Evaluation* saturations;
+
+        const Evaluation& saturation(unsigned phaseIdx) const
+        { return saturations[phaseIdx]; }
+    };
+
+    template <bool relperm, class Evaluation>
+    void evaluateRange_(unsigned firstElem,
+                        std::span<const Evaluation> saturations,
+                        std::span<Evaluation> values) const
+    {
+        assert(saturations.size() == values.size());
+        assert(saturations.size() % numPhases == 0);
+
+        switch (threePhaseApproach_) {
+        case EclMultiplexerApproach::Stone1:
+            evaluateCurves_<relperm, EclMultiplexerDispatch<EclMultiplexerApproach::Stone1>>
+                (firstElem, saturations, values);
+            break;
+        case EclMultiplexerApproach::Stone2:
+            evaluateCurves_<relperm, EclMultiplexerDispatch<EclMultiplexerApproach::Stone2>>
+                (firstElem, saturations, values);
+            break;
+        case EclMultiplexerApproach::Default:
+            evaluateCurves_<relperm, EclMultiplexerDispatch<EclMultiplexerApproach::Default>>
+                (firstElem, saturations, values);
+            break;
+        case EclMultiplexerApproach::TwoPhase:
+            evaluateCurves_<relperm, EclMultiplexerDispatch<EclMultiplexerApproach::TwoPhase>>
+                (firstElem, saturations, values);
+            break;
+        case EclMultiplexerApproach::OnePhase:
+            evaluateCurves_<relperm, EclMultiplexerDispatch<EclMultiplexerApproach::OnePhase>>
+                (firstElem, saturations, values);
+            break;
+        }
+    }
+
+    template <bool relperm, class ApproachDispatch, class Evaluation>
+    void evaluateCurves_(unsigned firstElem,
+                         std::span<const Evaluation> saturations,
+                         std::span<Evaluation> values) const
+    {
+        if (satCurveIsAllPiecewiseLinear()) {
+            evaluateCells_<relperm, ApproachDispatch,
+                           SatCurveMultiplexerDispatch<SatCurveMultiplexerApproach::PiecewiseLinear>>
+                (firstElem, saturations, values);
+        }
+        else {
+            evaluateCells_<relperm, ApproachDispatch>(firstElem, saturations, values);
+        }
+    }
+
+    template <bool relperm, class... Dispatch, class Evaluation>
+    void evaluateCells_(unsigned firstElem,
+                        std::span<const Evaluation> saturations,
+                        std::span<Evaluation> values) const
+    {
+        using Container = std::span<Evaluation, numPhases>;
+        using State = SaturationState_<Evaluation>;
+
+        const auto numElems = static_cast<unsigned>(saturations.size() / numPhases);
+        for (auto cell = 0u; cell < numElems; ++cell) {
+            const auto offset = static_cast<std::size_t>(cell) * numPhases;
+            const auto state = State { saturations.data() + offset };
+            auto cellValues = Container { values.data() + offset, numPhases };
+
+            if constexpr (relperm) {
+                MaterialLaw::template relativePermeabilities<Container, State, Dispatch...>
+                    (cellValues, materialLawParams(firstElem + cell), state);
+            }
+            else {
+                MaterialLaw::template capillaryPressures<Container, State, Dispatch...>
+                    (cellValues, materialLawParams(firstElem + cell), state);
+            }
+        }
+    }
+
+    template <class ActualLaw, EclMultiplexerApproach approach>
+    std::size_t updateHysteresisCells_(unsigned firstElem,
+                                       std::span<const Scalar> saturations,
+                                       std::vector<bool>& changed);
+
     const MaterialLawParams& materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const;
 
     void readGlobalEpsOptions_(const EclipseState& eclState);
@@ -29,6 +29,7 @@
 #include "blackoilpvt/OilPvtMultiplexer.hpp"
 #include "blackoilpvt/GasPvtMultiplexer.hpp"
 #include "blackoilpvt/WaterPvtMultiplexer.hpp"
+#include "blackoilpvt/PvtBatch.hpp"
 #include "opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp"
 #include "opm/material/fluidsystems/blackoilpvt/NullOilPvt.hpp"
 
@@ -51,6 +52,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -1451,6 +1453,66 @@ public:
         }
     }
 
+    /*!
+     * \brief Returns the inverse formation volume factors of a fluid phase in a
+     *        batch of cells.
+     *
+     * Unlike the fluid state based method, the batched methods evaluate the
+     * PVT relations for the given dissolution factors and do not switch to the
+     * saturated tables.  The phase and PVT approach are resolved once for the
+     * whole batch.  See PvtBatch for the layout of the arguments.
+     */
+    template <class Evaluation>
+    STATIC_OR_DEVICE void inverseFormationVolumeFactor(unsigned phaseIdx,
+                                                       const PvtBatch<Evaluation>& cells,
+                                                       std::span<Evaluation> values) NOTHING_OR_CONST
+    {
+        OPM_TIMEBLOCK_LOCAL(inverseFormationVolumeFactor, Subsystem::PvtProps);
+        switch (phaseIdx) {
+        case oilPhaseIdx: oilPvt_.inverseFormationVolumeFactor(cells, values); break;
+        case gasPhaseIdx: gasPvt_.inverseFormationVolumeFactor(cells, values); break;
+        case waterPhaseIdx: waterPvt_.inverseFormationVolumeFactor(cells, values); break;
+        default: OPM_THROW(std::logic_error, "Unhandled phase index " + std::to_string(phaseIdx));
+        }
+    }
+
+    /*!
+     * \brief Returns the dynamic viscosities of a fluid phase in a batch of cells.
+     */
+    template <class Evaluation>
+    STATIC_OR_DEVICE void viscosity(unsigned phaseIdx,
+                                    const PvtBatch<Evaluation>& cells,
+                                    std::span<Evaluation> values) NOTHING_OR_CONST
+    {
+        OPM_TIMEBLOCK_LOCAL(viscosity, Subsystem::PvtProps);
+        switch (phaseIdx) {
+        case oilPhaseIdx: oilPvt_.viscosity(cells, values); break;
+        case gasPhaseIdx: gasPvt_.viscosity(cells, values); break;
+        case waterPhaseIdx: waterPvt_.viscosity(cells, values); break;
+        default: OPM_THROW(std::logic_error, "Unhandled phase index " + std::to_string(phaseIdx));
+        }
+    }
+
+    /*!
+     * \brief Returns the dissolution factors of saturated fluid phases in a batch of
+     *        cells.
+     *
+     * This is \f$R_s\f$ for oil, \f$R_v\f$ for gas and \f$R_{sw}\f$ for water.
+     */
+    template <class Evaluation>
+    STATIC_OR_DEVICE void saturatedDissolutionFactor(unsigned phaseIdx,
+                                                     const PvtBatch<Evaluation>& cells,
+                                                     std::span<Evaluation> values) NOTHING_OR_CONST
+    {
+        OPM_TIMEBLOCK_LOCAL(saturatedDissolutionFactor, Subsystem::PvtProps);
+        switch (phaseIdx) {
+        case oilPhaseIdx: oilPvt_.saturatedGasDissolutionFactor(cells, values); break;
+        case gasPhaseIdx: gasPvt_.saturatedOilVaporizationFactor(cells, values); break;
+        case waterPhaseIdx: waterPvt_.saturatedGasDissolutionFactor(cells, values); break;
+        default: OPM_THROW(std::logic_error, "Unhandled phase index " + std::to_string(phaseIdx));
+        }
+    }
+
     /*!
      * \brief Returns the bubble point pressure $P_b$ using the current Rs
      */
@@ -33,6 +33,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <string>
+
 namespace Opm {
 
 template<class Scalar, template<class> class Storage>
@@ -225,6 +228,64 @@ setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa)
                              static_cast<Scalar>(viscaqa[0].getC2("NACL"))};
 }
 
+template<class Scalar, template<class> class Storage>
+void BrineCo2Pvt<Scalar, Storage>::
+enableSurrogate(const typename Surrogate::Range& range,
+                Scalar tolerance,
+                std::size_t maxSamples)
+{
+    // the tables are sampled from the exact model
+    surrogate_.reset();
+
+    auto tabulatedRange = range;
+    if (!enableSaltConcentration_ && !salinity_.empty()) {
+        const auto [salinityMin, salinityMax] = std::minmax_element(salinity_.begin(), salinity_.end());
+        tabulatedRange.salinityMin = *salinityMin;
+        tabulatedRange.salinityMax = *salinityMax;
+    }
+
+    auto moleFraction = typename Surrogate::Function{[](Scalar, Scalar, Scalar) { return Scalar{0}; }};
+    if (enableDissolution_) {
+        moleFraction = [this](Scalar T, Scalar p, Scalar salinity)
+        { return saturatedMoleFraction_(T, p, salinity); };
+    }
+
+    auto brineDensity = typename Surrogate::Function{};
+    if (!enableEzrokhiDensity_) {
+        brineDensity = [](Scalar T, Scalar p, Scalar salinity)
+        { return Brine::liquidDensity(T, p, salinity, extrapolate); };
+    }
+
+    auto surrogate = std::make_shared<const Surrogate>(
+        tabulatedRange, tolerance, maxSamples, moleFraction,
+        [this](Scalar T, Scalar p, Scalar salinity)
+        { return brineViscosity_(T, p, salinity); },
+        [](Scalar T, Scalar p, Scalar)
+        { return H2O::liquidDensity(T, p, extrapolate); },
+        brineDensity);
+
+    const auto report = [tolerance](const std::string& name, const typename Surrogate::Table& table)
+    {
+        const auto& n = table.numSamples();
+        OpmLog::info(fmt::format("Tabulated brine {} for CO2STORE on {}x{}x{} points "
+                                 "(temperature x pressure x salinity), relative error {:.2E}.",
+                                 name, n[0], n[1], n[2], table.relativeError()));
+        if (table.relativeError() > tolerance) {
+            OpmLog::warning(fmt::format("The tabulated brine {} for CO2STORE does not reach the "
+                                        "requested relative tolerance {:.2E} within the maximum "
+                                        "number of sampling points.", name, tolerance));
+        }
+    };
+    report("CO2 solubility", surrogate->moleFraction());
+    report("viscosity", surrogate->viscosity());
+    report("water density", surrogate->waterDensity());
+    if (surrogate->hasBrineDensity()) {
+        report("density", surrogate->brineDensity());
+    }
+
+    surrogate_ = std::move(surrogate);
+}
+
 template class BrineCo2Pvt<double>;
 template class BrineCo2Pvt<float>;
 
@@ -45,10 +45,13 @@
 #include <opm/material/binarycoefficients/H2O_CO2.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
 #include <opm/material/fluidsystems/BlackOilFunctions.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2PvtSurrogate.hpp>
 
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 
 #include <cstddef>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace Opm {
@@ -98,6 +101,12 @@ public:
     //! The binary coefficients for brine and CO2 used by this fluid system
     using BinaryCoeffBrineCO2 = BinaryCoeff::Brine_CO2<Scalar, H2O, CO2>;
 
+    using Surrogate = BrineCo2PvtSurrogate<Scalar>;
+
+    //! The surrogate tables live on the host only, so GPU copies never carry them.
+    static constexpr bool hasSurrogate_ =
+        std::is_same_v<ContainerT, VectorWithDefaultAllocator<Scalar>>;
+
     BrineCo2Pvt() = default;
 
     explicit BrineCo2Pvt(const ContainerT& salinity,
@@ -189,6 +198,53 @@ public:
 
     void setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa);
 
+    /*!
+     * \brief Tabulate the saturated CO2 mole fraction, the viscosity and the
+     *        density of the brine over a range of states.
+     *
+     * Evaluations inside the range subsequently interpolate the tables
+     * instead of solving the solubility model and evaluating the component
+     * correlations.  States outside the range are still evaluated exactly.
+     * Must be called after all other parameters of the model are set.  If
+     * the salt concentration is not considered, the salinity range is
+     * replaced by the range of the salinities of the PVT regions.
+     *
+     * \param range The temperatures, pressures and salinities expected in
+     *              the case.
+     * \param tolerance The maximum interpolation error relative to the
+     *                  largest magnitude of each quantity in the range.
+     * \param maxSamples The maximum number of sampling points per quantity.
+     *
+     * Only available for the default storage.
+     */
+    void enableSurrogate(const typename Surrogate::Range& range,
+                         Scalar tolerance,
+                         std::size_t maxSamples = std::size_t{1} << 20);
+
+    /*!
+     * \brief Evaluate all states exactly.
+     */
+    void disableSurrogate()
+    {
+        if constexpr (hasSurrogate_) {
+            surrogate_.reset();
+        }
+    }
+
+    /*!
+     * \brief Returns the tables used for states inside their range, or
+     *        nullptr if no surrogate is enabled.
+     */
+    const Surrogate* surrogate() const
+    {
+        if constexpr (hasSurrogate_) {
+            return surrogate_.get();
+        }
+        else {
+            return nullptr;
+        }
+    }
+
     /*!
      * \brief Return the number of PVT regions which are considered by this PVT-object.
      */
@@ -266,14 +322,7 @@ public:
     {
         OPM_TIMEFUNCTION_LOCAL(Subsystem::PvtProps);
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature, pressure, saltConcentration);
-        if (enableEzrokhiViscosity_) {
-            const Evaluation& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
-            const Evaluation& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
-            return mu_pure * pow(10.0, nacl_exponent * salinity);
-        }
-        else {
-            return Brine::liquidViscosity(temperature, pressure, salinity);
-        }
+        return brineViscosity_(temperature, pressure, salinity);
     }
 
     /*!
@@ -300,15 +349,7 @@ public:
                                                   const Evaluation& pressure) const
     {
         OPM_TIMEFUNCTION_LOCAL(Subsystem::PvtProps);
-        if (enableEzrokhiViscosity_) {
-            const Evaluation& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
-            const Evaluation& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
-            return mu_pure * pow(10.0, nacl_exponent * Evaluation(salinity_[regionIdx]));
-        }
-        else {
-            return Brine::liquidViscosity(temperature, pressure, Evaluation(salinity_[regionIdx]));
-        }
-
+        return brineViscosity_(temperature, pressure, Evaluation(salinity_[regionIdx]));
     }
 
 
@@ -568,10 +609,28 @@ public:
             return 0.0;
         }
 
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* surrogate = surrogateFor_(temperature, pressure, salinity)) {
+            const Evaluation xlCO2 =
+                max(0.0, min(1.0, surrogate->moleFraction().eval(temperature, pressure, salinity)));
+            return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+        }
+#endif
+
+        const Evaluation xlCO2 = saturatedMoleFraction_(temperature, pressure, salinity);
+        return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+    }
+
+private:
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval saturatedMoleFraction_(const LhsEval& temperature,
+                                                   const LhsEval& pressure,
+                                                   const LhsEval& salinity) const
+    {
         // calulate the equilibrium composition for the given
         // temperature and pressure.
-        Evaluation xgH2O;
-        Evaluation xlCO2;
+        LhsEval xgH2O;
+        LhsEval xlCO2;
         BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_,
                                                     temperature,
                                                     pressure,
@@ -583,12 +642,77 @@ public:
                                                     extrapolate);
 
         // normalize the phase compositions
-        xlCO2 = max(0.0, min(1.0, xlCO2));
+        return max(0.0, min(1.0, xlCO2));
+    }
 
-        return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval brineViscosity_(const LhsEval& temperature,
+                                            const LhsEval& pressure,
+                                            const LhsEval& salinity) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* surrogate = surrogateFor_(temperature, pressure, salinity)) {
+            return surrogate->viscosity().eval(temperature, pressure, salinity);
+        }
+#endif
+
+        if (enableEzrokhiViscosity_) {
+            const LhsEval& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
+            const LhsEval& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
+            return mu_pure * pow(10.0, nacl_exponent * salinity);
+        }
+        else {
+            return Brine::liquidViscosity(temperature, pressure, salinity);
+        }
+    }
+
+    /*!
+     * \brief Returns the surrogate if it covers the given state.
+     *
+     * Host only; callers guard it with OPM_IS_INSIDE_DEVICE_FUNCTION.
+     */
+    template <class LhsEval>
+    const Surrogate* surrogateFor_([[maybe_unused]] const LhsEval& temperature,
+                                   [[maybe_unused]] const LhsEval& pressure,
+                                   [[maybe_unused]] const LhsEval& salinity) const
+    {
+        if constexpr (hasSurrogate_) {
+            if (surrogate_ && surrogate_->applies(temperature, pressure, salinity)) {
+                return surrogate_.get();
+            }
+        }
+        return nullptr;
+    }
+
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval pureWaterDensity_(const LhsEval& T,
+                                              const LhsEval& pl,
+                                              [[maybe_unused]] const LhsEval& salinity) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* surrogate = surrogateFor_(T, pl, salinity)) {
+            return surrogate->waterDensity().eval(T, pl, salinity);
+        }
+#endif
+        return H2O::liquidDensity(T, pl, extrapolate);
+    }
+
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval brineDensity_(const LhsEval& T,
+                                          const LhsEval& pl,
+                                          const LhsEval& salinity,
+                                          const LhsEval& rho_pure) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* surrogate = surrogateFor_(T, pl, salinity);
+            surrogate && surrogate->hasBrineDensity())
+        {
+            return surrogate->brineDensity().eval(T, pl, salinity);
+        }
+#endif
+        return Brine::liquidDensity(T, pl, salinity, rho_pure);
     }
 
-private:
     template <class LhsEval>
     OPM_HOST_DEVICE LhsEval ezrokhiExponent_(const LhsEval& temperature,
                                              const ContainerT& ezrokhiCoeff) const
@@ -631,7 +755,7 @@ private:
 #endif
         }
 
-        const LhsEval& rho_pure = H2O::liquidDensity(T, pl, extrapolate);
+        const LhsEval& rho_pure = pureWaterDensity_(T, pl, salinity);
         if (enableEzrokhiDensity_) {
             const LhsEval& nacl_exponent = ezrokhiExponent_(T, ezrokhiDenNaClCoeff_);
             const LhsEval& co2_exponent = ezrokhiExponent_(T, ezrokhiDenCo2Coeff_);
@@ -639,7 +763,7 @@ private:
             return rho_pure * pow(10.0, nacl_exponent * salinity + co2_exponent * XCO2);
         }
         else {
-            const LhsEval& rho_brine = Brine::liquidDensity(T, pl, salinity, rho_pure);
+            const LhsEval& rho_brine = brineDensity_(T, pl, salinity, rho_pure);
             const LhsEval& rho_lCO2 = liquidDensityWaterCO2_(T, xlCO2, rho_pure);
             const LhsEval& contribCO2 = rho_lCO2 - rho_pure;
             return rho_brine + contribCO2;
@@ -850,6 +974,8 @@ private:
     Co2StoreConfig::LiquidMixingType liquidMixType_{};
     Co2StoreConfig::SaltMixingType saltMixType_{};
     Params co2Tables_;
+    struct NoSurrogate {};
+    std::conditional_t<hasSurrogate_, std::shared_ptr<const Surrogate>, NoSurrogate> surrogate_{};
 };
 
 } // namespace Opm
@@ -0,0 +1,180 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2PvtSurrogate.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <stdexcept>
+
+namespace {
+
+// number of intervals per axis of the initial grid
+constexpr unsigned initialIntervals = 8;
+
+} // Anonymous namespace
+
+namespace Opm {
+
+template<class Scalar>
+typename BrineCo2PvtSurrogate<Scalar>::Table
+BrineCo2PvtSurrogate<Scalar>::Table::
+build(const Range& range,
+      Scalar tolerance,
+      std::size_t maxSamples,
+      const Function& f)
+{
+    if (!(tolerance > 0)) {
+        OPM_THROW(std::invalid_argument, "The tolerance of the brine-CO2 PVT surrogate must be positive");
+    }
+
+    Table table;
+    table.min_ = {range.temperatureMin, range.pressureMin, range.salinityMin};
+    table.max_ = {range.temperatureMax, range.pressureMax, range.salinityMax};
+    for (int axis = 0; axis < 3; ++axis) {
+        if (table.max_[axis] < table.min_[axis]) {
+            OPM_THROW(std::invalid_argument, "Invalid range of the brine-CO2 PVT surrogate");
+        }
+        table.n_[axis] = table.max_[axis] > table.min_[axis] ? initialIntervals + 1 : 1;
+    }
+
+    int numAxes = 0;
+    for (const auto n : table.n_) {
+        numAxes += n > 1;
+    }
+
+    while (true) {
+        table.tabulate_(f);
+        const auto errors = table.axisErrors_(f);
+        table.relativeError_ = errors[0] + errors[1] + errors[2];
+        if (table.relativeError_ <= tolerance) {
+            break;
+        }
+
+        // halve the spacing of all axes which exceed their share of the
+        // tolerance
+        auto n = table.n_;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (n[axis] > 1 && errors[axis] > tolerance / numAxes) {
+                n[axis] = 2 * (n[axis] - 1) + 1;
+            }
+        }
+
+        if (static_cast<std::size_t>(n[0]) * n[1] * n[2] > maxSamples) {
+            break;
+        }
+        table.n_ = n;
+    }
+
+    return table;
+}
+
+template<class Scalar>
+void BrineCo2PvtSurrogate<Scalar>::Table::
+tabulate_(const Function& f)
+{
+    samples_.resize(static_cast<std::size_t>(n_[0]) * n_[1] * n_[2]);
+
+    scale_ = 0;
+    for (unsigned k = 0; k < n_[2]; ++k) {
+        for (unsigned j = 0; j < n_[1]; ++j) {
+            for (unsigned i = 0; i < n_[0]; ++i) {
+                const Scalar value = f(coordinate_(0, i), coordinate_(1, j), coordinate_(2, k));
+                samples_[(k * n_[1] + j) * n_[0] + i] = value;
+                scale_ = std::max(scale_, std::abs(value));
+            }
+        }
+    }
+
+    if (!(scale_ > 0)) {
+        scale_ = 1;
+    }
+}
+
+template<class Scalar>
+std::array<Scalar, 3>
+BrineCo2PvtSurrogate<Scalar>::Table::
+axisErrors_(const Function& f) const
+{
+    std::array<Scalar, 3> errors{};
+
+    for (int axis = 0; axis < 3; ++axis) {
+        if (n_[axis] == 1) {
+            continue;
+        }
+
+        // compare the function with the interpolation at the midpoints
+        // between adjacent sampling points along the axis
+        std::array<unsigned, 3> end = n_;
+        end[axis] -= 1;
+        for (unsigned k = 0; k < end[2]; ++k) {
+            for (unsigned j = 0; j < end[1]; ++j) {
+                for (unsigned i = 0; i < end[0]; ++i) {
+                    std::array<unsigned, 3> next = {i, j, k};
+                    next[axis] += 1;
+
+                    std::array<Scalar, 3> x = {coordinate_(0, i), coordinate_(1, j), coordinate_(2, k)};
+                    x[axis] = (x[axis] + coordinate_(axis, next[axis])) / 2;
+
+                    const Scalar interpolated = (sample_(i, j, k) + sample_(next[0], next[1], next[2])) / 2;
+                    const Scalar error = std::abs(f(x[0], x[1], x[2]) - interpolated) / scale_;
+                    errors[axis] = std::max(errors[axis], error);
+                }
+            }
+        }
+    }
+
+    return errors;
+}
+
+template<class Scalar>
+BrineCo2PvtSurrogate<Scalar>::
+BrineCo2PvtSurrogate(const Range& range,
+                     Scalar tolerance,
+                     std::size_t maxSamples,
+                     const Function& moleFraction,
+                     const Function& viscosity,
+                     const Function& waterDensity,
+                     const Function& brineDensity)
+    : range_(range)
+    , tolerance_(tolerance)
+{
+    moleFraction_ = Table::build(range, tolerance, maxSamples, moleFraction);
+    viscosity_ = Table::build(range, tolerance, maxSamples, viscosity);
+
+    // the density of pure water does not depend on the salinity
+    auto waterRange = range;
+    waterRange.salinityMax = waterRange.salinityMin;
+    waterDensity_ = Table::build(waterRange, tolerance, maxSamples, waterDensity);
+
+    hasBrineDensity_ = static_cast<bool>(brineDensity);
+    if (hasBrineDensity_) {
+        brineDensity_ = Table::build(range, tolerance, maxSamples, brineDensity);
+    }
+}
+
+template class BrineCo2PvtSurrogate<double>;
+template class BrineCo2PvtSurrogate<float>;
+
+} // namespace Opm
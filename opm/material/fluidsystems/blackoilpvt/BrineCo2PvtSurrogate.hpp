@@ -0,0 +1,295 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::BrineCo2PvtSurrogate
+ */
+#ifndef OPM_BRINE_CO2_PVT_SURROGATE_HPP
+#define OPM_BRINE_CO2_PVT_SURROGATE_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Pre-tabulated approximation of the expensive parts of the
+ *        brine-CO2 PVT model.
+ *
+ * Holds the mole fraction of CO2 in CO2-saturated brine, the brine
+ * viscosity, the density of pure water and the density of CO2-free brine,
+ * each sampled on a uniform temperature-pressure-salinity grid.  The grid
+ * of each quantity is refined, independently per axis, until the
+ * interpolation error between the sampling points is below a given
+ * tolerance relative to the largest magnitude of the quantity in the
+ * tabulated range.  The values are interpolated multi-linearly, so the
+ * derivatives of Evaluations are propagated through the interpolation
+ * weights.
+ *
+ * The surrogate is built by BrineCo2Pvt::enableSurrogate() and is only
+ * used for states inside the tabulated range.  It is not available in
+ * device code.
+ */
+template <class Scalar>
+class BrineCo2PvtSurrogate
+{
+public:
+    //! Function of temperature [K], pressure [Pa] and salinity [-].
+    using Function = std::function<Scalar(Scalar, Scalar, Scalar)>;
+
+    //! The range of states covered by the surrogate.
+    struct Range
+    {
+        Scalar temperatureMin{};
+        Scalar temperatureMax{};
+        Scalar pressureMin{};
+        Scalar pressureMax{};
+        Scalar salinityMin{};
+        Scalar salinityMax{};
+    };
+
+    /*!
+     * \brief A function sampled on a uniform temperature-pressure-salinity
+     *        grid.
+     *
+     * An axis with a single sampling point is ignored during the
+     * interpolation, i.e., the function is considered independent of the
+     * corresponding variable.
+     */
+    class Table
+    {
+    public:
+        Table() = default;
+
+        /*!
+         * \brief Tabulate a function over a range.
+         *
+         * Starts from a coarse grid and doubles the number of intervals of
+         * each axis whose interpolation error, measured at the midpoints
+         * between the sampling points along that axis, exceeds its share
+         * of the tolerance.  Stops when the sum of the errors of all axes
+         * is below the tolerance or when refining further would exceed
+         * maxSamples sampling points.
+         *
+         * \param range The tabulated range.  An axis with an empty range
+         *              gets a single sampling point.
+         * \param tolerance The maximum interpolation error relative to the
+         *                  largest magnitude of the function in the range.
+         * \param maxSamples The maximum number of sampling points.
+         * \param f The tabulated function.
+         */
+        static Table build(const Range& range,
+                           Scalar tolerance,
+                           std::size_t maxSamples,
+                           const Function& f);
+
+        //! Number of sampling points along the temperature, pressure and
+        //! salinity axes.
+        const std::array<unsigned, 3>& numSamples() const
+        { return n_; }
+
+        //! The estimated interpolation error relative to the largest
+        //! magnitude of the function in the tabulated range.
+        Scalar relativeError() const
+        { return relativeError_; }
+
+        /*!
+         * \brief Evaluate the tabulated function.
+         *
+         * Arguments outside the tabulated range are clamped to it.
+         */
+        template <class Evaluation>
+        Evaluation eval(const Evaluation& temperature,
+                        const Evaluation& pressure,
+                        const Evaluation& salinity) const
+        {
+            std::array<unsigned, 3> idx{};
+            std::array<Evaluation, 3> alpha{};
+            locate_(0, temperature, idx[0], alpha[0]);
+            locate_(1, pressure, idx[1], alpha[1]);
+            locate_(2, salinity, idx[2], alpha[2]);
+
+            // interpolate along the temperature axis, then pressure, then
+            // salinity, skipping axes with a single sampling point
+            const auto lineValue = [&](const unsigned j, const unsigned k) -> Evaluation
+            {
+                if (n_[0] == 1) {
+                    return sample_(idx[0], j, k);
+                }
+                return sample_(idx[0], j, k) * (1.0 - alpha[0])
+                    + sample_(idx[0] + 1, j, k) * alpha[0];
+            };
+            const auto planeValue = [&](const unsigned k) -> Evaluation
+            {
+                if (n_[1] == 1) {
+                    return lineValue(idx[1], k);
+                }
+                return lineValue(idx[1], k) * (1.0 - alpha[1])
+                    + lineValue(idx[1] + 1, k) * alpha[1];
+            };
+
+            if (n_[2] == 1) {
+                return planeValue(idx[2]);
+            }
+            return planeValue(idx[2]) * (1.0 - alpha[2])
+                + planeValue(idx[2] + 1) * alpha[2];
+        }
+
+    private:
+        Scalar coordinate_(const int axis, const unsigned i) const
+        {
+            if (n_[axis] == 1) {
+                return min_[axis];
+            }
+            return min_[axis] + i * (max_[axis] - min_[axis]) / (n_[axis] - 1);
+        }
+
+        Scalar sample_(const unsigned i, const unsigned j, const unsigned k) const
+        {
+            assert(i < n_[0] && j < n_[1] && k < n_[2]);
+            return samples_[(k * n_[1] + j) * n_[0] + i];
+        }
+
+        template <class Evaluation>
+        void locate_(const int axis,
+                     const Evaluation& x,
+                     unsigned& idx,
+                     Evaluation& alpha) const
+        {
+            if (n_[axis] == 1) {
+                idx = 0;
+                alpha = 0.0;
+                return;
+            }
+
+            alpha = (x - min_[axis]) / (max_[axis] - min_[axis]) * (n_[axis] - 1);
+            const Scalar pos = std::clamp(static_cast<Scalar>(scalarValue(alpha)),
+                                          Scalar{0}, static_cast<Scalar>(n_[axis] - 1));
+            idx = std::min(static_cast<unsigned>(pos), n_[axis] - 2);
+            if (scalarValue(alpha) < 0.0 || scalarValue(alpha) > n_[axis] - 1) {
+                // clamped to the range: constant continuation
+                alpha = pos - idx;
+            }
+            else {
+                alpha -= idx;
+            }
+        }
+
+        void tabulate_(const Function& f);
+        std::array<Scalar, 3> axisErrors_(const Function& f) const;
+
+        std::vector<Scalar> samples_{};
+        std::array<unsigned, 3> n_{1, 1, 1};
+        std::array<Scalar, 3> min_{};
+        std::array<Scalar, 3> max_{};
+        Scalar scale_{1};
+        Scalar relativeError_{};
+    };
+
+    /*!
+     * \brief Tabulate the saturated CO2 mole fraction, the viscosity and
+     *        the water and brine densities of a brine-CO2 PVT model.
+     *
+     * \param range The tabulated range.
+     * \param tolerance The maximum relative interpolation error.
+     * \param maxSamples The maximum number of sampling points per quantity.
+     * \param moleFraction Mole fraction of CO2 in CO2-saturated brine.
+     * \param viscosity Viscosity of brine [Pa s].
+     * \param waterDensity Density of pure water [kg/m^3].  Independent of
+     *                     the salinity.
+     * \param brineDensity Density of brine [kg/m^3].  Not tabulated if empty.
+     */
+    BrineCo2PvtSurrogate(const Range& range,
+                         Scalar tolerance,
+                         std::size_t maxSamples,
+                         const Function& moleFraction,
+                         const Function& viscosity,
+                         const Function& waterDensity,
+                         const Function& brineDensity);
+
+    const Range& range() const
+    { return range_; }
+
+    Scalar tolerance() const
+    { return tolerance_; }
+
+    /*!
+     * \brief Returns true iff a state lies in the tabulated range.
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& temperature,
+                 const Evaluation& pressure,
+                 const Evaluation& salinity) const
+    {
+        const auto inside = [](const Scalar x, const Scalar lo, const Scalar hi)
+        {
+            // allow for round-off in salinities computed from concentrations
+            const Scalar eps = 1.0e-6 * std::max(std::abs(hi), Scalar{1});
+            return lo - eps <= x && x <= hi + eps;
+        };
+
+        return inside(scalarValue(temperature), range_.temperatureMin, range_.temperatureMax)
+            && inside(scalarValue(pressure), range_.pressureMin, range_.pressureMax)
+            && inside(scalarValue(salinity), range_.salinityMin, range_.salinityMax);
+    }
+
+    //! Mole fraction of CO2 in CO2-saturated brine.
+    const Table& moleFraction() const
+    { return moleFraction_; }
+
+    //! Brine viscosity [Pa s].
+    const Table& viscosity() const
+    { return viscosity_; }
+
+    //! Density of pure water [kg/m^3].
+    const Table& waterDensity() const
+    { return waterDensity_; }
+
+    //! Density of brine without dissolved CO2 [kg/m^3].
+    const Table& brineDensity() const
+    { return brineDensity_; }
+
+    //! Whether the brine density is tabulated.
+    bool hasBrineDensity() const
+    { return hasBrineDensity_; }
+
+private:
+    Range range_{};
+    Scalar tolerance_{};
+    Table moleFraction_{};
+    Table viscosity_{};
+    Table waterDensity_{};
+    Table brineDensity_{};
+    bool hasBrineDensity_{false};
+};
+
+} // namespace Opm
+
+#endif
@@ -32,6 +32,7 @@
 #include <opm/material/fluidsystems/blackoilpvt/DryHumidGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtThermal.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/H2GasPvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WetGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WetHumidGasPvt.hpp>
 
@@ -142,6 +143,50 @@ public:
      */
     void initFromState(const EclipseState& eclState, const Schedule& schedule);
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-] of the fluid phase in a
+     *        batch of cells.
+     *
+     * The batched methods resolve the PVT approach once for the whole batch
+     * and otherwise evaluate each cell like the per-cell method.  See PvtBatch
+     * for the layout of the arguments.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(const PvtBatch<Evaluation>& cells,
+                                      std::span<Evaluation> values) const
+    {
+        OPM_GAS_PVT_MULTIPLEXER_CALL(cells.evaluate(values, [&](std::size_t i)
+        {
+            return pvtImpl.inverseFormationVolumeFactor(cells.regionIdx[i], cells.temperature[i],
+                                                        cells.pressure[i], cells.dissolutionAt(i),
+                                                        cells.vaporizedWaterAt(i));
+        }), break);
+    }
+
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase in a batch of cells.
+     */
+    template <class Evaluation>
+    void viscosity(const PvtBatch<Evaluation>& cells,
+                   std::span<Evaluation> values) const
+    {
+        OPM_GAS_PVT_MULTIPLEXER_CALL(cells.evaluate(values, [&](std::size_t i)
+        {
+            return pvtImpl.viscosity(cells.regionIdx[i], cells.temperature[i],
+                                     cells.pressure[i], cells.dissolutionAt(i),
+                                     cells.vaporizedWaterAt(i));
+        }), break);
+    }
+
+    /*!
+     * \brief Returns the oil vaporization factor \f$R_v\f$ [m^3/m^3] of oil saturated
+     *        gas in a batch of cells.
+     */
+    template <class Evaluation>
+    void saturatedOilVaporizationFactor(const PvtBatch<Evaluation>& cells,
+                                        std::span<Evaluation> values) const
+    { OPM_GAS_PVT_MULTIPLEXER_CALL(saturatedOilVaporizationFactor_(pvtImpl, cells, values), break); }
+
     void setApproach(GasPvtApproach gasPvtAppr);
 
     void initEnd();
@@ -399,6 +444,24 @@ public:
     operator=(const GasPvtMultiplexer<Scalar,enableThermal>& data);
 
 private:
+    // Use the batched implementation of the concrete PVT class if it has one.
+    template <class ConcretePvt, class Evaluation>
+    static void saturatedOilVaporizationFactor_(const ConcretePvt& pvtImpl,
+                                                const PvtBatch<Evaluation>& cells,
+                                                std::span<Evaluation> values)
+    {
+        if constexpr (requires { pvtImpl.saturatedOilVaporizationFactor(cells, values); }) {
+            pvtImpl.saturatedOilVaporizationFactor(cells, values);
+        }
+        else {
+            cells.evaluate(values, [&](std::size_t i)
+            {
+                return pvtImpl.saturatedOilVaporizationFactor(cells.regionIdx[i], cells.temperature[i],
+                                                              cells.pressure[i]);
+            });
+        }
+    }
+
     using UniqueVoidPtrWithDeleter = std::unique_ptr<void, std::function<void(void*)>>;
 
     template <class ConcreteGasPvt> UniqueVoidPtrWithDeleter makeGasPvt();
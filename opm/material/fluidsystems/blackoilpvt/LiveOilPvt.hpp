@@ -33,6 +33,7 @@
 #include <opm/material/common/MathToolbox.hpp>
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
 
 namespace Opm {
 
@@ -261,6 +262,15 @@ public:
                                              const Evaluation& pressure) const
     { return saturatedGasDissolutionFactorTable_[regionIdx].eval(pressure, /*extrapolate=*/true); }
 
+    /*!
+     * \brief Returns the gas dissolution factor \f$R_s\f$ [m^3/m^3] of saturated oil
+     *        in a batch of cells.
+     */
+    template <class Evaluation>
+    void saturatedGasDissolutionFactor(const PvtBatch<Evaluation>& cells,
+                                       std::span<Evaluation> values) const
+    { cells.evaluatePressureTable(saturatedGasDissolutionFactorTable_, values); }
+
     /*!
      * \brief Returns the gas dissolution factor \f$R_s\f$ [m^3/m^3] of the oil phase.
      *
@@ -33,6 +33,7 @@
 #include <opm/material/fluidsystems/blackoilpvt/DeadOilPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/LiveOilPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtThermal.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantRsDeadOilPvt.hpp>
 
 namespace Opm {
@@ -260,6 +261,48 @@ public:
       OPM_OIL_PVT_MULTIPLEXER_CALL(return pvtImpl.diffusionCoefficient(temperature, pressure, compIdx));
     }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-] of the fluid phase in a
+     *        batch of cells.
+     *
+     * The batched methods resolve the PVT approach once for the whole batch
+     * and otherwise evaluate each cell like the per-cell method.  See PvtBatch
+     * for the layout of the arguments.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(const PvtBatch<Evaluation>& cells,
+                                      std::span<Evaluation> values) const
+    {
+        OPM_OIL_PVT_MULTIPLEXER_CALL(cells.evaluate(values, [&](std::size_t i)
+        {
+            return pvtImpl.inverseFormationVolumeFactor(cells.regionIdx[i], cells.temperature[i],
+                                                        cells.pressure[i], cells.dissolutionAt(i));
+        }), break);
+    }
+
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase in a batch of cells.
+     */
+    template <class Evaluation>
+    void viscosity(const PvtBatch<Evaluation>& cells,
+                   std::span<Evaluation> values) const
+    {
+        OPM_OIL_PVT_MULTIPLEXER_CALL(cells.evaluate(values, [&](std::size_t i)
+        {
+            return pvtImpl.viscosity(cells.regionIdx[i], cells.temperature[i],
+                                     cells.pressure[i], cells.dissolutionAt(i));
+        }), break);
+    }
+
+    /*!
+     * \brief Returns the gas dissolution factor \f$R_s\f$ [m^3/m^3] of saturated oil
+     *        in a batch of cells.
+     */
+    template <class Evaluation>
+    void saturatedGasDissolutionFactor(const PvtBatch<Evaluation>& cells,
+                                       std::span<Evaluation> values) const
+    { OPM_OIL_PVT_MULTIPLEXER_CALL(saturatedGasDissolutionFactor_(pvtImpl, cells, values), break); }
+
     void setApproach(OilPvtApproach appr);
 
     /*!
@@ -375,6 +418,24 @@ public:
     operator=(const OilPvtMultiplexer<Scalar,enableThermal>& data);
 
 private:
+    // Use the batched implementation of the concrete PVT class if it has one.
+    template <class ConcretePvt, class Evaluation>
+    static void saturatedGasDissolutionFactor_(const ConcretePvt& pvtImpl,
+                                               const PvtBatch<Evaluation>& cells,
+                                               std::span<Evaluation> values)
+    {
+        if constexpr (requires { pvtImpl.saturatedGasDissolutionFactor(cells, values); }) {
+            pvtImpl.saturatedGasDissolutionFactor(cells, values);
+        }
+        else {
+            cells.evaluate(values, [&](std::size_t i)
+            {
+                return pvtImpl.saturatedGasDissolutionFactor(cells.regionIdx[i], cells.temperature[i],
+                                                             cells.pressure[i]);
+            });
+        }
+    }
+
     OilPvtApproach approach_{OilPvtApproach::NoOil};
     void* realOilPvt_{nullptr};
 };
@@ -0,0 +1,140 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::PvtBatch
+ */
+#ifndef OPM_PVT_BATCH_HPP
+#define OPM_PVT_BATCH_HPP
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Arguments of the batched PVT evaluation methods of the black-oil
+ *        PVT multiplexers and fluid system.
+ *
+ * Holds one value per cell in each array.  The optional arrays may be
+ * empty, in which case the corresponding quantity is zero in all cells.
+ * Cells which are adjacent in the arrays should preferably be in the same
+ * PVT region and have similar pressures, since the lookups in the saturated
+ * dissolution tables (\f$R_s\f$, \f$R_v\f$) then start from the segment
+ * found for the previous cell.  The formation volume factors and
+ * viscosities are evaluated cell by cell and only save the dispatch on the
+ * PVT approach.
+ */
+template <class Evaluation>
+struct PvtBatch
+{
+    //! PVT region index.
+    std::span<const unsigned> regionIdx{};
+
+    //! Temperature [K].
+    std::span<const Evaluation> temperature{};
+
+    //! Phase pressure [Pa].
+    std::span<const Evaluation> pressure{};
+
+    //! Dissolved gas-oil ratio \f$R_s\f$ for oil, vaporized oil-gas ratio
+    //! \f$R_v\f$ for gas, and dissolved gas-water ratio \f$R_{sw}\f$ for
+    //! water.  Optional.
+    std::span<const Evaluation> dissolution{};
+
+    //! Vaporized water-gas ratio \f$R_{vw}\f$.  Gas only and optional.
+    std::span<const Evaluation> vaporizedWater{};
+
+    //! Salt concentration.  Water only and optional.
+    std::span<const Evaluation> saltConcentration{};
+
+    //! Number of cells.
+    std::size_t size() const
+    {
+        assert(temperature.size() == regionIdx.size());
+        assert(pressure.size() == regionIdx.size());
+        assert(dissolution.empty() || dissolution.size() == regionIdx.size());
+        assert(vaporizedWater.empty() || vaporizedWater.size() == regionIdx.size());
+        assert(saltConcentration.empty() || saltConcentration.size() == regionIdx.size());
+
+        return regionIdx.size();
+    }
+
+    Evaluation dissolutionAt(std::size_t i) const
+    { return dissolution.empty() ? Evaluation{0.0} : dissolution[i]; }
+
+    Evaluation vaporizedWaterAt(std::size_t i) const
+    { return vaporizedWater.empty() ? Evaluation{0.0} : vaporizedWater[i]; }
+
+    Evaluation saltConcentrationAt(std::size_t i) const
+    { return saltConcentration.empty() ? Evaluation{0.0} : saltConcentration[i]; }
+
+    /*!
+     * \brief Assign \c values[i] = \c func(i) for all cells.
+     */
+    template <class Func>
+    void evaluate(std::span<Evaluation> values, Func&& func) const
+    {
+        assert(values.size() == size());
+
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = func(i);
+        }
+    }
+
+    /*!
+     * \brief Assign \c values[i] = \c tables[regionIdx[i]](pressure[i]) for
+     *        all cells, extrapolating outside the table range.
+     *
+     * Each segment search starts at the segment found for the previous
+     * cell, so runs of cells in the same region with similar pressures
+     * avoid the bisection.
+     */
+    template <class Scalar>
+    void evaluatePressureTable(const std::vector<Tabulated1DFunction<Scalar>>& tables,
+                               std::span<Evaluation> values) const
+    {
+        assert(values.size() == size());
+
+        auto prevRegionIdx = regionIdx.empty() ? 0u : regionIdx.front();
+        auto segIdx = SegmentIndex{0};
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (regionIdx[i] != prevRegionIdx) {
+                prevRegionIdx = regionIdx[i];
+                segIdx = SegmentIndex{0};
+            }
+
+            const auto& table = tables[regionIdx[i]];
+            segIdx = table.findSegmentIndex(pressure[i], /*extrapolate=*/true, segIdx);
+            values[i] = table.eval(pressure[i], segIdx);
+        }
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_PVT_BATCH_HPP
@@ -31,6 +31,7 @@
 #include <opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityWaterPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.hpp>
 
 #define OPM_WATER_PVT_MULTIPLEXER_CALL(codeToCall, ...)                                \
@@ -245,6 +246,56 @@ public:
       OPM_WATER_PVT_MULTIPLEXER_CALL(return pvtImpl.diffusionCoefficient(temperature, pressure, compIdx, regionIdx));
     }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-] of the fluid phase in a
+     *        batch of cells.
+     *
+     * The batched methods resolve the PVT approach once for the whole batch
+     * and otherwise evaluate each cell like the per-cell method.  See PvtBatch
+     * for the layout of the arguments.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(const PvtBatch<Evaluation>& cells,
+                                      std::span<Evaluation> values) const
+    {
+        OPM_WATER_PVT_MULTIPLEXER_CALL(cells.evaluate(values, [&](std::size_t i)
+        {
+            return pvtImpl.inverseFormationVolumeFactor(cells.regionIdx[i], cells.temperature[i],
+                                                        cells.pressure[i], cells.dissolutionAt(i),
+                                                        cells.saltConcentrationAt(i));
+        }), break);
+    }
+
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase in a batch of cells.
+     */
+    template <class Evaluation>
+    void viscosity(const PvtBatch<Evaluation>& cells,
+                   std::span<Evaluation> values) const
+    {
+        OPM_WATER_PVT_MULTIPLEXER_CALL(cells.evaluate(values, [&](std::size_t i)
+        {
+            return pvtImpl.viscosity(cells.regionIdx[i], cells.temperature[i],
+                                     cells.pressure[i], cells.dissolutionAt(i),
+                                     cells.saltConcentrationAt(i));
+        }), break);
+    }
+
+    /*!
+     * \brief Returns the gas dissolution factor \f$R_{sw}\f$ [m^3/m^3] of gas saturated
+     *        water in a batch of cells.
+     */
+    template <class Evaluation>
+    void saturatedGasDissolutionFactor(const PvtBatch<Evaluation>& cells,
+                                       std::span<Evaluation> values) const
+    {
+        OPM_WATER_PVT_MULTIPLEXER_CALL(cells.evaluate(values, [&](std::size_t i)
+        {
+            return pvtImpl.saturatedGasDissolutionFactor(cells.regionIdx[i], cells.temperature[i],
+                                                         cells.pressure[i], cells.saltConcentrationAt(i));
+        }), break);
+    }
+
     void setApproach(WaterPvtApproach appr);
 
     /*!
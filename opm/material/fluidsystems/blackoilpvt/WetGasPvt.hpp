@@ -33,6 +33,7 @@
 #include <opm/material/common/MathToolbox.hpp>
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
 
 #include <cstddef>
 
@@ -281,6 +282,15 @@ public:
         return saturatedOilVaporizationFactorTable_[regionIdx].eval(pressure, /*extrapolate=*/true);
     }
 
+    /*!
+     * \brief Returns the oil vaporization factor \f$R_v\f$ [m^3/m^3] of saturated gas
+     *        in a batch of cells.
+     */
+    template <class Evaluation>
+    void saturatedOilVaporizationFactor(const PvtBatch<Evaluation>& cells,
+                                        std::span<Evaluation> values) const
+    { cells.evaluatePressureTable(saturatedOilVaporizationFactorTable_, values); }
+
     /*!
      * \brief Returns the oil vaporization factor \f$R_v\f$ [m^3/m^3] of the gas phase.
      *
@@ -70,6 +70,12 @@ class Solution : public std::map<std::string, data::CellData>
         void convertToSI( const UnitSystem& );
         void convertFromSI( const UnitSystem& );
 
+        /*
+         * Whether or not the data fields are in SI units, i.e., have not
+         * been converted by convertFromSI().
+         */
+        bool isSI() const { return this->si; }
+
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
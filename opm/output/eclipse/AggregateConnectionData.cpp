@@ -24,6 +24,8 @@
 
 #include <opm/output/data/Wells.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
@@ -107,6 +109,29 @@ namespace {
         }
     }
 
+    /// Minimum number of wells for which the connection loops use
+    /// multiple threads.
+    constexpr auto minParallelWells = std::size_t{64};
+
+    /// Wells at a report step, paired with their dynamic results if any.
+    using WellList = std::vector<std::pair<const Opm::Well*, const Opm::data::Well*>>;
+
+    // Each well writes to its own set of windows in the output arrays, so
+    // the wells may be processed concurrently.
+    template <class ConnOp>
+    void wellConnectionLoop(const WellList&         wells,
+                            const Opm::EclipseGrid& grid,
+                            const bool              global_grid,
+                            ConnOp&&                connOp)
+    {
+        Opm::parallelFor(wells.size(), minParallelWells,
+                         [&wells, &grid, global_grid, &connOp](const std::size_t i)
+        {
+            connectionLoop(grid, *wells[i].first, wells[i].second,
+                           connOp, global_grid);
+        });
+    }
+
     template <class ConnOp>
     void wellConnectionLoop(const Opm::Schedule&    sched,
                             const std::size_t       sim_step,
@@ -114,14 +139,17 @@ namespace {
                             const Opm::data::Wells& xw,
                             ConnOp&&                connOp)
     {
+        auto wells = WellList{};
+
         for (const auto& wname : sched.wellNames(sim_step)) {
             const auto  well_iter = xw.find(wname);
             const auto* wellRes   = (well_iter == xw.end())
                 ? nullptr : &well_iter->second;
 
-            connectionLoop(grid, sched[sim_step].wells(wname),
-                           wellRes,  connOp);
+            wells.emplace_back(&sched[sim_step].wells(wname), wellRes);
         }
+
+        wellConnectionLoop(wells, grid, true, connOp);
     }
 
     template <class ConnOp>
@@ -132,6 +160,8 @@ namespace {
                             const std::string&      lgr_tag,
                             ConnOp&&                connOp)
     {
+        auto wells = WellList{};
+
         for (const auto& wname : sched.wellNames(sim_step)) {
             const auto& well = sched[sim_step].wells(wname);
 
@@ -144,8 +174,10 @@ namespace {
             const auto* wellRes   = (well_iter == xw.end())
                 ? nullptr : &well_iter->second;
 
-            connectionLoop(grid, well, wellRes, connOp,  false);
+            wells.emplace_back(&well, wellRes);
         }
+
+        wellConnectionLoop(wells, grid, false, connOp);
     }
 
     namespace IConn {
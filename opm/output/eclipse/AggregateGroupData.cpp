@@ -20,6 +20,7 @@
 #include <opm/output/eclipse/AggregateGroupData.hpp>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 
 #include <opm/output/eclipse/WriteRestartHelpers.hpp>
 #include <opm/output/eclipse/VectorItems/group.hpp>
@@ -116,20 +117,25 @@ GuideRateModeFromGuideRateProdTarget(Opm::Group::GuideRateProdTarget grpt)
     }
 }
 
+// Minimum number of groups for which the aggregation loops use multiple
+// threads.
+constexpr auto minParallelGroups = std::size_t {64};
+
+// Each group writes to its own window of the output arrays, so the groups
+// may be processed concurrently.
 template <typename GroupOp>
 void groupLoop(const std::vector<const Opm::Group*>& groups,
                GroupOp&&                             groupOp)
 {
-    auto groupID = std::size_t {0};
-    for (const auto* group : groups) {
-        groupID += 1;
-
-        if (group == nullptr) {
-            continue;
+    Opm::parallelFor(groups.size(), minParallelGroups,
+                     [&groups, &groupOp](const std::size_t groupID)
+    {
+        if (groups[groupID] == nullptr) {
+            return;
         }
 
-        groupOp(*group, groupID - 1);
-    }
+        groupOp(*groups[groupID], groupID);
+    });
 }
 
 template <typename GroupOp>
@@ -1245,6 +1251,10 @@ void assignSatelliteGroupProduction(const Opm::Group&        group,
                                               const std::string& udq,
                                               const float        value)
     {
+        // Group aggregation may run on multiple threads.
+#ifdef _OPENMP
+#pragma omp critical(opm_aggregate_group_log)
+#endif
         Opm::OpmLog::warning(fmt::format("Restart:GSATPROD:{}:IsUDA", item),
                              fmt::format("{} UDA '{}' in GSATPROD for group "
                                          "{} will be lost in restart and "
@@ -1630,7 +1640,7 @@ captureDeclaredGroupData(const Opm::Schedule&     sched,
     const auto& curGroups = sched.restart_groups(simStep);
     const auto& sched_state = sched[simStep];
 
-    groupLoop(curGroups, [&sched, simStep, sumState, this]
+    groupLoop(curGroups, [&sched, simStep, &sumState, this]
               (const Group& group, const std::size_t groupID) -> void
     {
         auto ig = this->iGroup_[groupID];
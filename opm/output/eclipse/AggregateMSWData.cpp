@@ -22,6 +22,8 @@
 #include <opm/output/eclipse/InteHEAD.hpp>
 #include <opm/output/eclipse/VectorItems/msw.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
 #include <opm/input/eclipse/Schedule/MSW/AICD.hpp>
@@ -386,18 +388,23 @@ namespace {
         return (inFlowSegInd == -1) ? 0 : inFlowSegInd;
     }
 
+    /// Minimum number of multi-segment wells for which the segment loops
+    /// use multiple threads.
+    constexpr auto minParallelWells = std::size_t{16};
+
+    // Each multi-segment well writes to its own window of the output
+    // arrays, so the wells may be processed concurrently.
     template <typename MSWOp>
     void MSWLoop(const std::vector<const Opm::Well*>& wells,
                  MSWOp&&                              mswOp)
     {
-        auto mswID = std::size_t{0};
-        for (const auto* well : wells) {
-            mswID += 1;
-
-            if (well == nullptr) { continue; }
+        Opm::parallelFor(wells.size(), minParallelWells,
+                         [&wells, &mswOp](const std::size_t mswID)
+        {
+            if (wells[mswID] == nullptr) { return; }
 
-            mswOp(*well, mswID - 1);
-        }
+            mswOp(*wells[mswID], mswID);
+        });
     }
 
     namespace ISeg {
@@ -25,6 +25,8 @@
 
 #include <opm/output/data/Wells.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionAST.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
@@ -69,6 +71,7 @@
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -105,32 +108,78 @@ namespace {
         return s.substr(b, e - b + 1);
     }
 
-    template <typename WellOp>
-    void wellLoop(const std::vector<std::string>& wells,
-                  const Opm::Schedule&            sched,
-                  const std::size_t               simStep,
-                  WellOp&&                        wellOp)
+    /// Wells at a report step, paired with their position in the
+    /// restart arrays.
+    using WellList = std::vector<std::pair<const Opm::Well*, std::size_t>>;
+
+    /// Minimum number of wells for which the aggregation loops use
+    /// multiple threads.
+    constexpr auto minParallelWells = std::size_t{64};
+
+    WellList collectWells(const std::vector<std::string>& wells,
+                          const Opm::Schedule&            sched,
+                          const std::size_t               simStep)
     {
+        auto wellList = WellList{};
+        wellList.reserve(wells.size());
+
         for (const auto& wname : wells) {
             const auto& well = sched.getWell(wname, simStep);
-            wellOp(well, well.seqIndex());
+            wellList.emplace_back(&well, well.seqIndex());
         }
+
+        return wellList;
     }
 
-    template <typename WellOp>
-    void wellLoop(const std::vector<std::string>& wells,
-                  const Opm::Schedule&            sched,
-                  const std::size_t               simStep,
-                  const std::string&              lgrTag,
-                  WellOp&&                        wellOp)
+    WellList collectWells(const std::vector<std::string>& wells,
+                          const Opm::Schedule&            sched,
+                          const std::size_t               simStep,
+                          const std::string&              lgrTag)
     {
+        auto wellList = WellList{};
+
         for (const auto& wname : wells) {
             const auto& well = sched.getWell(wname, simStep);
             if (well.get_lgr_well_tag().value_or("") != lgrTag) {
                 continue; // skip wells not in the specified LGR
             }
-            wellOp(well, well.seqIndexLGR());
+            wellList.emplace_back(&well, well.seqIndexLGR());
+        }
+
+        return wellList;
+    }
+
+    // Wells write to separate windows of the output arrays, so the
+    // operations may run concurrently.
+    template <typename WellOp>
+    void wellLoop(const WellList& wells, WellOp&& wellOp)
+    {
+        Opm::parallelFor(wells.size(), minParallelWells,
+                         [&wells, &wellOp](const std::size_t i)
+        {
+            wellOp(*wells[i].first, wells[i].second);
+        });
+    }
+
+    /// 1-based multi-segment well ID, indexed by well position.  Assigned
+    /// in well order, hence computed ahead of the parallel IWEL loop.
+    /// Standard wells get the ID of the preceding multi-segment well.
+    std::vector<std::size_t> msWellIDs(const WellList& wells)
+    {
+        auto msWellID = std::vector<std::size_t>{};
+        auto count = std::size_t{0};
+
+        for (const auto& [well, wellID] : wells) {
+            count += well->isMultiSegment();
+
+            if (wellID >= msWellID.size()) {
+                msWellID.resize(wellID + 1, 0);
+            }
+
+            msWellID[wellID] = count;
         }
+
+        return msWellID;
     }
 
     namespace IWell {
@@ -1722,7 +1771,7 @@ captureDeclaredWellData(const Schedule&             sched,
                         const ::Opm::SummaryState&  smry,
                         const std::vector<int>&     inteHead)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = collectWells(sched.wellNames(sim_step), sched, sim_step);
     const auto& step_glo = sched.glo(sim_step);
 
     // Static contributions to IWEL array.
@@ -1730,9 +1779,9 @@ captureDeclaredWellData(const Schedule&             sched,
         const auto groupMapNameIndex =
             IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
 
-        auto msWellID = std::size_t{0};
+        const auto msWellID = msWellIDs(wells);
 
-        wellLoop(wells, sched, sim_step,
+        wellLoop(wells,
                  [&groupMapNameIndex, &msWellID,
                   &step_glo, &wtest_state, &smry,
                   &sched, &sim_step, this]
@@ -1740,16 +1789,15 @@ captureDeclaredWellData(const Schedule&             sched,
         {
             const auto& wtest_config = sched[sim_step].wtest_config();
 
-            msWellID += well.isMultiSegment();  // 1-based index.
             auto iw   = this->iWell_[wellID];
 
             IWell::staticContrib(well, step_glo, wtest_config, wtest_state,
-                                 smry, msWellID, groupMapNameIndex, iw);
+                                 smry, msWellID[wellID], groupMapNameIndex, iw);
         });
     }
 
     // Static contributions to SWEL array.
-    wellLoop(wells, sched, sim_step, [&step_glo, &sim_step, &sched,
+    wellLoop(wells, [&step_glo, &sim_step, &sched,
                                       &tracers, &wtest_state, &smry, this]
              (const Well& well, const std::size_t wellID) -> void
     {
@@ -1760,7 +1808,7 @@ captureDeclaredWellData(const Schedule&             sched,
     });
 
     // Static contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, [&sched, &smry, this]
+    wellLoop(wells, [&sched, &smry, this]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xw = this->xWell_[wellID];
@@ -1769,7 +1817,7 @@ captureDeclaredWellData(const Schedule&             sched,
     });
 
     // Static contributions to ZWEL array.
-    wellLoop(wells, sched, sim_step, [&sim_step, &action_state, &sched, this]
+    wellLoop(wells, [&sim_step, &action_state, &sched, this]
              (const Well& well, const std::size_t wellID) -> void
     {
         auto zw = this->zWell_[wellID];
@@ -1791,7 +1839,7 @@ captureDeclaredWellData(const Schedule&             sched,
                         const ::Opm::SummaryState&  smry,
                         const std::vector<int>&     inteHead)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = collectWells(sched.wellNames(sim_step), sched, sim_step);
     const auto& step_glo = sched.glo(sim_step);
 
     // Static contributions to IWEL array.
@@ -1799,9 +1847,9 @@ captureDeclaredWellData(const Schedule&             sched,
         const auto groupMapNameIndex =
             IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
 
-        auto msWellID = std::size_t{0};
+        const auto msWellID = msWellIDs(wells);
 
-        wellLoop(wells, sched, sim_step,
+        wellLoop(wells,
                  [&groupMapNameIndex, &msWellID,
                   &step_glo, &wtest_state, &smry,
                   &sched, &grid, &sim_step, this]
@@ -1809,16 +1857,15 @@ captureDeclaredWellData(const Schedule&             sched,
         {
             const auto& wtest_config = sched[sim_step].wtest_config();
 
-            msWellID += well.isMultiSegment();  // 1-based index.
             auto iw   = this->iWell_[wellID];
 
             IWell::staticContrib(well, step_glo, wtest_config, wtest_state,
-                                 smry, msWellID, groupMapNameIndex, iw, grid);
+                                 smry, msWellID[wellID], groupMapNameIndex, iw, grid);
         });
     }
 
     // Static contributions to SWEL array.
-    wellLoop(wells, sched, sim_step, [&step_glo, &sim_step, &sched,
+    wellLoop(wells, [&step_glo, &sim_step, &sched,
                                       &tracers, &wtest_state, &smry, this]
              (const Well& well, const std::size_t wellID) -> void
     {
@@ -1829,7 +1876,7 @@ captureDeclaredWellData(const Schedule&             sched,
     });
 
     // Static contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, [&sched, &smry, this]
+    wellLoop(wells, [&sched, &smry, this]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xw = this->xWell_[wellID];
@@ -1838,7 +1885,7 @@ captureDeclaredWellData(const Schedule&             sched,
     });
 
     // Static contributions to ZWEL array.
-    wellLoop(wells, sched, sim_step, [&sim_step, &action_state, &sched, this]
+    wellLoop(wells, [&sim_step, &action_state, &sched, this]
              (const Well& well, const std::size_t wellID) -> void
     {
         auto zw = this->zWell_[wellID];
@@ -1861,7 +1908,7 @@ captureDeclaredWellDataLGR(const Schedule&             sched,
                            const std::vector<int>&     inteHead,
                            const std::string&          lgr_tag)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = collectWells(sched.wellNames(sim_step), sched, sim_step, lgr_tag);
     const auto& step_glo = sched.glo(sim_step);
 
     // Static contributions to IWEL array.
@@ -1869,9 +1916,9 @@ captureDeclaredWellDataLGR(const Schedule&             sched,
         const auto groupMapNameIndex =
             IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
 
-        auto msWellID = std::size_t{0};
+        const auto msWellID = msWellIDs(wells);
 
-        wellLoop(wells, sched,  sim_step, lgr_tag,
+        wellLoop(wells,
                  [&groupMapNameIndex, &msWellID,
                   &step_glo, &wtest_state, &smry,
                   &sched, &grid, &sim_step, this]
@@ -1879,16 +1926,15 @@ captureDeclaredWellDataLGR(const Schedule&             sched,
         {
             const auto& wtest_config = sched[sim_step].wtest_config();
 
-            msWellID += well.isMultiSegment();  // 1-based index.
             auto iw   = this->iWell_[wellID];
 
             IWell::staticContrib(well, step_glo, wtest_config, wtest_state,
-                                 smry, msWellID, groupMapNameIndex, iw, grid, false);
+                                 smry, msWellID[wellID], groupMapNameIndex, iw, grid, false);
         });
     }
 
     // Static contributions to SWEL array.
-    wellLoop(wells, sched, sim_step, lgr_tag, [&step_glo, &sim_step, &sched,
+    wellLoop(wells, [&step_glo, &sim_step, &sched,
                                       &tracers, &wtest_state, &smry, this]
              (const Well& well, const std::size_t wellID) -> void
     {
@@ -1899,7 +1945,7 @@ captureDeclaredWellDataLGR(const Schedule&             sched,
     } );
 
     // Static contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, lgr_tag, [&sched, &smry, this]
+    wellLoop(wells, [&sched, &smry, this]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xw = this->xWell_[wellID];
@@ -1908,7 +1954,7 @@ captureDeclaredWellDataLGR(const Schedule&             sched,
     });
 
     // Static contributions to ZWEL array.
-    wellLoop(wells, sched, sim_step, lgr_tag, [&sim_step, &action_state, &sched, this]
+    wellLoop(wells, [&sim_step, &action_state, &sched, this]
              (const Well& well, const std::size_t wellID) -> void
     {
         auto zw = this->zWell_[wellID];
@@ -1917,7 +1963,7 @@ captureDeclaredWellDataLGR(const Schedule&             sched,
     });
 
     // Static contributions to LGWELS array.
-    wellLoop(wells, sched, sim_step, lgr_tag, [this]
+    wellLoop(wells, [this]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto lgwell = this->lgWell_[wellID];
@@ -1938,10 +1984,10 @@ captureDynamicWellData(const Opm::Schedule&       sched,
                        const Opm::data::Wells&    xw,
                        const ::Opm::SummaryState& smry)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = collectWells(sched.wellNames(sim_step), sched, sim_step);
 
     // Dynamic contributions to IWEL array.
-    wellLoop(wells, sched, sim_step, [this, &xw]
+    wellLoop(wells, [this, &xw]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto iWell = this->iWell_[wellID];
@@ -1959,7 +2005,7 @@ captureDynamicWellData(const Opm::Schedule&       sched,
     });
 
     // Dynamic contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, [this, &sched, &tracers, &smry]
+    wellLoop(wells, [this, &sched, &tracers, &smry]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xwell = this->xWell_[wellID];
@@ -1978,10 +2024,10 @@ captureDynamicWellDataLGR(const Opm::Schedule&       sched,
                           const ::Opm::SummaryState& smry,
                           const std::string&         lgr_tag)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = collectWells(sched.wellNames(sim_step), sched, sim_step, lgr_tag);
 
     // Dynamic contributions to IWEL array.
-    wellLoop(wells, sched, sim_step, lgr_tag,  [this, &xw]
+    wellLoop(wells, [this, &xw]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto iWell = this->iWell_[wellID];
@@ -1999,7 +2045,7 @@ captureDynamicWellDataLGR(const Opm::Schedule&       sched,
     });
 
     // Dynamic contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, lgr_tag, [this, &sched, &tracers, &smry]
+    wellLoop(wells, [this, &sched, &tracers, &smry]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xwell = this->xWell_[wellID];
@@ -35,9 +35,13 @@
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
 
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
@@ -49,6 +53,8 @@
 #include <opm/output/eclipse/WriteInit.hpp>
 #include <opm/output/eclipse/WriteRFT.hpp>
 
+#include <opm/io/eclipse/CompressedRestart.hpp>
+#include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
 
@@ -59,17 +65,22 @@
 #include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <functional>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <unordered_map>
 #include <utility>    // move
 #include <vector>
@@ -127,6 +138,171 @@ std::vector<Opm::time_point> reportStepStartTimes(const Opm::Schedule& sched)
     return rptStepStart;
 }
 
+/// Single background thread running output operations in submission
+/// order.
+///
+/// Submitting an operation blocks while the maximum number of operations
+/// are already pending, thereby bounding the memory held by queued
+/// results.  An exception thrown by an operation is rethrown from the next
+/// call to submit() or wait(), and any remaining queued operations are
+/// discarded.
+class BackgroundWriter
+{
+public:
+    /// Constructor.
+    ///
+    /// \param[in] maxPending Maximum number of operations queued or in
+    /// progress before submit() blocks.  Must be positive.
+    explicit BackgroundWriter(const std::size_t maxPending)
+        : maxPending_ { std::max(maxPending, std::size_t{1}) }
+        , worker_     { [this]() { this->run(); } }
+    {}
+
+    BackgroundWriter(const BackgroundWriter&) = delete;
+    BackgroundWriter& operator=(const BackgroundWriter&) = delete;
+
+    /// Destructor.
+    ///
+    /// Completes all pending operations.  Errors which have not been
+    /// rethrown from submit() or wait() cannot be propagated from here, so
+    /// they are reported to the log from the destroying thread.
+    ~BackgroundWriter()
+    {
+        try {
+            this->wait();
+        }
+        catch (const std::exception& e) {
+            Opm::OpmLog::error(std::string { "Asynchronous restart output failed: " } + e.what());
+        }
+
+        {
+            std::lock_guard lock { this->mutex_ };
+            this->stop_ = true;
+        }
+
+        this->taskReady_.notify_one();
+        this->worker_.join();
+    }
+
+    /// Queue an operation for execution on the background thread.
+    ///
+    /// \param[in] task Output operation.
+    void submit(std::function<void()> task)
+    {
+        std::unique_lock lock { this->mutex_ };
+
+        this->taskDone_.wait(lock, [this]()
+        {
+            return (this->error_ != nullptr)
+                || (this->tasks_.size() + this->busy_ < this->maxPending_);
+        });
+
+        this->rethrowError();
+
+        this->tasks_.push_back(std::move(task));
+        lock.unlock();
+
+        this->taskReady_.notify_one();
+    }
+
+    /// Wait for all pending operations to complete.
+    void wait()
+    {
+        std::unique_lock lock { this->mutex_ };
+
+        this->taskDone_.wait(lock, [this]()
+        {
+            return this->tasks_.empty() && !this->busy_;
+        });
+
+        this->rethrowError();
+    }
+
+private:
+    std::size_t maxPending_{1};
+    std::mutex mutex_{};
+    std::condition_variable taskReady_{};
+    std::condition_variable taskDone_{};
+    std::deque<std::function<void()>> tasks_{};
+    bool busy_{false};
+    bool stop_{false};
+    std::exception_ptr error_{};
+
+    // Must be initialised last since the thread accesses the other members.
+    std::thread worker_;
+
+    void run()
+    {
+        std::unique_lock lock { this->mutex_ };
+
+        while (true) {
+            this->taskReady_.wait(lock, [this]()
+            {
+                return this->stop_ || !this->tasks_.empty();
+            });
+
+            if (this->tasks_.empty()) {
+                return;
+            }
+
+            auto task = std::move(this->tasks_.front());
+            this->tasks_.pop_front();
+            this->busy_ = true;
+
+            lock.unlock();
+
+            auto error = std::exception_ptr{};
+            try {
+                task();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+
+            this->busy_ = false;
+            if (error != nullptr) {
+                this->tasks_.clear();
+                if (this->error_ == nullptr) {
+                    this->error_ = error;
+                }
+            }
+
+            this->taskDone_.notify_all();
+        }
+    }
+
+    // Caller must hold mutex_.
+    void rethrowError()
+    {
+        if (this->error_ != nullptr) {
+            std::rethrow_exception(std::exchange(this->error_, nullptr));
+        }
+    }
+};
+
+/// Invoke function and accumulate its wall-clock time.
+///
+/// \param[in,out] elapsed Accumulated time, seconds.
+///
+/// \param[in,out] count Number of invocations.
+///
+/// \param[in] func Function.
+template <typename Func>
+void timedCall(double& elapsed, std::size_t& count, Func&& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    func();
+
+    elapsed += std::chrono::duration<double> {
+        std::chrono::steady_clock::now() - start
+    }.count();
+
+    ++count;
+}
+
 } // Anonymous namespace
 
 /// Internal implementation class for EclipseIO public interface.
@@ -253,6 +429,9 @@ public:
     /// Run's summary vector calculation engine.
     const out::Summary& summary() const { return this->summary_; }
 
+    /// Accumulated file output timings.
+    OutputTimings& outputTimings() { return this->outputTimings_; }
+
     /// Run's complete summary configuration object, including those vectors
     /// that are needed to evaluate the defining expressions of any
     /// user-defined quantities.
@@ -316,6 +495,12 @@ public:
     data::Solution loadRestartSolution(const std::vector<RestartKey>& solution_keys,
                                        const int                      report_step) const;
 
+    /// On-demand reader of per-cell solution data of a range of active
+    /// cells in restart file at specific time.
+    LazyRestartSolution restartSolution(const int         report_step,
+                                        const std::size_t cellBegin,
+                                        const std::size_t cellEnd) const;
+
     /// Output static properties to EGRID and INIT files.
     ///
     /// \param[in] simProps Initial per-cell properties such as
@@ -376,7 +561,8 @@ public:
 
     /// Create restart file output.
     ///
-    /// Calls RestartIO::save().
+    /// Calls RestartIO::save(), on a background thread if asynchronous
+    /// restart file output is enabled.
     ///
     /// \param[in] action_state Run's current action system state.  Expected
     /// to hold current values for the number of times each action has run
@@ -491,6 +677,31 @@ public:
     /// Record full processing of a complete time step.
     void countTimeStep() { ++this->miniStepId_; }
 
+    /// Select synchronous or asynchronous restart file output.
+    ///
+    /// Waits for any pending asynchronous output before switching.
+    ///
+    /// \param[in] maxPending Maximum number of restart file output events
+    /// queued or in progress before writeRestartFile() blocks.  Zero
+    /// selects synchronous output.
+    void setAsyncRestartOutput(const std::size_t maxPending);
+
+    /// Enable or disable compressed restart companion file output.
+    ///
+    /// Waits for any pending asynchronous output before switching.
+    void setCompressedRestartOutput(const bool compressed);
+
+    /// Select and round per-cell solution arrays of restart output.
+    ///
+    /// Waits for any pending asynchronous output before switching.
+    void setRestartOutputPolicy(EclIO::RestartOutputPolicy policy);
+
+    /// Wait for pending asynchronous restart file output to complete.
+    ///
+    /// Rethrows any exception raised during asynchronous output.  No
+    /// operation in synchronous mode.
+    void waitForRestartOutput() const;
+
 private:
     /// Run's static properties.
     std::reference_wrapper<const EclipseState> es_;
@@ -550,6 +761,51 @@ private:
     /// Stored as \c float to mimic the summary file's TIME vector.
     float last_summary_output_{std::numeric_limits<float>::lowest()};
 
+    /// Accumulated wall-clock time of file output.
+    OutputTimings outputTimings_{};
+
+    /// Whether or not to also write the compressed companion of each
+    /// restart file.
+    bool compressedRestart_{false};
+
+    /// Arrays of the last report step written to the compressed companion
+    /// of the unified restart file.  Spares each report step reading back
+    /// the previous one from the companion file.
+    std::shared_ptr<EclIO::CompressedRestart::ReferenceCache> compressedCache_{};
+
+    /// Selection and precision of per-cell restart arrays.  Null for full
+    /// output.
+    std::shared_ptr<const EclIO::RestartOutputPolicy> restartPolicy_{};
+
+    /// Background thread for asynchronous restart file output.  Null in
+    /// synchronous mode.
+    ///
+    /// Declared last, so pending output completes before the members it
+    /// references are destroyed.
+    std::unique_ptr<BackgroundWriter> restartWriter_{};
+
+    /// Create restart file output, either immediately or, in asynchronous
+    /// mode, on the background thread.
+    ///
+    /// Unit conversion of \p value is deferred in asynchronous mode, while
+    /// all other processing, including aggregation of well, group, and
+    /// aquifer data, happens on the calling thread.  The background thread
+    /// only writes the collected arrays, so it does not access the
+    /// EclipseState, the Schedule, or the grid.
+    ///
+    /// \param[in] value Collection of dynamic results for a single grid,
+    /// or one collection per grid.
+    template <typename Value>
+    void saveRestart(const Action::State& action_state,
+                     const WellTestState& wtest_state,
+                     const SummaryState&  st,
+                     const UDQState&      udq_state,
+                     const int            report_step,
+                     std::optional<int>   time_step,
+                     const double         secs_elapsed,
+                     const bool           write_double,
+                     Value&&              value);
+
     /// Output static properties to INIT file.
     ///
     /// \param[in] simProps Initial per-cell properties such as
@@ -766,6 +1022,8 @@ Opm::EclipseIO::Impl::loadRestart(const std::vector<RestartKey>& solution_keys,
                                   Action::State&                 action_state,
                                   SummaryState&                  summary_state) const
 {
+    this->waitForRestartOutput();
+
     const auto& initConfig = this->es_.get().getInitConfig();
 
     const auto report_step = initConfig.getRestartStep();
@@ -789,6 +1047,8 @@ Opm::data::Solution
 Opm::EclipseIO::Impl::loadRestartSolution(const std::vector<RestartKey>& solution_keys,
                                           const int                      report_step) const
 {
+    this->waitForRestartOutput();
+
     const auto& initConfig  = this->es_.get().getInitConfig();
     const auto  filename    = this->es_.get().getIOConfig()
         .getRestartFileName(initConfig.getRestartRootName(), report_step, false);
@@ -797,6 +1057,24 @@ Opm::EclipseIO::Impl::loadRestartSolution(const std::vector<RestartKey>& solutio
                                          this->es_, this->grid_);
 }
 
+Opm::LazyRestartSolution
+Opm::EclipseIO::Impl::restartSolution(const int         report_step,
+                                      const std::size_t cellBegin,
+                                      const std::size_t cellEnd) const
+{
+    this->waitForRestartOutput();
+
+    const auto& initConfig  = this->es_.get().getInitConfig();
+    const auto  filename    = this->es_.get().getIOConfig()
+        .getRestartFileName(initConfig.getRestartRootName(), report_step, false);
+
+    return {
+        std::make_shared<EclIO::ERst>(filename), report_step,
+        this->es_.get().getUnits(), this->grid_.getNumActive(),
+        cellBegin, cellEnd
+    };
+}
+
 void Opm::EclipseIO::Impl::writeInitial(data::Solution                          simProps,
                                         std::map<std::string, std::vector<int>> int_data,
                                         const std::vector<NNCdata>&             nnc) const
@@ -866,18 +1144,9 @@ void Opm::EclipseIO::Impl::writeRestartFile(const Action::State& action_state,
                                             const bool           write_double,
                                             RestartValue&&       value)
 {
-    EclIO::OutputStream::Restart rstFile {
-        EclIO::OutputStream::ResultSet { this->outputDir_, this->baseName_ },
-        this->reportIndex(report_step, time_step),
-        EclIO::OutputStream::Formatted { this->es_.get().cfg().io().getFMTOUT() },
-        EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() }
-    };
-
-    RestartIO::save(rstFile, report_step, secs_elapsed,
-                    std::move(value),
-                    this->es_, this->grid_, this->schedule_,
-                    action_state, wtest_state, st,
-                    udq_state, this->aquiferData_, write_double);
+    this->saveRestart(action_state, wtest_state, st, udq_state,
+                      report_step, time_step, secs_elapsed,
+                      write_double, std::move(value));
 }
 
 void Opm::EclipseIO::Impl::writeRestartFile(const Action::State&        action_state,
@@ -890,18 +1159,100 @@ void Opm::EclipseIO::Impl::writeRestartFile(const Action::State&        action_s
                                             const bool                  write_double,
                                             std::vector<RestartValue>&& value)
 {
-    EclIO::OutputStream::Restart rstFile {
-        EclIO::OutputStream::ResultSet { this->outputDir_, this->baseName_ },
-        this->reportIndex(report_step, time_step),
-        EclIO::OutputStream::Formatted { this->es_.get().cfg().io().getFMTOUT() },
-        EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() }
-    };
+    this->saveRestart(action_state, wtest_state, st, udq_state,
+                      report_step, time_step, secs_elapsed,
+                      write_double, std::move(value));
+}
 
-    RestartIO::save(rstFile, report_step, secs_elapsed,
+template <typename Value>
+void Opm::EclipseIO::Impl::saveRestart(const Action::State& action_state,
+                                       const WellTestState& wtest_state,
+                                       const SummaryState&  st,
+                                       const UDQState&      udq_state,
+                                       const int            report_step,
+                                       std::optional<int>   time_step,
+                                       const double         secs_elapsed,
+                                       const bool           write_double,
+                                       Value&&              value)
+{
+    // In asynchronous mode, the restart stream only collects the arrays.
+    // Aggregation of well, group, and aquifer data reads the Schedule and
+    // EclipseState, which may change once control returns to the caller,
+    // so it happens on this thread and only the file output is deferred.
+    //
+    // Monitoring output, with a restart output policy, goes to a separate
+    // restart file to keep the regular restart file usable for restarts.
+    const auto baseName = (this->restartPolicy_ == nullptr)
+        ? this->baseName_
+        : this->baseName_ + EclIO::RestartOutputPolicy::monitorSuffix;
+
+    auto rstFile = std::make_shared<EclIO::OutputStream::Restart>
+        (EclIO::OutputStream::ResultSet { this->outputDir_, baseName },
+         this->reportIndex(report_step, time_step),
+         EclIO::OutputStream::Formatted { this->es_.get().cfg().io().getFMTOUT() },
+         EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() },
+         EclIO::OutputStream::Compressed{ this->compressedRestart_, this->compressedCache_ },
+         EclIO::OutputStream::Deferred  { this->restartWriter_ != nullptr });
+
+    rstFile->setOutputPolicy(this->restartPolicy_);
+
+    RestartIO::save(*rstFile, report_step, secs_elapsed,
                     std::move(value),
                     this->es_, this->grid_, this->schedule_,
                     action_state, wtest_state, st,
                     udq_state, this->aquiferData_, write_double);
+
+    if (this->restartWriter_ == nullptr) {
+        return;
+    }
+
+    // Blocks if too many output events are pending.  Rethrows errors of
+    // earlier output events.
+    this->restartWriter_->submit([rstFile = std::move(rstFile)]()
+    {
+        rstFile->commit();
+    });
+}
+
+void Opm::EclipseIO::Impl::setAsyncRestartOutput(const std::size_t maxPending)
+{
+    this->waitForRestartOutput();
+    this->restartWriter_.reset();
+
+    if (maxPending == 0) {
+        return;
+    }
+
+    this->restartWriter_ = std::make_unique<BackgroundWriter>(maxPending);
+}
+
+void Opm::EclipseIO::Impl::setCompressedRestartOutput(const bool compressed)
+{
+    this->waitForRestartOutput();
+    this->compressedRestart_ = compressed;
+
+    // Only the companion of a unified restart file accumulates report
+    // steps which refer to the previous one.
+    this->compressedCache_.reset();
+    if (compressed && this->es_.get().cfg().io().getUNIFOUT()) {
+        this->compressedCache_ = std::make_shared<EclIO::CompressedRestart::ReferenceCache>();
+    }
+}
+
+void Opm::EclipseIO::Impl::setRestartOutputPolicy(EclIO::RestartOutputPolicy policy)
+{
+    this->waitForRestartOutput();
+
+    this->restartPolicy_ = policy.fullOutput()
+        ? nullptr
+        : std::make_shared<const EclIO::RestartOutputPolicy>(std::move(policy));
+}
+
+void Opm::EclipseIO::Impl::waitForRestartOutput() const
+{
+    if (this->restartWriter_ != nullptr) {
+        this->restartWriter_->wait();
+    }
 }
 
 void Opm::EclipseIO::Impl::writeRunSummary() const
@@ -1170,25 +1521,36 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
         return;
     }
 
+    auto& timings = this->impl->outputTimings();
+
     // RFT file written only if requested and never for substeps.
     if (const auto& [wantRFT, haveExistingRFT] =
         this->impl->wantRFTOutput(report_step, isSubstep);
         wantRFT)
     {
-        this->impl->writeRftFile(secs_elapsed, report_step,
-                                 haveExistingRFT, value.wells);
+        timedCall(timings.rft, timings.numRft, [&]()
+        {
+            this->impl->writeRftFile(secs_elapsed, report_step,
+                                     haveExistingRFT, value.wells);
+        });
     }
 
     if (this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed, time_step)) {
-        this->impl->writeSummaryFile(st, report_step, time_step,
-                                     secs_elapsed, isSubstep, forceFinalWrite);
+        timedCall(timings.summary, timings.numSummary, [&]()
+        {
+            this->impl->writeSummaryFile(st, report_step, time_step,
+                                         secs_elapsed, isSubstep, forceFinalWrite);
+        });
     }
 
     if (this->impl->wantRestartOutput(report_step, isSubstep, time_step)) {
         // Restart file output (RPTRST &c).
-        this->impl->writeRestartFile(action_state, wtest_state, st, udq_state,
-                                     report_step, time_step, secs_elapsed,
-                                     write_double, std::move(value));
+        timedCall(timings.restart, timings.numRestart, [&]()
+        {
+            this->impl->writeRestartFile(action_state, wtest_state, st, udq_state,
+                                         report_step, time_step, secs_elapsed,
+                                         write_double, std::move(value));
+        });
     }
 
     if ( this->impl->isFinalWrite(report_step, isSubstep, forceFinalWrite)  &&
@@ -1220,18 +1582,26 @@ void Opm::EclipseIO::writeTimeStep(const Action::State&      action_state,
         return;
     }
 
+    auto& timings = this->impl->outputTimings();
+
     // RFT file is currently skipped for LGR grids.
 
     if (this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed, time_step)) {
-        this->impl->writeSummaryFile(st, report_step, time_step,
-                                     secs_elapsed, isSubstep, forceFinalWrite);
+        timedCall(timings.summary, timings.numSummary, [&]()
+        {
+            this->impl->writeSummaryFile(st, report_step, time_step,
+                                         secs_elapsed, isSubstep, forceFinalWrite);
+        });
     }
 
     if (this->impl->wantRestartOutput(report_step, isSubstep, time_step)) {
         // Restart file output (RPTRST &c).
-        this->impl->writeRestartFile(action_state, wtest_state, st, udq_state,
-                                     report_step, time_step, secs_elapsed,
-                                     write_double, std::move(value));
+        timedCall(timings.restart, timings.numRestart, [&]()
+        {
+            this->impl->writeRestartFile(action_state, wtest_state, st, udq_state,
+                                         report_step, time_step, secs_elapsed,
+                                         write_double, std::move(value));
+        });
     }
 
     if ( this->impl->isFinalWrite(report_step, isSubstep, forceFinalWrite) &&
@@ -1262,6 +1632,39 @@ Opm::EclipseIO::loadRestartSolution(const std::vector<RestartKey>& solution_keys
     return this->impl->loadRestartSolution(solution_keys, report_step);
 }
 
+Opm::LazyRestartSolution
+Opm::EclipseIO::restartSolution(const int         report_step,
+                                const std::size_t cellBegin,
+                                const std::size_t cellEnd) const
+{
+    return this->impl->restartSolution(report_step, cellBegin, cellEnd);
+}
+
+void Opm::EclipseIO::setAsyncRestartOutput(const std::size_t maxPending)
+{
+    this->impl->setAsyncRestartOutput(maxPending);
+}
+
+void Opm::EclipseIO::setCompressedRestartOutput(const bool compressed)
+{
+    this->impl->setCompressedRestartOutput(compressed);
+}
+
+void Opm::EclipseIO::setRestartOutputPolicy(EclIO::RestartOutputPolicy policy)
+{
+    this->impl->setRestartOutputPolicy(std::move(policy));
+}
+
+void Opm::EclipseIO::waitForRestartOutput() const
+{
+    this->impl->waitForRestartOutput();
+}
+
+const Opm::EclipseIO::OutputTimings& Opm::EclipseIO::outputTimings() const
+{
+    return this->impl->outputTimings();
+}
+
 const Opm::out::Summary& Opm::EclipseIO::summary() const
 {
     return this->impl->summary();
@@ -24,9 +24,13 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/NNC.hpp>
 
+#include <opm/io/eclipse/RestartOutputPolicy.hpp>
+
 #include <opm/output/data/Solution.hpp>
+#include <opm/output/eclipse/LazyRestartSolution.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -415,6 +419,118 @@ public:
     data::Solution loadRestartSolution(const std::vector<RestartKey>& solution_keys,
                                        const int                      report_step) const;
 
+    /// Access per-cell solution data of a range of active cells in
+    /// restart file at specific time.
+    ///
+    /// Arrays are read from file on first access, and only the values of
+    /// cells in [cellBegin, cellEnd) are loaded.  Intended for parallel
+    /// runs where each process owns a contiguous range of active cells.
+    ///
+    /// Name of restart file inferred from internal IOConfig and InitConfig
+    /// objects.
+    ///
+    /// \param[in] report_step One-based report step index for which load
+    /// restart file information.
+    ///
+    /// \param[in] cellBegin First active cell, zero-based, of range.
+    ///
+    /// \param[in] cellEnd One past last active cell of range.
+    ///
+    /// \return On-demand reader of per-cell results at \p report_step.
+    LazyRestartSolution restartSolution(const int         report_step,
+                                        const std::size_t cellBegin,
+                                        const std::size_t cellEnd) const;
+
+    /// Select synchronous or asynchronous restart file output.
+    ///
+    /// In asynchronous mode, writeTimeStep() aggregates well, group, and
+    /// segment data as usual, but hands the resulting arrays and the
+    /// solution over to a background thread which performs unit
+    /// conversion and restart file output.  Control returns to the caller
+    /// as soon as the restart output event is queued.  Summary and RFT
+    /// output remain synchronous.
+    ///
+    /// Pending output events do not reference the EclipseState, the
+    /// Schedule, or the grid, so these may change, e.g., when applying
+    /// ACTIONX effects, while output is in progress.  Errors of
+    /// asynchronous output are rethrown when the next restart output
+    /// event is submitted, i.e., from the next writeTimeStep() call which
+    /// writes a restart file, or from waitForRestartOutput(), which is
+    /// also called by loadRestart() and by the output mode setters.
+    /// writeTimeStep() calls without restart output do not report them.
+    ///
+    /// \param[in] maxPending Maximum number of restart output events
+    /// queued or in progress before writeTimeStep() blocks.  One gives
+    /// double buffering, i.e., output of one report step overlaps the
+    /// computation of the next.  Zero, the default, selects synchronous
+    /// output.
+    void setAsyncRestartOutput(std::size_t maxPending);
+
+    /// Enable or disable output of compressed restart companion files.
+    ///
+    /// When enabled, each restart file, e.g., CASE.UNRST, is accompanied
+    /// by a compressed file, CASE.UNRST.OPMZ, holding the same arrays.
+    /// Arrays are stored as differences against the previous report step
+    /// and run-length encoded.  ERst reads the companion file if the
+    /// restart file itself is not present, and
+    /// EclIO::CompressedRestartFile::writeRestartFile() recreates the
+    /// restart file.  Disabled by default.
+    ///
+    /// \param[in] compressed Whether or not to create companion files.
+    void setCompressedRestartOutput(bool compressed);
+
+    /// Select and round per-cell solution arrays of subsequent restart
+    /// output.
+    ///
+    /// Allows light-weight monitoring restart files, e.g., a few arrays
+    /// in a region of interest at reduced precision, to be written
+    /// frequently while regular restart files are written rarely.  While
+    /// a policy is active, restart output goes to a separate monitoring
+    /// restart file, e.g., CASE_MON.UNRST, and the regular restart file
+    /// only receives full output.  Pass a default constructed policy to
+    /// restore full output to the regular restart file.  See
+    /// EclIO::RestartOutputPolicy.
+    ///
+    /// \param[in] policy Restart output policy.
+    void setRestartOutputPolicy(EclIO::RestartOutputPolicy policy);
+
+    /// Wait for all pending asynchronous restart file output to complete.
+    ///
+    /// Rethrows any exception raised while creating asynchronous output.
+    /// No operation in synchronous mode.  Invoked automatically before
+    /// loading restart information and when the EclipseIO object is
+    /// destroyed.
+    void waitForRestartOutput() const;
+
+    /// Accumulated wall-clock time of file output in writeTimeStep().
+    ///
+    /// Intended for performance monitoring and benchmarking.  In
+    /// asynchronous restart output mode, the restart time is the time
+    /// needed to queue each output event.
+    struct OutputTimings
+    {
+        /// Time spent creating RFT files, seconds.
+        double rft{0.0};
+
+        /// Time spent creating summary files, seconds.
+        double summary{0.0};
+
+        /// Time spent creating restart files, seconds.
+        double restart{0.0};
+
+        /// Number of RFT file output events.
+        std::size_t numRft{0};
+
+        /// Number of summary file output events.
+        std::size_t numSummary{0};
+
+        /// Number of restart file output events.
+        std::size_t numRestart{0};
+    };
+
+    /// Retrieve accumulated file output timings.
+    const OutputTimings& outputTimings() const;
+
     /// Access internal summary vector calculation engine.
     ///
     /// Mainly provided in order to allow callers to invoke Summary::eval().
@@ -0,0 +1,267 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/eclipse/LazyRestartSolution.hpp>
+
+#include <opm/common/utility/ParallelFor.hpp>
+
+#include <opm/io/eclipse/ArrayView.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+    using SourceView = std::variant<Opm::EclIO::ArrayView<float>,
+                                    Opm::EclIO::ArrayView<double>>;
+
+    void copyRange(const Opm::EclIO::ArrayView<double>& view,
+                   const std::size_t                    first,
+                   std::vector<double>&                 dest)
+    {
+        view.copy(first, std::span<double>{ dest });
+    }
+
+    void copyRange(const Opm::EclIO::ArrayView<float>& view,
+                   const std::size_t                   first,
+                   std::vector<double>&                dest)
+    {
+        // Convert one on-disk block at a time to avoid a full size
+        // single precision temporary.
+        auto buffer = std::array<float, Opm::EclIO::ArrayView<float>::perBlock>{};
+
+        for (auto done = std::size_t{0}; done < dest.size();) {
+            const auto n = view.copy(first + done,
+                                     std::span<float>{ buffer.data(),
+                                                       std::min(buffer.size(), dest.size() - done) });
+
+            std::copy_n(buffer.begin(), n, dest.begin() + done);
+            done += n;
+        }
+    }
+
+    template <typename T>
+    std::vector<double> toDouble(const std::vector<T>& source)
+    {
+        return { source.begin(), source.end() };
+    }
+
+} // Anonymous namespace
+
+Opm::LazyRestartSolution::
+LazyRestartSolution(std::shared_ptr<EclIO::ERst> rstFile,
+                    const int                    reportStep,
+                    const UnitSystem&            units,
+                    const std::size_t            numActive,
+                    const std::size_t            cellBegin,
+                    const std::size_t            cellEnd)
+    : rstFile_   { std::move(rstFile) }
+    , reportStep_{ reportStep }
+    , units_     { units }
+    , numActive_ { numActive }
+    , cellBegin_ { std::min(cellBegin, numActive) }
+    , cellEnd_   { std::clamp(cellEnd, this->cellBegin_, numActive) }
+{
+    this->valid_ = (this->rstFile_ != nullptr)
+        && this->rstFile_->hasReportStepNumber(this->reportStep_);
+
+    if (! this->valid_) {
+        return;
+    }
+
+    for (const auto& [name, type, size] : this->rstFile_->listOfRstArrays(this->reportStep_)) {
+        if (((type == EclIO::eclArrType::REAL) || (type == EclIO::eclArrType::DOUB)) &&
+            ! this->arrays_.contains(name))
+        {
+            this->arrays_.emplace(name, ArrayInfo { type, static_cast<std::size_t>(size) });
+        }
+    }
+}
+
+Opm::LazyRestartSolution::
+LazyRestartSolution(std::shared_ptr<EclIO::ERst> rstFile,
+                    const int                    reportStep,
+                    const UnitSystem&            units,
+                    const std::size_t            numActive)
+    : LazyRestartSolution { std::move(rstFile), reportStep, units,
+                            numActive, 0, numActive }
+{}
+
+bool Opm::LazyRestartSolution::has(const std::string& key) const
+{
+    return this->arrays_.contains(key);
+}
+
+const std::vector<double>&
+Opm::LazyRestartSolution::get(const RestartKey& key)
+{
+    static const auto unavailable = std::vector<double>{};
+
+    auto pos = this->loaded_.find(key.key);
+    if (pos == this->loaded_.end()) {
+        this->load(this->pendingLoads({ key }));
+        pos = this->loaded_.find(key.key);
+    }
+
+    return (pos == this->loaded_.end()) ? unavailable : pos->second;
+}
+
+void Opm::LazyRestartSolution::prefetch(const std::vector<RestartKey>& keys)
+{
+    this->load(this->pendingLoads(keys));
+}
+
+Opm::data::Solution
+Opm::LazyRestartSolution::solution(const std::vector<RestartKey>& keys)
+{
+    this->prefetch(keys);
+
+    auto sol = data::Solution{};
+
+    for (const auto& key : keys) {
+        auto pos = this->loaded_.find(key.key);
+        if (pos == this->loaded_.end()) {
+            continue;
+        }
+
+        sol.insert(key.key, key.dim, std::move(pos->second),
+                   data::TargetType::RESTART_SOLUTION);
+
+        this->loaded_.erase(pos);
+    }
+
+    return sol;
+}
+
+void Opm::LazyRestartSolution::release(const std::string& key)
+{
+    this->loaded_.erase(key);
+}
+
+std::vector<Opm::RestartKey>
+Opm::LazyRestartSolution::pendingLoads(const std::vector<RestartKey>& keys) const
+{
+    auto pending = std::vector<RestartKey>{};
+
+    for (const auto& key : keys) {
+        if (this->loaded_.contains(key.key) ||
+            std::any_of(pending.begin(), pending.end(),
+                        [&key](const auto& p) { return p.key == key.key; }))
+        {
+            continue;
+        }
+
+        auto pos = this->arrays_.find(key.key);
+        if (pos == this->arrays_.end()) {
+            if (key.required) {
+                throw std::runtime_error {
+                    "Requisite restart vector '"
+                    + key.key +
+                    "' is not available in restart file"
+                };
+            }
+
+            // Not available, but caller does not require it.  Skip.
+            continue;
+        }
+
+        if (pos->second.size != this->numActive_) {
+            throw std::runtime_error {
+                "Restart file: Could not restore '"
+                + key.key
+                + "', mismatched number of cells"
+            };
+        }
+
+        pending.push_back(key);
+    }
+
+    return pending;
+}
+
+void Opm::LazyRestartSolution::load(const std::vector<RestartKey>& keys)
+{
+    if (keys.empty()) {
+        return;
+    }
+
+    const auto numCells = this->cellEnd_ - this->cellBegin_;
+    auto values = std::vector<std::vector<double>>(keys.size());
+
+    if (this->rstFile_->formattedInput() || this->rstFile_->compressedInput()) {
+        // Formatted and compressed files cannot be mapped.  Read the cell
+        // range of each array past the restart file's array cache.  This
+        // decodes only the blocks spanning the range of a compressed file.
+        // Reading ranges is thread safe.
+        parallelFor(keys.size(), 2, [&keys, &values, numCells, this](const std::size_t i)
+        {
+            const auto& name = keys[i].key;
+
+            values[i] = (this->arrays_.at(name).type == EclIO::eclArrType::DOUB)
+                ? this->rstFile_->getRestartRange<double>(name, this->reportStep_,
+                                                          this->cellBegin_, numCells)
+                : toDouble(this->rstFile_->getRestartRange<float>(name, this->reportStep_,
+                                                                  this->cellBegin_, numCells));
+        });
+    }
+    else {
+        // Views are created serially since that may (re-)map the file.
+        // Reading through the views is thread safe.
+        auto views = std::vector<SourceView>{};
+        views.reserve(keys.size());
+
+        for (const auto& key : keys) {
+            if (this->arrays_.at(key.key).type == EclIO::eclArrType::DOUB) {
+                views.emplace_back(this->rstFile_->getRestartView<double>(key.key, this->reportStep_));
+            }
+            else {
+                views.emplace_back(this->rstFile_->getRestartView<float>(key.key, this->reportStep_));
+            }
+        }
+
+        parallelFor(keys.size(), 2, [&views, &values, numCells, this](const std::size_t i)
+        {
+            values[i].resize(numCells);
+
+            std::visit([&dest = values[i], this](const auto& view)
+            { copyRange(view, this->cellBegin_, dest); }, views[i]);
+        });
+    }
+
+    parallelFor(keys.size(), 2, [&keys, &values, this](const std::size_t i)
+    {
+        if (keys[i].dim != UnitSystem::measure::identity) {
+            this->units_.to_si(keys[i].dim, values[i]);
+        }
+    });
+
+    for (auto i = 0*keys.size(); i < keys.size(); ++i) {
+        this->loaded_.insert_or_assign(keys[i].key, std::move(values[i]));
+    }
+}
@@ -0,0 +1,154 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_LAZY_RESTART_SOLUTION_HPP
+#define OPM_LAZY_RESTART_SOLUTION_HPP
+
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+#include <opm/output/data/Solution.hpp>
+#include <opm/output/eclipse/RestartValue.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm::EclIO {
+    class ERst;
+} // namespace Opm::EclIO
+
+namespace Opm {
+
+/// Per-cell solution arrays of a single report step in a restart file,
+/// loaded on first access.
+///
+/// Each object covers a contiguous range of active cells, typically the
+/// range owned by a single simulator process, and only that part of each
+/// array is kept in memory.  Values are converted to SI units on
+/// loading.  Binary restart files are memory mapped, only the blocks
+/// spanning the cell range are decoded from compressed companion files, and
+/// formatted files are read in full.  Arrays requested together through
+/// prefetch() or solution() are read and converted in parallel if OpenMP
+/// is enabled.
+///
+/// Not thread safe.
+class LazyRestartSolution
+{
+public:
+    /// Constructor.
+    ///
+    /// \param[in] rstFile Restart file.  Shared with other readers, such
+    ///   as RestartFileView, of the same file.
+    ///
+    /// \param[in] reportStep One-based report step index.
+    ///
+    /// \param[in] units Unit system of restart file.
+    ///
+    /// \param[in] numActive Number of active cells in model.  Global
+    ///   solution arrays must have this size.
+    ///
+    /// \param[in] cellBegin First active cell, zero-based, of range.
+    ///
+    /// \param[in] cellEnd One past last active cell of range.  Clamped
+    ///   to \p numActive.
+    LazyRestartSolution(std::shared_ptr<EclIO::ERst> rstFile,
+                        int                          reportStep,
+                        const UnitSystem&            units,
+                        std::size_t                  numActive,
+                        std::size_t                  cellBegin,
+                        std::size_t                  cellEnd);
+
+    /// Constructor.  Range covering all active cells.
+    LazyRestartSolution(std::shared_ptr<EclIO::ERst> rstFile,
+                        int                          reportStep,
+                        const UnitSystem&            units,
+                        std::size_t                  numActive);
+
+    /// Whether or not the restart file has the requested report step.
+    bool valid() const { return this->valid_; }
+
+    /// Whether or not a solution array is available in the restart file.
+    bool has(const std::string& key) const;
+
+    std::size_t cellBegin() const { return this->cellBegin_; }
+    std::size_t cellEnd() const { return this->cellEnd_; }
+
+    /// Solution values of the cell range, in SI units.
+    ///
+    /// Reads the array from file on first access.  Throws if the array
+    /// is not available and \code key.required \endcode is set, or if the
+    /// array does not have one value per active cell.
+    ///
+    /// \return Cell range values.  Empty if the array is not available.
+    ///   The reference stays valid across later calls to get() and
+    ///   prefetch().  It is invalidated by release() of \p key, by
+    ///   solution() if its keys include \p key, and by destruction of
+    ///   *this.  Copy the values to keep them beyond that.
+    const std::vector<double>& get(const RestartKey& key);
+
+    /// Load all available and not yet loaded arrays in a single pass.
+    ///
+    /// Same error handling as get().
+    void prefetch(const std::vector<RestartKey>& keys);
+
+    /// Solution container of the available arrays amongst \p keys.
+    ///
+    /// Arrays are moved out of this object, so a later get() reads the
+    /// array again.
+    data::Solution solution(const std::vector<RestartKey>& keys);
+
+    /// Drop loaded values of a single array.
+    void release(const std::string& key);
+
+private:
+    /// Location of a solution array in the restart file.
+    struct ArrayInfo
+    {
+        EclIO::eclArrType type{EclIO::eclArrType::REAL};
+        std::size_t size{0};
+    };
+
+    std::shared_ptr<EclIO::ERst> rstFile_{};
+    int reportStep_{0};
+    UnitSystem units_{};
+    std::size_t numActive_{0};
+    std::size_t cellBegin_{0};
+    std::size_t cellEnd_{0};
+    bool valid_{false};
+
+    /// Numeric arrays of report step, first occurrence only.
+    std::unordered_map<std::string, ArrayInfo> arrays_{};
+
+    /// Loaded cell range values.
+    std::unordered_map<std::string, std::vector<double>> loaded_{};
+
+    /// Arrays to load in next pass.  Validated, not yet loaded.
+    std::vector<RestartKey> pendingLoads(const std::vector<RestartKey>& keys) const;
+
+    /// Read and convert cell range of each array in \p keys.
+    void load(const std::vector<RestartKey>& keys);
+};
+
+} // namespace Opm
+
+#endif // OPM_LAZY_RESTART_SOLUTION_HPP
@@ -41,6 +41,7 @@
 #include <opm/output/eclipse/VectorItems/msw.hpp>
 #include <opm/output/eclipse/VectorItems/well.hpp>
 
+#include <opm/output/eclipse/LazyRestartSolution.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
@@ -606,42 +607,6 @@ namespace {
         return {};
     }
 
-    void insertSolutionVector(const std::vector<double>&           vector,
-                              const Opm::RestartKey&               value,
-                              const std::vector<double>::size_type numcells,
-                              Opm::data::Solution&                 sol)
-    {
-        if (vector.size() != numcells) {
-            throw std::runtime_error {
-                "Restart file: Could not restore '"
-                + value.key
-                + "', mismatched number of cells"
-            };
-        }
-
-        sol.insert(value.key, value.dim, vector,
-                   Opm::data::TargetType::RESTART_SOLUTION);
-    }
-
-    void loadIfAvailable(const Opm::RestartKey&               value,
-                         const std::vector<double>::size_type numcells,
-                         const Opm::EclIO::RestartFileView&   rst_view,
-                         Opm::data::Solution&                 sol)
-    {
-        const auto& kwdata = double_vector(value.key, rst_view);
-
-        if (kwdata.empty()) {
-            throwIfMissingRequired(value);
-
-            // If we get here, the requested value was not available in the
-            // result set.  However, the client does not actually require
-            // the value for restart purposes so we can safely skip this.
-            return;
-        }
-
-        insertSolutionVector(kwdata, value, numcells, sol);
-    }
-
     std::vector<double>
     getOpmExtraFromDoubHEAD(const bool                         required,
                             const Opm::UnitSystem&             usys,
@@ -660,21 +625,6 @@ namespace {
         return { usys.to_si(M::time, TsInit) };
     }
 
-    Opm::data::Solution
-    restoreSOLUTION(const std::vector<Opm::RestartKey>& solution_keys,
-                    const int                           numcells,
-                    const Opm::EclIO::RestartFileView&  rst_view)
-    {
-        Opm::data::Solution sol(/* init_si = */ false);
-
-        for (const auto& value : solution_keys) {
-            // Load vector if available.
-            loadIfAvailable(value, numcells, rst_view, sol);
-        }
-
-        return sol;
-    }
-
     void restoreExtra(const std::vector<Opm::RestartKey>& extra_keys,
                       const Opm::UnitSystem&              usys,
                       const Opm::EclIO::RestartFileView&  rst_view,
@@ -1631,11 +1581,12 @@ namespace Opm::RestartIO  {
          const Schedule&                schedule,
          const std::vector<RestartKey>& extra_keys)
     {
-        auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
-            (std::make_shared<Opm::EclIO::ERst>(filename), report_step);
+        auto rst_file = std::make_shared<Opm::EclIO::ERst>(filename);
+        auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>(rst_file, report_step);
 
-        auto xr = restoreSOLUTION(solution_keys, grid.getNumActive(), *rst_view);
-        xr.convertToSI(es.getUnits());
+        auto xr = LazyRestartSolution {
+            std::move(rst_file), report_step, es.getUnits(), grid.getNumActive()
+        }.solution(solution_keys);
 
         auto xw = restore_wells(es, grid, schedule, summary_state, rst_view);
         auto xgrp_nwrk = restore_grp_nwrk(schedule, es.getUnits(), rst_view);
@@ -1667,17 +1618,16 @@ namespace Opm::RestartIO  {
                        const EclipseState&            es,
                        const EclipseGrid&             grid)
     {
-        auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
-            (std::make_shared<Opm::EclIO::ERst>(filename), report_step);
+        auto solution = LazyRestartSolution {
+            std::make_shared<Opm::EclIO::ERst>(filename), report_step,
+            es.getUnits(), grid.getNumActive()
+        };
 
-        if (!rst_view->valid()) {
+        if (! solution.valid()) {
             return {};
         }
 
-        auto sol =  restoreSOLUTION(solution_keys, grid.getNumActive(), *rst_view);
-        sol.convertToSI(es.getUnits());
-
-        return sol;
+        return solution.solution(solution_keys);
     }
 
 } // Opm::RestartIO
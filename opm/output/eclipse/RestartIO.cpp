@@ -65,6 +65,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -109,6 +110,13 @@ namespace {
         return extra_solution.count(vector) > 0;
     }
 
+    void convertExtraFromSI(const UnitSystem& units, RestartValue& value)
+    {
+        for (auto& [restart_key, data] : value.extra) {
+            units.from_si(restart_key.dim, data);
+        }
+    }
+
     double nextStepSize(const RestartValue& rst_value)
     {
         return rst_value.hasExtra("OPMEXTRA")
@@ -662,6 +670,30 @@ namespace {
         return vectors;
     }
 
+    // Solution arrays are kept in SI units and converted to output units,
+    // and possibly to single precision, one output block at a time while
+    // being written.  Solutions which are not in SI units, see
+    // data::Solution::isSI(), are written unchanged.
+    void writeSolutionArray(const std::string&            key,
+                            const std::vector<double>&    data,
+                            const UnitSystem::measure     dim,
+                            const UnitSystem&             units,
+                            const bool                    si,
+                            const bool                    writeDouble,
+                            EclIO::OutputStream::Restart& rstFile)
+    {
+        const auto [factor, offset] = (!si || (dim == UnitSystem::measure::identity))
+            ? std::pair { 1.0, 0.0 }
+            : units.from_si_factor_offset(dim);
+
+        if (writeDouble) {
+            rstFile.writeConverted<double>(key, data, factor, offset);
+        }
+        else {
+            rstFile.writeConverted<float>(key, data, factor, offset);
+        }
+    }
+
     template <class OutputVector, class OutputVectorInt>
     void writeSolutionVectors(const RestartValue&             value,
                               const std::vector<std::string>& vectors,
@@ -670,11 +702,12 @@ namespace {
     {
         for (const auto& vector : vectors) {
             if (vector=="TEMP") continue;  // Write this together with the tracers
-            value.solution.at(vector).visit(VisitorOverloadSet{
+            const auto& cellData = value.solution.at(vector);
+            cellData.visit(VisitorOverloadSet{
                 MonoThrowHandler<std::logic_error>(fmt::format("{} does not have an associate value", vector)),
-                [&vector,&writeVectorF](const std::vector<double>& v)
+                [&vector,&writeVectorF,dim = cellData.dim](const std::vector<double>& v)
                 {
-                    writeVectorF(vector, v);
+                    writeVectorF(vector, v, dim);
                 },
                 [&vector,&writeVectorI](const std::vector<int>& v)
                 {
@@ -712,22 +745,16 @@ namespace {
         }
 
         auto writeVector =
-            [writeDouble, &rstFile](const std::string&         arrayName,
-                                    const std::vector<double>& fipArray)
+            [writeDouble, &units = es.getUnits(), si = value.solution.isSI(), &rstFile]
+            (const std::string& arrayName, const data::CellData& fipArray)
         {
-            if (writeDouble) {
-                rstFile.write(arrayName, fipArray);
-            }
-            else {
-                rstFile.write(arrayName, std::vector<float> {
-                    fipArray.begin(), fipArray.end()
-                });
-            }
+            writeSolutionArray(arrayName, fipArray.data<double>(), fipArray.dim,
+                               units, si, writeDouble, rstFile);
         };
 
         auto anyRSFip = false;
         for (const auto& vector : vectors) {
-            writeVector(vector, value.solution.at(vector).data<double>());
+            writeVector(vector, value.solution.at(vector));
 
             if ((vector.front() == 'R') || (vector.front() == 'S')) {
                 // The vector name is RFIP* or SFIP*.  These refer to
@@ -748,7 +775,7 @@ namespace {
         // represent surface condition volumes.  Output the same vectors
         // using the corresponding SFIP name as well.
         for (const auto& vector : vectors) {
-            writeVector('S' + vector, value.solution.at(vector).data<double>());
+            writeVector('S' + vector, value.solution.at(vector));
         }
     }
 
@@ -788,12 +815,8 @@ namespace {
                 zatracer.push_back("TEMP");
                 zatracer.push_back(unit_system.name(UnitSystem::measure::temperature));
                 rstFile.write("ZATRACER", zatracer);
-                const auto& data = vector.data<double>();
-                if (write_double) {
-                    rstFile.write(tracer_rst_name, data);
-                } else {
-                    rstFile.write(tracer_rst_name, std::vector<float> {data.begin(), data.end()});
-                }
+                writeSolutionArray(tracer_rst_name, vector.data<double>(), vector.dim,
+                                   unit_system, value.solution.isSI(), write_double, rstFile);
                 continue;
             }
 
@@ -812,15 +835,8 @@ namespace {
             ztracer.push_back(fmt::format("{}/{}", tracer.unit_string, unit_system.name( UnitSystem::measure::volume )));
             rstFile.write("ZTRACER", ztracer);
 
-            const auto& data = vector.data<double>();
-            if (write_double) {
-                rstFile.write(tracer_rst_name, data);
-            }
-            else {
-                rstFile.write(tracer_rst_name, std::vector<float> {
-                        data.begin(), data.end()
-                    });
-            }
+            writeSolutionArray(tracer_rst_name, vector.data<double>(), vector.dim,
+                               unit_system, value.solution.isSI(), write_double, rstFile);
         }
     }
 
@@ -857,17 +873,13 @@ namespace {
                            EclIO::OutputStream::Restart& rstFile,
                            const bool                    is_lgr_grid = false)
     {
-        auto writeDorF = [&rstFile, write_double = write_double_arg]
-            (const std::string& key, const std::vector<double>& data)
+        auto writeDorF = [&rstFile, &units = es.getUnits(), si = value.solution.isSI(),
+                          write_double = write_double_arg]
+            (const std::string&         key,
+             const std::vector<double>& data,
+             const UnitSystem::measure  dim)
         {
-            if (write_double) {
-                rstFile.write(key, data);
-            }
-            else {
-                rstFile.write(key, std::vector<float> {
-                    data.begin(), data.end()
-                });
-            }
+            writeSolutionArray(key, data, dim, units, si, write_double, rstFile);
         };
 
         auto writeInt = [&rstFile](const std::string& key,
@@ -1068,7 +1080,7 @@ namespace {
 void save(EclIO::OutputStream::Restart&                 rstFile,
           int                                           report_step,
           double                                        seconds_elapsed,
-          RestartValue                                  value,
+          RestartValue                                  restart_value,
           const EclipseState&                           es,
           const EclipseGrid&                            grid,
           const Schedule&                               schedule,
@@ -1079,6 +1091,13 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
           std::optional<Helpers::AggregateAquiferData>& aquiferData,
           bool                                          write_double)
 {
+    // A deferred stream writes the solution arrays after this function
+    // returns.  Let it share ownership of them rather than copy them.
+    const auto owner = std::make_shared<RestartValue>(std::move(restart_value));
+    rstFile.shareOwnership(owner);
+
+    auto& value = *owner;
+
     ::Opm::RestartIO::checkSaveArguments(es, value, grid);
 
     const auto& ioCfg = es.getIOConfig();
@@ -1091,8 +1110,9 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
         write_double = false;
     }
 
-    // Convert solution fields and extra values from SI to user units.
-    value.convertFromSI(units);
+    // Convert extra values from SI to user units.  Solution fields are
+    // converted while being written.
+    convertExtraFromSI(units, value);
 
     const auto inteHD =
         writeHeader(report_step, sim_step, nextStepSize(value),
@@ -1121,7 +1141,7 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
 void save(EclIO::OutputStream::Restart&                 rstFile,
           int                                           report_step,
           double                                        seconds_elapsed,
-          std::vector<RestartValue>                     values,
+          std::vector<RestartValue>                     restart_values,
           const EclipseState&                           es,
           const EclipseGrid&                            grid,
           const Schedule&                               schedule,
@@ -1132,6 +1152,12 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
           std::optional<Helpers::AggregateAquiferData>& aquiferData,
           bool                                          write_double)
 {
+    // Let a deferred stream share ownership of the solution arrays.
+    const auto owner = std::make_shared<std::vector<RestartValue>>(std::move(restart_values));
+    rstFile.shareOwnership(owner);
+
+    auto& values = *owner;
+
     //checking Grid
     {
         //checking Global Grid
@@ -1155,10 +1181,11 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
     write_double = false;
     }
 
-    // Convert solution fields and extra values from SI to user units.
+    // Convert extra values from SI to user units.  Solution fields are
+    // converted while being written.
     std::ranges::for_each(values,
                           [&units](RestartValue& value )
-                          { return value.convertFromSI(units); });
+                          { convertExtraFromSI(units, value); });
 
 
     const std::vector<int>& inteHD = writeGlobalRestart(report_step, sim_step, seconds_elapsed, schedule, grid, es,
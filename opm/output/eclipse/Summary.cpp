@@ -5735,6 +5735,12 @@ void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary
     // Eagerly output last set of parameters to permanent storage.
     this->stream_->flushStream();
 
+    if (is_final_summary) {
+        // Summary file is complete.  Write side-car index of unified
+        // summary file to speed up subsequent opening of result set.
+        this->stream_->writeIndex();
+    }
+
     if (this->esmry_ != nullptr) {
         for (auto i = 0*this->numUnwritten_; i < this->numUnwritten_; ++i) {
             this->esmry_->write(this->unwritten_[i].params,
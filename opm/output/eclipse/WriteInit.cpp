@@ -23,6 +23,7 @@
 */
 
 #include <opm/output/eclipse/WriteInit.hpp>
+#include <opm/common/utility/ParallelFor.hpp>
 #include <opm/common/utility/numeric/VectorUtil.hpp>
 
 #include <opm/io/eclipse/OutputStream.hpp>
@@ -46,6 +47,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <future>
 #include <initializer_list>
 #include <stdexcept>
 #include <utility>
@@ -240,6 +242,10 @@ namespace {
 
     // =================================================================
 
+    /// Minimum number of active cells for which to compute per-cell INIT
+    /// arrays in parallel.
+    constexpr auto minParallelCells = std::size_t{4096};
+
     std::vector<float> singlePrecision(const std::vector<double>& x)
     {
         return { x.begin(), x.end() };
@@ -447,20 +453,23 @@ namespace {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
+        auto dx    = std::vector<float>(nAct);
+        auto dy    = std::vector<float>(nAct);
+        auto dz    = std::vector<float>(nAct);
+        auto depth = std::vector<float>(nAct);
 
-        for (auto cell = 0*nAct; cell < nAct; ++cell) {
+        // Cell geometry is computed from the corner-point description of
+        // each cell independently.
+        ::Opm::parallelFor(nAct, minParallelCells, [&](const std::size_t cell)
+        {
             const auto  globCell = grid.getGlobalIndex(cell);
             const auto& dims     = grid.getCellDims(globCell);
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
-        }
+            dx   [cell] = units.from_si(length, dims[0]);
+            dy   [cell] = units.from_si(length, dims[1]);
+            dz   [cell] = units.from_si(length, dims[2]);
+            depth[cell] = units.from_si(length, grid.getCellDepth(globCell));
+        });
 
         initFile.write("DEPTH", depth);
         initFile.write("DX"   , dx);
@@ -605,8 +614,8 @@ namespace {
                 [&units, &initFile](const CellProperty&   prop,
                                     std::vector<double>&& value)
             {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
+                const auto [factor, offset] = units.from_si_factor_offset(prop.unit);
+                initFile.writeConverted<float>(prop.name, value, factor, offset);
             });
         }
     }
@@ -700,7 +709,7 @@ namespace {
         for (const auto& prop : simProps) {
             const auto& value = grid.compressedVector(prop.second.data<double>());
 
-            initFile.write(prop.first, singlePrecision(value));
+            initFile.writeConverted<float>(prop.first, value, 1.0);
         }
     }
 
@@ -723,9 +732,8 @@ namespace {
         }
     }
 
-    void writeTableData(const ::Opm::EclipseState&        es,
-                        const ::Opm::UnitSystem&          units,
-                        ::Opm::EclIO::OutputStream::Init& initFile)
+    ::Opm::Tables linearisedTables(const ::Opm::EclipseState& es,
+                                   const ::Opm::UnitSystem&   units)
     {
         ::Opm::Tables tables(units);
 
@@ -733,6 +741,12 @@ namespace {
         tables.addDensity(es.getTableManager().getDensityTable());
         tables.addSatFunc(es);
 
+        return tables;
+    }
+
+    void writeTableData(const ::Opm::Tables&              tables,
+                        ::Opm::EclIO::OutputStream::Init& initFile)
+    {
         initFile.write("TABDIMS", tables.tabdims());
         initFile.write("TAB"    , tables.tab());
     }
@@ -1064,6 +1078,12 @@ void Opm::InitIO::write(const ::Opm::EclipseState&                  es,
 {
     const auto& units = es.getUnits();
 
+    // The linearised tables depend on neither the grid nor the cell
+    // properties.  Build them concurrently with the cell arrays and output
+    // them at their regular position in the file.
+    auto tables = std::async(std::launch::async,
+                             [&es, &units] { return linearisedTables(es, units); });
+
     // GLOBAL HEADER (INTEHEAD, LOGIHEAD, DOUBHEAD)
     writeInitFileHeader(es, grid, schedule, initFile);
 
@@ -1112,7 +1132,7 @@ void Opm::InitIO::write(const ::Opm::EclipseState&                  es,
     writeLGRLocalProperties(es, grid, schedule, simProps, porv, units, initFile);
 
     // TABULAR DATA (TABDIMS, TAB, CON) - after all LGR sections per reference output
-    writeTableData(es, units, initFile);
+    writeTableData(tables.get(), initFile);
 
     writeSatFuncScaling(es, units, initFile);
 
@@ -24,6 +24,8 @@
 
 #include <opm/output/eclipse/WriteRFT.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/io/eclipse/OutputStream.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 
@@ -170,23 +172,150 @@ namespace {
         }
     } // namespace RftUnits
 
-    std::optional<std::vector<Opm::data::Connection>::const_iterator>
-    findConnResults(const std::size_t                         cellIndex,
-                    const std::vector<Opm::data::Connection>& xcon)
+    /// Minimum number of wells for which RFT records are collected using
+    /// multiple threads.
+    constexpr auto minParallelWells = std::size_t{16};
+
+    /// Minimum number of connected cells for which the connection geometry
+    /// is computed using multiple threads.
+    constexpr auto minParallelCells = std::size_t{1024};
+
+    /// Activity status and centre depth of all cells connected to wells
+    /// with RFT output at a single report step.
+    ///
+    /// Computed once per report step rather than once per well and record
+    /// type.  Cell depths are comparatively expensive to compute from the
+    /// corner-point geometry.
+    class ConnectionGeometry
+    {
+    public:
+        explicit ConnectionGeometry(const Opm::EclipseGrid&              grid,
+                                    const std::vector<const Opm::Well*>& wells);
+
+        bool active(const std::size_t cellIndex) const;
+        double depth(const std::size_t cellIndex) const;
+
+    private:
+        /// Global indices of connected cells.  Sorted, unique.
+        std::vector<std::size_t> cells_{};
+
+        /// Whether or not each cell is active.  One-to-one with cells_.
+        std::vector<unsigned char> active_{};
+
+        /// Centre depth of each active cell.  One-to-one with cells_.
+        std::vector<double> depth_{};
+
+        std::optional<std::size_t> position(const std::size_t cellIndex) const;
+    };
+
+    ConnectionGeometry::ConnectionGeometry(const Opm::EclipseGrid&              grid,
+                                           const std::vector<const Opm::Well*>& wells)
     {
-        const auto pos =
-            std::ranges::find_if(xcon,
-                                 [cellIndex](const Opm::data::Connection& xc)
-                                 { return xc.index == cellIndex; });
+        for (const auto* well : wells) {
+            for (const auto& conn : well->getConnections()) {
+                this->cells_.push_back(conn.global_index());
+            }
+        }
+
+        std::ranges::sort(this->cells_);
+        this->cells_.erase(std::unique(this->cells_.begin(), this->cells_.end()),
+                           this->cells_.end());
 
-        if (pos == xcon.end()) {
+        this->active_.assign(this->cells_.size(), 0);
+        this->depth_.assign(this->cells_.size(), 0.0);
+
+        Opm::parallelFor(this->cells_.size(), minParallelCells,
+                         [&grid, this](const std::size_t i)
+        {
+            if (! grid.cellActive(this->cells_[i])) {
+                return;
+            }
+
+            this->active_[i] = 1;
+            this->depth_[i] = grid.getCellDepth(this->cells_[i]);
+        });
+    }
+
+    bool ConnectionGeometry::active(const std::size_t cellIndex) const
+    {
+        const auto i = this->position(cellIndex);
+
+        return i.has_value() && (this->active_[*i] != 0);
+    }
+
+    double ConnectionGeometry::depth(const std::size_t cellIndex) const
+    {
+        const auto i = this->position(cellIndex);
+        if (! i.has_value()) {
+            throw std::logic_error {
+                fmt::format("Cell {} is not connected to "
+                            "any well with RFT output", cellIndex)
+            };
+        }
+
+        return this->depth_[*i];
+    }
+
+    std::optional<std::size_t>
+    ConnectionGeometry::position(const std::size_t cellIndex) const
+    {
+        const auto pos = std::ranges::lower_bound(this->cells_, cellIndex);
+        if ((pos == this->cells_.end()) || (*pos != cellIndex)) {
             return std::nullopt;
         }
 
-        // C++17 class template argument deduction.
-        return std::optional{pos};
+        return std::distance(this->cells_.begin(), pos);
     }
 
+    // -----------------------------------------------------------------------
+
+    /// Dynamic connection results of a single well, searchable by cell.
+    ///
+    /// Replaces a linear search through all connection results for each of
+    /// the well's connections in each RFT record type.
+    class ConnectionResults
+    {
+    public:
+        explicit ConnectionResults(const std::vector<Opm::data::Connection>& xcon);
+
+        /// Connection results of a single cell.  Nullptr if no such
+        /// results exist.
+        const Opm::data::Connection* find(const std::size_t cellIndex) const;
+
+    private:
+        /// Cell index and connection results.  Sorted on cell index.
+        std::vector<std::pair<std::size_t, const Opm::data::Connection*>> index_{};
+    };
+
+    ConnectionResults::ConnectionResults(const std::vector<Opm::data::Connection>& xcon)
+    {
+        this->index_.reserve(xcon.size());
+
+        for (const auto& xc : xcon) {
+            this->index_.emplace_back(xc.index, &xc);
+        }
+
+        // Stable sort to find the first of multiple results, if any, for
+        // the same cell.
+        std::ranges::stable_sort(this->index_, std::less<>{},
+                                 [](const auto& elem) { return elem.first; });
+    }
+
+    const Opm::data::Connection*
+    ConnectionResults::find(const std::size_t cellIndex) const
+    {
+        const auto pos = std::ranges::lower_bound(this->index_, cellIndex, std::less<>{},
+                                                  [](const auto& elem) { return elem.first; });
+
+        if ((pos == this->index_.end()) || (pos->first != cellIndex)) {
+            return nullptr;
+        }
+
+        return pos->second;
+    }
+
+    // -----------------------------------------------------------------------
+
     template <typename ConnectionIsActive, typename ConnOp>
     void connectionLoop(const Opm::WellConnections& connections,
                         ConnectionIsActive&&        connectionIsActive,
@@ -206,12 +335,12 @@ namespace {
 
     template <typename ConnOp>
     void connectionLoop(const Opm::WellConnections& connections,
-                        const Opm::EclipseGrid&     grid,
+                        const ConnectionGeometry&   geometry,
                         ConnOp&&                    connOp)
     {
         connectionLoop(connections,
-                       [&grid](Opm::WellConnections::const_iterator connPos)
-                       { return grid.cellActive(connPos->global_index()); },
+                       [&geometry](Opm::WellConnections::const_iterator connPos)
+                       { return geometry.active(connPos->global_index()); },
                        std::forward<ConnOp>(connOp));
     }
 
@@ -222,7 +351,7 @@ namespace {
     public:
         explicit WellConnectionRecord(const std::size_t nconn = 0);
 
-        void collectRecordData(const ::Opm::EclipseGrid& grid,
+        void collectRecordData(const ConnectionGeometry& geometry,
                                const ::Opm::Well&        well);
 
         void write(::Opm::EclIO::OutputStream::RFT& rftFile) const;
@@ -248,12 +377,12 @@ namespace {
         this->host_.reserve(nconn);
     }
 
-    void WellConnectionRecord::collectRecordData(const ::Opm::EclipseGrid& grid,
+    void WellConnectionRecord::collectRecordData(const ConnectionGeometry& geometry,
                                                  const ::Opm::Well&        well)
     {
         using ConnPos = ::Opm::WellConnections::const_iterator;
 
-        connectionLoop(well.getConnections(), grid, [this](ConnPos connPos)
+        connectionLoop(well.getConnections(), geometry, [this](ConnPos connPos)
         {
             this->addConnection(*connPos);
         });
@@ -285,9 +414,9 @@ namespace {
         explicit RFTRecord(const std::size_t nconn = 0);
 
         void collectRecordData(const ::Opm::UnitSystem&  usys,
-                               const ::Opm::EclipseGrid& grid,
+                               const ConnectionGeometry& geometry,
                                const ::Opm::Well&        well,
-                               const ::Opm::data::Well&  wellSol);
+                               const ConnectionResults&  xcon);
 
         std::size_t nConn() const { return this->depth_.size(); }
 
@@ -315,25 +444,23 @@ namespace {
     }
 
     void RFTRecord::collectRecordData(const ::Opm::UnitSystem&  usys,
-                                      const ::Opm::EclipseGrid& grid,
+                                      const ConnectionGeometry& geometry,
                                       const ::Opm::Well&        well,
-                                      const ::Opm::data::Well&  wellSol)
+                                      const ConnectionResults&  xcon)
     {
         using ConnPos = ::Opm::WellConnections::const_iterator;
 
-        const auto& xcon = wellSol.connections;
-        connectionLoop(well.getConnections(), grid,
-            [this, &usys, &grid, &xcon](ConnPos connPos)
+        connectionLoop(well.getConnections(), geometry,
+            [this, &usys, &geometry, &xcon](ConnPos connPos)
         {
-            const auto xconPos =
-                findConnResults(connPos->global_index(), xcon);
+            const auto* xconPos = xcon.find(connPos->global_index());
 
-            if (! xconPos.has_value()) {
+            if (xconPos == nullptr) {
                 return;
             }
 
-            const double cell_depth = grid.getCellDepth(connPos->global_index());
-            this->addConnection(usys, cell_depth, *xconPos.value());
+            const double cell_depth = geometry.depth(connPos->global_index());
+            this->addConnection(usys, cell_depth, *xconPos);
         });
     }
 
@@ -605,9 +732,9 @@ namespace {
         virtual ~PLTRecord() = default;
 
         void collectRecordData(const ::Opm::UnitSystem&  usys,
-                               const ::Opm::EclipseGrid& grid,
+                               const ConnectionGeometry& geometry,
                                const ::Opm::Well&        well,
-                               const ::Opm::data::Well&  wellSol);
+                               const ConnectionResults&  xcon);
 
         std::size_t nConn() const { return this->conn_depth_.size(); }
 
@@ -653,24 +780,22 @@ namespace {
     }
 
     void PLTRecord::collectRecordData(const ::Opm::UnitSystem&  usys,
-                                      const ::Opm::EclipseGrid& grid,
+                                      const ConnectionGeometry& geometry,
                                       const ::Opm::Well&        well,
-                                      const ::Opm::data::Well&  wellSol)
+                                      const ConnectionResults&  xcon)
     {
         this->prepareConnections(well);
 
-        const auto& xcon = wellSol.connections;
-        connectionLoop(well.getConnections(), grid,
+        connectionLoop(well.getConnections(), geometry,
             [this, &usys, &well, &xcon](ConnPos connPos)
         {
-            const auto xconPos =
-                findConnResults(connPos->global_index(), xcon);
+            const auto* xconPos = xcon.find(connPos->global_index());
 
-            if (! xconPos.has_value()) {
+            if (xconPos == nullptr) {
                 return;
             }
 
-            this->addConnection(usys, well, connPos, *xconPos.value());
+            this->addConnection(usys, well, connPos, *xconPos);
         });
     }
 
@@ -1567,7 +1692,7 @@ namespace {
                                    const double                                 elapsed,
                                    const ::Opm::RestartIO::InteHEAD::TimePoint& timePoint,
                                    const ::Opm::UnitSystem&                     usys,
-                                   const ::Opm::EclipseGrid&                    grid,
+                                   const ConnectionGeometry&                    geometry,
                                    const ::Opm::Well&                           well);
 
         void addDynamicData(const ::Opm::data::Well& wellSol);
@@ -1576,7 +1701,7 @@ namespace {
 
     private:
         using DataHandler = std::function<
-            void(const Opm::data::Well& wellSol)
+            void(const Opm::data::Well& wellSol, const ConnectionResults& xcon)
         >;
 
         using RecordWriter = std::function<
@@ -1586,7 +1711,7 @@ namespace {
         using CreateTypeHandler = void (WellRFTOutputData::*)();
 
         std::reference_wrapper<const Opm::UnitSystem>  usys_;
-        std::reference_wrapper<const Opm::EclipseGrid> grid_;
+        std::reference_wrapper<const ConnectionGeometry> geometry_;
         std::reference_wrapper<const Opm::Well>        well_;
         double                                         elapsed_{};
         Opm::RestartIO::InteHEAD::TimePoint            timeStamp_{};
@@ -1626,10 +1751,10 @@ namespace {
                                          const double                                 elapsed,
                                          const ::Opm::RestartIO::InteHEAD::TimePoint& timeStamp,
                                          const ::Opm::UnitSystem&                     usys,
-                                         const ::Opm::EclipseGrid&                    grid,
+                                         const ConnectionGeometry&                    geometry,
                                          const ::Opm::Well&                           well)
         : usys_     { std::cref(usys) }
-        , grid_     { std::cref(grid) }
+        , geometry_ { std::cref(geometry) }
         , well_     { std::cref(well) }
         , elapsed_  { elapsed         }
         , timeStamp_{ timeStamp       }
@@ -1655,8 +1780,11 @@ namespace {
 
     void WellRFTOutputData::addDynamicData(const Opm::data::Well& wellSol)
     {
+        // Connection results are shared between the RFT and PLT records.
+        const auto xcon = ConnectionResults { wellSol.connections };
+
         for (const auto& handler : this->dataHandlers_) {
-            handler(wellSol);
+            handler(wellSol, xcon);
         }
     }
 
@@ -1683,9 +1811,10 @@ namespace {
             (this->well_.get().getConnections().size());
 
         this->dataHandlers_.emplace_back(
-            [this]([[maybe_unused]] const Opm::data::Well& wellSol)
+            [this]([[maybe_unused]] const Opm::data::Well&   wellSol,
+                   [[maybe_unused]] const ConnectionResults& xcon)
         {
-            this->wconns_->collectRecordData(this->grid_, this->well_);
+            this->wconns_->collectRecordData(this->geometry_, this->well_);
         });
 
         this->recordWriters_.emplace_back(
@@ -1705,10 +1834,11 @@ namespace {
             (this->well_.get().getConnections().size());
 
         this->dataHandlers_.emplace_back(
-            [this](const Opm::data::Well& wellSol)
+            [this]([[maybe_unused]] const Opm::data::Well& wellSol,
+                   const ConnectionResults&                xcon)
         {
-            this->rft_->collectRecordData(this->usys_, this->grid_,
-                                          this->well_, wellSol);
+            this->rft_->collectRecordData(this->usys_, this->geometry_,
+                                          this->well_, xcon);
         });
 
         this->recordWriters_.emplace_back(
@@ -1731,10 +1861,11 @@ namespace {
             : std::make_unique<PLTRecord>   (well.getConnections().size());
 
         this->dataHandlers_.emplace_back(
-            [this](const Opm::data::Well& wellSol)
+            [this]([[maybe_unused]] const Opm::data::Well& wellSol,
+                   const ConnectionResults&                xcon)
         {
-            this->plt_->collectRecordData(this->usys_, this->grid_,
-                                          this->well_, wellSol);
+            this->plt_->collectRecordData(this->usys_, this->geometry_,
+                                          this->well_, xcon);
         });
 
         this->recordWriters_.emplace_back(
@@ -1756,7 +1887,8 @@ namespace {
             (well.getSegments().size());
 
         this->dataHandlers_.emplace_back(
-            [this](const Opm::data::Well& wellSol)
+            [this](const Opm::data::Well&                   wellSol,
+                   [[maybe_unused]] const ConnectionResults& xcon)
         {
             this->seg_->collectRecordData(this->usys_, this->well_, wellSol);
         });
@@ -1917,10 +2049,16 @@ void Opm::RftIO::write(const int                        reportStep,
     const auto timePoint = ::Opm::RestartIO::
         getSimulationTimePoint(schedule.getStartTime(), elapsed);
 
+    // Wells for which RFT file output is requested at this time and for
+    // which dynamic data is available.
+    auto rftTypes = std::vector<std::vector<WellRFTOutputData::DataTypes>>{};
+    auto wells = std::vector<const ::Opm::Well*>{};
+    auto xwells = std::vector<const ::Opm::data::Well*>{};
+
     for (const auto& wname : schedule.wellNames(reportStep)) {
-        const auto rftTypes = rftDataTypes(rftCfg, wname);
+        auto types = rftDataTypes(rftCfg, wname);
 
-        if (rftTypes.empty()) {
+        if (types.empty()) {
             // RFT file output not requested for 'wname' at this time.
             continue;
         }
@@ -1931,18 +2069,36 @@ void Opm::RftIO::write(const int                        reportStep,
             continue;
         }
 
-        // RFT file output requested for 'wname' at this time and dynamic
-        // data is available.  Collect requisite information.
-        auto rftOutput = WellRFTOutputData {
-            rftTypes, elapsed, timePoint, usys, grid,
-            schedule[reportStep].wells(wname)
-        };
+        rftTypes.push_back(std::move(types));
+        wells.push_back(&schedule[reportStep].wells(wname));
+        xwells.push_back(&xwPos->second);
+    }
+
+    if (wells.empty()) {
+        return;
+    }
+
+    const auto geometry = ConnectionGeometry { grid, wells };
+
+    // Collect requisite information for all wells, possibly concurrently.
+    // Records are self-contained and do not move once created since the
+    // record handlers refer to the record object.
+    auto rftOutput = std::vector<std::unique_ptr<WellRFTOutputData>>(wells.size());
+
+    ::Opm::parallelFor(wells.size(), minParallelWells,
+                       [&rftOutput, &rftTypes, &wells, &xwells,
+                        &geometry, &usys, elapsed, &timePoint](const std::size_t i)
+    {
+        rftOutput[i] = std::make_unique<WellRFTOutputData>
+            (rftTypes[i], elapsed, timePoint, usys, geometry, *wells[i]);
 
-        rftOutput.addDynamicData(xwPos->second);
+        rftOutput[i]->addDynamicData(*xwells[i]);
+    });
 
-        // Emit RFT file output record for 'wname'.  This transparently
-        // handles wells without connections--e.g., if the well is only
-        // connected in inactive/deactivated cells.
-        rftOutput.write(rftFile);
+    // Emit RFT file output records in well order.  This transparently
+    // handles wells without connections--e.g., if the well is only
+    // connected in inactive/deactivated cells.
+    for (const auto& output : rftOutput) {
+        output->write(rftFile);
     }
 }
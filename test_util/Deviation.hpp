@@ -20,6 +20,10 @@
 #ifndef DEVIATION_HPP
 #define DEVIATION_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
 /*! \brief Deviation struct.
     \details The member variables are default initialized to -1,
              which is an invalid deviation value.
@@ -29,4 +33,55 @@ struct Deviation {
     double rel = -1; //!< Relative deviation
 };
 
+/*! \brief Check whether any pair of values deviates beyond tolerances.
+    \details Uses the same criterion as ECLRegressionTest::deviationsForCell(),
+             i.e., a pair of values fails if the absolute deviation exceeds
+             \p absTol and either the relative deviation exceeds \p relTol
+             or exactly one of the values is zero.  Values are processed in
+             fixed size chunks with a branch-free inner loop that the compiler
+             can vectorise, and the scan stops at the first failing chunk.
+             Requires \p absTol to be non-negative.
+    \param[in] v1 First set of values.
+    \param[in] v2 Second set of values.
+    \param[in] n Number of values in \p v1 and \p v2.
+    \param[in] absTol Tolerance for absolute deviation.
+    \param[in] relTol Tolerance for relative deviation.
+    \return Whether or not at least one pair of values fails.
+ */
+template <typename T>
+bool exceedsTolerances(const T* v1, const T* v2, const std::size_t n,
+                       const double absTol, const double relTol)
+{
+    constexpr std::size_t chunkSize = 512;
+
+    for (std::size_t start = 0; start < n; start += chunkSize) {
+        const std::size_t end = std::min(n, start + chunkSize);
+
+        int fails = 0;
+#ifdef _OPENMP
+#pragma omp simd reduction(|:fails)
+#endif
+        for (std::size_t i = start; i < end; ++i) {
+            const double a = static_cast<double>(v1[i]);
+            const double b = static_cast<double>(v2[i]);
+
+            const double absDev = std::abs(a - b);
+            const double maxAbs = std::max(std::abs(a), std::abs(b));
+            const bool bothNonZero = (a != 0) && (b != 0);
+
+            // The division is only meaningful if both values are non-zero,
+            // but evaluating it unconditionally keeps the loop branch-free.
+            const bool relFails = !bothNonZero || (absDev / maxAbs > relTol);
+
+            fails |= static_cast<int>((absDev > absTol) && relFails);
+        }
+
+        if (fails != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 #endif
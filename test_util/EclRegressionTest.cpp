@@ -34,14 +34,20 @@
 #include <opm/common/utility/numeric/cmp.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <set>
+#include <span>
+#include <type_traits>
 #include <typeinfo>
 #include <unordered_set>
+#include <utility>
+#include <variant>
 #include <vector>
 
 // helper macro to handle error throws or not
@@ -76,6 +82,48 @@ std::vector<T> sorted(std::vector<T> v) {
     return v;
 }
 
+// Streams both arrays through fixed size buffers, so memory use is
+// bounded independently of array size, and stops at the first chunk
+// containing a deviation.
+template <typename T>
+bool withinTolerances(const Opm::EclIO::ArrayView<T>& v1,
+                      const Opm::EclIO::ArrayView<T>& v2,
+                      double absTol, double relTol)
+{
+    if (v1.size() != v2.size()) {
+        return false;
+    }
+
+    constexpr std::size_t chunkSize = 64 * 1024;
+    const std::size_t len = std::min(chunkSize, v1.size());
+
+    auto buf1 = std::make_unique<T[]>(len);
+    auto buf2 = std::make_unique<T[]>(len);
+
+    for (std::size_t first = 0; first < v1.size(); first += len) {
+        const auto n = v1.copy(first, std::span<T>{buf1.get(), len});
+        v2.copy(first, std::span<T>{buf2.get(), len});
+
+        if constexpr (std::is_floating_point_v<T>) {
+            if (exceedsTolerances(buf1.get(), buf2.get(), n, absTol, relTol)) {
+                return false;
+            }
+        } else if (!std::equal(buf1.get(), buf1.get() + n, buf2.get())) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void printElapsed(const std::string& fileName1, const std::string& fileName2,
+                  std::chrono::steady_clock::time_point start)
+{
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << fmt::format("\nCompared {} and {} in {:.3f} seconds\n",
+                             fileName1, fileName2, elapsed.count()) << std::endl;
+}
+
 }
 
 using namespace Opm::EclIO;
@@ -245,6 +293,88 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
 }
 
 
+bool ECLRegressionTest::screenable(const std::string& keyword, eclArrType type) const
+{
+    if (type != INTE && type != REAL && type != DOUB && type != LOGI) {
+        return false;
+    }
+
+    // DOUBHEAD[1] is exempt from comparison, and keywords disallowing
+    // negative values have additional checks.
+    if (keyword == "DOUBHEAD" ||
+        std::ranges::find(keywordDisallowNegatives, keyword) != keywordDisallowNegatives.end())
+    {
+        return false;
+    }
+
+    return getAbsTolerance() >= 0;
+}
+
+
+template <typename MakeViews>
+std::set<std::pair<int, std::string>>
+ECLRegressionTest::screenArrays(const std::vector<ScreenRequest>& requests, MakeViews&& makeViews) const
+{
+    using ViewPair = std::variant<std::monostate,
+                                  std::pair<ArrayView<int>, ArrayView<int>>,
+                                  std::pair<ArrayView<float>, ArrayView<float>>,
+                                  std::pair<ArrayView<double>, ArrayView<double>>,
+                                  std::pair<ArrayView<bool>, ArrayView<bool>>>;
+
+    // Views are created serially since the files are mapped on first use.
+    // Requests without views, e.g., for formatted files, are left to the
+    // detailed comparison.
+    std::vector<ViewPair> views(requests.size());
+
+    for (std::size_t i = 0; i < requests.size(); i++) {
+        try {
+            switch (requests[i].type) {
+            case INTE: views[i] = makeViews(int{}, requests[i]); break;
+            case REAL: views[i] = makeViews(float{}, requests[i]); break;
+            case DOUB: views[i] = makeViews(double{}, requests[i]); break;
+            case LOGI: views[i] = makeViews(bool{}, requests[i]); break;
+            default: break;
+            }
+        }
+        catch (const std::exception&) {
+            views[i] = std::monostate{};
+        }
+    }
+
+    std::vector<char> clean(requests.size(), 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < static_cast<int>(requests.size()); i++) {
+        const bool strictTol = std::ranges::find(keywordsStrictTol, requests[i].keyword)
+            != keywordsStrictTol.end();
+
+        // Same tolerances as in deviationsForCell().
+        const double absTol = strictTol ? strictAbsTol : getAbsTolerance();
+        const double relTol = strictTol ? strictAbsTol : getRelTolerance();
+
+        clean[i] = std::visit([absTol, relTol](const auto& viewPair) -> char
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(viewPair)>, std::monostate>) {
+                return 0;
+            } else {
+                return withinTolerances(viewPair.first, viewPair.second, absTol, relTol);
+            }
+        }, views[i]);
+    }
+
+    std::set<std::pair<int, std::string>> result;
+    for (std::size_t i = 0; i < requests.size(); i++) {
+        if (clean[i]) {
+            result.emplace(requests[i].seqnum, requests[i].keyword);
+        }
+    }
+
+    return result;
+}
+
+
 void ECLRegressionTest::printDeviationReport()
 {
     if (analysis) {
@@ -389,12 +519,14 @@ void ECLRegressionTest::loadGrids()
     if (foundEGrid1) {
         std::cout << "\nLoading EGrid " << fileName1 << "  .... ";
         grid1 = new EGrid(fileName1);
+        grid1->setMemoryBudget(memoryBudget);
         std::cout << " done." << std::endl;
     }
 
     if (foundEGrid2) {
         std::cout << "Loading EGrid " << fileName2 << "  .... ";
         grid2 = new EGrid(fileName2);
+        grid2->setMemoryBudget(memoryBudget);
         std::cout << " done." << std::endl;
     }
 
@@ -481,66 +613,13 @@ void ECLRegressionTest::gridCompare()
 
         std::cout << "X, Y and Z coordinates " << " ... ";
 
-        std::array<double,8> X1 = {0.0};
-        std::array<double,8> Y1 = {0.0};
-        std::array<double,8> Z1 = {0.0};
-
-        std::array<double,8> X2 = {0.0};
-        std::array<double,8> Y2 = {0.0};
-        std::array<double,8> Z2 = {0.0};
-
-        for (int k = 0; k < dim1[2]; k++) {
-            for (int j = 0; j < dim1[1]; j++) {
-                for (int i = 0; i < dim1[0]; i++) {
-                    if (grid1->active_index(i,j,k) > -1) {
-                        grid1->getCellCorners({i,j,k}, X1, Y1, Z1);
-                        grid2->getCellCorners({i,j,k}, X2, Y2, Z2);
-
-                        for (int n = 0; n < 8; n++) {
-                            Deviation devX = calculateDeviations(X1[n], X2[n]);
-                            Deviation devY = calculateDeviations(Y1[n], Y2[n]);
-                            Deviation devZ = calculateDeviations(Z1[n], Z2[n]);
-
-                            if (devX.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["xcoordinate"].push_back(devX);
-                                } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different X coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
-                                }
-                            }
-
-                            if (devY.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["ycoordinate"].push_back(devY);
-                                } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different Y coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
-                                }
-                            }
-
-                            if (devZ.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["zcoordinate"].push_back(devZ);
-                                } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different Z coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+        if (identicalGeometry()) {
+            // Same corners for all cells, no need to load the arrays.
+            std::cout << " done." << std::endl;
+        } else {
+            compareCellCorners(dim1);
         }
 
-        std::cout << " done." << std::endl;
-
         std::cout << "NNC indices            " << " ... ";
 
         // check / compare NNC definitions
@@ -596,6 +675,91 @@ void ECLRegressionTest::gridCompare()
 }
 
 
+bool ECLRegressionTest::identicalGeometry() const
+{
+    // Identical ACTNUM has been established by the caller.  Corners are
+    // computed from COORD and ZCORN only, so bitwise identical arrays give
+    // identical corners without visiting every cell.
+    try {
+        for (const auto* name : {"COORD", "ZCORN"}) {
+            if (!withinTolerances(grid1->getView<float>(name), grid2->getView<float>(name), 0.0, 0.0)) {
+                return false;
+            }
+        }
+    }
+    catch (const std::exception&) {
+        // Formatted grid files cannot be viewed.
+        return false;
+    }
+
+    return true;
+}
+
+
+void ECLRegressionTest::compareCellCorners(const std::array<int, 3>& dim)
+{
+    std::array<double,8> X1 = {0.0};
+    std::array<double,8> Y1 = {0.0};
+    std::array<double,8> Z1 = {0.0};
+
+    std::array<double,8> X2 = {0.0};
+    std::array<double,8> Y2 = {0.0};
+    std::array<double,8> Z2 = {0.0};
+
+    for (int k = 0; k < dim[2]; k++) {
+        for (int j = 0; j < dim[1]; j++) {
+            for (int i = 0; i < dim[0]; i++) {
+                if (grid1->active_index(i,j,k) > -1) {
+                    grid1->getCellCorners({i,j,k}, X1, Y1, Z1);
+                    grid2->getCellCorners({i,j,k}, X2, Y2, Z2);
+
+                    for (int n = 0; n < 8; n++) {
+                        Deviation devX = calculateDeviations(X1[n], X2[n]);
+                        Deviation devY = calculateDeviations(Y1[n], Y2[n]);
+                        Deviation devZ = calculateDeviations(Z1[n], Z2[n]);
+
+                        if (devX.abs > strictAbsTol) {
+                            if (analysis) {
+                                deviations["xcoordinate"].push_back(devX);
+                            } else {
+                                OPM_THROW(std::runtime_error,
+                                          fmt::format("\nGrid1 and grid2 have different X coordinates. "
+                                                      "First difference found for cell i={} j={} k={}",
+                                                      i+1, j+1, k+1));
+                            }
+                        }
+
+                        if (devY.abs > strictAbsTol) {
+                            if (analysis) {
+                                deviations["ycoordinate"].push_back(devY);
+                            } else {
+                                OPM_THROW(std::runtime_error,
+                                          fmt::format("\nGrid1 and grid2 have different Y coordinates. "
+                                                      "First difference found for cell i={} j={} k={}",
+                                                      i+1, j+1, k+1));
+                            }
+                        }
+
+                        if (devZ.abs > strictAbsTol) {
+                            if (analysis) {
+                                deviations["zcoordinate"].push_back(devZ);
+                            } else {
+                                OPM_THROW(std::runtime_error,
+                                          fmt::format("\nGrid1 and grid2 have different Z coordinates. "
+                                                      "First difference found for cell i={} j={} k={}",
+                                                      i+1, j+1, k+1));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout << " done." << std::endl;
+}
+
+
 void ECLRegressionTest::results_init()
 {
     std::string fileName1, fileName2;
@@ -610,6 +774,8 @@ void ECLRegressionTest::results_init()
     }
 
     if (foundInit1 && foundInit2) {
+        const auto start = std::chrono::steady_clock::now();
+
         EclFile init1(fileName1);
         std::cout << "\nLoading INIT file " << fileName1 << "  .... done" << std::endl;
 
@@ -618,8 +784,10 @@ void ECLRegressionTest::results_init()
 
         deviations.clear();
 
-        init1.loadData();
-        init2.loadData();
+        // Arrays are loaded on demand, and only if the screening pass
+        // cannot rule out deviations.
+        init1.setMemoryBudget(memoryBudget);
+        init2.setMemoryBudget(memoryBudget);
 
         auto arrayList1 = init1.getList();
         auto arrayList2 = init2.getList();
@@ -672,6 +840,26 @@ void ECLRegressionTest::results_init()
                 checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
             }
 
+            std::vector<ScreenRequest> requests;
+            for (size_t i = 0; i < keywords1.size(); i++) {
+                const auto it2 = std::ranges::find(keywords2, keywords1[i]);
+                if (it2 != keywords2.end() &&
+                    arrayType2[std::distance(keywords2.begin(), it2)] == arrayType1[i] &&
+                    std::ranges::find(keywordsBlackList, keywords1[i]) == keywordsBlackList.end() &&
+                    screenable(keywords1[i], arrayType1[i]))
+                {
+                    requests.push_back({keywords1[i], 0, arrayType1[i]});
+                }
+            }
+
+            const auto screened = screenArrays(requests,
+                [&init1, &init2](auto tag, const ScreenRequest& request)
+            {
+                using T = decltype(tag);
+                return std::pair { init1.getView<T>(request.keyword),
+                                   init2.getView<T>(request.keyword) };
+            });
+
             for (size_t i = 0; i < keywords1.size(); i++) {
                 const auto it1 = std::ranges::find(keywords2, keywords1[i]);
                 if (it1 == keywords2.end() && acceptExtraKeywordsBoth) {
@@ -694,7 +882,9 @@ void ECLRegressionTest::results_init()
                 } else {
                     std::cout << "Comparing " << keywords1[i] << " ... ";
 
-                    if (arrayType1[i] == INTE) {
+                    if (screened.contains({0, keywords1[i]})) {
+                        // Within tolerances, no need to load the arrays.
+                    } else if (arrayType1[i] == INTE) {
                         auto vect1 = init1.get<int>(keywords1[i]);
                         auto vect2 = init2.get<int>(keywords2[ind2]);
                         compareVectors(vect1, vect2, keywords1[i],reference);
@@ -728,6 +918,8 @@ void ECLRegressionTest::results_init()
             if (!deviations.empty()) {
                 printDeviationReport();
             }
+
+            printElapsed(fileName1, fileName2, start);
         }
     } else {
         std::cout << "\n!Warning, init files not found, hence not compared. \n" << std::endl;
@@ -749,12 +941,19 @@ void ECLRegressionTest::results_rst()
     }
 
     if (foundRst1 && foundRst2) {
+        const auto start = std::chrono::steady_clock::now();
+
         auto rst1 = std::make_shared<ERst>(fileName1);
         std::cout << "\nLoading restart file " << fileName1 << "  .... done" << std::endl;
 
         auto rst2 = std::make_shared<ERst>(fileName2);
         std::cout << "Loading restart file " << fileName2 << "  .... done\n" << std::endl;
 
+        // Arrays are loaded on demand, and only if the screening pass
+        // cannot rule out deviations.
+        rst1->setMemoryBudget(memoryBudget);
+        rst2->setMemoryBudget(memoryBudget);
+
         std::vector<int> seqnums1 = rst1->listOfReportStepNumbers();
         std::vector<int> seqnums2 = rst2->listOfReportStepNumbers();
 
@@ -812,14 +1011,56 @@ void ECLRegressionTest::results_rst()
             OPM_THROW(std::runtime_error, "\nRestart files not having the same report steps: ");
         }
 
+        // Screen the arrays of all report steps in one parallel pass.  The
+        // keyword checks below are applied per report step as before.
+        std::set<std::pair<int, std::string>> screened;
+
+        if (!printKeywordOnly) {
+            std::vector<ScreenRequest> requests;
+
+            for (const int seqn : seqnums1) {
+                const auto arrays2 = rst2->listOfRstArrays(seqn);
+                std::unordered_set<std::string> seen;
+
+                for (const auto& [name, type, size] : rst1->listOfRstArrays(seqn)) {
+                    if (!seen.insert(name).second) {
+                        continue;
+                    }
+
+                    if (!specificKeyword.empty() && name != specificKeyword) {
+                        continue;
+                    }
+
+                    if (integrationTest && name != "PRESSURE" && name != "SWAT" && name != "SGAS") {
+                        continue;
+                    }
+
+                    const auto it2 = std::ranges::find_if(arrays2, [&name](const auto& array)
+                                                          { return std::get<0>(array) == name; });
+
+                    if (it2 != arrays2.end() && std::get<1>(*it2) == type &&
+                        std::ranges::find(keywordsBlackList, name) == keywordsBlackList.end() &&
+                        screenable(name, type))
+                    {
+                        requests.push_back({name, seqn, type});
+                    }
+                }
+            }
+
+            screened = screenArrays(requests,
+                [&rst1, &rst2](auto tag, const ScreenRequest& request)
+            {
+                using T = decltype(tag);
+                return std::pair { rst1->getRestartView<T>(request.keyword, request.seqnum),
+                                   rst2->getRestartView<T>(request.keyword, request.seqnum) };
+            });
+        }
+
         for (int& seqn : seqnums1) {
             std::cout << "\nUnified restart files, sequence  " << std::to_string(seqn) << "\n" << std::endl;
 
             std::string reference = "Restart, sequence "+std::to_string(seqn);
 
-            rst1->loadReportStepNumber(seqn);
-            rst2->loadReportStepNumber(seqn);
-
             auto arrays1 = rst1->listOfRstArrays(seqn);
             auto arrays2 = rst2->listOfRstArrays(seqn);
 
@@ -840,6 +1081,8 @@ void ECLRegressionTest::results_rst()
 
             if (integrationTest) {
                 std::vector<std::string> keywords;
+                std::vector<eclArrType> types1;
+                std::vector<eclArrType> types2;
 
                 for (size_t i = 0; i < keywords1.size(); i++) {
                     if (keywords1[i] == "PRESSURE" ||
@@ -849,6 +1092,8 @@ void ECLRegressionTest::results_rst()
                         const auto search2 = std::ranges::find(keywords2, keywords1[i]);
                         if (search2 != keywords2.end()) {
                             keywords.push_back(keywords1[i]);
+                            types1.push_back(arrayType1[i]);
+                            types2.push_back(arrayType2[std::distance(keywords2.begin(), search2)]);
                         }
                         else if (acceptExtraKeywordsBoth) {
                             continue;
@@ -856,11 +1101,11 @@ void ECLRegressionTest::results_rst()
                     }
                 }
 
+                // Compared with their own types, so that DOUB arrays
+                // are screened and compared as double.
                 keywords1 = keywords2 = keywords;
-
-                int nKeys = keywords.size();
-                arrayType1.assign(nKeys, REAL);
-                arrayType2.assign(nKeys, REAL);
+                arrayType1 = std::move(types1);
+                arrayType2 = std::move(types2);
             }
 
             if (printKeywordOnly) {
@@ -899,7 +1144,9 @@ void ECLRegressionTest::results_rst()
 
                         std::cout << "Comparing " << keywords1[i] << " ... ";
 
-                        if (arrayType1[i] == INTE) {
+                        if (screened.contains({seqn, keywords1[i]})) {
+                            // Within tolerances, no need to load the arrays.
+                        } else if (arrayType1[i] == INTE) {
                             auto vect1 = rst1->getRestartData<int>(keywords1[i], seqn, 0);
                             auto vect2 = rst2->getRestartData<int>(keywords2[ind2], seqn, 0);
                             compareVectors(vect1, vect2, keywords1[i], reference);
@@ -941,6 +1188,8 @@ void ECLRegressionTest::results_rst()
         if (!deviations.empty()) {
             printDeviationReport();
         }
+
+        printElapsed(fileName1, fileName2, start);
     } else {
         std::cout << "\n!Warning, restart files not found, hence not compared. \n" << std::endl;
     }
@@ -961,6 +1210,8 @@ void ECLRegressionTest::results_smry()
     }
 
     if (foundSmspec1 && foundSmspec2) {
+        const auto start = std::chrono::steady_clock::now();
+
         ESmry smry1(fileName1, loadBaseRunData);
         smry1.loadData();
         std::cout << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
@@ -1089,6 +1340,8 @@ void ECLRegressionTest::results_smry()
             if (!deviations.empty()) {
                 printDeviationReport();
             }
+
+            printElapsed(fileName1, fileName2, start);
         }
 
     } else {
@@ -1143,12 +1396,19 @@ void ECLRegressionTest::results_rft()
     }
 
     if (foundRft1 && foundRft2) {
+        const auto start = std::chrono::steady_clock::now();
+
         ERft rft1(fileName1);
         std::cout << "\nLoading rft file " << fileName1 << "  .... done" << std::endl;
 
         ERft rft2(fileName2);
         std::cout << "Loading rft file " << fileName2 << "  .... done\n" << std::endl;
 
+        // Arrays are loaded on demand, and only if the screening pass
+        // cannot rule out deviations.
+        rft1.setMemoryBudget(memoryBudget);
+        rft2.setMemoryBudget(memoryBudget);
+
         auto rftReportList1 = rft1.listOfRftReports();
         auto rftReportList2 = rft2.listOfRftReports();
 
@@ -1176,7 +1436,42 @@ void ECLRegressionTest::results_rft()
             OPM_THROW(std::runtime_error, "\nNot same RFTs in in RFT file ");
         }
 
-        for (auto& report : rftReportList2) {
+        // Screen the arrays of all RFTs in one parallel pass, identifying
+        // each RFT by its position in the report list.
+        std::set<std::pair<int, std::string>> screened;
+
+        if (!printKeywordOnly) {
+            std::vector<ScreenRequest> requests;
+
+            for (std::size_t reportIndex = 0; reportIndex < rftReportList2.size(); reportIndex++) {
+                const auto& [well, date, time] = rftReportList2[reportIndex];
+                const auto arrays2 = rft2.listOfRftArrays(well, date);
+
+                for (const auto& [name, type, size] : rft1.listOfRftArrays(well, date)) {
+                    const auto it2 = std::ranges::find_if(arrays2, [&name](const auto& array)
+                                                          { return std::get<0>(array) == name; });
+
+                    if (it2 != arrays2.end() && std::get<1>(*it2) == type &&
+                        std::ranges::find(keywordsBlackList, name) == keywordsBlackList.end() &&
+                        screenable(name, type))
+                    {
+                        requests.push_back({name, static_cast<int>(reportIndex), type});
+                    }
+                }
+            }
+
+            screened = screenArrays(requests,
+                [&rft1, &rft2, &rftReportList2](auto tag, const ScreenRequest& request)
+            {
+                using T = decltype(tag);
+                const auto& [well, date, time] = rftReportList2[request.seqnum];
+                return std::pair { rft1.getRftView<T>(request.keyword, well, date),
+                                   rft2.getRftView<T>(request.keyword, well, date) };
+            });
+        }
+
+        for (std::size_t reportIndex = 0; reportIndex < rftReportList2.size(); reportIndex++) {
+            const auto& report = rftReportList2[reportIndex];
             std::string well =  std::get<0>(report);
             std::tuple<int, int, int> date =  std::get<1>(report);
 
@@ -1223,7 +1518,9 @@ void ECLRegressionTest::results_rft()
                     } else {
                         std::cout << "Comparing: " << keyword << " ... ";
 
-                        if (arrayType == INTE) {
+                        if (screened.contains({static_cast<int>(reportIndex), keyword})) {
+                            // Within tolerances, no need to load the arrays.
+                        } else if (arrayType == INTE) {
                             auto vect1 = rft1.getRft<int>(keyword, well, date);
                             auto vect2 = rft2.getRft<int>(keyword, well, date);
                             compareVectors(vect1, vect2, keyword, reference);
@@ -1260,6 +1557,8 @@ void ECLRegressionTest::results_rft()
         if (!deviations.empty()) {
             printDeviationReport();
         }
+
+        printElapsed(fileName1, fileName2, start);
     } else {
         std::cout << "\n!Warning, rft files not found, hence not compared. \n" << std::endl;
     }
@@ -24,6 +24,13 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <array>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace Opm { namespace EclIO {
     class EGrid;
 }}
@@ -52,6 +59,9 @@ public:
 
     ~ECLRegressionTest();
 
+    //! \brief Default memory budget, see setMemoryBudget().
+    static constexpr std::size_t defaultMemoryBudget = std::size_t{1} << 30;
+
     //! \brief Option to only compare last occurrence
     void setOnlyLastReportNumber(bool onlyLastSequenceArg) {
         this->onlyLastSequence = onlyLastSequenceArg;
@@ -95,6 +105,15 @@ public:
         this->loadBaseRunData = loadArg;
     }
 
+    //! \brief Upper limit, in bytes, of array data kept in memory per EGRID, INIT, restart or RFT file.
+    //! \details Summary files are not covered.  Their vectors are stored as one PARAMS
+    //!          record per time step rather than as contiguous arrays, so they can be
+    //!          neither viewed nor evicted vector by vector, and they are small
+    //!          compared with the other result files.
+    void setMemoryBudget(std::size_t bytes) {
+        this->memoryBudget = bytes;
+    }
+
     void loadGrids();
     void printDeviationReport();
 
@@ -150,6 +169,36 @@ private:
                            const std::string& reference, size_t kw_size, size_t cell,
                            bool allowNegativeValues, bool useStrictTol);
 
+    // Pair of arrays, identified by keyword and report step, to be checked
+    // in the parallel screening pass.
+    struct ScreenRequest {
+        std::string keyword;
+        int seqnum;
+        EIOD::eclArrType type;
+    };
+
+    // Whether or not the arrays of a keyword can be compared in the
+    // parallel screening pass.  Arrays requiring special treatment in the
+    // detailed comparison are excluded.
+    bool screenable(const std::string& keyword, EIOD::eclArrType type) const;
+
+    // Compares the requested pairs of arrays in parallel, without loading
+    // them, and returns (seqnum, keyword) of those pairs which are known to
+    // be within tolerances.  All other pairs must go through the detailed
+    // comparison.  makeViews(T{}, request) returns the pair of array views
+    // for a request with element type T.
+    template <typename MakeViews>
+    std::set<std::pair<int, std::string>>
+    screenArrays(const std::vector<ScreenRequest>& requests, MakeViews&& makeViews) const;
+
+    // Whether or not the COORD and ZCORN arrays of the two grids are
+    // identical, checked without loading them.  False if the arrays
+    // cannot be viewed.
+    bool identicalGeometry() const;
+
+    // Compares the corner coordinates of all active cells.
+    void compareCellCorners(const std::array<int, 3>& dim);
+
     template <typename T>
     void deviationsForNonFloatingPoints(T val1, T val2, const std::string& keyword,
                                         const std::string& reference,
@@ -183,6 +232,9 @@ private:
 
     bool loadBaseRunData = false;
 
+    // Upper limit of array data kept in memory per EGRID, INIT, restart or RFT file.
+    std::size_t memoryBudget = defaultMemoryBudget;
+
     // specific keyword to be compared
     std::string specificKeyword;
 
@@ -21,6 +21,8 @@
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdlib>
 #include <filesystem>
 #include <getopt.h>
 #include <iostream>
@@ -42,6 +44,10 @@ static void printHelp() {
               << "   The integration test compares SGAS, SWAT and PRESSURE in unified restart files, and WOPR, WGPR, WWPR and WBHP (all wells) in summary file. \n"
               << "-k Specify specific keyword to compare (capitalized), for examples -k PRESSURE or -k WOPR:A-1H \n"
               << "-l Only do comparison for the last Report Step. This option is only valid for restart files.\n"
+              << "-m Memory budget in MiB for array data kept in memory per EGRID, INIT, restart or RFT file (default "
+              << ECLRegressionTest::defaultMemoryBudget / (1024 * 1024) << ").\n"
+              << "   Arrays are loaded on demand and the least recently used arrays are released when the budget is exceeded.\n"
+              << "   Summary files are always loaded completely.\n"
               << "-n Do not throw on errors.\n"
               << "-p Print keywords in both cases and exit.\n"
               << "-r compare a specific report time step number in a restart file.\n"
@@ -94,9 +100,10 @@ int main(int argc, char** argv) {
     char* keyword                  = nullptr;
     int c                          = 0;
     int reportStepNumber           = -1;
+    std::size_t memoryBudget       = ECLRegressionTest::defaultMemoryBudget;
     std::string fileTypeString;
 
-    while ((c = getopt(argc, argv, "hik:alnpt:Rr:xdy")) != -1) {
+    while ((c = getopt(argc, argv, "hik:alm:npt:Rr:xdy")) != -1) {
         switch (c) {
         case 'a':
             analysis = true;
@@ -118,6 +125,13 @@ int main(int argc, char** argv) {
         case 'l':
             onlyLastSequence = true;
             break;
+        case 'm':
+            memoryBudget = std::strtoull(optarg, nullptr, 10) * 1024 * 1024;
+            if (memoryBudget == 0) {
+                std::cerr << "Option m requires a positive memory budget in MiB as argument, see manual (-h) for more information." << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
         case 'n':
             throwOnError = false;
             break;
@@ -142,7 +156,11 @@ int main(int argc, char** argv) {
             acceptExtraKeywordsBoth = true;
             break;
         case '?':
-            if (optopt == 'k' || optopt == 'm' || optopt == 's') {
+            if (optopt == 'm') {
+                std::cerr << "Option m requires a memory budget in MiB as argument, see manual (-h) for more information." << std::endl;
+                return EXIT_FAILURE;
+            }
+            else if (optopt == 'k' || optopt == 's') {
                 std::cerr << "Option " << optopt << " requires a keyword as argument, see manual (-h) for more information." << std::endl;
                 return EXIT_FAILURE;
             }
@@ -186,6 +204,7 @@ int main(int argc, char** argv) {
         comparator.doAnalysis(analysis);
         comparator.setAcceptExtraKeywords(acceptExtraKeywords);
         comparator.setAcceptExtraKeywordsBoth(acceptExtraKeywordsBoth);
+        comparator.setMemoryBudget(memoryBudget);
 
         if (integrationTest) {
             comparator.setIntegrationTest(true);
@@ -27,14 +27,23 @@
 
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <cstddef>
 #include <ctime>
+#include <exception>
 #include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <getopt.h>
 
@@ -44,11 +53,26 @@ using EclEntry = EclFile::EclEntry;
 
 namespace {
 
+// Arrays are loaded one at a time as they are written.  Limit the amount
+// of array data kept in memory, so that only the array currently being
+// converted is held once the limit is reached.
+constexpr std::size_t streamingMemoryBudget = std::size_t{64} * 1024 * 1024;
+
+struct Options
+{
+    int reportStepNumber = -1;
+    bool specificReportStepNumber = false;
+    bool listProperties = false;
+    bool enforce_ix_output = false;
+    bool to_grdecl = false;
+    std::string output_fname{};
+};
+
 template <typename T>
 void write(EclOutput& outFile, EclFile& file1,
            const std::string& name, int index)
 {
-    auto vect = file1.get<T>(index);
+    const auto& vect = file1.get<T>(index);
     outFile.write(name, vect);
 }
 
@@ -57,7 +81,7 @@ template<typename T>
 void write(EclOutput& outFile, ERst& file1,
            const std::string& name, int index, int reportStepNumber)
 {
-    auto vect = file1.getRestartData<T>(index, reportStepNumber);
+    const auto& vect = file1.getRestartData<T>(index, reportStepNumber);
     outFile.write(name, vect);
 }
 
@@ -65,7 +89,7 @@ template<typename T>
 void write(EclOutput& outFile, ERst& file1,
            const std::string& name, int index)
 {
-    auto vect = file1.get<T>(index);
+    const auto& vect = file1.get<T>(index);
     outFile.write(name, vect);
 }
 
@@ -88,8 +112,7 @@ void writeArray(std::string name, eclArrType arrType, T& file1, int index, EclOu
     } else if (arrType == MESS) {
         outFile.message(name);
     } else {
-        std::cout << "unknown array type " << std::endl;
-        exit(1);
+        throw std::runtime_error("unknown array type for array " + name);
     }
 }
 
@@ -110,15 +133,14 @@ void writeArray(std::string name, eclArrType arrType, T& file1, int index, int r
     } else if (arrType == MESS) {
         outFile.message(name);
     } else {
-        std::cout << "unknown array type " << std::endl;
-        exit(1);
+        throw std::runtime_error("unknown array type for array " + name);
     }
 }
 
 
 void writeC0nnArray(const std::string& name, int elementSize, EclFile& file1, int index, EclOutput& outFile)
 {
-    auto vect = file1.get<std::string>(index);
+    const auto& vect = file1.get<std::string>(index);
     outFile.write(name, vect, elementSize);
 }
 
@@ -139,7 +161,7 @@ void writeArrayList(std::vector<EclEntry>& arrayList,
     }
 }
 
-void writeArrayList(std::vector<EclEntry>& arrayList, ERst file1, int reportStepNumber, EclOutput& outFile) {
+void writeArrayList(std::vector<EclEntry>& arrayList, ERst& file1, int reportStepNumber, EclOutput& outFile) {
 
     for (size_t index = 0; index < arrayList.size(); index++) {
         std::string name = std::get<0>(arrayList[index]);
@@ -180,6 +202,7 @@ void listReportSteps(const std::string& filename)
 void printHelp() {
 
     std::cout << "\nconvertECL needs one argument which is the input file to be converted. If this is a binary file the output file will be formatted. If the input file is formatted the output will be binary. \n"
+              << "\nSeveral input files, for instance separate restart files (*.X0001, *.X0002, ...), may be given. These are converted in parallel.\n"
               << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
               << "-h Print help and exit.\n"
               << "-l List report step numbers in the selected restart file.\n"
@@ -189,20 +212,21 @@ void printHelp() {
               << "-r Extract and convert a specific report time step number from a unified restart file. \n\n";
 }
 
-void logConvert(const bool stdoutIsTerminal,
+void logConvert(std::ostream& out,
+                const bool stdoutIsTerminal,
                 std::string_view sourceFile,
                 std::string_view resultFile)
 {
     const auto colourOn  = stdoutIsTerminal ? std::string_view { "\033[1;31m" } : std::string_view {};
     const auto colourOff = stdoutIsTerminal ? std::string_view { "\033[0m"    } : std::string_view {};
 
-    std::cout << colourOn
-              << "\nconverting  "
-              << sourceFile << " -> " << resultFile
-              << colourOff
-              << "\n\n";
+    out << colourOn
+        << "\nconverting  "
+        << sourceFile << " -> " << resultFile
+        << colourOff
+        << "\n\n";
 
-    std::cout.flush();
+    out.flush();
 }
 
 struct GrdeclDataFormatParams
@@ -264,8 +288,7 @@ void open_grdecl_output(const std::string& output_fname, const std::string& inpu
         grdeclfile.replace_extension(".grdecl");
 
         if (std::filesystem::exists(grdeclfile)) {
-            std::cout << "\nError, cant make grdecl file " << grdeclfile.string() << ". File exists \n";
-            exit(1);
+            throw std::runtime_error("cant make grdecl file " + grdeclfile.string() + ". File exists");
         }
 
         ofileH.open(grdeclfile, std::ios::out);
@@ -276,30 +299,22 @@ void open_grdecl_output(const std::string& output_fname, const std::string& inpu
 
         if (path.empty() || std::filesystem::exists(path)) {
             if (std::filesystem::exists(grdeclfile)) {
-                std::cout << "\nError, cant make grdecl file " << grdeclfile.string() << ". File exists \n";
-                exit(1);
+                throw std::runtime_error("cant make grdecl file " + grdeclfile.string() + ". File exists");
             }
         }
         else {
-            std::cout << "\n!Error, output directory : '" << path.string() << "' doesn't exist \n";
-            exit(1);
+            throw std::runtime_error("output directory : '" + path.string() + "' doesn't exist");
         }
 
         ofileH.open(grdeclfile.string(), std::ios::out);
     }
 }
 
-} // Anonymous namespace
-
-int main(int argc, char **argv)
+void convertFile(const std::string& filename,
+                 const Options& opts,
+                 const bool stdoutIsTerminal,
+                 std::ostream& out)
 {
-    int c                          = 0;
-    int reportStepNumber           = -1;
-    bool specificReportStepNumber  = false;
-    bool listProperties            = false;
-    bool enforce_ix_output         = false;
-    bool to_grdecl                 = false;
-
     const std::map<std::string, std::string> to_formatted {
         {".EGRID" , ".FEGRID" },
         {".ESMRY" , ".FESMRY" },
@@ -328,45 +343,12 @@ int main(int argc, char **argv)
         {".FUNSMRY", ".UNSMRY"},
     };
 
-    std::string output_fname{};
-    while ((c = getopt(argc, argv, "hr:ligo:")) != -1) {
-        switch (c) {
-        case 'h':
-            printHelp();
-            return 0;
-        case 'l':
-            listProperties = true;
-            break;
-        case 'g':
-            to_grdecl = true;
-            break;
-        case 'i':
-            enforce_ix_output = true;
-            break;
-        case 'r':
-            specificReportStepNumber = true;
-            reportStepNumber = atoi(optarg);
-            break;
-        case 'o':
-            output_fname = optarg;
-            break;
-        default:
-            return EXIT_FAILURE;
-        }
-    }
-
-    int argOffset = optind;
-
-    if (!output_fname.empty() && !to_grdecl) {
-        std::cout << "\n!Error, option -o only valid whit option -g \n\n";
-        exit(1);
-    }
-
     // start reading
     const auto start = std::chrono::system_clock::now();
-    const auto filename = std::string { argv[argOffset] };
 
     EclFile file1(filename);
+    file1.setMemoryBudget(streamingMemoryBudget);
+
     bool formattedOutput = file1.formattedInput() ? false : true;
 
     int p = filename.find_last_of(".");
@@ -379,59 +361,46 @@ int main(int argc, char **argv)
     std::string resFile;
 
 
-    if (to_grdecl) {
+    if (opts.to_grdecl) {
         auto array_list = file1.getList();
-        file1.loadData();
 
         auto start_g = std::chrono::system_clock::now();
 
         std::ofstream ofileH;
-        open_grdecl_output(output_fname, filename, ofileH);
+        open_grdecl_output(opts.output_fname, filename, ofileH);
 
         for (size_t n = 0; n < array_list.size(); n ++) {
             std::string name = std::get<0>(array_list[n]);
             auto arr_type = std::get<1>(array_list[n]);
 
             if (arr_type == Opm::EclIO::REAL) {
-                auto  data = file1.get<float>(n);
+                const auto& data = file1.get<float>(n);
                 writeGrdeclData(ofileH, name, data);
              } else if (arr_type == Opm::EclIO::DOUB) {
-                auto  data = file1.get<double>(n);
+                const auto& data = file1.get<double>(n);
                 writeGrdeclData(ofileH, name, data);
             } else if (arr_type == Opm::EclIO::INTE) {
-                auto  data = file1.get<int>(n);
+                const auto& data = file1.get<int>(n);
                 writeGrdeclData(ofileH, name, data);
             } else if (arr_type == Opm::EclIO::CHAR) {
-                auto  data = file1.get<std::string>(n);
+                const auto& data = file1.get<std::string>(n);
                 writeGrdeclData(ofileH, name, data);
             } else if (arr_type == Opm::EclIO::LOGI) {
-                std::cout << "\n!Warning, skipping array '" << name << " of type LOGI \n";
+                out << "\n!Warning, skipping array '" << name << " of type LOGI \n";
             } else if (arr_type == Opm::EclIO::C0NN) {
-                std::cout << "\n!Warning, skipping array '" << name << " of type C0NN \n";
+                out << "\n!Warning, skipping array '" << name << " of type C0NN \n";
             } else {
-                std::cout << "unknown data type for array " << name << std::endl;
-                exit(1);
+                throw std::runtime_error("unknown data type for array " + name);
             }
         }
 
         auto end_g = std::chrono::system_clock::now();
         std::chrono::duration<double> elapsed_seconds = end_g-start_g;
 
-        std::cout << "\nruntime writing grdecl file : " << elapsed_seconds.count() << " seconds\n" << std::endl;
-
-        std::cout << std::endl;
-        return 0;
-    }
-
-    if (listProperties) {
-        if (extension != ".UNRST") {
-            std::cerr << "\n!ERROR, option -l available only for unified restart files (*.UNRST)" << std::endl;
-            exit(1);
-        }
-
-        listReportSteps(filename);
+        out << "\nruntime writing grdecl file : " << elapsed_seconds.count() << " seconds\n" << std::endl;
 
-        return 0;
+        out << std::endl;
+        return;
     }
 
     if (formattedOutput) {
@@ -446,8 +415,7 @@ int main(int argc, char **argv)
             resFile = rootN + ".A" + extension.substr(2);
         }
         else {
-            std::cout << "\n!ERROR, unknown file type for input file '" << rootN + extension << "'\n" << std::endl;
-            exit(1);
+            throw std::runtime_error("unknown file type for input file '" + rootN + extension + "'");
         }
     }
     else {
@@ -462,40 +430,36 @@ int main(int argc, char **argv)
             resFile = rootN + ".S" + extension.substr(2);
         }
         else {
-            std::cout << "\n!ERROR, unknown file type for input file '" << rootN + extension << "'\n" << std::endl;
-            exit(1);
+            throw std::runtime_error("unknown file type for input file '" + rootN + extension + "'");
         }
     }
 
-    logConvert(Opm::OpmLog::stdoutIsTerminal(), argv[argOffset], resFile);
+    logConvert(out, stdoutIsTerminal, filename, resFile);
 
     EclOutput outFile(resFile, formattedOutput);
 
-    if (file1.is_ix() || enforce_ix_output) {
-        std::cout << "setting IX flag on output file \n";
+    if (file1.is_ix() || opts.enforce_ix_output) {
+        out << "setting IX flag on output file \n";
         outFile.set_ix();
     }
 
-    if (specificReportStepNumber) {
+    if (opts.specificReportStepNumber) {
         if (extension != ".UNRST") {
-            std::cout << "\n!ERROR, option -r only can only be used with unified restart files (*.UNRST) " << std::endl;
-            exit(1);
+            throw std::runtime_error("option -r only can only be used with unified restart files (*.UNRST)");
         }
 
         ERst rst1(filename);
+        rst1.setMemoryBudget(streamingMemoryBudget);
 
-        if (!rst1.hasReportStepNumber(reportStepNumber)) {
-            std::cout << "\n!ERROR, selected unified restart file doesn't have report step number " << reportStepNumber << "\n" << std::endl;
-            exit(1);
+        if (!rst1.hasReportStepNumber(opts.reportStepNumber)) {
+            throw std::runtime_error("selected unified restart file doesn't have report step number "
+                                     + std::to_string(opts.reportStepNumber));
         }
 
-        rst1.loadReportStepNumber(reportStepNumber);
-
-        auto arrayList = rst1.listOfRstArrays(reportStepNumber);
-        writeArrayList(arrayList, rst1, reportStepNumber, outFile);
+        auto arrayList = rst1.listOfRstArrays(opts.reportStepNumber);
+        writeArrayList(arrayList, rst1, opts.reportStepNumber, outFile);
     }
     else {
-        file1.loadData();
         auto arrayList = file1.getList();
         std::vector<int> elementSizeList = file1.getElementSizeList();
         writeArrayList(arrayList, elementSizeList, file1, outFile);
@@ -504,7 +468,113 @@ int main(int argc, char **argv)
     auto end = std::chrono::system_clock::now();
     std::chrono::duration<double> elapsed_seconds = end-start;
 
-    std::cout << "runtime  : " << argv[argOffset] << ": " << elapsed_seconds.count() << " seconds\n" << std::endl;
+    out << "runtime  : " << filename << ": " << elapsed_seconds.count() << " seconds\n" << std::endl;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    int c = 0;
+    auto opts = Options{};
+
+    while ((c = getopt(argc, argv, "hr:ligo:")) != -1) {
+        switch (c) {
+        case 'h':
+            printHelp();
+            return 0;
+        case 'l':
+            opts.listProperties = true;
+            break;
+        case 'g':
+            opts.to_grdecl = true;
+            break;
+        case 'i':
+            opts.enforce_ix_output = true;
+            break;
+        case 'r':
+            opts.specificReportStepNumber = true;
+            opts.reportStepNumber = atoi(optarg);
+            break;
+        case 'o':
+            opts.output_fname = optarg;
+            break;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    int argOffset = optind;
+
+    if (!opts.output_fname.empty() && !opts.to_grdecl) {
+        std::cout << "\n!Error, option -o only valid whit option -g \n\n";
+        exit(1);
+    }
+
+    if (argOffset >= argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    const auto files = std::vector<std::string>(argv + argOffset, argv + argc);
+
+    if ((files.size() > 1) &&
+        (opts.listProperties || opts.specificReportStepNumber || !opts.output_fname.empty()))
+    {
+        std::cout << "\n!Error, options -l, -r and -o only valid with a single input file \n\n";
+        exit(1);
+    }
+
+    if (opts.listProperties) {
+        const auto& filename = files.front();
+        auto extension = filename.substr(filename.find_last_of("."));
+        std::ranges::transform(extension, extension.begin(),
+                               [](unsigned char ckey) { return std::toupper(ckey); });
+
+        if (extension != ".UNRST") {
+            std::cerr << "\n!ERROR, option -l available only for unified restart files (*.UNRST)" << std::endl;
+            exit(1);
+        }
+
+        listReportSteps(filename);
+
+        return 0;
+    }
+
+    const bool stdoutIsTerminal = Opm::OpmLog::stdoutIsTerminal();
+    int status = EXIT_SUCCESS;
+
+    // Input files are independent, so convert them concurrently.  Progress
+    // messages of each file are collected and printed once the file is
+    // done, to avoid interleaving output from different files.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (files.size() > 1)
+#endif
+    for (int i = 0; i < static_cast<int>(files.size()); ++i) {
+        std::ostringstream buffer;
+        std::ostream& out = (files.size() > 1) ? static_cast<std::ostream&>(buffer) : std::cout;
+
+        bool ok = true;
+        try {
+            convertFile(files[i], opts, stdoutIsTerminal, out);
+        }
+        catch (const std::exception& e) {
+            out << "\n!ERROR, " << e.what() << "\n" << std::endl;
+            ok = false;
+        }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            std::cout << buffer.str();
+            std::cout.flush();
+
+            if (!ok) {
+                status = EXIT_FAILURE;
+            }
+        }
+    }
 
-    return 0;
+    return status;
 }
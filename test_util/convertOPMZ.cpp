@@ -0,0 +1,177 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  OPM is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/io/eclipse/CompressedRestart.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include <getopt.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nconvertOPMZ recreates ECLIPSE-style restart files from compressed OPM restart companion\n"
+              << "files, e.g., CASE.UNRST.OPMZ -> CASE.UNRST. Existing restart files are not overwritten.\n"
+              << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
+              << "-c Create compressed companion files from unified restart files instead, e.g.,\n"
+              << "   CASE.UNRST -> CASE.UNRST.OPMZ.\n"
+              << "-h Print help and exit.\n"
+              << "-f Create formatted output file, e.g., CASE.FUNRST.\n"
+              << "-l List arrays, with report step and position in chain of differences, and exit.\n\n";
+}
+
+std::string outputFileName(const std::string& companion, const bool formatted)
+{
+    auto path = std::filesystem::path { companion }.replace_extension();
+
+    if (formatted) {
+        const auto ext = path.extension().string();
+        if (ext.size() > 1) {
+            path.replace_extension(".F" + ext.substr(ext[1] == 'X' ? 2 : 1));
+        }
+    }
+
+    return path.string();
+}
+
+void listArrays(const std::string& filename)
+{
+    const auto file = Opm::EclIO::CompressedRestartFile { filename };
+
+    for (const auto& e : file.entries()) {
+        std::cout << e.seqnum << '\t' << e.name << '\t' << e.size << '\t'
+                  << ((e.reference < 0) ? std::string { "key" } : "delta " + std::to_string(e.depth))
+                  << '\n';
+    }
+}
+
+int compressRestartFile(const std::string& filename)
+{
+    if (! Opm::EclIO::fileExists(filename) ||
+        Opm::EclIO::CompressedRestart::isCompanionName(filename))
+    {
+        std::cerr << "Error, input file " << filename << " not found or already a .OPMZ file\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto output = Opm::EclIO::CompressedRestart::companionName(filename);
+    if (Opm::EclIO::fileExists(output)) {
+        std::cerr << "Error, output file " << output << " already exists\n";
+        return EXIT_FAILURE;
+    }
+
+    try {
+        Opm::EclIO::CompressedRestart::writeCompanionFile(filename);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error, unable to compress " << filename << ": " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    std::cout << filename << " -> " << output << '\n';
+
+    return EXIT_SUCCESS;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    int c = 0;
+    bool formatted = false;
+    bool listOnly = false;
+    bool compress = false;
+
+    while ((c = getopt(argc, argv, "chfl")) != -1) {
+        switch (c) {
+        case 'c':
+            compress = true;
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 'f':
+            formatted = true;
+            break;
+        case 'l':
+            listOnly = true;
+            break;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind == argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    int status = EXIT_SUCCESS;
+
+    for (int argInd = optind; argInd < argc; ++argInd) {
+        const std::string filename = argv[argInd];
+
+        if (compress) {
+            if (compressRestartFile(filename) != EXIT_SUCCESS) {
+                status = EXIT_FAILURE;
+            }
+            continue;
+        }
+
+        if (! Opm::EclIO::fileExists(filename) ||
+            ! Opm::EclIO::CompressedRestart::isCompanionName(filename))
+        {
+            std::cerr << "Error, input file " << filename << " not found or not a .OPMZ file\n";
+            status = EXIT_FAILURE;
+            continue;
+        }
+
+        try {
+            if (listOnly) {
+                listArrays(filename);
+                continue;
+            }
+
+            const auto output = outputFileName(filename, formatted);
+            if (Opm::EclIO::fileExists(output)) {
+                std::cerr << "Error, output file " << output << " already exists\n";
+                status = EXIT_FAILURE;
+                continue;
+            }
+
+            Opm::EclIO::CompressedRestartFile { filename }.writeRestartFile(output, formatted);
+
+            std::cout << filename << " -> " << output << '\n';
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Error, unable to convert " << filename << ": " << e.what() << '\n';
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
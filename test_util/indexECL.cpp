@@ -0,0 +1,129 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  OPM is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/io/eclipse/EclIndex.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include <getopt.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nindexECL creates a side-car array index (FILE.IDX) for one or more ECLIPSE-style result files,\n"
+              << "typically unified restart (UNRST) or summary (UNSMRY) files. The index lets EclFile, ERst and\n"
+              << "ESmry open the result file without visiting every array header.\n"
+              << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
+              << "-h Print help and exit.\n"
+              << "-c Check whether or not an existing index is valid. Does not create new index files.\n"
+              << "-d Delete existing index files.\n\n";
+}
+
+bool checkIndex(const std::string& filename)
+{
+    const auto formatted = Opm::EclIO::isFormatted(filename);
+    const auto index = Opm::EclIO::EclIndex::load(filename, formatted);
+
+    std::cout << filename << ": "
+              << (index.has_value() ? "valid index, " + std::to_string(index->entries().size()) + " arrays"
+                                    : std::string { "no valid index" })
+              << '\n';
+
+    return index.has_value();
+}
+
+void createIndex(const std::string& filename)
+{
+    const auto formatted = Opm::EclIO::isFormatted(filename);
+
+    auto index = Opm::EclIO::EclIndex::scan(filename, formatted);
+    index.write(filename);
+
+    std::cout << filename << " -> " << Opm::EclIO::EclIndex::indexFileName(filename)
+              << " (" << index.entries().size() << " arrays)\n";
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    int c = 0;
+    bool checkOnly = false;
+    bool deleteIndex = false;
+
+    while ((c = getopt(argc, argv, "hcd")) != -1) {
+        switch (c) {
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 'c':
+            checkOnly = true;
+            break;
+        case 'd':
+            deleteIndex = true;
+            break;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind == argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    int status = EXIT_SUCCESS;
+
+    for (int argInd = optind; argInd < argc; ++argInd) {
+        const std::string filename = argv[argInd];
+
+        if (! Opm::EclIO::fileExists(filename)) {
+            std::cerr << "Error, input file " << filename << " not found\n";
+            status = EXIT_FAILURE;
+            continue;
+        }
+
+        try {
+            if (deleteIndex) {
+                Opm::EclIO::EclIndex::remove(filename);
+            }
+            else if (checkOnly) {
+                if (! checkIndex(filename)) {
+                    status = EXIT_FAILURE;
+                }
+            }
+            else {
+                createIndex(filename);
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Error, unable to index " << filename << ": " << e.what() << '\n';
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
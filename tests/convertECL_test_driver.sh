@@ -0,0 +1,57 @@
+#!/bin/bash
+set -e
+
+# Round trip of binary files through convertECL.  Formatted files store
+# floating point values with fewer digits than the binary files, so the
+# first conversion is lossy; converting the result back and forth once more
+# must then reproduce the files byte for byte.  All files are converted in
+# one invocation, i.e., concurrently, and the result must match converting
+# each file on its own.
+
+convertECL=$1
+shift
+
+workdir=$(mktemp -d)
+mkdir ${workdir}/single
+
+binary=
+for file in "$@"; do
+    cp ${file} ${workdir}/
+    cp ${file} ${workdir}/single/
+    binary="${binary} $(basename ${file})"
+done
+
+pushd ${workdir}
+
+${convertECL} ${binary} > /dev/null
+formatted=$(shopt -s nullglob; echo *.F* *.A*)
+
+for file in ${binary}; do
+    ${convertECL} single/${file} > /dev/null
+done
+
+for file in ${formatted}; do
+    cmp ${file} single/${file}
+done
+
+mkdir first
+cp ${formatted} first/
+rm ${binary}
+
+${convertECL} ${formatted} > /dev/null
+mkdir second
+cp ${binary} second/
+rm ${formatted}
+
+${convertECL} ${binary} > /dev/null
+for file in ${formatted}; do
+    cmp ${file} first/${file}
+done
+
+rm ${binary}
+${convertECL} ${formatted} > /dev/null
+for file in ${binary}; do
+    cmp ${file} second/${file}
+done
+
+popd
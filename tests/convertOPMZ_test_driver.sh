@@ -0,0 +1,51 @@
+#!/bin/bash
+set -e
+
+# Creates the compressed companion of a unified restart file and recreates
+# the restart file from it through convertOPMZ.  The binary result must
+# match the original restart file byte for byte and the formatted result
+# must match the original converted by convertECL.  Existing files must
+# not be overwritten.
+
+convertOPMZ=$1
+convertECL=$2
+restart=$3
+
+workdir=$(mktemp -d)
+trap 'rm -rf "$workdir"' EXIT
+
+mkdir ${workdir}/expect
+
+cp ${restart} ${workdir}/
+cp ${restart} ${workdir}/expect/
+
+restart=$(basename ${restart})
+companion=${restart}.OPMZ
+formatted=${restart%.*}.F${restart##*.}
+
+pushd ${workdir}
+
+${convertOPMZ} -c ${restart} > /dev/null
+
+if ${convertOPMZ} -c ${restart} > /dev/null 2>&1; then
+    echo "convertOPMZ overwrote existing file ${companion}"
+    exit 1
+fi
+
+rm ${restart}
+
+${convertOPMZ} -l ${companion} | grep -q PRESSURE
+
+${convertOPMZ} ${companion} > /dev/null
+cmp ${restart} expect/${restart}
+
+if ${convertOPMZ} ${companion} > /dev/null 2>&1; then
+    echo "convertOPMZ overwrote existing file ${restart}"
+    exit 1
+fi
+
+${convertOPMZ} -f ${companion} > /dev/null
+${convertECL} expect/${restart} > /dev/null
+cmp ${formatted} expect/${formatted}
+
+popd
@@ -41,6 +41,7 @@
 #include <memory>
 #include <cmath>
 #include <iostream>
+#include <limits>
 
 template <class ScalarT>
 struct Test
@@ -406,3 +407,49 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction3, Scalar, Types)
     test.compareTableWithAnalyticFn2(xytab, xMin, xMax, m,
                                      yMin, yMax, n, test.testFn3, tolerance);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedYSegmentSearch, Scalar, Types)
+{
+    // Uniformly spaced y values along the first line, geometric along the
+    // second one.
+    Opm::UniformXTabulated2DFunction<Scalar> table;
+    table.appendXPos(0.0);
+    table.appendXPos(1.0);
+    for (unsigned j = 0; j < 11; ++j) {
+        table.appendSamplePoint(0, 100.0 + 10.0*j, 1.0);
+        table.appendSamplePoint(1, std::pow(2.0, j), 1.0);
+    }
+
+    for (unsigned i = 0; i < table.numX(); ++i) {
+        const unsigned n = table.numY(i);
+        const Scalar yMin = table.yMin(i);
+        const Scalar yMax = table.yMax(i);
+
+        unsigned hint = 0;
+        for (int k = -20; k <= 320; ++k) {
+            const Scalar y = yMin + (yMax - yMin)*k/300;
+
+            // interval as defined by ySegmentIndex(), found by linear search
+            unsigned expected = 1;
+            if (y <= table.jToY(i, 1)) {
+                expected = 0;
+            } else if (y >= table.jToY(i, n - 2)) {
+                expected = n - 2;
+            } else {
+                while (table.jToY(i, expected + 1) <= y) {
+                    ++expected;
+                }
+            }
+
+            BOOST_CHECK_EQUAL(table.ySegmentIndex(y, i, /*extrapolate=*/true), expected);
+
+            hint = table.ySegmentIndex(y, i, /*extrapolate=*/true, hint);
+            BOOST_CHECK_EQUAL(hint, expected);
+        }
+
+        // NaN fails every comparison; it must still give a valid interval
+        const Scalar nan = std::numeric_limits<Scalar>::quiet_NaN();
+        BOOST_CHECK_LT(table.ySegmentIndex(nan, i, /*extrapolate=*/true), n - 1);
+        BOOST_CHECK_LT(table.ySegmentIndex(nan, i, /*extrapolate=*/true, hint), n - 1);
+    }
+}
@@ -40,6 +40,7 @@
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
 
 #include <opm/material/densead/Evaluation.hpp>
 #include <opm/material/densead/Math.hpp>
@@ -50,7 +51,9 @@
 #include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -278,3 +281,64 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Water, Scalar, Types)
     ensurePvtApiGas<Scalar>(co2Pvt);
     ensurePvtApiBrine<Eval>(brinePvt);
 }
+
+BOOST_AUTO_TEST_CASE(Surrogate)
+{
+    using Eval = Opm::DenseAd::Evaluation<double,2>;
+    using Pvt = Opm::BrineCo2Pvt<double>;
+
+    Pvt brinePvt(std::vector<double>{0.1});
+    Pvt exactPvt(brinePvt);
+
+    const double tolerance = 1.0e-4;
+    auto range = Pvt::Surrogate::Range{};
+    range.temperatureMin = 300.0;
+    range.temperatureMax = 380.0;
+    range.pressureMin = 50.0e5;
+    range.pressureMax = 400.0e5;
+    brinePvt.enableSurrogate(range, tolerance);
+
+    const auto* surrogate = brinePvt.surrogate();
+    BOOST_REQUIRE(surrogate != nullptr);
+    BOOST_CHECK_EQUAL(surrogate->moleFraction().numSamples()[2], 1u);
+    BOOST_CHECK(surrogate->hasBrineDensity());
+    BOOST_CHECK(exactPvt.surrogate() == nullptr);
+
+    // the derivatives agree to within the error of the piecewise linear
+    // interpolation
+    const auto check = [](const Eval& approx, const Eval& exact, const double relTol)
+    {
+        const double scale = std::abs(exact.value());
+        BOOST_CHECK_SMALL((approx.value() - exact.value()) / scale, relTol);
+        for (int i = 0; i < 2; ++i) {
+            const double derivScale = std::max(std::abs(exact.derivative(i)), 1.0e-3 * scale);
+            BOOST_CHECK_SMALL((approx.derivative(i) - exact.derivative(i)) / derivScale, 0.1);
+        }
+    };
+
+    for (int i = 0; i < 7; ++i) {
+        for (int j = 0; j < 11; ++j) {
+            const Eval T = Eval::createVariable(303.0 + 11.3 * i, 0);
+            const Eval p = Eval::createVariable(57.0e5 + 33.1e5 * j, 1);
+
+            const Eval rs = brinePvt.saturatedGasDissolutionFactor(0, T, p);
+            const Eval rsExact = exactPvt.saturatedGasDissolutionFactor(0, T, p);
+            check(rs, rsExact, 5 * tolerance);
+            check(brinePvt.saturatedViscosity(0, T, p),
+                  exactPvt.saturatedViscosity(0, T, p), 5 * tolerance);
+            check(brinePvt.inverseFormationVolumeFactor(0, T, p, rsExact),
+                  exactPvt.inverseFormationVolumeFactor(0, T, p, rsExact), 5 * tolerance);
+        }
+    }
+
+    // states outside the tabulated range are evaluated exactly
+    const Eval T = Eval::createVariable(390.0, 0);
+    const Eval p = Eval::createVariable(450.0e5, 1);
+    BOOST_CHECK_EQUAL(brinePvt.saturatedGasDissolutionFactor(0, T, p),
+                      exactPvt.saturatedGasDissolutionFactor(0, T, p));
+    BOOST_CHECK_EQUAL(brinePvt.saturatedViscosity(0, T, p),
+                      exactPvt.saturatedViscosity(0, T, p));
+
+    brinePvt.disableSurrogate();
+    BOOST_CHECK(brinePvt.surrogate() == nullptr);
+}
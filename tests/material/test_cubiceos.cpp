@@ -0,0 +1,133 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Test for the batched evaluation of the cubic equations of state.
+ */
+#include "config.h"
+
+#define BOOST_TEST_MODULE CubicEOS
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/eos/CubicEOSBatch.hpp>
+#include <opm/material/fluidstates/CompositionalFluidState.hpp>
+#include <opm/material/fluidsystems/ThreeComponentFluidSystem.hh>
+
+#include <opm/input/eclipse/EclipseState/Compositional/CompositionalConfig.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+using Scalar = double;
+using EOSType = Opm::CompositionalConfig::EOSType;
+using FluidSystem = Opm::ThreeComponentFluidSystem<Scalar>;
+
+constexpr int numComponents = FluidSystem::numComponents;
+using Evaluation = Opm::DenseAd::Evaluation<Scalar, numComponents>;
+using FluidState = Opm::CompositionalFluidState<Evaluation, FluidSystem>;
+
+bool isSame(const Evaluation& a, const Evaluation& b, const Scalar tol)
+{
+    const auto close = [tol](const Scalar x, const Scalar y)
+    { return std::abs(x - y) <= tol * std::max({1.0, std::abs(x), std::abs(y)}); };
+
+    bool same = close(a.value(), b.value());
+    for (int i = 0; i < Evaluation::numVars; ++i) {
+        same = same && close(a.derivative(i), b.derivative(i));
+    }
+    return same;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(BatchMatchesCubicEOS)
+{
+    constexpr Scalar T = 300.0;
+    constexpr std::size_t numCells = 12;
+
+    // pressure and the mole fractions of the first two components are
+    // the primary variables
+    std::vector<FluidState> fluidStates(numCells);
+    std::vector<Evaluation> p(numCells), x(numComponents * numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        auto& fs = fluidStates[cellIdx];
+        p[cellIdx] = Evaluation::createVariable(5e5 + 10e5 * cellIdx, 0);
+        const Evaluation x0 = Evaluation::createVariable(0.1 + 0.05 * cellIdx, 1);
+        const Evaluation x1 = Evaluation::createVariable(0.6 - 0.04 * cellIdx, 2);
+        const Evaluation x2 = 1.0 - x0 - x1;
+
+        fs.setTemperature(T);
+        for (const int phaseIdx : {FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx}) {
+            fs.setPressure(phaseIdx, p[cellIdx]);
+            fs.setMoleFraction(phaseIdx, 0, x0);
+            fs.setMoleFraction(phaseIdx, 1, x1);
+            fs.setMoleFraction(phaseIdx, 2, x2);
+        }
+        x[0 * numCells + cellIdx] = x0;
+        x[1 * numCells + cellIdx] = x1;
+        x[2 * numCells + cellIdx] = x2;
+    }
+
+    for (const auto eosType : {EOSType::PR, EOSType::PRCORR, EOSType::SRK, EOSType::RK}) {
+        Opm::CubicEOSBatch<Scalar, FluidSystem> batch(eosType);
+        batch.updateTemperature(T);
+
+        std::vector<Evaluation> A(numCells), B(numCells), Z(numCells);
+        std::vector<Evaluation> ASum(numComponents * numCells), phi(numComponents * numCells);
+        batch.mix<Evaluation>(p, x, A, B, ASum);
+
+        for (const int phaseIdx : {FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx}) {
+            const bool isGas = phaseIdx == FluidSystem::gasPhaseIdx;
+            batch.compressibilityFactor<Evaluation>(A, B, isGas, Z);
+            batch.fugacityCoefficients<Evaluation>(p, A, B, ASum, Z, phi);
+
+            for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                const auto& fs = fluidStates[cellIdx];
+                FluidSystem::ParameterCache<Evaluation> paramCache(eosType);
+                paramCache.updatePhase(fs, phaseIdx);
+
+                BOOST_CHECK_CLOSE(A[cellIdx].value(), paramCache.A(phaseIdx).value(), 1e-10);
+                BOOST_CHECK_CLOSE(B[cellIdx].value(), paramCache.B(phaseIdx).value(), 1e-10);
+
+                const Evaluation refZ = p[cellIdx] * paramCache.molarVolume(phaseIdx)
+                    / (Opm::Constants<Scalar>::R * T);
+                BOOST_CHECK_MESSAGE(isSame(Z[cellIdx], refZ, 1e-8),
+                                    "Z of cell " << cellIdx << " differs");
+
+                for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    const Evaluation refPhi = FluidSystem::fugacityCoefficient(fs, paramCache, phaseIdx, compIdx);
+                    BOOST_CHECK_MESSAGE(isSame(phi[compIdx * numCells + cellIdx], refPhi, 1e-7),
+                                        "fugacity coefficient of component " << compIdx
+                                        << " in cell " << cellIdx << " differs");
+                }
+            }
+        }
+    }
+}
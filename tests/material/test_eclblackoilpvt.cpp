@@ -45,6 +45,10 @@
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp>
 
+#include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+
 #include <opm/material/densead/Evaluation.hpp>
 #include <opm/material/densead/Math.hpp>
 
@@ -55,7 +59,10 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
 
+#include <span>
+#include <stdexcept>
 #include <tuple>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -406,4 +413,265 @@ BOOST_AUTO_TEST_CASE(RSCONST_ThrowsBelowBubblePoint)
     );
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(HintedSegmentSearch, Scalar, Types)
+{
+    const std::vector<Scalar> x { 1.0, 2.0, 4.0, 5.0, 7.0, 8.0 };
+    const std::vector<Scalar> y { 0.0, 1.0, 3.0, 2.0, 0.0, 1.0 };
+    const Opm::Tabulated1DFunction<Scalar> table(x.size(), x, y);
+
+    // Includes the sample points themselves and positions outside the range.
+    const std::vector<Scalar> positions {
+        0.0, 1.0, 1.5, 2.0, 3.0, 4.0, 4.5, 5.0, 6.0, 7.0, 7.5, 8.0, 9.0,
+        4.5, 1.5, 8.5, 5.0, 2.0, 7.0, 3.0, 3.5, 4.0
+    };
+
+    for (std::size_t hint = 0; hint < x.size() - 1; ++hint) {
+        for (const auto& pos : positions) {
+            const auto expected = table.findSegmentIndex(pos, /*extrapolate=*/true).value;
+            const auto segIdx = table.findSegmentIndex(pos, /*extrapolate=*/true,
+                                                       Opm::SegmentIndex{hint}).value;
+            BOOST_CHECK_EQUAL(segIdx, expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformSegmentSearch, Scalar, Types)
+{
+    // Segment of x as defined by findSegmentIndex(), found by linear search.
+    const auto expectedSegment = [](const std::vector<Scalar>& x, const Scalar pos)
+    {
+        if (pos <= x[1]) {
+            return std::size_t{0};
+        }
+        if (pos >= x[x.size() - 2]) {
+            return x.size() - 2;
+        }
+        std::size_t segIdx = 1;
+        while (x[segIdx + 1] <= pos) {
+            ++segIdx;
+        }
+        return segIdx;
+    };
+
+    // Uniform, nearly uniform and non-uniform (geometric) spacing.
+    const std::vector<std::vector<Scalar>> xs {
+        { 0.0, 0.05, 0.1, 0.15, 0.2, 0.25, 0.3, 0.35, 0.4, 0.45, 0.5 },
+        { 10.0, 20.5, 29.0, 40.0, 51.0, 60.0, 69.5, 80.0 },
+        { 1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0 },
+    };
+    const std::vector<bool> uniform { true, true, false };
+
+    for (std::size_t t = 0; t < xs.size(); ++t) {
+        const auto& x = xs[t];
+        const std::vector<Scalar> y(x.size(), 1.0);
+        const Opm::Tabulated1DFunction<Scalar> table(x.size(), x, y);
+        BOOST_CHECK_EQUAL(table.uniformlySpaced(), uniform[t]);
+
+        const Scalar xMin = x.front();
+        const Scalar xMax = x.back();
+        auto cursor = Opm::SegmentIndex{0};
+        for (int i = -20; i <= 220; ++i) {
+            const Scalar pos = xMin + (xMax - xMin)*i/200;
+            const auto expected = expectedSegment(x, pos);
+            BOOST_CHECK_EQUAL(table.findSegmentIndex(pos, /*extrapolate=*/true).value, expected);
+
+            table.eval(pos, /*extrapolate=*/true, cursor);
+            BOOST_CHECK_EQUAL(cursor.value, expected);
+        }
+
+        // The sampling points themselves.
+        for (const auto& pos : x) {
+            BOOST_CHECK_EQUAL(table.findSegmentIndex(pos).value, expectedSegment(x, pos));
+        }
+    }
+}
+
+static constexpr const char* batchDeckString =
+    "RUNSPEC\n"
+    "DIMENS\n"
+    "   1 1 1 /\n"
+    "TABDIMS\n"
+    " 1 1 /\n"
+    "OIL\n"
+    "GAS\n"
+    "WATER\n"
+    "DISGAS\n"
+    "VAPOIL\n"
+    "METRIC\n"
+    "GRID\n"
+    "DX\n"
+    "  1000 /\n"
+    "DY\n"
+    "  1000 /\n"
+    "DZ\n"
+    "  20 /\n"
+    "TOPS\n"
+    "  1234 /\n"
+    "PORO\n"
+    "  0.15 /\n"
+    "PROPS\n"
+    "DENSITY\n"
+    "  850.0 1000.0 0.9 /\n"
+    "PVTW\n"
+    "  1.0 1.02 4e-5 0.5 0 /\n"
+    "PVTO\n"
+    "    0.0  10.0 1.05 1.2 /\n"
+    "   20.0  50.0 1.10 1.1 /\n"
+    "   50.0 100.0 1.20 1.0 /\n"
+    "   80.0 150.0 1.30 0.9\n"
+    "        250.0 1.28 0.95 /\n"
+    "  120.0 200.0 1.40 0.8\n"
+    "        300.0 1.38 0.85 /\n"
+    "/\n"
+    "PVTG\n"
+    "   10.0 0.0001 0.05   0.015\n"
+    "        0.0    0.051  0.014 /\n"
+    "  100.0 0.0005 0.01   0.02\n"
+    "        0.0    0.0102 0.019 /\n"
+    "  200.0 0.001  0.006  0.025\n"
+    "        0.0    0.0061 0.024 /\n"
+    "/\n";
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedEvaluation, Scalar, Types)
+{
+    const auto deck = Opm::Parser().parseString(batchDeckString);
+    const Opm::EclipseState eclState(deck);
+    const Opm::Schedule schedule(deck, eclState, std::make_shared<Opm::Python>());
+
+    Opm::GasPvtMultiplexer<Scalar> gasPvt;
+    Opm::OilPvtMultiplexer<Scalar> oilPvt;
+    Opm::WaterPvtMultiplexer<Scalar> waterPvt;
+    gasPvt.initFromState(eclState, schedule);
+    oilPvt.initFromState(eclState, schedule);
+    waterPvt.initFromState(eclState, schedule);
+
+    // Mostly increasing pressures with a few jumps, partly outside the tables.
+    const std::size_t n = 60;
+    std::vector<unsigned> regionIdx(n, 0);
+    std::vector<Scalar> temperature(n, 350.0);
+    std::vector<Scalar> pressure(n);
+    std::vector<Scalar> ratio(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto bar = (i % 17 == 0) ? Scalar(5 + 11*i % 300) : Scalar(5 + 5*i);
+        pressure[i] = bar * 1e5;
+    }
+
+    std::vector<Scalar> values(n);
+    auto cells = Opm::PvtBatch<Scalar> { regionIdx, temperature, pressure };
+
+    oilPvt.saturatedGasDissolutionFactor(cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], oilPvt.saturatedGasDissolutionFactor(0, temperature[i], pressure[i]));
+        ratio[i] = Scalar(0.8) * values[i];
+    }
+
+    cells.dissolution = ratio;
+    oilPvt.inverseFormationVolumeFactor(cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], oilPvt.inverseFormationVolumeFactor(0, temperature[i], pressure[i], ratio[i]));
+    }
+
+    oilPvt.viscosity(cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], oilPvt.viscosity(0, temperature[i], pressure[i], ratio[i]));
+    }
+
+    cells.dissolution = {};
+    gasPvt.saturatedOilVaporizationFactor(cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], gasPvt.saturatedOilVaporizationFactor(0, temperature[i], pressure[i]));
+        ratio[i] = Scalar(0.5) * values[i];
+    }
+
+    cells.dissolution = ratio;
+    gasPvt.inverseFormationVolumeFactor(cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], gasPvt.inverseFormationVolumeFactor(0, temperature[i], pressure[i],
+                                                                         ratio[i], Scalar(0.0)));
+    }
+
+    cells.dissolution = {};
+    waterPvt.inverseFormationVolumeFactor(cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], waterPvt.inverseFormationVolumeFactor(0, temperature[i], pressure[i],
+                                                                           Scalar(0.0), Scalar(0.0)));
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedFluidSystemEvaluation, Scalar, Types)
+{
+    using FluidSystem = Opm::BlackOilFluidSystem<Scalar>;
+
+    const auto deck = Opm::Parser().parseString(batchDeckString);
+    const Opm::EclipseState eclState(deck);
+    const Opm::Schedule schedule(deck, eclState, std::make_shared<Opm::Python>());
+    FluidSystem::initFromState(eclState, schedule);
+
+    const std::size_t n = 40;
+    std::vector<unsigned> regionIdx(n, 0);
+    std::vector<Scalar> temperature(n, 350.0);
+    std::vector<Scalar> pressure(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        pressure[i] = Scalar(20 + 7*i % 260) * 1e5;
+    }
+
+    std::vector<Scalar> values(n);
+    std::vector<Scalar> ratio(n);
+    auto cells = Opm::PvtBatch<Scalar> { regionIdx, temperature, pressure };
+
+    FluidSystem::saturatedDissolutionFactor(FluidSystem::oilPhaseIdx, cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], FluidSystem::oilPvt().saturatedGasDissolutionFactor(0, temperature[i], pressure[i]));
+        ratio[i] = Scalar(0.7) * values[i];
+    }
+
+    cells.dissolution = ratio;
+    FluidSystem::inverseFormationVolumeFactor(FluidSystem::oilPhaseIdx, cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], FluidSystem::oilPvt().inverseFormationVolumeFactor(0, temperature[i], pressure[i], ratio[i]));
+    }
+
+    FluidSystem::viscosity(FluidSystem::oilPhaseIdx, cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], FluidSystem::oilPvt().viscosity(0, temperature[i], pressure[i], ratio[i]));
+    }
+
+    cells.dissolution = {};
+    FluidSystem::saturatedDissolutionFactor(FluidSystem::gasPhaseIdx, cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], FluidSystem::gasPvt().saturatedOilVaporizationFactor(0, temperature[i], pressure[i]));
+        ratio[i] = Scalar(0.5) * values[i];
+    }
+
+    cells.dissolution = ratio;
+    FluidSystem::inverseFormationVolumeFactor(FluidSystem::gasPhaseIdx, cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], FluidSystem::gasPvt().inverseFormationVolumeFactor(0, temperature[i], pressure[i],
+                                                                                        ratio[i], Scalar(0.0)));
+    }
+
+    FluidSystem::viscosity(FluidSystem::gasPhaseIdx, cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], FluidSystem::gasPvt().viscosity(0, temperature[i], pressure[i],
+                                                                     ratio[i], Scalar(0.0)));
+    }
+
+    cells.dissolution = {};
+    FluidSystem::inverseFormationVolumeFactor(FluidSystem::waterPhaseIdx, cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], FluidSystem::waterPvt().inverseFormationVolumeFactor(0, temperature[i], pressure[i],
+                                                                                          Scalar(0.0), Scalar(0.0)));
+    }
+
+    FluidSystem::viscosity(FluidSystem::waterPhaseIdx, cells, std::span<Scalar>{values});
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(values[i], FluidSystem::waterPvt().viscosity(0, temperature[i], pressure[i],
+                                                                       Scalar(0.0), Scalar(0.0)));
+    }
+
+    BOOST_CHECK_THROW(FluidSystem::viscosity(FluidSystem::numPhases, cells, std::span<Scalar>{values}),
+                      std::logic_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
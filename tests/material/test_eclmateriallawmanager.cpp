@@ -44,6 +44,11 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
+#include <array>
+#include <span>
+#include <string>
+#include <vector>
+
 // values of strings taken from the SPE1 test case1 of opm-data
 static constexpr const char* fam1DeckString =
     "RUNSPEC\n"
@@ -964,3 +969,257 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedEvaluation, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    Opm::Parser parser;
+
+    for (const auto* deckString : { hysterDeckString, letDeckString }) {
+        const auto deck = parser.parseString(deckString);
+        const Opm::EclipseState eclState(deck);
+
+        const size_t n = eclState.getInputGrid().getCartesianSize();
+
+        MaterialLawManager materialLawManager;
+        materialLawManager.initFromState(eclState);
+        materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+        // Evaluate all but the first cell, a different state in each cell.
+        const unsigned firstElem = 1;
+        const size_t numElems = n - firstElem;
+
+        std::vector<Scalar> saturations(numElems * numPhases);
+        for (size_t cell = 0; cell < numElems; ++cell) {
+            const Scalar Sw = Scalar(cell % 11) / 10;
+            const Scalar So = (1 - Sw) * Scalar(cell % 7) / 6;
+            saturations[cell*numPhases + Fixture<Scalar>::waterPhaseIdx] = Sw;
+            saturations[cell*numPhases + Fixture<Scalar>::oilPhaseIdx] = So;
+            saturations[cell*numPhases + Fixture<Scalar>::gasPhaseIdx] = 1 - Sw - So;
+        }
+
+        std::vector<Scalar> kr(saturations.size());
+        std::vector<Scalar> pc(saturations.size());
+        materialLawManager.relativePermeabilities(firstElem,
+                                                  std::span<const Scalar>{saturations},
+                                                  std::span<Scalar>{kr});
+        materialLawManager.capillaryPressures(firstElem,
+                                              std::span<const Scalar>{saturations},
+                                              std::span<Scalar>{pc});
+
+        for (size_t cell = 0; cell < numElems; ++cell) {
+            typename Fixture<Scalar>::FluidState fs;
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                fs.setSaturation(phaseIdx, saturations[cell*numPhases + phaseIdx]);
+            }
+
+            std::array<Scalar,numPhases> krExpect = {0.0, 0.0, 0.0};
+            std::array<Scalar,numPhases> pcExpect = {0.0, 0.0, 0.0};
+            const auto& params = materialLawManager.materialLawParams(firstElem + cell);
+            MaterialLaw::relativePermeabilities(krExpect, params, fs);
+            MaterialLaw::capillaryPressures(pcExpect, params, fs);
+
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                BOOST_CHECK_EQUAL(kr[cell*numPhases + phaseIdx], krExpect[phaseIdx]);
+                BOOST_CHECK_EQUAL(pc[cell*numPhases + phaseIdx], pcExpect[phaseIdx]);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ScaledPointsStore, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(hysterDeckString);
+    const Opm::EclipseState eclState(deck);
+
+    const size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager materialLawManager;
+    materialLawManager.initFromState(eclState);
+    materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    // One value per cell, but only a few distinct values.
+    const auto usage = materialLawManager.scaledEpsInfoMemoryUsage();
+    BOOST_CHECK_EQUAL(usage.numCells, n);
+    BOOST_CHECK_EQUAL(usage.numUnique, 0u);
+    BOOST_CHECK_LT(usage.numShared, n);
+    BOOST_CHECK_LT(usage.bytesStored(), usage.bytesUnshared());
+
+    typename Fixture<Scalar>::FluidState fs;
+    fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, 0.2);
+    fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, 0.5);
+    fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, 0.3);
+
+    std::array<Scalar,numPhases> pcBefore = {0.0, 0.0, 0.0};
+    MaterialLaw::capillaryPressures(pcBefore, materialLawManager.materialLawParams(1), fs);
+    const auto infoBefore = materialLawManager.oilWaterScaledEpsInfoDrainage(1);
+
+    // Modifying the end-points of one cell must not affect any other cell.
+    const Scalar maxPcow = 1.234e5;
+    materialLawManager.applyRestartSwatInit(0, maxPcow);
+    BOOST_CHECK_EQUAL(materialLawManager.scaledEpsInfoMemoryUsage().numUnique, 1u);
+    BOOST_CHECK_EQUAL(materialLawManager.oilWaterScaledEpsInfoDrainage(0).maxPcow, maxPcow);
+    BOOST_CHECK_EQUAL(materialLawManager.oilWaterScaledEpsPointsDrainage(0).maxPcnw(), maxPcow);
+
+    materialLawManager.applyRestartSwatInit(0, 2*maxPcow);
+    BOOST_CHECK_EQUAL(materialLawManager.scaledEpsInfoMemoryUsage().numUnique, 1u);
+    BOOST_CHECK_EQUAL(materialLawManager.oilWaterScaledEpsInfoDrainage(0).maxPcow, 2*maxPcow);
+
+    BOOST_CHECK(materialLawManager.oilWaterScaledEpsInfoDrainage(1) == infoBefore);
+
+    std::array<Scalar,numPhases> pcAfter = {0.0, 0.0, 0.0};
+    MaterialLaw::capillaryPressures(pcAfter, materialLawManager.materialLawParams(1), fs);
+    for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+        BOOST_CHECK_EQUAL(pcAfter[phaseIdx], pcBefore[phaseIdx]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ScaledPointsStoreMergeAndCopy, Scalar, Types)
+{
+    using Store = Opm::EclEpsScalingPointsStore<Scalar>;
+
+    auto info = [](const Scalar swl)
+    {
+        auto value = typename Store::Info{};
+        value.Swl = swl;
+        return value;
+    };
+
+    Store store;
+    store.resize(6);
+
+    // Two threads, sharing one of their values, and one cell assigned by
+    // both.
+    auto builders = std::vector<typename Store::Builder>(2);
+    builders[0].set(0, info(0.1));
+    builders[0].set(1, info(0.2));
+    builders[0].set(2, info(0.1));
+    builders[1].set(3, info(0.2));
+    builders[1].set(4, info(0.3));
+    builders[1].set(2, info(0.3));
+    store.merge(builders);
+
+    const auto expected = std::array<Scalar, 6> { 0.1, 0.2, 0.3, 0.2, 0.3, 0.0 };
+    for (std::size_t cell = 0; cell < expected.size(); ++cell) {
+        BOOST_CHECK_EQUAL(store[cell].Swl, expected[cell]);
+    }
+
+    // Value-initialised default, 0.1, 0.2 and 0.3.
+    BOOST_CHECK_EQUAL(store.memoryUsage().numShared, 4u);
+
+    store.unique(1).Swl = 0.25;
+
+    // Copies are independent, including private values.
+    auto copy = store;
+    copy.unique(1).Swl = 0.5;
+    copy.unique(3).Swl = 0.5;
+
+    BOOST_CHECK_EQUAL(store[1].Swl, Scalar(0.25));
+    BOOST_CHECK_EQUAL(store[3].Swl, Scalar(0.2));
+    BOOST_CHECK_EQUAL(copy[1].Swl, Scalar(0.5));
+    BOOST_CHECK_EQUAL(copy[3].Swl, Scalar(0.5));
+    BOOST_CHECK_EQUAL(store.memoryUsage().numUnique, 1u);
+    BOOST_CHECK_EQUAL(copy.memoryUsage().numUnique, 2u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedHysteresisUpdate, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    // Same deck with directional relative permeabilities and imbibition
+    // regions, so that the directional parameters are updated as well.
+    auto directionalDeckString = std::string { hysterDeckString };
+    directionalDeckString.replace(directionalDeckString.find("HYSTER /"), 8, "DIRECT HYSTER /");
+    directionalDeckString +=
+        "\n"
+        "REGIONS\n"
+        "\n"
+        "KRNUMX\n"
+        "  300*1 /\n"
+        "IMBNUMX\n"
+        "  300*1 /\n";
+
+    using Dir = Opm::FaceDir::DirEnum;
+    const Dir facedirs[] = { Dir::XPlus, Dir::YPlus, Dir::ZPlus };
+
+    Opm::Parser parser;
+    for (const auto& deckString : { std::string { hysterDeckString }, directionalDeckString }) {
+        const auto deck = parser.parseString(deckString);
+        const Opm::EclipseState eclState(deck);
+
+        const size_t n = eclState.getInputGrid().getCartesianSize();
+
+        MaterialLawManager cellManager;
+        cellManager.initFromState(eclState);
+        cellManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+        MaterialLawManager rangeManager;
+        rangeManager.initFromState(eclState);
+        rangeManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+        const bool directional = rangeManager.hasDirectionalRelperms() ||
+                                 rangeManager.hasDirectionalImbnum();
+        BOOST_CHECK_EQUAL(directional, deckString == directionalDeckString);
+
+        std::vector<Scalar> saturations(n * numPhases);
+        std::vector<bool> changed;
+        for (int step = 0; step < 3; ++step) {
+            // Only every other cell moves after the first step.
+            for (size_t cell = 0; cell < n; ++cell) {
+                const int shift = (step > 0 && cell % 2 == 0) ? 0 : step;
+                const Scalar Sw = Scalar((cell + shift) % 9 + 1) / 10;
+                const Scalar So = (1 - Sw) * Scalar((cell + 2*shift) % 5) / 4;
+                saturations[cell*numPhases + Fixture<Scalar>::waterPhaseIdx] = Sw;
+                saturations[cell*numPhases + Fixture<Scalar>::oilPhaseIdx] = So;
+                saturations[cell*numPhases + Fixture<Scalar>::gasPhaseIdx] = 1 - Sw - So;
+            }
+
+            const auto numChanged = rangeManager.updateHysteresis(0, saturations, changed);
+            BOOST_REQUIRE_EQUAL(changed.size(), n);
+
+            size_t numExpected = 0;
+            for (size_t cell = 0; cell < n; ++cell) {
+                typename Fixture<Scalar>::FluidState fs;
+                for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                    fs.setSaturation(phaseIdx, saturations[cell*numPhases + phaseIdx]);
+                }
+
+                const bool expected = cellManager.updateHysteresis(fs, cell);
+                BOOST_CHECK_EQUAL(changed[cell], expected);
+                numExpected += expected;
+
+                auto checkRelperms = [&fs](const auto& cellParams, const auto& rangeParams)
+                {
+                    std::array<Scalar,numPhases> krCell = {0.0, 0.0, 0.0};
+                    std::array<Scalar,numPhases> krRange = {0.0, 0.0, 0.0};
+                    MaterialLaw::relativePermeabilities(krCell, cellParams, fs);
+                    MaterialLaw::relativePermeabilities(krRange, rangeParams, fs);
+                    for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                        BOOST_CHECK_EQUAL(krRange[phaseIdx], krCell[phaseIdx]);
+                    }
+                };
+
+                checkRelperms(cellManager.materialLawParams(cell),
+                              rangeManager.materialLawParams(cell));
+
+                if (directional) {
+                    for (const auto facedir : facedirs) {
+                        checkRelperms(cellManager.materialLawParams(cell, facedir),
+                                      rangeManager.materialLawParams(cell, facedir));
+                    }
+                }
+            }
+            BOOST_CHECK_EQUAL(numChanged, numExpected);
+        }
+    }
+}
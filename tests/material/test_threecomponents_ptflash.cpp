@@ -55,8 +55,11 @@
 
 #include <fmt/format.h>
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
+#include <span>
+#include <vector>
 
 // It is a three component system
 using Scalar = double;
@@ -234,3 +237,128 @@ for (const auto& sample : test_methods) {
 }
 #endif
 }
+
+BOOST_AUTO_TEST_CASE(PtFlashBatch)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem, true>;
+    using ScalarVector = Dune::FieldVector<Scalar, numComponents>;
+
+    const double flash_tolerance = 1.e-8;
+    const EOSType eos_type = EOSType::PR;
+
+    // cells from 1 to 200 bar at 300 K, which are partly single-phase
+    // and partly two-phase
+    constexpr std::size_t numCells = 40;
+    const auto makeFluidState = [](const std::size_t cellIdx, const Scalar dp)
+    {
+        const Evaluation p = Evaluation::createVariable(1e5 + cellIdx * 5e5 + dp, 0);
+        const Evaluation T = Evaluation::createVariable(300.0, 1);
+        const Evaluation z0 = Evaluation::createVariable(0.5, 2);
+        const Evaluation z1 = Evaluation::createVariable(0.3, 3);
+
+        FluidState fluid_state;
+        fluid_state.setPressure(FluidSystem::oilPhaseIdx, p);
+        fluid_state.setPressure(FluidSystem::gasPhaseIdx, p);
+        fluid_state.setMoleFraction(FluidSystem::Comp0Idx, z0);
+        fluid_state.setMoleFraction(FluidSystem::Comp1Idx, z1);
+        fluid_state.setMoleFraction(FluidSystem::Comp2Idx, 1. - z0 - z1);
+        fluid_state.setTemperature(T);
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state.setKvalue(compIdx, fluid_state.wilsonK_(compIdx));
+        }
+        fluid_state.setLvalue(1.);
+        return fluid_state;
+    };
+
+    const auto checkSame = [](const FluidState& fs, const FluidState& ref, const double tol)
+    {
+        BOOST_CHECK(Opm::MathToolbox<Evaluation>::isSame(fs.L(), ref.L(), tol));
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            for (const int phaseIdx : {FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx}) {
+                BOOST_CHECK(Opm::MathToolbox<Evaluation>::isSame(fs.moleFraction(phaseIdx, compIdx),
+                                                                 ref.moleFraction(phaseIdx, compIdx), tol));
+            }
+        }
+    };
+
+    std::vector<FluidState> fluid_states, ref_states;
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        fluid_states.push_back(makeFluidState(cellIdx, 0.0));
+        ref_states.push_back(fluid_states.back());
+        Flash::solve(ref_states.back(), "newton", flash_tolerance, eos_type);
+    }
+
+    // without history the batch reproduces the cell-by-cell flash
+    std::vector<Flash::CellHistory> history(numCells);
+    auto statistics = Flash::solveBatch(std::span(fluid_states), std::span(history),
+                                        "newton", flash_tolerance, eos_type);
+    BOOST_CHECK_EQUAL(statistics.numStabilityTests, numCells);
+    BOOST_CHECK_EQUAL(statistics.numSkippedStabilityTests, 0u);
+    BOOST_CHECK(statistics.numTwoPhase > 0);
+    BOOST_CHECK(statistics.numTwoPhase < numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        BOOST_CHECK(history[cellIdx].valid);
+        checkSame(fluid_states[cellIdx], ref_states[cellIdx], 1e-6);
+    }
+
+    // after a small pressure change, the flash is warm started from the
+    // history.  The single-phase cells of this system all have a trivial
+    // trial phase, so their stability margin is zero and they are tested
+    // again.
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        fluid_states[cellIdx] = makeFluidState(cellIdx, 1e3);
+        ref_states[cellIdx] = fluid_states[cellIdx];
+        Flash::solve(ref_states[cellIdx], "newton", flash_tolerance, eos_type);
+    }
+    statistics = Flash::solveBatch(std::span(fluid_states), std::span(history),
+                                   "newton", flash_tolerance, eos_type);
+    BOOST_CHECK_EQUAL(statistics.numSkippedStabilityTests, 0u);
+    BOOST_CHECK_EQUAL(statistics.numStabilityTests + statistics.numTwoPhase, numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        checkSame(fluid_states[cellIdx], ref_states[cellIdx], 1e-6);
+    }
+
+    // the stability test is skipped for the cells whose last test was
+    // clearly single-phase
+    std::size_t numSinglePhase = 0;
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        const auto L = Opm::getValue(fluid_states[cellIdx].L());
+        if (L <= 0 || L == 1) {
+            history[cellIdx].stabilityMargin = 1.0;
+            ++numSinglePhase;
+        }
+        fluid_states[cellIdx] = makeFluidState(cellIdx, 2e3);
+        ref_states[cellIdx] = fluid_states[cellIdx];
+        Flash::solve(ref_states[cellIdx], "newton", flash_tolerance, eos_type);
+    }
+    statistics = Flash::solveBatch(std::span(fluid_states), std::span(history),
+                                   "newton", flash_tolerance, eos_type);
+    BOOST_CHECK(numSinglePhase > 0);
+    BOOST_CHECK_EQUAL(statistics.numSkippedStabilityTests, numSinglePhase);
+    BOOST_CHECK_EQUAL(statistics.numStabilityTests + statistics.numSkippedStabilityTests + statistics.numTwoPhase,
+                      numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        checkSame(fluid_states[cellIdx], ref_states[cellIdx], 1e-6);
+    }
+
+    // the batched Rachford-Rice solver agrees with the scalar one
+    constexpr std::size_t numRR = 7;
+    std::vector<Scalar> K(numComponents * numRR), z(numComponents * numRR), L(numRR);
+    for (std::size_t i = 0; i < numRR; ++i) {
+        const ScalarVector Ki = {3.0 + i, 0.8 + 0.1 * i, 0.01 * (i + 1)};
+        const ScalarVector zi = {0.2 + 0.05 * i, 0.5 - 0.05 * i, 0.3};
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            K[compIdx * numRR + i] = Ki[compIdx];
+            z[compIdx * numRR + i] = zi[compIdx];
+        }
+    }
+    Flash::solveRachfordRiceBatch_g_(std::span<const Scalar>(K), std::span<const Scalar>(z), std::span(L), 0);
+    for (std::size_t i = 0; i < numRR; ++i) {
+        ScalarVector Ki, zi;
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            Ki[compIdx] = K[compIdx * numRR + i];
+            zi[compIdx] = z[compIdx * numRR + i];
+        }
+        BOOST_CHECK_CLOSE(L[i], Flash::solveRachfordRice_g_(Ki, zi, 0), 1e-8);
+    }
+}
@@ -0,0 +1,70 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE MSIM_IO_BENCHMARK
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/msim/IOBenchmark.hpp>
+
+#include <opm/io/eclipse/ESmry.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <tests/WorkArea.hpp>
+
+BOOST_AUTO_TEST_CASE(Small_Model)
+{
+    WorkArea work_area("test_msim_io_benchmark");
+
+    auto config = Opm::IOBenchmark::Config{};
+    config.numCells = 1000;
+    config.numWells = 4;
+    config.numSteps = 3;
+    config.numActions = 2;
+
+    const auto report = Opm::IOBenchmark { config }.run();
+
+    BOOST_CHECK_EQUAL(report.numCells, std::size_t{1000});
+    BOOST_CHECK_EQUAL(report.numWells, std::size_t{4});
+    BOOST_CHECK_EQUAL(report.numSteps, std::size_t{3});
+
+    BOOST_CHECK_EQUAL(report.summaryEval.count, std::size_t{3});
+    BOOST_CHECK_EQUAL(report.udqEval.count, std::size_t{3});
+    BOOST_CHECK_EQUAL(report.summaryWrite.count, std::size_t{3});
+    BOOST_CHECK_EQUAL(report.restartWrite.count, std::size_t{3});
+    BOOST_CHECK_EQUAL(report.actionEval.count, std::size_t{6});
+
+    BOOST_CHECK_GT(report.summaryWrite.bytes, std::uintmax_t{0});
+    BOOST_CHECK_GT(report.restartWrite.bytes, std::uintmax_t{0});
+    BOOST_CHECK_GT(report.rftWrite.bytes, std::uintmax_t{0});
+
+    const auto smry = Opm::EclIO::ESmry { "IOBENCH.SMSPEC" };
+    BOOST_CHECK_MESSAGE(smry.hasKey("WOPR:P1"), "Summary file must have well vectors");
+
+    const auto json = report.json();
+    for (const auto* phase : { "summary_eval", "actionx_eval", "summary_write",
+                               "restart_write", "rft_write" })
+    {
+        BOOST_CHECK_MESSAGE(json.find(phase) != std::string::npos,
+                            "JSON report must have phase " << phase);
+    }
+}
@@ -0,0 +1,415 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE CompressedRestart
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/CompressedRestart.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/OutputStream.hpp>
+#include <opm/io/eclipse/PaddedOutputString.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+namespace {
+
+    using Opm::EclIO::CompressedRestart::companionName;
+
+    std::vector<float> pressure(const int seqnum)
+    {
+        // Large enough to span several blocks.  Only a few cells change
+        // between report steps.
+        auto p = std::vector<float>(40'000, 250.0f);
+        for (auto i = std::size_t{0}; i < p.size(); i += 997) {
+            p[i] += 0.5f * seqnum + 0.001f * i;
+        }
+
+        return p;
+    }
+
+    std::vector<double> swat(const int seqnum)
+    {
+        auto s = std::vector<double>(1000);
+        for (auto i = std::size_t{0}; i < s.size(); ++i) {
+            s[i] = 0.2 + 1.0e-4*i + 0.01*seqnum*(i % 7 == 0);
+        }
+
+        return s;
+    }
+
+    using CachePtr = std::shared_ptr<Opm::EclIO::CompressedRestart::ReferenceCache>;
+
+    void writeStep(const Opm::EclIO::OutputStream::ResultSet& rset,
+                   const int seqnum, const bool unified,
+                   const CachePtr& cache = {})
+    {
+        using Char8 = Opm::EclIO::PaddedOutputString<8>;
+
+        auto rst = Opm::EclIO::OutputStream::Restart {
+            rset, seqnum,
+            Opm::EclIO::OutputStream::Formatted  { false },
+            Opm::EclIO::OutputStream::Unified    { unified },
+            Opm::EclIO::OutputStream::Compressed { true, cache }
+        };
+
+        rst.write("INTEHEAD", std::vector<int>(seqnum + 10, seqnum));
+        rst.write("LOGIHEAD", std::vector<bool>{ true, false, seqnum % 2 == 0 });
+        rst.write("ZWEL", std::vector<Char8>{ Char8{ "PROD" }, Char8{ "INJ" } });
+        rst.write("ZLONG", std::vector<std::string>{ "A_LONG_NAME_C0NN" });
+        rst.message("STARTSOL");
+        rst.write("PRESSURE", pressure(seqnum));
+
+        const auto sw = swat(seqnum);
+        rst.writeConverted<double>("SWAT", sw, 1.0);
+        rst.message("ENDSOL");
+    }
+
+    template <typename T>
+    void checkEqual(const std::vector<T>& actual, const std::vector<T>& expect)
+    {
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(),
+                                      expect.begin(), expect.end());
+    }
+
+    std::vector<char> fileContents(const std::string& fname)
+    {
+        auto is = std::ifstream { fname, std::ios::binary };
+
+        return { std::istreambuf_iterator<char>{ is },
+                 std::istreambuf_iterator<char>{} };
+    }
+
+    void checkStep(Opm::EclIO::ERst& rst, const int seqnum)
+    {
+        BOOST_REQUIRE_MESSAGE(rst.hasReportStepNumber(seqnum),
+                              "Restart file must have report step " << seqnum);
+
+        checkEqual(rst.getRestartData<int>("INTEHEAD", seqnum),
+                   std::vector<int>(seqnum + 10, seqnum));
+        checkEqual(rst.getRestartData<bool>("LOGIHEAD", seqnum),
+                   std::vector<bool>{ true, false, seqnum % 2 == 0 });
+        checkEqual(rst.getRestartData<std::string>("ZWEL", seqnum),
+                   std::vector<std::string>{ "PROD", "INJ" });
+        checkEqual(rst.getRestartData<float>("PRESSURE", seqnum), pressure(seqnum));
+        checkEqual(rst.getRestartData<double>("SWAT", seqnum), swat(seqnum));
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Unified_Round_Trip)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+    for (auto seqnum = 1; seqnum <= 12; ++seqnum) {
+        writeStep(rset, seqnum, true);
+    }
+
+    BOOST_REQUIRE_MESSAGE(std::filesystem::exists(companionName(fname)),
+                          "Compressed companion file must exist");
+
+    BOOST_CHECK_MESSAGE(std::filesystem::file_size(companionName(fname)) <
+                        std::filesystem::file_size(fname) / 4,
+                        "Companion file must be substantially smaller than restart file");
+
+    const auto file = Opm::EclIO::CompressedRestartFile { companionName(fname) };
+
+    // Key frame interval bounds chains of differences.
+    auto numKeyFrames = 0;
+    for (const auto& e : file.entries()) {
+        BOOST_CHECK_LT(e.depth, Opm::EclIO::CompressedRestart::defaultKeyframeInterval);
+        numKeyFrames += (e.name == "PRESSURE") && (e.reference < 0);
+    }
+
+    BOOST_CHECK_EQUAL(numKeyFrames, 2);
+
+    // Read through ERst once the restart file itself is gone.
+    std::filesystem::remove(fname);
+
+    auto rst = Opm::EclIO::ERst { fname };
+    BOOST_CHECK_MESSAGE(rst.compressedInput(), "ERst must read companion file");
+
+    const auto& steps = rst.listOfReportStepNumbers();
+    BOOST_CHECK_EQUAL(steps.size(), std::size_t{12});
+
+    for (const auto seqnum : { 1, 7, 10, 12 }) {
+        checkStep(rst, seqnum);
+    }
+
+    BOOST_CHECK_THROW(rst.getRestartView<float>("PRESSURE", 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Element_Range)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+    for (auto seqnum = 1; seqnum <= 3; ++seqnum) {
+        writeStep(rset, seqnum, true);
+    }
+
+    const auto file = Opm::EclIO::CompressedRestartFile { companionName(fname) };
+
+    auto last = std::size_t{0};
+    for (auto i = std::size_t{0}; i < file.entries().size(); ++i) {
+        if (file.entries()[i].name == "PRESSURE") {
+            last = i;
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL(file.entries()[last].seqnum, 3);
+
+    const auto expect = pressure(3);
+    for (const auto& [first, count] : { std::pair<std::size_t, std::size_t>{ 0, 10 },
+                                        { 16'380, 20 }, { 20'000, 20'000 }, { 39'999, 1 } })
+    {
+        const auto actual = file.getRange<float>(last, first, count);
+        checkEqual(actual, std::vector<float>(expect.begin() + first,
+                                              expect.begin() + first + count));
+    }
+
+    BOOST_CHECK_THROW(file.getRange<float>(last, 39'990, 11), std::out_of_range);
+    BOOST_CHECK_THROW(file.getRange<double>(last, 0, 1), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Overwrite_Report_Step)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+    for (auto seqnum = 1; seqnum <= 4; ++seqnum) {
+        writeStep(rset, seqnum, true);
+    }
+
+    // Restart from report step 2.  Drops steps 3 and 4.
+    writeStep(rset, 2, true);
+    writeStep(rset, 3, true);
+
+    std::filesystem::remove(fname);
+
+    auto rst = Opm::EclIO::ERst { fname };
+
+    const auto& steps = rst.listOfReportStepNumbers();
+    checkEqual(steps, std::vector<int>{ 1, 2, 3 });
+
+    for (const auto seqnum : { 1, 2, 3 }) {
+        checkStep(rst, seqnum);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Cached_Reference)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto cached = Opm::EclIO::OutputStream::ResultSet { ".", "CACHED" };
+    auto cache = std::make_shared<Opm::EclIO::CompressedRestart::ReferenceCache>();
+
+    // Restart from report step 2 invalidates the cache, so step 2 is
+    // formed against step 1 read back from the file.
+    for (const auto seqnum : { 1, 2, 3, 4, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 }) {
+        writeStep(rset, seqnum, true);
+        writeStep(cached, seqnum, true, cache);
+    }
+
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(cached, "UNRST");
+    BOOST_CHECK_EQUAL(cache->filename, companionName(fname));
+    BOOST_CHECK_EQUAL(cache->seqnum, 12);
+    BOOST_CHECK_MESSAGE(cache->arrays.count({ "PRESSURE", 0 }) == 1,
+                        "Cache must hold last report step's PRESSURE");
+
+    const auto expect = fileContents(companionName(Opm::EclIO::OutputStream::outputFileName(rset, "UNRST")));
+    const auto actual = fileContents(companionName(fname));
+    BOOST_CHECK_MESSAGE(actual == expect,
+                        "Cached reference arrays must not change companion file");
+
+    std::filesystem::remove(fname);
+
+    auto rst = Opm::EclIO::ERst { fname };
+    for (const auto seqnum : { 1, 2, 9, 12 }) {
+        checkStep(rst, seqnum);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Write_Restart_File)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+    for (auto seqnum = 1; seqnum <= 3; ++seqnum) {
+        writeStep(rset, seqnum, true);
+    }
+
+    Opm::EclIO::CompressedRestartFile { companionName(fname) }
+        .writeRestartFile("COPY.UNRST", false);
+
+    auto original = Opm::EclIO::ERst { fname };
+    auto copy = Opm::EclIO::ERst { "COPY.UNRST" };
+
+    BOOST_CHECK_MESSAGE(! copy.compressedInput(), "Copy must be a regular restart file");
+
+    const auto expect = original.getList();
+    const auto actual = copy.getList();
+    BOOST_REQUIRE_EQUAL(actual.size(), expect.size());
+
+    for (auto i = std::size_t{0}; i < actual.size(); ++i) {
+        BOOST_CHECK_EQUAL(std::get<0>(actual[i]), std::get<0>(expect[i]));
+        BOOST_CHECK(std::get<1>(actual[i]) == std::get<1>(expect[i]));
+        BOOST_CHECK_EQUAL(std::get<2>(actual[i]), std::get<2>(expect[i]));
+    }
+
+    BOOST_CHECK_EQUAL(std::filesystem::file_size("COPY.UNRST"),
+                      std::filesystem::file_size(fname));
+
+    for (const auto seqnum : { 1, 3 }) {
+        checkStep(copy, seqnum);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Companion_From_Restart_File)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+    for (auto seqnum = 1; seqnum <= 12; ++seqnum) {
+        writeStep(rset, seqnum, true);
+    }
+
+    const auto expect = fileContents(companionName(fname));
+
+    std::filesystem::rename(companionName(fname), "EXPECT.OPMZ");
+    BOOST_CHECK_EQUAL(Opm::EclIO::CompressedRestart::writeCompanionFile(fname),
+                      companionName(fname));
+
+    BOOST_CHECK_MESSAGE(fileContents(companionName(fname)) == expect,
+                        "Companion created from restart file must match "
+                        "companion written alongside restart file");
+
+    std::filesystem::remove(fname);
+
+    auto rst = Opm::EclIO::ERst { fname };
+    for (const auto seqnum : { 1, 7, 12 }) {
+        checkStep(rst, seqnum);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Separate_Restart_Files)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+
+    writeStep(rset, 1, false);
+    writeStep(rset, 2, false);
+
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "X0002");
+    std::filesystem::remove(fname);
+
+    const auto file = Opm::EclIO::CompressedRestartFile { companionName(fname) };
+    for (const auto& e : file.entries()) {
+        BOOST_CHECK_MESSAGE(e.reference < 0, "Separate files must hold key frames only");
+    }
+
+    auto rst = Opm::EclIO::EclFile { fname };
+    BOOST_CHECK_MESSAGE(rst.compressedInput(), "EclFile must read companion file");
+    checkEqual(rst.get<float>("PRESSURE"), pressure(2));
+    checkEqual(rst.get<std::string>("ZLONG"), std::vector<std::string>{ "A_LONG_NAME_C0NN" });
+}
+
+BOOST_AUTO_TEST_CASE(Incomplete_File_Rejected)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+    writeStep(rset, 1, true);
+    writeStep(rset, 2, true);
+
+    const auto companion = companionName(fname);
+    std::filesystem::resize_file(companion, std::filesystem::file_size(companion) - 4);
+
+    BOOST_CHECK_THROW(Opm::EclIO::CompressedRestartFile { companion }, std::runtime_error);
+
+    // Next report step recreates the companion file from scratch.
+    writeStep(rset, 3, true);
+
+    const auto file = Opm::EclIO::CompressedRestartFile { companion };
+    BOOST_REQUIRE(! file.entries().empty());
+    BOOST_CHECK_EQUAL(file.entries().front().seqnum, 3);
+}
+
+BOOST_AUTO_TEST_CASE(Corrupt_Index_Rejected)
+{
+    WorkArea work {"compressed_restart"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+    writeStep(rset, 1, true);
+
+    const auto companion = companionName(fname);
+    const auto fileSize = std::filesystem::file_size(companion);
+
+    // The index position is the last eight bytes of the file, and the
+    // index starts with the number of arrays.
+    auto indexPos = std::uint64_t{0};
+    {
+        auto is = std::ifstream { companion, std::ios::binary };
+        is.seekg(fileSize - sizeof indexPos);
+        is.read(reinterpret_cast<char*>(&indexPos), sizeof indexPos);
+    }
+
+    {
+        const auto numEntries = std::numeric_limits<std::uint64_t>::max() / 2;
+        auto os = std::fstream { companion, std::ios::binary | std::ios::in | std::ios::out };
+        os.seekp(indexPos);
+        os.write(reinterpret_cast<const char*>(&numEntries), sizeof numEntries);
+    }
+
+    BOOST_CHECK_THROW(Opm::EclIO::CompressedRestartFile { companion }, std::runtime_error);
+}
@@ -27,6 +27,7 @@
 #include <opm/io/eclipse/EclOutput.hpp>
 
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <math.h>
@@ -225,3 +226,80 @@ BOOST_AUTO_TEST_CASE(TestERft_2)
         BOOST_CHECK_EQUAL(compare_files("SPE1CASE1.RFT", "TEST.RFT"), true);
     }
 }
+
+
+
+BOOST_AUTO_TEST_CASE(Formatted_And_Const_Access)
+{
+    WorkArea work;
+    work.copyIn("SPE1CASE1.RFT");
+
+    {
+        EclOutput formatted("TEST.FRFT", true);
+
+        EclFile source("SPE1CASE1.RFT");
+        const auto arrays = source.getList();
+        for (auto i = 0*arrays.size(); i < arrays.size(); ++i) {
+            const auto& [arrName, arrType, size] = arrays[i];
+            if (arrType == INTE) {
+                formatted.write(arrName, source.get<int>(i));
+            } else if (arrType == REAL) {
+                formatted.write(arrName, source.get<float>(i));
+            } else if (arrType == DOUB) {
+                formatted.write(arrName, source.get<double>(i));
+            } else if (arrType == LOGI) {
+                formatted.write(arrName, source.get<bool>(i));
+            } else if (arrType == CHAR) {
+                formatted.write(arrName, source.get<std::string>(i));
+            } else if (arrType == MESS) {
+                formatted.write(arrName, std::vector<char>());
+            }
+        }
+    }
+
+    auto binary = ERft("SPE1CASE1.RFT");
+    binary.setMemoryBudget(1);
+
+    const auto& rft1 = binary;
+    const auto rft2 = ERft("TEST.FRFT");
+
+    // Arrays returned by value are unaffected by evictions from the array
+    // cache.
+    const auto pressure = rft1.getRft<float>("PRESSURE", "B-2H", 2016, 5, 31);
+    BOOST_CHECK_EQUAL(pressure.size(), 3U);
+
+    for (const auto& [wellName, date, time] : rft1.listOfRftReports()) {
+        for (const auto& [arrName, arrType, size] : rft1.listOfRftArrays(wellName, date)) {
+            if (arrType == INTE) {
+                BOOST_CHECK(rft1.getRft<int>(arrName, wellName, date) ==
+                            rft2.getRft<int>(arrName, wellName, date));
+            } else if (arrType == REAL) {
+                BOOST_CHECK(rft1.getRft<float>(arrName, wellName, date) ==
+                            rft2.getRft<float>(arrName, wellName, date));
+            } else if (arrType == LOGI) {
+                BOOST_CHECK(rft1.getRft<bool>(arrName, wellName, date) ==
+                            rft2.getRft<bool>(arrName, wellName, date));
+            } else if (arrType == CHAR) {
+                BOOST_CHECK(rft1.getRft<std::string>(arrName, wellName, date) ==
+                            rft2.getRft<std::string>(arrName, wellName, date));
+            }
+        }
+    }
+
+    BOOST_CHECK(pressure == rft2.getRft<float>("PRESSURE", "B-2H", 2016, 5, 31));
+}
+
+BOOST_AUTO_TEST_CASE(Loaded_Arrays_Served_From_Memory)
+{
+    WorkArea work;
+    work.copyIn("SPE1CASE1.RFT");
+
+    auto rft = ERft("SPE1CASE1.RFT");
+    const auto expect = rft.getRft<float>("PRESSURE", "B-2H", 2016, 5, 31);
+
+    // Once loaded, getRft() no longer reads from the file.
+    rft.loadData();
+    std::filesystem::resize_file("SPE1CASE1.RFT", 0);
+
+    BOOST_CHECK(rft.getRft<float>("PRESSURE", "B-2H", 2016, 5, 31) == expect);
+}
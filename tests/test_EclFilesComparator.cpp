@@ -44,6 +44,34 @@ BOOST_AUTO_TEST_CASE(deviation) {
 
 
 
+BOOST_AUTO_TEST_CASE(exceeds_tolerances) {
+    std::vector<double> v1(2000, 1.0);
+    std::vector<double> v2 = v1;
+    v1[10] = v2[10] = 0.0;
+
+    BOOST_CHECK(!exceedsTolerances(v1.data(), v2.data(), v1.size(), 1e-3, 1e-3));
+
+    // Absolute deviation within tolerance.
+    v2[1500] = 1.0005;
+    BOOST_CHECK(!exceedsTolerances(v1.data(), v2.data(), v1.size(), 1e-3, 1e-3));
+
+    // Relative deviation within tolerance.
+    v1[1700] = 1000.0;
+    v2[1700] = 1000.5;
+    BOOST_CHECK(!exceedsTolerances(v1.data(), v2.data(), v1.size(), 1e-3, 1e-3));
+
+    // Both deviations exceed tolerances.
+    v2[1999] = 1.1;
+    BOOST_CHECK(exceedsTolerances(v1.data(), v2.data(), v1.size(), 1e-3, 1e-3));
+    BOOST_CHECK(!exceedsTolerances(v1.data(), v2.data(), v1.size() - 1, 1e-3, 1e-3));
+
+    // Exactly one value zero: no relative deviation.
+    v2[10] = 0.01;
+    BOOST_CHECK(exceedsTolerances(v1.data(), v2.data(), 11, 1e-3, 1e6));
+}
+
+
+
 BOOST_AUTO_TEST_CASE(median) {
     std::vector<double> vec = {1,3,4,5};
 
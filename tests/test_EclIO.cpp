@@ -34,6 +34,7 @@
 #include <tuple>
 #include <cmath>
 #include <numeric>
+#include <span>
 
 #include <math.h>
 #include <stdio.h>
@@ -265,6 +266,121 @@ BOOST_AUTO_TEST_CASE(TestEclFile_IX)
         BOOST_CHECK_EQUAL(refLogihead[n], logih[n]);
 }
 
+BOOST_AUTO_TEST_CASE(TestEclFile_ArrayView)
+{
+    EclFile file1("ECLFILE.INIT");
+
+    const auto icon = file1.getView<int>("ICON");
+    const auto logihead = file1.getView<bool>("LOGIHEAD");
+    const auto porv = file1.getView<float>(2);
+    const auto xcon = file1.getView<double>("XCON");
+
+    // Views do not load arrays into the cache.
+    BOOST_CHECK_EQUAL(file1.memoryInUse(), std::size_t{0});
+
+    BOOST_CHECK_EQUAL(icon.size(), 1875U);
+    BOOST_CHECK_EQUAL(logihead.size(), 121U);
+    BOOST_CHECK_EQUAL(porv.size(), 3146U);
+    BOOST_CHECK_EQUAL(xcon.size(), 1740U);
+
+    BOOST_CHECK(icon.toVector() == file1.get<int>("ICON"));
+    BOOST_CHECK(logihead.toVector() == file1.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(porv.toVector() == file1.get<float>("PORV"));
+    BOOST_CHECK(xcon.toVector() == file1.get<double>("XCON"));
+
+    // Random access across block boundaries.
+    const auto& porvRef = file1.get<float>("PORV");
+    for (const auto i : { 0, 999, 1000, 1001, 2000, 3145 }) {
+        BOOST_CHECK_EQUAL(porv[i], porvRef[i]);
+    }
+
+    BOOST_CHECK(std::equal(porv.begin(), porv.end(), porvRef.begin()));
+    BOOST_CHECK_THROW(porv.at(3146), std::out_of_range);
+
+    // Partial conversion starting in the middle of a block.
+    std::vector<float> part(1500);
+    BOOST_CHECK_EQUAL(porv.copy(900, part), std::size_t{1500});
+    BOOST_CHECK(std::equal(part.begin(), part.end(), porvRef.begin() + 900));
+    BOOST_CHECK_EQUAL(porv.copy(3000, part), std::size_t{146});
+
+    BOOST_CHECK_THROW(file1.getView<float>("ICON"), std::runtime_error);
+    BOOST_CHECK_THROW(file1.getView<int>("XPORV"), std::invalid_argument);
+
+    // View outlives file object.
+    auto view = ArrayView<double>{};
+    {
+        EclFile file2("ECLFILE.INIT");
+        view = file2.getView<double>("XCON");
+    }
+
+    BOOST_CHECK(view.toVector() == file1.get<double>("XCON"));
+
+    EclFile file3("ECLFILE.FINIT");
+    BOOST_CHECK_THROW(file3.getView<int>("ICON"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryBudget)
+{
+    EclFile file1("ECLFILE.INIT");
+
+    file1.loadData();
+    const auto all = file1.memoryInUse();
+    BOOST_CHECK(all > 0);
+
+    // ICON (7500 bytes) and PORV (12584 bytes) do not fit together.
+    file1.setMemoryBudget(15000);
+    BOOST_CHECK(file1.memoryInUse() <= 15000);
+
+    file1.clearData();
+    BOOST_CHECK_EQUAL(file1.memoryInUse(), std::size_t{0});
+
+    const auto icon = file1.get<int>("ICON");
+    BOOST_CHECK_EQUAL(file1.memoryInUse(), std::size_t{7500});
+
+    const auto porv = file1.get<float>("PORV");
+    BOOST_CHECK_EQUAL(file1.memoryInUse(), std::size_t{12584});
+
+    // Evicted arrays are transparently reloaded.
+    BOOST_CHECK(file1.get<int>("ICON") == icon);
+    BOOST_CHECK_EQUAL(file1.memoryInUse(), std::size_t{7500});
+
+    // Single array exceeding budget is still loaded.
+    file1.setMemoryBudget(100);
+    BOOST_CHECK(file1.get<float>("PORV") == porv);
+
+    // Lifting limit keeps everything.
+    file1.setMemoryBudget(0);
+    file1.loadData();
+    BOOST_CHECK_EQUAL(file1.memoryInUse(), all);
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryBudget_Copy)
+{
+    EclFile file1("ECLFILE.INIT");
+    file1.setMemoryBudget(15000);
+
+    const auto icon = file1.get<int>("ICON");
+    const auto porv = file1.get<float>("PORV");
+
+    // Copies track the use of their own arrays, so evicting from either
+    // must not touch the other.
+    EclFile file2 = file1;
+    BOOST_CHECK_EQUAL(file2.memoryInUse(), std::size_t{12584});
+
+    BOOST_CHECK(file2.get<int>("ICON") == icon);
+    BOOST_CHECK_EQUAL(file2.memoryInUse(), std::size_t{7500});
+    BOOST_CHECK_EQUAL(file1.memoryInUse(), std::size_t{12584});
+
+    file1 = file2;
+    BOOST_CHECK(file1.get<float>("PORV") == porv);
+    BOOST_CHECK(file2.get<float>("PORV") == porv);
+    BOOST_CHECK_EQUAL(file1.memoryInUse(), std::size_t{12584});
+    BOOST_CHECK_EQUAL(file2.memoryInUse(), std::size_t{12584});
+
+    file1.clearData();
+    BOOST_CHECK(file2.get<int>("ICON") == icon);
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_Write_binary)
 {
     std::string inputFile="ECLFILE.INIT";
@@ -358,6 +474,50 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_not_finite)
     BOOST_CHECK_EQUAL(file1.size(), 2U);
 }
 
+BOOST_AUTO_TEST_CASE(TestEcl_Write_converted)
+{
+    // Several output blocks, last one partially filled.
+    auto si = std::vector<double>(2519);
+    std::iota(si.begin(), si.end(), 0.0);
+    std::ranges::transform(si, si.begin(), [](const double x) { return 273.15 + 0.1*x; });
+
+    const auto original = si;
+    const auto factor = 1.0 / 3.0;
+    const auto offset = 273.15;
+
+    auto converted = std::vector<double>(si.size());
+    std::ranges::transform(si, converted.begin(),
+                           [=](const double x) { return (x - offset) * factor; });
+
+    const auto convertedF = std::vector<float>(converted.begin(), converted.end());
+
+    WorkArea work;
+
+    for (const auto formatted : { false, true }) {
+        const std::string refFile  = formatted ? "REF.FDAT" : "REF.DAT";
+        const std::string testFile = formatted ? "TEST.FDAT" : "TEST.DAT";
+
+        {
+            EclOutput ref(refFile, formatted);
+            ref.write("REAL", convertedF);
+            ref.write("DOUB", converted);
+            ref.write("EMPTY", std::vector<float>{});
+        }
+
+        {
+            EclOutput test(testFile, formatted);
+            test.writeConverted<float>("REAL", si, factor, offset);
+            test.writeConverted<double>("DOUB", si, factor, offset);
+            test.writeConverted<float>("EMPTY", std::span<const double>{}, factor);
+        }
+
+        BOOST_CHECK_MESSAGE(compare_files(refFile, testFile),
+                            "Converted output must match output of converted vector");
+    }
+
+    BOOST_CHECK_MESSAGE(si == original, "Input data must not be modified");
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_getList)
 {
     std::string inputFile="ECLFILE.INIT";
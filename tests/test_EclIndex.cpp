@@ -0,0 +1,329 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE EclIndex
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/EclIndex.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ERft.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
+#include <opm/io/eclipse/OutputStream.hpp>
+#include <opm/io/eclipse/PaddedOutputString.hpp>
+
+#include <filesystem>
+#include <ios>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+namespace Opm::EclIO {
+
+    // Needed by BOOST_CHECK_EQUAL_COLLECTIONS.
+    static std::ostream&
+    operator<<(std::ostream& os, const EclIndex::Entry& e)
+    {
+        os << "{ " << e.name
+           << ", " << static_cast<int>(e.type)
+           << ", " << e.elementSize
+           << ", " << e.size
+           << ", " << e.dataPos
+           << " }";
+
+        return os;
+    }
+
+} // namespace Opm::EclIO
+
+namespace {
+
+    void writeStep(const Opm::EclIO::OutputStream::ResultSet& rset,
+                   const int seqnum, const bool formatted)
+    {
+        auto rst = Opm::EclIO::OutputStream::Restart {
+            rset, seqnum,
+            Opm::EclIO::OutputStream::Formatted { formatted },
+            Opm::EclIO::OutputStream::Unified   { true }
+        };
+
+        rst.write("INTEHEAD", std::vector<int>(seqnum + 10, seqnum));
+        rst.write("LOGIHEAD", std::vector<bool>{ true, false, seqnum % 2 == 0 });
+        rst.write("DOUBHEAD", std::vector<double>(seqnum + 2, 1.5 * seqnum));
+        rst.write("ZWEL", std::vector<std::string>{ "PROD", "INJ" });
+        rst.message("STARTSOL");
+        rst.write("PRESSURE", std::vector<float>(100, 250.0f + seqnum));
+        rst.write("WELLNAME", std::vector<std::string>{ "OP_1" });
+        rst.message("ENDSOL");
+    }
+
+    void checkIndexMatchesScan(const std::string& fname, const bool formatted)
+    {
+        const auto index = Opm::EclIO::EclIndex::load(fname, formatted);
+        BOOST_REQUIRE_MESSAGE(index.has_value(),
+                              "Side-car index must exist and be valid for " << fname);
+
+        const auto scanned = Opm::EclIO::EclIndex::scan(fname, formatted);
+
+        BOOST_CHECK_EQUAL(index->endPosition(), scanned.endPosition());
+        BOOST_CHECK_EQUAL_COLLECTIONS(index->entries().begin(), index->entries().end(),
+                                      scanned.entries().begin(), scanned.entries().end());
+    }
+
+    void writeRftRecord(const Opm::EclIO::OutputStream::ResultSet& rset,
+                        const std::string& well, const int day,
+                        const bool formatted, const bool existing)
+    {
+        using Char8 = Opm::EclIO::PaddedOutputString<8>;
+
+        auto rft = Opm::EclIO::OutputStream::RFT {
+            rset,
+            Opm::EclIO::OutputStream::Formatted { formatted },
+            Opm::EclIO::OutputStream::RFT::OpenExisting { existing }
+        };
+
+        auto welletc = std::vector<Char8>(16);
+        welletc[1] = well;
+        welletc[5] = "R";
+
+        rft.write("TIME", std::vector<float>{ static_cast<float>(day) });
+        rft.write("DATE", std::vector<int>{ day, 1, 2020 });
+        rft.write("WELLETC", welletc);
+        rft.write("DEPTH", std::vector<float>(5, 1000.0f + day));
+        rft.write("PRESSURE", std::vector<float>(5, 250.0f + day));
+    }
+
+    void checkUnifiedRestart(const bool formatted)
+    {
+        WorkArea work {"eclindex"};
+
+        const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+        const auto fname = Opm::EclIO::OutputStream::
+            outputFileName(rset, formatted ? "FUNRST" : "UNRST");
+
+        for (const auto seqnum : { 1, 2, 3 }) {
+            writeStep(rset, seqnum, formatted);
+            checkIndexMatchesScan(fname, formatted);
+        }
+
+        // Overwrite report step 2.  Drops step 3.
+        writeStep(rset, 2, formatted);
+        checkIndexMatchesScan(fname, formatted);
+
+        auto rst = Opm::EclIO::ERst { fname };
+
+        const auto& seqnum = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int> { 1, 2 };
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(), expect_seqnum.end());
+
+        const auto& inteh = rst.getRestartData<int>("INTEHEAD", 2);
+        BOOST_CHECK_EQUAL(inteh.size(), std::size_t{12});
+        BOOST_CHECK_EQUAL(inteh.front(), 2);
+
+        const auto& pres = rst.getRestartData<float>("PRESSURE", 1);
+        BOOST_CHECK_EQUAL(pres.size(), std::size_t{100});
+        BOOST_CHECK_CLOSE(pres.back(), 251.0f, 1.0e-5f);
+
+        const auto& wname = rst.getRestartData<std::string>("WELLNAME", 2);
+        BOOST_CHECK_EQUAL(wname.front(), "OP_1");
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Unified_Restart_Unformatted)
+{
+    checkUnifiedRestart(false);
+}
+
+BOOST_AUTO_TEST_CASE(Unified_Restart_Formatted)
+{
+    checkUnifiedRestart(true);
+}
+
+BOOST_AUTO_TEST_CASE(Separate_Restart_Not_Indexed)
+{
+    WorkArea work {"eclindex"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+
+    {
+        auto rst = Opm::EclIO::OutputStream::Restart {
+            rset, 1,
+            Opm::EclIO::OutputStream::Formatted { false },
+            Opm::EclIO::OutputStream::Unified   { false }
+        };
+
+        rst.write("INTEHEAD", std::vector<int>(10, 1));
+    }
+
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "X0001");
+    BOOST_CHECK(! std::filesystem::exists(Opm::EclIO::EclIndex::indexFileName(fname)));
+}
+
+BOOST_AUTO_TEST_CASE(Stale_Index_Ignored)
+{
+    WorkArea work {"eclindex"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+    writeStep(rset, 1, false);
+    BOOST_CHECK(Opm::EclIO::EclIndex::load(fname, false).has_value());
+
+    // Modify result file without updating index.
+    {
+        auto output = Opm::EclIO::EclOutput { fname, false, std::ios::app };
+        output.write("EXTRA", std::vector<int>{ 1, 2, 3 });
+    }
+
+    BOOST_CHECK(! Opm::EclIO::EclIndex::load(fname, false).has_value());
+
+    // Readers fall back to scanning the file.
+    auto file = Opm::EclIO::EclFile { fname };
+    BOOST_CHECK(file.hasKey("EXTRA"));
+
+    const auto& extra = file.get<int>("EXTRA");
+    BOOST_CHECK_EQUAL(extra.size(), std::size_t{3});
+
+    // Format mismatch
+    auto index = Opm::EclIO::EclIndex::scan(fname, false);
+    index.write(fname);
+    BOOST_CHECK(  Opm::EclIO::EclIndex::load(fname, false).has_value());
+    BOOST_CHECK(! Opm::EclIO::EclIndex::load(fname, true) .has_value());
+
+    Opm::EclIO::EclIndex::remove(fname);
+    BOOST_CHECK(! Opm::EclIO::EclIndex::load(fname, false).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(Unified_Summary)
+{
+    WorkArea work {"eclindex"};
+
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    auto expect = std::vector<float>{};
+    auto expect_rstep = std::vector<float>{};
+    {
+        auto smry = Opm::EclIO::ESmry { "SPE1CASE1.SMSPEC" };
+        expect = smry.get("FOPR");
+        expect_rstep = smry.get_at_rstep("WBHP:PROD");
+    }
+
+    auto index = Opm::EclIO::EclIndex::scan("SPE1CASE1.UNSMRY", false);
+    index.write("SPE1CASE1.UNSMRY");
+
+    BOOST_REQUIRE(Opm::EclIO::EclIndex::load("SPE1CASE1.UNSMRY", false).has_value());
+
+    auto smry = Opm::EclIO::ESmry { "SPE1CASE1.SMSPEC" };
+
+    const auto& fopr = smry.get("FOPR");
+    BOOST_CHECK_EQUAL_COLLECTIONS(fopr.begin(), fopr.end(),
+                                  expect.begin(), expect.end());
+
+    const auto wbhp = smry.get_at_rstep("WBHP:PROD");
+    BOOST_CHECK_EQUAL_COLLECTIONS(wbhp.begin(), wbhp.end(),
+                                  expect_rstep.begin(), expect_rstep.end());
+}
+
+BOOST_AUTO_TEST_CASE(Summary_Stream)
+{
+    WorkArea work {"eclindex"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+
+    {
+        auto smry = Opm::EclIO::OutputStream::createSummaryFile
+            (rset, 1,
+             Opm::EclIO::OutputStream::Formatted { false },
+             Opm::EclIO::OutputStream::Unified   { true });
+
+        for (auto step = 1; step <= 5; ++step) {
+            smry->write("SEQHDR", std::vector<int>{ step });
+            smry->write("MINISTEP", std::vector<int>{ step - 1 });
+            smry->write("PARAMS", std::vector<float>(7, 0.5f * step));
+        }
+
+        smry->writeIndex();
+    }
+
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "UNSMRY");
+    checkIndexMatchesScan(fname, false);
+}
+
+BOOST_AUTO_TEST_CASE(RFT_Stream)
+{
+    for (const auto formatted : { false, true }) {
+        WorkArea work {"eclindex"};
+
+        const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+        const auto fname = Opm::EclIO::OutputStream::
+            outputFileName(rset, formatted ? "FRFT" : "RFT");
+
+        writeRftRecord(rset, "PROD", 1, formatted, false);
+        checkIndexMatchesScan(fname, formatted);
+
+        writeRftRecord(rset, "INJ", 2, formatted, true);
+        writeRftRecord(rset, "PROD", 3, formatted, true);
+        checkIndexMatchesScan(fname, formatted);
+
+        auto rft = Opm::EclIO::ERft { fname };
+        BOOST_CHECK_EQUAL(rft.numberOfReports(), 3);
+
+        const auto& depth = rft.getRft<float>("DEPTH", "INJ", 2020, 1, 2);
+        BOOST_CHECK_EQUAL(depth.size(), std::size_t{5});
+        BOOST_CHECK_CLOSE(depth.front(), 1002.0f, 1.0e-5);
+
+        const auto& press = rft.getRft<float>("PRESSURE", 2);
+        BOOST_CHECK_CLOSE(press.back(), 253.0f, 1.0e-5);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RFT_Existing_Without_Index)
+{
+    WorkArea work {"eclindex"};
+
+    work.copyIn("SPE1CASE1.RFT");
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "SPE1CASE1" };
+    const auto fname = Opm::EclIO::OutputStream::outputFileName(rset, "RFT");
+
+    BOOST_REQUIRE(! Opm::EclIO::EclIndex::load(fname, false).has_value());
+
+    // Existing records are indexed by scanning the file when appending.
+    writeRftRecord(rset, "PROD", 17, false, true);
+    checkIndexMatchesScan(fname, false);
+
+    auto rft = Opm::EclIO::ERft { fname };
+    BOOST_CHECK_EQUAL(rft.numberOfReports(), 6);
+    BOOST_CHECK(rft.hasRft("B-2H", 2016, 5, 31));
+    BOOST_CHECK(rft.hasRft("PROD", 2020, 1, 17));
+
+    const auto& sgas = rft.getRft<float>("SGAS", "B-2H", 2016, 5, 31);
+    BOOST_CHECK(! sgas.empty());
+}
@@ -447,6 +447,72 @@ BOOST_AUTO_TEST_CASE(gridCompare)
     BOOST_CHECK_THROW(test6.gridCompare(),std::runtime_error);
 }
 
+BOOST_AUTO_TEST_CASE(memory_budget)
+{
+    WorkArea work;
+
+    // Arrays larger than the memory budget, so every array is released
+    // again as soon as the next one is loaded.
+    const std::size_t numCells = 20000;
+    const std::size_t budget = 1024;
+
+    std::vector<float> porv(numCells);
+    for (std::size_t i = 0; i < numCells; i++) {
+        porv[i] = 1000.0f + i;
+    }
+    const std::vector<int> fipnum(numCells, 1);
+
+    makeInitFile("TMP1.INIT", {"PORV"}, {porv}, {"FIPNUM"}, {fipnum});
+    makeInitFile("TMP2.INIT", {"PORV"}, {porv}, {"FIPNUM"}, {fipnum});
+
+    ECLRegressionTest init1("TMP1", "TMP2", 1e-3, 1e-3);
+    init1.setMemoryBudget(budget);
+    init1.results_init();
+
+    auto porv2 = porv;
+    porv2[numCells - 1] *= 1.1f;
+    makeInitFile("TMP2.INIT", {"PORV"}, {porv2}, {"FIPNUM"}, {fipnum});
+
+    ECLRegressionTest init2("TMP1", "TMP2", 1e-3, 1e-3);
+    init2.setMemoryBudget(budget);
+    BOOST_CHECK_THROW(init2.results_init(), std::runtime_error);
+
+    init2.doAnalysis(true);
+    init2.results_init();
+    BOOST_CHECK_EQUAL(init2.countDev(), 1);
+
+    // RFT arrays, both within and outside tolerances.
+    using Date = std::tuple<int, int, int>;
+
+    const std::vector<float> time = {0.0, 40.0};
+    const std::vector<Date> date = { Date{2000,1,1}, Date{2000,2,10} };
+    const std::vector<std::string> wellN = {"A-1H", "A-1H"};
+
+    const std::vector<std::vector<int>> conpos = {{1,1},{1,1}};
+    const std::vector<std::vector<float>> depth = {{2004.68,2009.67},{2004.68,2009.67}};
+
+    const std::vector<std::vector<float>> pressure1 = {{208.75, 209.07},{178.045, 178.361}};
+    const std::vector<std::vector<float>> pressure2 = {{208.75, 209.07},{178.045, 178.362}};
+    const std::vector<std::vector<float>> pressure3 = {{208.75, 209.07},{178.045, 188.361}};
+
+    makeRftFile("TMP1.RFT", time, date, wellN, conpos, conpos, conpos, depth, {"PRESSURE"}, {pressure1});
+    makeRftFile("TMP2.RFT", time, date, wellN, conpos, conpos, conpos, depth, {"PRESSURE"}, {pressure2});
+
+    ECLRegressionTest rft1("TMP1", "TMP2", 1e-3, 1e-3);
+    rft1.setMemoryBudget(budget);
+    rft1.results_rft();
+
+    makeRftFile("TMP2.RFT", time, date, wellN, conpos, conpos, conpos, depth, {"PRESSURE"}, {pressure3});
+
+    ECLRegressionTest rft2("TMP1", "TMP2", 1e-3, 1e-3);
+    rft2.setMemoryBudget(budget);
+    BOOST_CHECK_THROW(rft2.results_rft(), std::runtime_error);
+
+    rft2.doAnalysis(true);
+    rft2.results_rft();
+    BOOST_CHECK_EQUAL(rft2.countDev(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(results_init_1)
 {
     WorkArea work;
@@ -952,6 +1018,54 @@ BOOST_AUTO_TEST_CASE(results_unrst_3)
 
 }
 
+BOOST_AUTO_TEST_CASE(results_unrst_doub)
+{
+    WorkArea work;
+    using Date = std::tuple<int, int, int>;
+
+    const std::vector<int> seqnum = {0};
+    const std::vector<Date> dates = { Date{2000,1,1} };
+    const std::vector<double> time = {0};
+    std::vector<bool> logihead(121, false);
+    logihead[3] = logihead[8] = true;
+    std::vector<double> doubhead = {0.0,1,0, 365, 0.10000000149012E+00,0.15000000596046E+00,0.30000000000000E+01};
+    doubhead.resize(229, 0.0);
+    const std::vector<std::string> zgrp = {"GRP1", "GRP2"};
+    const std::vector<int> iwel = {1,4,6,8};
+
+    // Single report step with a DOUB pressure array.
+    auto makeFile = [&](const std::string& fileName, const std::vector<double>& pressure)
+    {
+        makeUnrstFile(fileName, seqnum, dates, time, logihead, doubhead, zgrp, iwel, {}, {});
+        EclOutput eclTest(fileName, false, std::ios::app);
+        eclTest.write("PRESSURE", pressure);
+    };
+
+    const std::vector<double> pressure1 = {210, 210.1, 210.2, 210.05, 210.15, 210.25};
+    auto pressure2 = pressure1;
+    pressure2[5] = 230.25;
+
+    makeFile("TMP1.UNRST", pressure1);
+    makeFile("TMP2.UNRST", pressure1);
+
+    ECLRegressionTest test1("TMP1", "TMP2", 1e-3, 1e-3);
+    test1.results_rst();
+
+    // integration tests compare DOUB arrays as double
+    test1.setIntegrationTest(true);
+    test1.results_rst();
+
+    makeFile("TMP2.UNRST", pressure2);
+
+    ECLRegressionTest test2("TMP1", "TMP2", 1e-3, 1e-3);
+    test2.setIntegrationTest(true);
+    BOOST_CHECK_THROW(test2.results_rst(), std::runtime_error);
+
+    test2.doAnalysis(true);
+    test2.results_rst();
+    BOOST_CHECK_EQUAL(test2.countDev(), 1);
+}
+
 
 BOOST_AUTO_TEST_CASE(results_unsmry_1) {
     WorkArea work;
@@ -56,6 +56,7 @@
 #include <algorithm>
 #include <fstream>
 #include <ios>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -67,6 +68,10 @@
 
 #include <time.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <tests/WorkArea.hpp>
 
 using namespace Opm;
@@ -433,6 +438,173 @@ WELSPECS
     BOOST_CHECK_EQUAL(file_size, write_and_check(3, 5));
 }
 
+BOOST_AUTO_TEST_CASE(EclipseIOAsyncRestart)
+{
+    const auto deckString = std::string { R"(RUNSPEC
+UNIFOUT
+OIL
+GAS
+WATER
+METRIC
+DIMENS
+3 3 3/
+GRID
+DXV
+1.0 2.0 3.0 /
+DYV
+4.0 5.0 6.0 /
+DZV
+7.0 8.0 9.0 /
+TOPS
+9*100 /
+PORO
+27*0.15 /
+PERMX
+27*1 /
+SOLUTION
+RPTRST
+BASIC=2
+/
+SCHEDULE
+TSTEP
+1.0 2.0 3.0 4.0 5.0 6.0 7.0 /
+)" };
+
+    // Writes restart files for steps 1..4 and returns the UNRST contents.
+    auto write_steps = [&deckString](const std::string& baseName,
+                                     const std::size_t  maxPending)
+    {
+        const auto deck = Parser().parseString(deckString);
+        auto es = EclipseState(deck);
+        const Schedule schedule(deck, es, std::make_shared<Python>());
+        const SummaryConfig summary_config(deck, schedule, es.fieldProps(), es.aquifer());
+        es.getIOConfig().setBaseName(baseName);
+
+        EclipseIO eclWriter(es, es.getInputGrid(), schedule, summary_config);
+        eclWriter.setAsyncRestartOutput(maxPending);
+
+        const auto start_time = ecl_util_make_date(10, 10, 2008);
+
+        for (int i = 1; i < 5; ++i) {
+            data::Solution sol = createBlackoilState(i, 3 * 3 * 3);
+
+            // The state objects and the RestartValue are released before
+            // the asynchronous output completes.
+            Action::State action_state;
+            WellTestState wtest_state;
+            UDQState udq_state(1);
+            const SummaryState st(TimeService::now(), 0.0);
+
+            eclWriter.writeTimeStep(action_state, wtest_state, st, udq_state,
+                                    i, false,
+                                    ecl_util_make_date(10 + i, 11, 2008) - start_time,
+                                    RestartValue(sol, data::Wells{},
+                                                 data::GroupAndNetworkValues{}, {}));
+        }
+
+        eclWriter.waitForRestartOutput();
+
+        std::ifstream file(baseName + ".UNRST", std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), {});
+    };
+
+    WorkArea work_area("test_ecl_writer_async");
+
+    const auto sync = write_steps("SYNC", 0);
+    const auto async = write_steps("ASYNC", 2);
+
+    BOOST_CHECK(!sync.empty());
+    BOOST_CHECK(sync == async);
+
+    EclIO::ERst rstFile("ASYNC.UNRST");
+    for (int i = 1; i < 5; ++i) {
+        BOOST_CHECK_MESSAGE(rstFile.hasReportStepNumber(i),
+                            "Asynchronous restart file must have report step " << i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(EclipseIOMonitoringRestart)
+{
+    const auto deckString = std::string { R"(RUNSPEC
+UNIFOUT
+OIL
+GAS
+WATER
+METRIC
+DIMENS
+3 3 3/
+GRID
+DXV
+1.0 2.0 3.0 /
+DYV
+4.0 5.0 6.0 /
+DZV
+7.0 8.0 9.0 /
+TOPS
+9*100 /
+PORO
+27*0.15 /
+PERMX
+27*1 /
+SOLUTION
+RPTRST
+BASIC=2
+/
+SCHEDULE
+TSTEP
+1.0 2.0 3.0 4.0 5.0 6.0 7.0 /
+)" };
+
+    WorkArea work_area("test_ecl_writer_monitor");
+
+    const auto deck = Parser().parseString(deckString);
+    auto es = EclipseState(deck);
+    const Schedule schedule(deck, es, std::make_shared<Python>());
+    const SummaryConfig summary_config(deck, schedule, es.fieldProps(), es.aquifer());
+    es.getIOConfig().setBaseName("MON");
+
+    EclipseIO eclWriter(es, es.getInputGrid(), schedule, summary_config);
+
+    const auto start_time = ecl_util_make_date(10, 10, 2008);
+    auto writeStep = [&eclWriter, start_time](const int i)
+    {
+        const Action::State action_state;
+        const WellTestState wtest_state;
+        const UDQState udq_state(1);
+        const SummaryState st(TimeService::now(), 0.0);
+
+        eclWriter.writeTimeStep(action_state, wtest_state, st, udq_state,
+                                i, false,
+                                ecl_util_make_date(10 + i, 11, 2008) - start_time,
+                                RestartValue(createBlackoilState(i, 3 * 3 * 3), data::Wells{},
+                                             data::GroupAndNetworkValues{}, {}));
+    };
+
+    writeStep(1);
+
+    auto policy = EclIO::RestartOutputPolicy { 3 * 3 * 3 };
+    policy.selectArrays({ "PRESSURE" }).selectCellRange(0, 9);
+    eclWriter.setRestartOutputPolicy(std::move(policy));
+    writeStep(2);
+
+    eclWriter.setRestartOutputPolicy(EclIO::RestartOutputPolicy{});
+    writeStep(3);
+
+    // Regular restart file remains complete.
+    EclIO::ERst full("MON.UNRST");
+    BOOST_CHECK(full.hasReportStepNumber(1));
+    BOOST_CHECK(!full.hasReportStepNumber(2));
+    BOOST_CHECK(full.hasReportStepNumber(3));
+    BOOST_CHECK_EQUAL(full.getRestartData<float>("PRESSURE", 3).size(), std::size_t{27});
+    BOOST_CHECK_EQUAL(full.getRestartData<float>("SWAT", 3).size(), std::size_t{27});
+
+    EclIO::ERst monitor("MON_MON.UNRST");
+    BOOST_CHECK(!monitor.hasReportStepNumber(1));
+    BOOST_CHECK(monitor.hasReportStepNumber(2));
+    BOOST_CHECK_EQUAL(monitor.getRestartData<float>("PRESSURE", 2).size(), std::size_t{9});
+    BOOST_CHECK(!monitor.hasArray("SWAT", 2));
+}
+
 namespace {
 
 std::pair<std::string,std::array<std::array<std::vector<float>,2>,3>>
@@ -948,3 +1120,115 @@ BOOST_AUTO_TEST_CASE(MULTPVBOXInit)
 {
     checkMULTPV(createMULTPVBOXDECK());
 }
+
+#ifdef _OPENMP
+
+namespace {
+
+// Grid large enough for the per-cell INIT arrays to be computed in
+// parallel, with varying cell sizes and some inactive cells.
+std::string createLargeInitDeck()
+{
+    const auto nx = 20, ny = 20, nz = 15;
+
+    auto deckString = std::string { R"(RUNSPEC
+DIMENS
+20 20 15 /
+OIL
+GAS
+WATER
+METRIC
+UNIFOUT
+GRID
+INIT
+)" };
+
+    const auto values = [](const int n, auto&& value)
+    {
+        auto s = std::string{};
+        for (auto i = 0; i < n; ++i) {
+            s += std::to_string(value(i)) + ' ';
+        }
+        return s + "/\n";
+    };
+
+    deckString += "DXV\n" + values(nx, [](int i) { return 10.0 + 0.5*i; });
+    deckString += "DYV\n" + values(ny, [](int j) { return 20.0 - 0.25*j; });
+    deckString += "DZV\n" + values(nz, [](int k) { return 1.0 + 0.1*k; });
+    deckString += "TOPS\n" + values(nx*ny, [](int c) { return 2000.0 + 0.01*c; });
+    deckString += "ACTNUM\n" + values(nx*ny*nz, [](int c) { return (c % 7 == 3) ? 0 : 1; });
+    deckString += "PORO\n" + values(nx*ny*nz, [](int c) { return 0.1 + 0.001*(c % 100); });
+    deckString += "PERMX\n" + values(nx*ny*nz, [](int c) { return 100.0 + c; });
+    deckString += std::string { R"(COPY
+PERMX PERMY /
+PERMX PERMZ /
+/
+PROPS
+SWOF
+0.1 0.0 1.0 0.0
+0.5 0.3 0.3 0.0
+1.0 1.0 0.0 0.0 /
+SGOF
+0.0 0.0 1.0 0.0
+0.5 0.4 0.2 0.0
+0.9 1.0 0.0 0.0 /
+DENSITY
+800 1000 1 /
+PVTW
+250 1.0 4.0E-5 0.5 0 /
+PVDO
+100 1.10 1.0
+300 1.05 1.2 /
+PVDG
+100 0.010 0.015
+300 0.004 0.020 /
+SCHEDULE
+)" };
+
+    return deckString;
+}
+
+std::string readFile(const std::string& filename)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    return { std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+}
+
+void writeInitFile(const std::string& deckString,
+                   const std::string& baseName,
+                   const int          numThreads)
+{
+    const auto deck = Parser().parseString(deckString);
+    auto es = EclipseState(deck);
+    const Schedule schedule(deck, es, std::make_shared<Python>());
+    const SummaryConfig summary_config(deck, schedule, es.fieldProps(), es.aquifer());
+    es.getIOConfig().setBaseName(baseName);
+
+    const auto origThreads = omp_get_max_threads();
+    omp_set_num_threads(numThreads);
+
+    EclipseIO eclWriter(es, es.getInputGrid(), schedule, summary_config);
+    eclWriter.writeInitial();
+
+    omp_set_num_threads(origThreads);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(InitThreadCountIndependent)
+{
+    WorkArea work_area("test_init_threads");
+    const auto deckString = createLargeInitDeck();
+
+    writeInitFile(deckString, "SERIAL", 1);
+    writeInitFile(deckString, "THREADED", std::max(4, omp_get_num_procs()));
+
+    const auto serial = readFile("SERIAL.INIT");
+    const auto threaded = readFile("THREADED.INIT");
+
+    BOOST_REQUIRE(!serial.empty());
+    BOOST_CHECK_MESSAGE(serial == threaded,
+                        "INIT file must not depend on the number of threads");
+}
+
+#endif // _OPENMP
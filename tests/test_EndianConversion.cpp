@@ -0,0 +1,209 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE Endian_Conversion
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/EndianConversion.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+using Opm::EclIO::ByteSwapKernel;
+
+namespace {
+
+    std::vector<ByteSwapKernel> availableKernels()
+    {
+        auto kernels = std::vector<ByteSwapKernel>{};
+
+        for (const auto k : { ByteSwapKernel::Portable,
+                              ByteSwapKernel::AVX2,
+                              ByteSwapKernel::NEON })
+        {
+            if (Opm::EclIO::isAvailable(k)) {
+                kernels.push_back(k);
+            }
+        }
+
+        return kernels;
+    }
+
+    // Byte pattern with distinct values in every position.
+    std::vector<unsigned char> sourceBytes(const std::size_t n)
+    {
+        auto bytes = std::vector<unsigned char>(n);
+        std::iota(bytes.begin(), bytes.end(), static_cast<unsigned char>(1));
+        return bytes;
+    }
+
+    template <typename UInt>
+    void checkReversed(const unsigned char* src,
+                       const unsigned char* dst,
+                       const std::size_t    n)
+    {
+        for (auto i = 0*n; i < n; ++i) {
+            for (auto b = 0*sizeof(UInt); b < sizeof(UInt); ++b) {
+                BOOST_REQUIRE_EQUAL(int(dst[i*sizeof(UInt) + b]),
+                                    int(src[i*sizeof(UInt) + sizeof(UInt) - 1 - b]));
+            }
+        }
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Portable_Always_Available)
+{
+    BOOST_CHECK(Opm::EclIO::isAvailable(ByteSwapKernel::Portable));
+    BOOST_CHECK(Opm::EclIO::isAvailable(Opm::EclIO::defaultByteSwapKernel()));
+}
+
+BOOST_AUTO_TEST_CASE(Swap_32_Bit)
+{
+    // Cover vector bodies, remainders, and misaligned buffers.
+    for (const auto kernel : availableKernels()) {
+        BOOST_TEST_MESSAGE("Kernel " << Opm::EclIO::kernelName(kernel));
+
+        for (const auto offset : { 0, 1, 3 }) {
+            for (const auto n : { 0, 1, 7, 8, 15, 16, 17, 63, 1000 }) {
+                const auto src = sourceBytes(n*4 + offset);
+                auto dst = src;
+
+                Opm::EclIO::byteSwap32(src.data() + offset, dst.data() + offset, n, kernel);
+                checkReversed<std::uint32_t>(src.data() + offset, dst.data() + offset, n);
+
+                // In place
+                auto inplace = src;
+                Opm::EclIO::byteSwap32(inplace.data() + offset, inplace.data() + offset, n, kernel);
+                BOOST_CHECK(inplace == dst);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Swap_64_Bit)
+{
+    for (const auto kernel : availableKernels()) {
+        BOOST_TEST_MESSAGE("Kernel " << Opm::EclIO::kernelName(kernel));
+
+        for (const auto offset : { 0, 1, 5 }) {
+            for (const auto n : { 0, 1, 3, 4, 7, 8, 9, 31, 1000 }) {
+                const auto src = sourceBytes(n*8 + offset);
+                auto dst = src;
+
+                Opm::EclIO::byteSwap64(src.data() + offset, dst.data() + offset, n, kernel);
+                checkReversed<std::uint64_t>(src.data() + offset, dst.data() + offset, n);
+
+                auto inplace = src;
+                Opm::EclIO::byteSwap64(inplace.data() + offset, inplace.data() + offset, n, kernel);
+                BOOST_CHECK(inplace == dst);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Typed_Matches_Scalar)
+{
+    auto ints = std::vector<int>(1234);
+    std::iota(ints.begin(), ints.end(), -617);
+
+    auto doubles = std::vector<double>(ints.begin(), ints.end());
+    for (auto& d : doubles) { d *= 0.125; }
+
+    auto floats = std::vector<float>(doubles.begin(), doubles.end());
+
+    auto flippedInts = ints;
+    auto flippedFloats = floats;
+    auto flippedDoubles = doubles;
+
+    Opm::EclIO::flipEndianArray(flippedInts.data(), flippedInts.size());
+    Opm::EclIO::flipEndianArray(flippedFloats.data(), flippedFloats.size());
+    Opm::EclIO::flipEndianArray(flippedDoubles.data(), flippedDoubles.size());
+
+    for (auto i = 0*ints.size(); i < ints.size(); ++i) {
+        BOOST_CHECK_EQUAL(flippedInts[i], Opm::EclIO::flipEndianInt(ints[i]));
+
+        const auto f = Opm::EclIO::flipEndianFloat(floats[i]);
+        BOOST_CHECK(std::memcmp(&flippedFloats[i], &f, sizeof f) == 0);
+
+        const auto d = Opm::EclIO::flipEndianDouble(doubles[i]);
+        BOOST_CHECK(std::memcmp(&flippedDoubles[i], &d, sizeof d) == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Unavailable_Kernel_Throws)
+{
+    for (const auto kernel : { ByteSwapKernel::AVX2, ByteSwapKernel::NEON }) {
+        if (Opm::EclIO::isAvailable(kernel)) {
+            continue;
+        }
+
+        auto x = std::vector<std::uint32_t>(16);
+        BOOST_CHECK_THROW(Opm::EclIO::byteSwap32(x.data(), x.data(), x.size(), kernel),
+                          std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Multi_Block_Round_Trip)
+{
+    WorkArea work {"endian_conversion"};
+
+    // Sizes straddling the 1000 element block boundary of binary files.
+    auto inte = std::vector<int>(2501);
+    std::iota(inte.begin(), inte.end(), -1250);
+
+    auto real = std::vector<float>(inte.begin(), inte.end());
+    auto doub = std::vector<double>(inte.begin(), inte.end());
+
+    auto logi = std::vector<bool>(1001);
+    for (auto i = 0*logi.size(); i < logi.size(); ++i) {
+        logi[i] = (i % 3) == 0;
+    }
+
+    {
+        auto output = Opm::EclIO::EclOutput { "TEST.INIT", false };
+
+        output.write("INTE", inte);
+        output.write("REAL", real);
+        output.write("DOUB", doub);
+        output.write("LOGI", logi);
+        output.write("EMPTY", std::vector<double>{});
+    }
+
+    auto file = Opm::EclIO::EclFile { "TEST.INIT" };
+
+    BOOST_CHECK(file.get<int>("INTE") == inte);
+    BOOST_CHECK(file.get<float>("REAL") == real);
+    BOOST_CHECK(file.get<double>("DOUB") == doub);
+    BOOST_CHECK(file.get<bool>("LOGI") == logi);
+    BOOST_CHECK(file.get<double>("EMPTY").empty());
+}
@@ -0,0 +1,228 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE Lazy_Restart_Solution
+#include <boost/test/unit_test.hpp>
+
+#include <opm/output/eclipse/LazyRestartSolution.hpp>
+
+#include <opm/io/eclipse/CompressedRestart.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <opm/output/data/Solution.hpp>
+#include <opm/output/eclipse/RestartValue.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+namespace {
+
+using M = Opm::UnitSystem::measure;
+
+const auto numActive = std::size_t{300};
+
+std::vector<Opm::RestartKey> solutionKeys()
+{
+    return {
+        { "PRESSURE", M::pressure },
+        { "SWAT"    , M::identity },
+        { "SGAS"    , M::identity },
+        { "RS"      , M::gas_oil_ratio },
+    };
+}
+
+std::vector<double> expected(const std::string&      filename,
+                             const Opm::RestartKey&  key,
+                             const Opm::UnitSystem&  units,
+                             const std::size_t       begin,
+                             const std::size_t       end)
+{
+    auto rst = Opm::EclIO::ERst { filename };
+    const auto& values = rst.getRestartData<float>(key.key, 10);
+
+    auto result = std::vector<double>(values.begin() + begin, values.begin() + end);
+    units.to_si(key.dim, result);
+
+    return result;
+}
+
+Opm::LazyRestartSolution
+openSolution(const std::string&     filename,
+             const int              reportStep,
+             const Opm::UnitSystem& units,
+             const std::size_t      begin = 0,
+             const std::size_t      end   = numActive)
+{
+    return {
+        std::make_shared<Opm::EclIO::ERst>(filename),
+        reportStep, units, numActive, begin, end
+    };
+}
+
+void checkEqual(const std::vector<double>& actual,
+                const std::vector<double>& expect)
+{
+    BOOST_REQUIRE_EQUAL(actual.size(), expect.size());
+
+    for (auto i = 0*actual.size(); i < actual.size(); ++i) {
+        BOOST_CHECK_EQUAL(actual[i], expect[i]);
+    }
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Lazy_Restart_Solution)
+
+BOOST_AUTO_TEST_CASE(Full_Range)
+{
+    const auto units = Opm::UnitSystem::newFIELD();
+    auto lazy = openSolution("SPE1_TESTCASE.UNRST", 10, units);
+
+    BOOST_REQUIRE_MESSAGE(lazy.valid(), "Restart file must have report step 10");
+    BOOST_CHECK_EQUAL(lazy.cellBegin(), std::size_t{0});
+    BOOST_CHECK_EQUAL(lazy.cellEnd(), numActive);
+    BOOST_CHECK_MESSAGE(lazy.has("PRESSURE"), "Restart step must have PRESSURE");
+    BOOST_CHECK_MESSAGE(! lazy.has("ICON"), "ICON must not be a solution array");
+
+    const auto sol = lazy.solution(solutionKeys());
+
+    BOOST_CHECK_EQUAL(sol.size(), solutionKeys().size());
+
+    for (const auto& key : solutionKeys()) {
+        BOOST_REQUIRE_MESSAGE(sol.has(key.key), "Solution must have " << key.key);
+
+        checkEqual(sol.data<double>(key.key),
+                   expected("SPE1_TESTCASE.UNRST", key, units, 0, numActive));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Cell_Range)
+{
+    const auto units = Opm::UnitSystem::newFIELD();
+    const auto begin = std::size_t{117};
+    const auto end   = std::size_t{251};
+
+    auto lazy = openSolution("SPE1_TESTCASE.UNRST", 10, units, begin, end);
+
+    for (const auto& key : solutionKeys()) {
+        const auto& values = lazy.get(key);
+
+        BOOST_CHECK_EQUAL(values.size(), end - begin);
+        checkEqual(values, expected("SPE1_TESTCASE.UNRST", key, units, begin, end));
+
+        // Second access returns loaded values.
+        BOOST_CHECK_EQUAL(&lazy.get(key), &values);
+    }
+
+    const auto prefetched = lazy.solution(solutionKeys());
+    BOOST_CHECK_EQUAL(prefetched.size(), solutionKeys().size());
+    BOOST_CHECK_EQUAL(prefetched.data<double>("SWAT").size(), end - begin);
+}
+
+BOOST_AUTO_TEST_CASE(Formatted_Matches_Binary)
+{
+    const auto units = Opm::UnitSystem::newMETRIC();
+
+    auto binary    = openSolution("SPE1_TESTCASE.UNRST" , 10, units, 50, 200);
+    auto formatted = openSolution("SPE1_TESTCASE.FUNRST", 10, units, 50, 200);
+
+    // Formatted output has a slightly different round-off.
+    for (const auto& key : solutionKeys()) {
+        const auto& actual = formatted.get(key);
+        const auto& expect = binary.get(key);
+
+        BOOST_REQUIRE_EQUAL(actual.size(), expect.size());
+
+        for (auto i = 0*actual.size(); i < actual.size(); ++i) {
+            BOOST_CHECK_CLOSE(actual[i], expect[i], 1.0e-4);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Compressed_Matches_Binary)
+{
+    const auto units = Opm::UnitSystem::newMETRIC();
+
+    WorkArea work {"lazy_restart_compressed"};
+    work.copyIn("BASE.UNRST");
+
+    const auto companion = Opm::EclIO::CompressedRestart::writeCompanionFile("BASE.UNRST");
+
+    auto binaryFile = std::make_shared<Opm::EclIO::ERst>("BASE.UNRST");
+    auto compressedFile = std::make_shared<Opm::EclIO::ERst>(companion);
+    BOOST_REQUIRE_MESSAGE(compressedFile->compressedInput(), "ERst must read companion file");
+
+    const auto step = binaryFile->listOfReportStepNumbers().back();
+    const auto size = binaryFile->getRestartData<float>("PRESSURE", step).size();
+
+    auto binary     = Opm::LazyRestartSolution { binaryFile    , step, units, size, size / 3, size - 7 };
+    auto compressed = Opm::LazyRestartSolution { compressedFile, step, units, size, size / 3, size - 7 };
+
+    const auto keys = std::vector<Opm::RestartKey> {
+        { "PRESSURE", M::pressure },
+        { "SWAT"    , M::identity },
+    };
+
+    compressed.prefetch(keys);
+    for (const auto& key : keys) {
+        checkEqual(compressed.get(key), binary.get(key));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Missing_Arrays)
+{
+    const auto units = Opm::UnitSystem::newFIELD();
+    auto lazy = openSolution("SPE1_TESTCASE.UNRST", 10, units);
+
+    BOOST_CHECK_THROW(lazy.get({ "NO_SUCH", M::identity, true }), std::runtime_error);
+    BOOST_CHECK_MESSAGE(lazy.get({ "NO_SUCH", M::identity, false }).empty(),
+                        "Optional, unavailable array must be empty");
+
+    auto keys = solutionKeys();
+    keys.emplace_back("NO_SUCH", M::identity, false);
+
+    const auto sol = lazy.solution(keys);
+    BOOST_CHECK_MESSAGE(! sol.has("NO_SUCH"), "Solution must not have unavailable array");
+
+    BOOST_CHECK_THROW(lazy.get({ "INTEHEAD", M::identity, true }), std::runtime_error);
+
+    auto mismatch = Opm::LazyRestartSolution {
+        std::make_shared<Opm::EclIO::ERst>("SPE1_TESTCASE.UNRST"),
+        10, units, numActive + 1
+    };
+
+    BOOST_CHECK_THROW(mismatch.get({ "PRESSURE", M::pressure }), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Missing_Report_Step)
+{
+    const auto lazy = openSolution("SPE1_TESTCASE.UNRST", 1234, Opm::UnitSystem::newFIELD());
+
+    BOOST_CHECK_MESSAGE(! lazy.valid(), "Restart file must not have report step 1234");
+    BOOST_CHECK_MESSAGE(! lazy.has("PRESSURE"), "Invalid step must not have PRESSURE");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -35,7 +35,9 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <fstream>
 #include <iterator>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <tuple>
@@ -1089,6 +1091,102 @@ BOOST_AUTO_TEST_CASE(Formatted_Separate)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Deferred_Unified)
+{
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted { false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified   { true };
+    const auto comp = ::Opm::EclIO::OutputStream::Compressed{ true };
+
+    const auto writeSteps = [&](const ::Opm::EclIO::OutputStream::ResultSet& rset,
+                                const bool                                  defer)
+    {
+        const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+
+        auto first = true;
+        for (const auto seqnum : { 1, 2, 1 }) {
+            auto rst = ::Opm::EclIO::OutputStream::Restart {
+                rset, seqnum, fmt, unif, comp,
+                ::Opm::EclIO::OutputStream::Deferred { defer }
+            };
+
+            rst.write("I", std::vector<int>   {1, 7, 2, seqnum});
+            rst.message("STARTSOL");
+            rst.writeConverted<float>("P", std::vector<double>{1.0e5, 2.0e5 * seqnum}, 1.0e-5);
+            rst.write("D", std::vector<double>{2.71, 8.21});
+            rst.message("ENDSOL");
+
+            if (defer) {
+                // Nothing is written before commit().
+                BOOST_CHECK_MESSAGE(! first || ! std::filesystem::exists(fname),
+                                    "Deferred restart stream must not create output file");
+
+                rst.commit();
+            }
+
+            first = false;
+        }
+    };
+
+    const auto contents = [](const std::string& fname)
+    {
+        std::ifstream file(fname, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), {});
+    };
+
+    const auto direct   = RSet("DIRECT");
+    const auto deferred = RSet("DEFERRED");
+
+    writeSteps(direct, false);
+    writeSteps(deferred, true);
+
+    for (const auto* ext : { "UNRST", "UNRST.OPMZ" }) {
+        const auto expect = contents(::Opm::EclIO::OutputStream::outputFileName(direct, ext));
+        const auto actual = contents(::Opm::EclIO::OutputStream::outputFileName(deferred, ext));
+
+        BOOST_CHECK(! expect.empty());
+        BOOST_CHECK_MESSAGE(expect == actual,
+                            "Deferred output must match direct output in " << ext);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Deferred_Shared_Owner)
+{
+    const auto rset = RSet("SHARED");
+
+    auto owner = std::make_shared<std::vector<double>>(std::vector<double>{1.0e5, 2.0e5, 3.0e5});
+    const auto observer = std::weak_ptr<std::vector<double>>{ owner };
+
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, 1,
+            ::Opm::EclIO::OutputStream::Formatted  { false },
+            ::Opm::EclIO::OutputStream::Unified    { true },
+            ::Opm::EclIO::OutputStream::Compressed { true },
+            ::Opm::EclIO::OutputStream::Deferred   { true }
+        };
+
+        rst.shareOwnership(owner);
+        rst.message("STARTSOL");
+        rst.writeConverted<float>("P", *owner, 1.0e-5);
+        rst.message("ENDSOL");
+
+        // The stream keeps the owner, and hence the array, alive until
+        // commit() and releases it afterwards.
+        owner.reset();
+        BOOST_CHECK_MESSAGE(! observer.expired(), "Deferred stream must keep shared owner alive");
+
+        rst.commit();
+        BOOST_CHECK_MESSAGE(observer.expired(), "Commit must release shared owner");
+    }
+
+    const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+    auto rstFile = ::Opm::EclIO::ERst { fname };
+
+    const auto& P = rstFile.getRestartData<float>("P", 1);
+    const auto expect_P = std::vector<float>{ 1.0f, 2.0f, 3.0f };
+    BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(), expect_P.begin(), expect_P.end());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Class_Restart
 
 // ==========================================================================
@@ -0,0 +1,83 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE PARALLEL_FOR_TESTS
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/ParallelFor.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(Visits_All_Indices)
+{
+    for (const auto minParallel : { std::size_t{0}, std::size_t{1000000} }) {
+        auto visits = std::vector<int>(10000, 0);
+
+        Opm::parallelFor(visits.size(), minParallel,
+                         [&visits](const std::size_t i) { visits[i] += 1; });
+
+        BOOST_CHECK_EQUAL(std::accumulate(visits.begin(), visits.end(), 0),
+                          static_cast<int>(visits.size()));
+
+        for (const auto& v : visits) {
+            BOOST_REQUIRE_EQUAL(v, 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Empty_Range)
+{
+    auto called = false;
+
+    Opm::parallelFor(0, 0, [&called](const std::size_t) { called = true; });
+
+    BOOST_CHECK_MESSAGE(! called, "Body must not be invoked for empty range");
+}
+
+BOOST_AUTO_TEST_CASE(Rethrows_Lowest_Index_Exception)
+{
+    auto visits = std::vector<int>(1000, 0);
+
+    try {
+        Opm::parallelFor(visits.size(), 0, [&visits](const std::size_t i)
+        {
+            visits[i] += 1;
+
+            if ((i == 17) || (i == 500) || (i == 999)) {
+                throw std::runtime_error { std::to_string(i) };
+            }
+        });
+
+        BOOST_FAIL("parallelFor() must rethrow body exceptions");
+    }
+    catch (const std::runtime_error& e) {
+        BOOST_CHECK_EQUAL(std::string { e.what() }, "17");
+    }
+
+    // Remaining iterations still run when one of them throws.
+    for (const auto& v : visits) {
+        BOOST_REQUIRE_EQUAL(v, 1);
+    }
+}
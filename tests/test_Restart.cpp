@@ -1418,3 +1418,78 @@ BOOST_AUTO_TEST_CASE(Fluid_In_Place)
         checkAllEntriesAre(12.0, "SFIPGAS", rst.getRestartData<double>("SFIPGAS", 1));
     }
 }
+
+BOOST_AUTO_TEST_CASE(Solution_Not_SI)
+{
+    namespace OS = ::Opm::EclIO::OutputStream;
+    using measure = UnitSystem::measure;
+
+    WorkArea test_area("test_Restart");
+    test_area.copyIn("BASE_SIM.DATA");
+
+    const Setup base_setup("BASE_SIM.DATA");
+
+    const auto num_cells = base_setup.grid.getNumActive();
+    const auto wells = mkWells();
+    const auto groups = mkGroups();
+    const auto sumState = sim_state(base_setup.schedule);
+    const auto udqState = UDQState{1};
+    auto aquiferData = std::optional<Opm::RestartIO::Helpers::AggregateAquiferData>{std::nullopt};
+    const Action::State action_state{};
+    const WellTestState wtest_state{};
+
+    const auto outputDir = test_area.currentWorkingDirectory();
+
+    // Solution already in output units must be written unchanged, while
+    // one in SI units is converted.
+    for (const auto si : { false, true }) {
+        auto cells = data::Solution { si };
+        cells.insert("PRESSURE", measure::pressure,
+                     std::vector<double>(num_cells, 6.0e5),
+                     data::TargetType::RESTART_SOLUTION);
+        cells.insert("SWAT", measure::identity,
+                     std::vector<double>(num_cells, 0.25),
+                     data::TargetType::RESTART_SOLUTION);
+        cells.insert("SGAS", measure::identity,
+                     std::vector<double>(num_cells, 0.125),
+                     data::TargetType::RESTART_SOLUTION);
+
+        const RestartValue restart_value(cells, wells, groups, {});
+        const auto baseName = std::string { si ? "SI" : "NOT_SI" };
+
+        {
+            const auto seqnum = 1;
+
+            auto rstFile = OS::Restart {
+                OS::ResultSet{ outputDir, baseName }, seqnum,
+                OS::Formatted{ false }, OS::Unified{ true }
+            };
+
+            RestartIO::save(rstFile, seqnum,
+                            100,
+                            restart_value,
+                            base_setup.es,
+                            base_setup.grid,
+                            base_setup.schedule,
+                            action_state,
+                            wtest_state,
+                            sumState,
+                            udqState,
+                            aquiferData,
+                            true);
+        }
+
+        const auto rstFile = ::Opm::EclIO::OutputStream::
+            outputFileName({outputDir, baseName}, "UNRST");
+
+        EclIO::ERst rst{ rstFile };
+
+        const auto expectPressure = si
+            ? base_setup.es.getUnits().from_si(measure::pressure, 6.0e5)
+            : 6.0e5;
+
+        checkAllEntriesAre(expectPressure, "PRESSURE", rst.getRestartData<double>("PRESSURE", 1));
+        checkAllEntriesAre(0.25, "SWAT", rst.getRestartData<double>("SWAT", 1));
+        checkAllEntriesAre(0.125, "SGAS", rst.getRestartData<double>("SGAS", 1));
+    }
+}
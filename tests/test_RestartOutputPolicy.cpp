@@ -0,0 +1,256 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE RestartOutputPolicy
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/RestartOutputPolicy.hpp>
+
+#include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/OutputStream.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+namespace {
+
+    constexpr auto numActive = std::size_t{100};
+
+    std::vector<double> pressure()
+    {
+        auto p = std::vector<double>(numActive);
+        for (auto i = std::size_t{0}; i < p.size(); ++i) {
+            p[i] = 200.0 + 0.123456789*i;
+        }
+
+        return p;
+    }
+
+    std::vector<double> swat()
+    {
+        auto s = std::vector<double>(numActive);
+        for (auto i = std::size_t{0}; i < s.size(); ++i) {
+            s[i] = 0.2 + 0.00654321*i;
+        }
+
+        return s;
+    }
+
+    void writeStep(const Opm::EclIO::OutputStream::ResultSet&                  rset,
+                   const int                                                   seqnum,
+                   std::shared_ptr<const Opm::EclIO::RestartOutputPolicy>      policy)
+    {
+        auto rst = Opm::EclIO::OutputStream::Restart {
+            rset, seqnum,
+            Opm::EclIO::OutputStream::Formatted { false },
+            Opm::EclIO::OutputStream::Unified   { true }
+        };
+
+        rst.setOutputPolicy(std::move(policy));
+
+        rst.write("INTEHEAD", std::vector<int>(numActive, seqnum));
+        rst.message("STARTSOL");
+
+        const auto p = pressure();
+        rst.writeConverted<float>("PRESSURE", p, 1.0);
+        rst.write("SWAT", swat());
+        rst.write("REGION", std::vector<int>(numActive, 1));
+        rst.write("ZTRACER", std::vector<std::string>{ "TR_A", "KG/SM3" });
+        rst.message("ENDSOL");
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Policy)
+
+BOOST_AUTO_TEST_CASE(Default_Full_Output)
+{
+    const auto policy = Opm::EclIO::RestartOutputPolicy{};
+
+    BOOST_CHECK_MESSAGE(policy.fullOutput(), "Default policy must select full output");
+    BOOST_CHECK_MESSAGE(! policy.perCell(numActive), "Default policy must not apply to any array");
+    BOOST_CHECK_MESSAGE(Opm::EclIO::RestartOutputPolicy{ numActive }.fullOutput(),
+                        "Policy without selections must select full output");
+}
+
+BOOST_AUTO_TEST_CASE(Cell_Selection)
+{
+    auto regionID = std::vector<int>(numActive);
+    for (auto i = std::size_t{0}; i < numActive; ++i) {
+        regionID[i] = 1 + static_cast<int>(i % 4);
+    }
+
+    auto policy = Opm::EclIO::RestartOutputPolicy { numActive };
+    policy.selectCellRange(10, 30).selectRegions(regionID, { 2, 3 });
+
+    BOOST_CHECK_MESSAGE(policy.hasCellSelection(), "Policy must have cell selection");
+
+    const auto expect = std::vector<int> {
+        10, 13, 14, 17, 18, 21, 22, 25, 26, 29
+    };
+
+    const auto cells = policy.cells();
+    BOOST_CHECK_EQUAL_COLLECTIONS(cells.begin(), cells.end(), expect.begin(), expect.end());
+
+    const auto values = pressure();
+    const auto subset = policy.gather(std::span<const double>{ values });
+    BOOST_REQUIRE_EQUAL(subset.size(), expect.size());
+
+    for (auto i = std::size_t{0}; i < subset.size(); ++i) {
+        BOOST_CHECK_EQUAL(subset[i], values[expect[i]]);
+    }
+
+    BOOST_CHECK_THROW(policy.selectRegions(std::vector<int>(numActive - 1), { 1 }),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Quantization_Error_Bound)
+{
+    auto policy = Opm::EclIO::RestartOutputPolicy { numActive };
+    policy.setAbsoluteError("PRESSURE", 0.05).setSignificandBits(10);
+
+    {
+        const auto expect = pressure();
+        auto values = expect;
+        policy.quantize("PRESSURE", values);
+
+        for (auto i = std::size_t{0}; i < values.size(); ++i) {
+            BOOST_CHECK_LE(std::abs(values[i] - expect[i]), 0.05 * (1.0 + 1.0e-12));
+            BOOST_CHECK_SMALL(std::remainder(values[i], 0.1), 1.0e-9);
+        }
+    }
+
+    {
+        const auto expect = swat();
+        auto values = expect;
+        policy.quantize("SWAT", values);
+
+        for (auto i = std::size_t{0}; i < values.size(); ++i) {
+            BOOST_CHECK_LE(std::abs(values[i] - expect[i]),
+                           std::abs(expect[i]) * std::ldexp(1.0, -11));
+
+            // At most 11 significant bits remain.
+            auto exponent = 0;
+            const auto fraction = std::frexp(values[i], &exponent);
+            const auto scaled = std::ldexp(fraction, 11);
+            BOOST_CHECK_EQUAL(scaled, std::round(scaled));
+        }
+    }
+
+    // Single precision values are rounded in single precision, and the
+    // error bound holds for the output values.
+    {
+        auto values = std::vector<float>(numActive);
+        for (auto i = std::size_t{0}; i < values.size(); ++i) {
+            values[i] = 1.0e6f + 0.37f*i;
+        }
+
+        const auto expect = values;
+        policy.quantize("PRESSURE", std::span<float>{ values });
+
+        for (auto i = std::size_t{0}; i < values.size(); ++i) {
+            BOOST_CHECK_LE(std::abs(static_cast<double>(values[i]) - expect[i]), 0.05);
+        }
+    }
+
+    // Non-finite values are unchanged.
+    auto special = std::vector<double> { 0.0, INFINITY, -1.0e300 };
+    policy.quantize("SWAT", special);
+    BOOST_CHECK_EQUAL(special[0], 0.0);
+    BOOST_CHECK(std::isinf(special[1]));
+    BOOST_CHECK_CLOSE(special[2], -1.0e300, 0.1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Policy
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Restart_Stream)
+
+BOOST_AUTO_TEST_CASE(Monitoring_Restart)
+{
+    WorkArea work {"restart_output_policy"};
+
+    const auto rset = Opm::EclIO::OutputStream::ResultSet { ".", "CASE" };
+
+    auto policy = std::make_shared<Opm::EclIO::RestartOutputPolicy>(numActive);
+    policy->selectArrays({ "PRESSURE", "REGION" })
+        .selectCellRange(40, 60)
+        .setAbsoluteError("PRESSURE", 0.01);
+
+    const auto monitor = Opm::EclIO::OutputStream::ResultSet {
+        ".", std::string { "CASE" } + Opm::EclIO::RestartOutputPolicy::monitorSuffix
+    };
+
+    writeStep(rset, 1, nullptr);
+    writeStep(monitor, 2, policy);
+    writeStep(rset, 3, nullptr);
+
+    {
+        // Regular restart file has full output only.
+        auto full = Opm::EclIO::ERst { "CASE.UNRST" };
+
+        BOOST_CHECK_MESSAGE(! full.hasReportStepNumber(2),
+                            "Regular restart file must not have monitoring output");
+
+        for (const auto step : { 1, 3 }) {
+            BOOST_CHECK_MESSAGE(! full.hasArray(Opm::EclIO::RestartOutputPolicy::cellArrayName, step),
+                                "Full restart must not have cell array");
+            BOOST_CHECK_EQUAL(full.getRestartData<float>("PRESSURE", step).size(), numActive);
+            BOOST_CHECK_EQUAL(full.getRestartData<double>("SWAT", step).size(), numActive);
+        }
+    }
+
+    auto rst = Opm::EclIO::ERst { "CASE_MON.UNRST" };
+    BOOST_CHECK_MESSAGE(! rst.hasReportStepNumber(1),
+                        "Monitoring restart file must not have full output");
+
+    // Monitoring output.  Header arrays unchanged.
+    BOOST_CHECK_EQUAL(rst.getRestartData<int>("INTEHEAD", 2).size(), numActive);
+    BOOST_CHECK_MESSAGE(! rst.hasArray("SWAT", 2), "Unselected array must not be written");
+    BOOST_CHECK_MESSAGE(rst.hasArray("ZTRACER", 2), "Non per-cell array must be written");
+
+    const auto& cells = rst.getRestartData<int>(Opm::EclIO::RestartOutputPolicy::cellArrayName, 2);
+    BOOST_REQUIRE_EQUAL(cells.size(), std::size_t{20});
+    BOOST_CHECK_EQUAL(cells.front(), 40);
+    BOOST_CHECK_EQUAL(cells.back(), 59);
+
+    const auto& p = rst.getRestartData<float>("PRESSURE", 2);
+    BOOST_REQUIRE_EQUAL(p.size(), cells.size());
+
+    const auto expect = pressure();
+    for (auto i = std::size_t{0}; i < p.size(); ++i) {
+        BOOST_CHECK_LE(std::abs(p[i] - expect[cells[i]]), 0.01);
+    }
+
+    BOOST_CHECK_EQUAL(rst.getRestartData<int>("REGION", 2).size(), cells.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Restart_Stream
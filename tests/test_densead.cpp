@@ -35,6 +35,7 @@
 #endif
 
 #include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/ExpressionTemplates.hpp>
 #include <opm/material/densead/Math.hpp>
 
 #include <algorithm>
@@ -43,6 +44,7 @@
 #include <iostream>
 #include <numbers>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 
 template <class Eval, int numVars, int staticSize, class Scalar, class Implementation>
@@ -675,6 +677,119 @@ struct StaticTestEnv : public TestEnvBase<Opm::DenseAd::Evaluation<Scalar, numDe
     { return Opm::variable<Eval, Scalar>(v, varIdx); }
 };
 
+// Compare the vectorised arithmetic of the statically sized evaluations with the
+// element-by-element arithmetic of the generic Evaluation template.  The non-zero
+// staticSize selects the latter.
+template <int numDerivs>
+void testSimdArithmetic()
+{
+    using SimdEval = Opm::DenseAd::Evaluation<double, numDerivs>;
+    using GenericEval = Opm::DenseAd::Evaluation<double, numDerivs, 1u>;
+
+    // arbitrary values and derivatives
+    auto create = [](auto eval, double value, double offset)
+    {
+        eval = value;
+        for (int i = 0; i < eval.size(); ++i)
+            eval.setDerivative(i, offset + 0.37*i - 0.11*i*i);
+        return eval;
+    };
+
+    const SimdEval xs = create(SimdEval{}, 1.7, 0.5);
+    const SimdEval ys = create(SimdEval{}, -2.3, -1.25);
+    const GenericEval xg = create(GenericEval{}, 1.7, 0.5);
+    const GenericEval yg = create(GenericEval{}, -2.3, -1.25);
+
+    auto check = [](const SimdEval& a, const GenericEval& b, const char* op)
+    {
+        auto close = [](double u, double v)
+        { return std::abs(u - v) <= 1e-14*std::max(1.0, std::abs(v)); };
+
+        bool ok = close(a.value(), b.value());
+        for (int i = 0; i < a.size(); ++i)
+            ok = ok && close(a.derivative(i), b.derivative(i));
+
+        if (!ok)
+            throw std::logic_error(std::string("oops: SIMD ") + op);
+    };
+
+    check(xs + ys, xg + yg, "operator+");
+    check(xs - ys, xg - yg, "operator-");
+    check(xs*ys, xg*yg, "operator*");
+    check(xs/ys, xg/yg, "operator/");
+    check(xs*3.5, xg*3.5, "operator* (scalar)");
+    check(xs/3.5, xg/3.5, "operator/ (scalar)");
+    check(-xs, -xg, "unary operator-");
+    check(Opm::exp(xs), Opm::exp(xg), "exp");
+    check(Opm::log(xs), Opm::log(xg), "log");
+    check(Opm::sqrt(xs), Opm::sqrt(xg), "sqrt");
+    check(Opm::pow(xs, 2.5), Opm::pow(xg, 2.5), "pow");
+
+    SimdEval zs = xs;
+    GenericEval zg = xg;
+    zs *= zs;
+    zg *= zg;
+    check(zs, zg, "operator*= (aliased)");
+    zs /= zs;
+    zg /= zg;
+    check(zs, zg, "operator/= (aliased)");
+
+    // adding a scalar to the value must not touch the derivatives, not even
+    // the sign of a zero
+    SimdEval ns = xs;
+    ns.setDerivative(0, -0.0);
+    ns += 1.0;
+    if (!std::signbit(ns.derivative(0)))
+        throw std::logic_error("oops: SIMD operator+= (scalar) changed -0.0");
+}
+
+// Compare expressions evaluated by the expression templates with the same
+// expressions evaluated eagerly.
+template <class Eval>
+void testExpressionTemplates(const Eval& x, const Eval& y, const Eval& z)
+{
+    using Opm::DenseAd::lazy;
+
+    auto check = [](const Eval& a, const Eval& b, const char* expr)
+    {
+        auto close = [](double u, double v)
+        { return std::abs(u - v) <= 1e-13*std::max(1.0, std::abs(v)); };
+
+        bool ok = a.size() == b.size() && close(a.value(), b.value());
+        for (int i = 0; ok && i < a.size(); ++i)
+            ok = close(a.derivative(i), b.derivative(i));
+
+        if (!ok)
+            throw std::logic_error(std::string("oops: expression template ") + expr);
+    };
+
+    check(lazy(x) + y, x + y, "x + y");
+    check(x - lazy(y), x - y, "x - y");
+    check(lazy(x)*lazy(y), x*y, "x*y");
+    check(lazy(x)/y, x/y, "x/y");
+    check(2.5 - lazy(x)*3.0, 2.5 - x*3.0, "2.5 - x*3");
+    check(1.5/lazy(y) + 4.0, 1.5/y + 4.0, "1.5/y + 4");
+    check(-lazy(x)/2.0, -x/2.0, "-x/2");
+    check(lazy(x)*y + lazy(z)/x - Opm::exp(lazy(y)),
+          x*y + z/x - Opm::exp(y), "x*y + z/x - exp(y)");
+    check(Opm::sqrt(lazy(z)) * Opm::log(lazy(x)) + Opm::log10(lazy(z)),
+          Opm::sqrt(z) * Opm::log(x) + Opm::log10(z), "sqrt(z)*log(x) + log10(z)");
+    check(Opm::sin(lazy(x)) - Opm::cos(lazy(y))*Opm::tan(lazy(z)) + Opm::atan(lazy(y)),
+          Opm::sin(x) - Opm::cos(y)*Opm::tan(z) + Opm::atan(y), "sin(x) - cos(y)*tan(z) + atan(y)");
+    check(Opm::abs(lazy(y)) * Opm::pow(lazy(x), 1.7),
+          Opm::abs(y) * Opm::pow(x, 1.7), "abs(y)*pow(x, 1.7)");
+    check(Opm::pow(2.0, lazy(y)) + Opm::pow(lazy(x), lazy(z)),
+          Opm::pow(2.0, y) + Opm::pow(x, z), "pow(2, y) + pow(x, z)");
+
+    // assignment, including expressions which refer to the assigned object
+    Eval r = x;
+    r = lazy(r)*y - r;
+    check(r, x*y - x, "r = r*y - r");
+    r += lazy(x)/z;
+    check(r, x*y - x + x/z, "r += x/z");
+    check((lazy(x)*z).evaluate(), x*z, "evaluate()");
+}
+
 int main()
 {
     std::cout << "Testing statically sized evaluations\n";
@@ -687,6 +802,39 @@ int main()
     std::cout << " -> Scalar == float, n = 2\n";
     StaticTestEnv<float, 2>().testAll();
 
+    std::cout << " -> Scalar == double, n = 4\n";
+    StaticTestEnv<double, 4>().testAll();
+
+    std::cout << "Testing vectorised arithmetic (" << Opm::DenseAd::simd::isaName() << ")\n";
+    testSimdArithmetic<3>();
+    testSimdArithmetic<4>();
+    testSimdArithmetic<5>();
+    testSimdArithmetic<6>();
+    testSimdArithmetic<7>();
+    testSimdArithmetic<8>();
+
+    std::cout << "Testing expression templates\n";
+    {
+        using Eval3 = Opm::DenseAd::Evaluation<double, 3>;
+        using Eval15 = Opm::DenseAd::Evaluation<double, 15>;
+        using DynEval = Opm::DenseAd::DynamicEvaluation<double, 4>;
+
+        auto create = [](auto eval, double value, double offset)
+        {
+            eval = value;
+            for (int i = 0; i < eval.size(); ++i)
+                eval.setDerivative(i, offset + 0.37*i - 0.11*i*i);
+            return eval;
+        };
+
+        testExpressionTemplates(create(Eval3{}, 1.7, 0.5), create(Eval3{}, -2.3, -1.25),
+                                create(Eval3{}, 0.8, 2.0));
+        testExpressionTemplates(create(Eval15{}, 1.7, 0.5), create(Eval15{}, -2.3, -1.25),
+                                create(Eval15{}, 0.8, 2.0));
+        testExpressionTemplates(create(DynEval(6, 0.0), 1.7, 0.5), create(DynEval(6, 0.0), -2.3, -1.25),
+                                create(DynEval(6, 0.0), 0.8, 2.0));
+    }
+
     std::cout << "Testing dynamically sized evaluations\n";
     std::cout << " -> Scalar == double\n";
     DynamicTestEnv<double, 6>(5).testAll();